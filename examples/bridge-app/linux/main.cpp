@@ -378,6 +378,12 @@ void CallReportingCallback(intptr_t closure)
 
 void ScheduleReportingCallback(Device * dev, ClusterId cluster, AttributeId attribute)
 {
+    // Device changes are notified from the device threads: publish them without taking the stack lock.
+    if (MatterPublishAttributeChange(app::ConcreteAttributePath(dev->GetEndpointId(), cluster, attribute)) == CHIP_NO_ERROR)
+    {
+        return;
+    }
+
     auto * path = Platform::New<app::ConcreteAttributePath>(dev->GetEndpointId(), cluster, attribute);
     PlatformMgr().ScheduleWork(CallReportingCallback, reinterpret_cast<intptr_t>(path));
 }
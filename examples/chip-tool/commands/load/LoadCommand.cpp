@@ -0,0 +1,581 @@
+/*
+ *   Copyright (c) 2022 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#include "LoadCommand.h"
+
+#include <app/InteractionModelEngine.h>
+#include <platform/CHIPDeviceLayer.h>
+
+#include <algorithm>
+#include <string>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+const char * const kOperationNames[] = { "read", "write", "invoke", "subscribe" };
+static_assert(ArraySize(kOperationNames) == static_cast<size_t>(LoadOperationType::kCount), "Missing operation name");
+
+System::Clock::Microseconds64 Now()
+{
+    return System::SystemClock().GetMonotonicMicroseconds64();
+}
+
+double ToMilliseconds(uint64_t microseconds)
+{
+    return static_cast<double>(microseconds) / 1000.0;
+}
+
+// Read of the attribute, or subscription to it for the kSubscribe type. A subscription is recorded once it is
+// established, and then held until the command releases it at the end of the run.
+class ReadOperation : public LoadOperation, public ReadClient::Callback
+{
+public:
+    ReadOperation(LoadCommand & command, LoadOperationType type) : LoadOperation(command, type) {}
+
+    CHIP_ERROR Start(Messaging::ExchangeManager & exchangeMgr, const SessionHandle & session) override
+    {
+        mPath = AttributePathParams(mCommand.GetEndpointId(), mCommand.GetClusterId(), mCommand.GetAttributeId());
+
+        ReadPrepareParams params(session);
+        params.mpAttributePathParamsList    = &mPath;
+        params.mAttributePathParamsListSize = 1;
+
+        bool subscribe = (mType == LoadOperationType::kSubscribe);
+        if (subscribe)
+        {
+            params.mMinIntervalFloorSeconds   = mCommand.GetMinIntervalSecs();
+            params.mMaxIntervalCeilingSeconds = mCommand.GetMaxIntervalSecs();
+            params.mKeepSubscriptions         = true;
+        }
+
+        mClient = std::make_unique<ReadClient>(InteractionModelEngine::GetInstance(), &exchangeMgr, *this,
+                                               subscribe ? ReadClient::InteractionType::Subscribe
+                                                         : ReadClient::InteractionType::Read);
+        MarkStarted();
+        return mClient->SendRequest(params);
+    }
+
+    /////////// ReadClient Callback Interface /////////
+    void OnAttributeData(const ConcreteDataAttributePath & path, TLV::TLVReader * data, const StatusIB & status) override
+    {
+        if (status.mStatus != Protocols::InteractionModel::Status::Success)
+        {
+            mError = status.ToChipError();
+        }
+    }
+
+    void OnReportEnd() override
+    {
+        if (mRecorded)
+        {
+            mCommand.OnSubscriptionReport();
+        }
+    }
+
+    void OnSubscriptionEstablished(SubscriptionId subscriptionId) override { Record(mError); }
+
+    void OnError(CHIP_ERROR error) override { mError = error; }
+
+    void OnDone(ReadClient * client) override { Done(); }
+
+private:
+    AttributePathParams mPath;
+    std::unique_ptr<ReadClient> mClient;
+};
+
+class WriteOperation : public LoadOperation, public WriteClient::Callback
+{
+public:
+    WriteOperation(LoadCommand & command) : LoadOperation(command, LoadOperationType::kWrite) {}
+
+    CHIP_ERROR Start(Messaging::ExchangeManager & exchangeMgr, const SessionHandle & session) override
+    {
+        mClient = std::make_unique<WriteClient>(&exchangeMgr, this, NullOptional);
+        ReturnErrorOnFailure(mClient->EncodeAttribute(
+            AttributePathParams(mCommand.GetEndpointId(), mCommand.GetClusterId(), mCommand.GetAttributeId()),
+            mCommand.GetWriteValue()));
+        MarkStarted();
+        return mClient->SendWriteRequest(session);
+    }
+
+    /////////// WriteClient Callback Interface /////////
+    void OnResponse(const WriteClient * client, const ConcreteDataAttributePath & path, StatusIB status) override
+    {
+        if (status.mStatus != Protocols::InteractionModel::Status::Success)
+        {
+            mError = status.ToChipError();
+        }
+    }
+
+    void OnError(const WriteClient * client, CHIP_ERROR error) override { mError = error; }
+
+    void OnDone(WriteClient * client) override { Done(); }
+
+private:
+    std::unique_ptr<WriteClient> mClient;
+};
+
+class InvokeOperation : public LoadOperation, public CommandSender::Callback
+{
+public:
+    InvokeOperation(LoadCommand & command) : LoadOperation(command, LoadOperationType::kInvoke) {}
+
+    CHIP_ERROR Start(Messaging::ExchangeManager & exchangeMgr, const SessionHandle & session) override
+    {
+        CommandPathParams commandPath = { mCommand.GetEndpointId(), mCommand.GetClusterId(), mCommand.GetCommandId(),
+                                          CommandPathFlags::kEndpointIdValid };
+
+        mSender = std::make_unique<CommandSender>(this, &exchangeMgr);
+        ReturnErrorOnFailure(mSender->AddRequestDataNoTimedCheck(commandPath, mCommand.GetCommandPayload(), NullOptional));
+        MarkStarted();
+        return mSender->SendCommandRequest(session);
+    }
+
+    /////////// CommandSender Callback Interface /////////
+    void OnResponse(CommandSender * sender, const ConcreteCommandPath & path, const StatusIB & status,
+                    TLV::TLVReader * data) override
+    {
+        if (status.mStatus != Protocols::InteractionModel::Status::Success)
+        {
+            mError = status.ToChipError();
+        }
+    }
+
+    void OnError(const CommandSender * sender, CHIP_ERROR error) override { mError = error; }
+
+    void OnDone(CommandSender * sender) override { Done(); }
+
+private:
+    std::unique_ptr<CommandSender> mSender;
+};
+
+} // namespace
+
+constexpr System::Clock::Milliseconds32 LoadCommand::kTickInterval;
+
+LoadNode::LoadNode(LoadCommand * command, NodeId nodeId) :
+    mCommand(command), mNodeId(nodeId), mOnDeviceConnectedCallback(LoadCommand::OnDeviceConnectedFn, this),
+    mOnDeviceConnectionFailureCallback(LoadCommand::OnDeviceConnectionFailureFn, this)
+{}
+
+void LoadOperation::MarkStarted()
+{
+    mStartTime = Now();
+}
+
+void LoadOperation::Record(CHIP_ERROR error)
+{
+    mRecorded = true;
+    mCommand.OnOperationRecorded(mType, Now() - mStartTime, error);
+}
+
+void LoadOperation::Done()
+{
+    if (!mRecorded)
+    {
+        // A subscription that ends without having been established failed even if no error was reported.
+        if (mType == LoadOperationType::kSubscribe && mError == CHIP_NO_ERROR)
+        {
+            mError = CHIP_ERROR_INCORRECT_STATE;
+        }
+        Record(mError);
+    }
+    mCommand.OnOperationDone(this);
+}
+
+CHIP_ERROR LoadCommand::RunCommand()
+{
+    Reset();
+
+    mWeights[static_cast<size_t>(LoadOperationType::kRead)]   = mReadWeight.ValueOr(1);
+    mWeights[static_cast<size_t>(LoadOperationType::kWrite)]  = mWriteWeight.ValueOr(0);
+    mWeights[static_cast<size_t>(LoadOperationType::kInvoke)] = mInvokeWeight.ValueOr(0);
+    for (uint32_t weight : mWeights)
+    {
+        mTotalWeight += weight;
+    }
+    if (mTotalWeight == 0 && mSubscriptionsPerNode.ValueOr(0) == 0)
+    {
+        ChipLogError(chipTool, "Nothing to run: the mix is empty and no subscriptions are requested");
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+
+    if (mWriteWeight.ValueOr(0) > 0)
+    {
+        if (!mWriteValue.HasValue())
+        {
+            ChipLogError(chipTool, "write-value is required when writes are in the mix");
+            return CHIP_ERROR_INVALID_ARGUMENT;
+        }
+        mWriteData = std::make_unique<CustomArgument>();
+        ReturnErrorOnFailure(mWriteData->Parse("write-value", mWriteValue.Value()));
+    }
+
+    if (mInvokeWeight.ValueOr(0) > 0)
+    {
+        mCommandData = std::make_unique<CustomArgument>();
+        ReturnErrorOnFailure(mCommandData->Parse("command-payload", mCommandPayload.ValueOr(const_cast<char *>("{}"))));
+    }
+
+    // All the shards are configured alike, so that every node of the range is driven by exactly one of them.
+    Controller::ShardRouter router;
+    ReturnErrorOnFailure(router.Init(mShardCount.ValueOr(1),
+                                     mShardByFabric.ValueOr(false) ? Controller::ShardRouter::Partitioning::kByFabric
+                                                                   : Controller::ShardRouter::Partitioning::kByNode));
+    if (mShardIndex.ValueOr(0) >= router.GetShardCount())
+    {
+        ChipLogError(chipTool, "shard-index must be lower than shard-count");
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+
+    PeerId peer = PeerId().SetCompressedFabricId(CurrentCommissioner().GetCompressedFabricId());
+    for (uint16_t i = 0; i < mNodeCount.ValueOr(1); i++)
+    {
+        if (router.IsManagedBy(peer.SetNodeId(mFirstNodeId + i), mShardIndex.ValueOr(0)))
+        {
+            mNodes.push_back(std::make_unique<LoadNode>(this, mFirstNodeId + i));
+        }
+    }
+    if (mNodes.empty())
+    {
+        ChipLogError(chipTool, "None of the nodes belongs to shard %u", static_cast<unsigned>(mShardIndex.ValueOr(0)));
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+
+    // Connecting may complete synchronously, so the nodes are only connected once they have all been created.
+    mPendingConnections = mNodes.size();
+    for (size_t i = 0; i < mNodes.size(); i++)
+    {
+        LoadNode * node = mNodes[i].get();
+        CHIP_ERROR err  = CurrentCommissioner().GetConnectedDevice(node->mNodeId, &node->mOnDeviceConnectedCallback,
+                                                                   &node->mOnDeviceConnectionFailureCallback);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(chipTool, "Failed to connect to node 0x" ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                         ChipLogValueX64(node->mNodeId), err.Format());
+            OnNodeConnectionDone();
+        }
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void LoadCommand::OnDeviceConnectedFn(void * context, Messaging::ExchangeManager & exchangeMgr, SessionHandle & sessionHandle)
+{
+    auto * node = reinterpret_cast<LoadNode *>(context);
+    VerifyOrReturn(node != nullptr, ChipLogError(chipTool, "OnDeviceConnectedFn: context is null"));
+
+    node->mExchangeMgr = &exchangeMgr;
+    node->mSession.Grab(sessionHandle);
+    node->mCommand->mConnectedNodes++;
+    node->mCommand->OnNodeConnectionDone();
+}
+
+void LoadCommand::OnDeviceConnectionFailureFn(void * context, const ScopedNodeId & peerId, CHIP_ERROR err)
+{
+    auto * node = reinterpret_cast<LoadNode *>(context);
+    VerifyOrReturn(node != nullptr, ChipLogError(chipTool, "OnDeviceConnectionFailureFn: context is null"));
+
+    ChipLogError(chipTool, "Failed to connect to node 0x" ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                 ChipLogValueX64(peerId.GetNodeId()), err.Format());
+    node->mCommand->OnNodeConnectionDone();
+}
+
+void LoadCommand::OnNodeConnectionDone()
+{
+    VerifyOrReturn(mPendingConnections > 0);
+    if (--mPendingConnections == 0)
+    {
+        StartLoad();
+    }
+}
+
+void LoadCommand::StartLoad()
+{
+    VerifyOrReturn(mConnectedNodes > 0, SetCommandExitStatus(CHIP_ERROR_NOT_CONNECTED));
+
+    ChipLogProgress(chipTool, "Generating load against %u of %u nodes for %u seconds", static_cast<unsigned>(mConnectedNodes),
+                    static_cast<unsigned>(mNodes.size()), mDurationSecs.ValueOr(10));
+
+    mRunning   = true;
+    mStartTime = Now();
+    mEndTime   = mStartTime + System::Clock::Seconds32(mDurationSecs.ValueOr(10));
+
+    for (auto & node : mNodes)
+    {
+        for (uint16_t i = 0; node->mSession && i < mSubscriptionsPerNode.ValueOr(0); i++)
+        {
+            StartOperation(LoadOperationType::kSubscribe, *node);
+        }
+    }
+
+    CHIP_ERROR err = DeviceLayer::SystemLayer().StartTimer(kTickInterval, OnTick, this);
+    VerifyOrReturn(err == CHIP_NO_ERROR, SetCommandExitStatus(err));
+
+    Pump();
+}
+
+void LoadCommand::OnTick(System::Layer * layer, void * context)
+{
+    auto * command = reinterpret_cast<LoadCommand *>(context);
+
+    command->Pump();
+    if (command->mRunning)
+    {
+        LogErrorOnFailure(DeviceLayer::SystemLayer().StartTimer(kTickInterval, OnTick, command));
+    }
+}
+
+void LoadCommand::Pump()
+{
+    VerifyOrReturn(mRunning);
+
+    System::Clock::Microseconds64 now = Now();
+    if (now >= mEndTime)
+    {
+        if (mOperationsInFlight == 0)
+        {
+            Finish();
+        }
+        return;
+    }
+
+    // Without a target rate, keep the concurrency saturated. Otherwise start the operations due since the start of the
+    // run, so that a tick running late catches up.
+    uint64_t due = UINT64_MAX;
+    if (mRate.ValueOr(0) > 0)
+    {
+        uint64_t expected = (now - mStartTime).count() * mRate.Value() / 1000000;
+        due               = (expected > mOperationsStarted) ? expected - mOperationsStarted : 0;
+    }
+
+    while (mTotalWeight > 0 && due > 0 && mOperationsInFlight < mConcurrency.ValueOr(8))
+    {
+        // Spread the operations over the nodes that are still connected.
+        LoadNode * node = nullptr;
+        for (size_t i = 0; i < mNodes.size() && node == nullptr; i++)
+        {
+            LoadNode * candidate = mNodes[mNextNode].get();
+            mNextNode            = (mNextNode + 1) % mNodes.size();
+            if (candidate->mSession)
+            {
+                node = candidate;
+            }
+        }
+        VerifyOrReturn(node != nullptr, mEndTime = now);
+
+        // A failed start counts toward the rate, and leaves the rest to the next tick rather than retrying right away, as
+        // nothing would change in between.
+        CHIP_ERROR err = StartOperation(NextOperationType(), *node);
+        mOperationsStarted++;
+        due--;
+        VerifyOrReturn(err == CHIP_NO_ERROR);
+    }
+}
+
+LoadOperationType LoadCommand::NextOperationType()
+{
+    // Interleave the types in proportion to their weight, so that a short run gets the requested mix too.
+    uint32_t slot  = mNextOperation;
+    mNextOperation = (mNextOperation + 1) % mTotalWeight;
+
+    for (size_t type = 0; type < static_cast<size_t>(LoadOperationType::kCount); type++)
+    {
+        if (slot < mWeights[type])
+        {
+            return static_cast<LoadOperationType>(type);
+        }
+        slot -= mWeights[type];
+    }
+    return LoadOperationType::kRead;
+}
+
+CHIP_ERROR LoadCommand::StartOperation(LoadOperationType type, LoadNode & node)
+{
+    std::unique_ptr<LoadOperation> operation;
+    switch (type)
+    {
+    case LoadOperationType::kRead:
+    case LoadOperationType::kSubscribe:
+        operation = std::make_unique<ReadOperation>(*this, type);
+        break;
+    case LoadOperationType::kWrite:
+        operation = std::make_unique<WriteOperation>(*this);
+        break;
+    case LoadOperationType::kInvoke:
+        operation = std::make_unique<InvokeOperation>(*this);
+        break;
+    default:
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+
+    CHIP_ERROR err                  = CHIP_ERROR_NOT_CONNECTED;
+    Optional<SessionHandle> session = node.mSession.Get();
+    if (session.HasValue())
+    {
+        err = operation->Start(*node.mExchangeMgr, session.Value());
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(chipTool, "Failed to start %s: %" CHIP_ERROR_FORMAT, kOperationNames[static_cast<size_t>(type)], err.Format());
+        OnOperationRecorded(type, System::Clock::Microseconds64(0), err);
+        return err;
+    }
+
+    if (type != LoadOperationType::kSubscribe)
+    {
+        mOperationsInFlight++;
+    }
+    mOperations.push_back(std::move(operation));
+    return CHIP_NO_ERROR;
+}
+
+void LoadCommand::OnOperationRecorded(LoadOperationType type, System::Clock::Microseconds64 latency, CHIP_ERROR error)
+{
+    Stats & stats = mStats[static_cast<size_t>(type)];
+    if (error == CHIP_NO_ERROR)
+    {
+        stats.latenciesUs.push_back(static_cast<uint32_t>(std::min<uint64_t>(latency.count(), UINT32_MAX)));
+    }
+    else
+    {
+        stats.errors++;
+    }
+}
+
+void LoadCommand::OnOperationDone(LoadOperation * operation)
+{
+    auto it = std::find_if(mOperations.begin(), mOperations.end(),
+                           [operation](const std::unique_ptr<LoadOperation> & candidate) { return candidate.get() == operation; });
+    VerifyOrReturn(it != mOperations.end());
+
+    if (operation->GetType() != LoadOperationType::kSubscribe)
+    {
+        mOperationsInFlight--;
+    }
+    // Releases the operation, from its own OnDone callback.
+    mOperations.erase(it);
+
+    if (mRunning && (mRate.ValueOr(0) == 0 || Now() >= mEndTime))
+    {
+        Pump();
+    }
+}
+
+void LoadCommand::Finish()
+{
+    System::Clock::Microseconds64 elapsed = Now() - mStartTime;
+
+    mRunning = false;
+    DeviceLayer::SystemLayer().CancelTimer(OnTick, this);
+
+    std::string report = Json::writeString(Json::StreamWriterBuilder(), BuildReport(elapsed));
+    fprintf(stdout, "%s\n", report.c_str());
+
+    // Close the subscriptions still open.
+    mOperations.clear();
+    SetCommandExitStatus(CHIP_NO_ERROR);
+}
+
+Json::Value LoadCommand::BuildReport(System::Clock::Microseconds64 elapsed) const
+{
+    double elapsedSecs = static_cast<double>(elapsed.count()) / 1000000.0;
+    uint64_t completed = 0;
+    uint64_t errors    = 0;
+
+    Json::Value report;
+    report["nodes"]["requested"]  = static_cast<Json::UInt>(mNodes.size());
+    report["nodes"]["connected"]  = static_cast<Json::UInt>(mConnectedNodes);
+    report["shard"]["index"]      = static_cast<Json::UInt>(mShardIndex.ValueOr(0));
+    report["shard"]["count"]      = static_cast<Json::UInt>(mShardCount.ValueOr(1));
+    report["durationSeconds"]     = elapsedSecs;
+    report["subscriptionReports"] = static_cast<Json::UInt64>(mSubscriptionReports);
+
+    for (size_t type = 0; type < static_cast<size_t>(LoadOperationType::kCount); type++)
+    {
+        std::vector<uint32_t> latencies = mStats[type].latenciesUs;
+        std::sort(latencies.begin(), latencies.end());
+
+        Json::Value & entry = report["operations"][kOperationNames[type]];
+        entry["completed"]  = static_cast<Json::UInt64>(latencies.size());
+        entry["errors"]     = mStats[type].errors;
+        if (static_cast<LoadOperationType>(type) != LoadOperationType::kSubscribe)
+        {
+            entry["throughput"] = elapsedSecs > 0 ? static_cast<double>(latencies.size()) / elapsedSecs : 0.0;
+            completed += latencies.size();
+            errors += mStats[type].errors;
+        }
+
+        if (!latencies.empty())
+        {
+            // Nearest-rank percentiles.
+            auto percentile = [&latencies](unsigned p) {
+                size_t rank = (latencies.size() * p + 99) / 100;
+                return ToMilliseconds(latencies[std::max<size_t>(rank, 1) - 1]);
+            };
+            uint64_t total = 0;
+            for (uint32_t latency : latencies)
+            {
+                total += latency;
+            }
+
+            Json::Value & latency = entry["latencyMs"];
+            latency["min"]        = ToMilliseconds(latencies.front());
+            latency["mean"]       = ToMilliseconds(total / latencies.size());
+            latency["p50"]        = percentile(50);
+            latency["p90"]        = percentile(90);
+            latency["p99"]        = percentile(99);
+            latency["max"]        = ToMilliseconds(latencies.back());
+        }
+    }
+
+    report["completed"]  = static_cast<Json::UInt64>(completed);
+    report["errors"]     = static_cast<Json::UInt64>(errors);
+    report["throughput"] = elapsedSecs > 0 ? static_cast<double>(completed) / elapsedSecs : 0.0;
+    return report;
+}
+
+void LoadCommand::Reset()
+{
+    mOperations.clear();
+    mNodes.clear();
+    mWriteData.reset();
+    mCommandData.reset();
+    mPendingConnections  = 0;
+    mConnectedNodes      = 0;
+    mNextNode            = 0;
+    mTotalWeight         = 0;
+    mNextOperation       = 0;
+    mRunning             = false;
+    mOperationsStarted   = 0;
+    mOperationsInFlight  = 0;
+    mSubscriptionReports = 0;
+    for (auto & stats : mStats)
+    {
+        stats = Stats();
+    }
+}
+
+void LoadCommand::Shutdown()
+{
+    DeviceLayer::SystemLayer().CancelTimer(OnTick, this);
+    Reset();
+    CHIPCommand::Shutdown();
+}
@@ -0,0 +1,233 @@
+/*
+ *   Copyright (c) 2022 Project CHIP Authors
+ *   All rights reserved.
+ *
+ *   Licensed under the Apache License, Version 2.0 (the "License");
+ *   you may not use this file except in compliance with the License.
+ *   You may obtain a copy of the License at
+ *
+ *       http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *   Unless required by applicable law or agreed to in writing, software
+ *   distributed under the License is distributed on an "AS IS" BASIS,
+ *   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *   See the License for the specific language governing permissions and
+ *   limitations under the License.
+ *
+ */
+
+#pragma once
+
+#include "../common/CHIPCommand.h"
+#include <app/CommandSender.h>
+#include <app/OperationalSessionSetup.h>
+#include <app/ReadClient.h>
+#include <app/WriteClient.h>
+#include <commands/clusters/CustomArgument.h>
+#include <controller/ShardRouter.h>
+#include <lib/core/CHIPCallback.h>
+#include <lib/core/DataModelTypes.h>
+
+#include <json/json.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+enum class LoadOperationType : uint8_t
+{
+    kRead,
+    kWrite,
+    kInvoke,
+    kSubscribe,
+    kCount,
+};
+
+class LoadCommand;
+
+/**
+ * A node the load is generated against, and the session established with it.
+ */
+struct LoadNode
+{
+    LoadNode(LoadCommand * command, chip::NodeId nodeId);
+
+    LoadCommand * mCommand;
+    chip::NodeId mNodeId;
+    chip::Messaging::ExchangeManager * mExchangeMgr = nullptr;
+    chip::SessionHolder mSession;
+
+    chip::Callback::Callback<chip::OnDeviceConnected> mOnDeviceConnectedCallback;
+    chip::Callback::Callback<chip::OnDeviceConnectionFailure> mOnDeviceConnectionFailureCallback;
+};
+
+/**
+ * A single read, write, invoke or subscription in flight. The operation reports its outcome to the command, which then
+ * destroys it.
+ */
+class LoadOperation
+{
+public:
+    LoadOperation(LoadCommand & command, LoadOperationType type) : mCommand(command), mType(type) {}
+    virtual ~LoadOperation() = default;
+
+    virtual CHIP_ERROR Start(chip::Messaging::ExchangeManager & exchangeMgr, const chip::SessionHandle & session) = 0;
+
+    LoadOperationType GetType() const { return mType; }
+
+protected:
+    void MarkStarted();
+
+    // Record the latency of the operation since MarkStarted() and the error it completed with.
+    void Record(CHIP_ERROR error);
+
+    // Record the operation, unless it was already recorded, and release it. Nothing may be accessed after this call.
+    void Done();
+
+    LoadCommand & mCommand;
+    const LoadOperationType mType;
+    chip::System::Clock::Microseconds64 mStartTime;
+    CHIP_ERROR mError = CHIP_NO_ERROR;
+    bool mRecorded    = false;
+};
+
+class LoadCommand : public CHIPCommand
+{
+public:
+    LoadCommand(CredentialIssuerCommands * credsIssuerConfig) :
+        CHIPCommand("run", credsIssuerConfig,
+                    "Run a mix of reads, writes and invokes of an attribute and a command of a range of nodes at a target rate, "
+                    "with subscriptions held open, and print the latency percentiles, throughput and error counts as JSON.")
+    {
+        AddArgument("first-node-id", 0, UINT64_MAX, &mFirstNodeId, "Node id of the first node to generate load against.");
+        AddArgument("endpoint-id", 0, UINT16_MAX, &mEndpointId, "Endpoint of the attribute and the command.");
+        AddArgument("node-count", 1, UINT16_MAX, &mNodeCount,
+                    "Number of nodes, with consecutive node ids starting at first-node-id. Defaults to 1.");
+        AddArgument("cluster-id", 0, UINT32_MAX, &mClusterId,
+                    "Cluster of the attribute and the command. Defaults to On/Off (0x0006).");
+        AddArgument("attribute-id", 0, UINT32_MAX, &mAttributeId,
+                    "Attribute read, written and subscribed to. Defaults to OnOff (0x0000).");
+        AddArgument("command-id", 0, UINT32_MAX, &mCommandId, "Command invoked. Defaults to Toggle (0x02).");
+        AddArgument("write-value", &mWriteValue,
+                    "JSON value written to the attribute, in the format of write-by-id. Required when writes are in the mix.");
+        AddArgument("command-payload", &mCommandPayload,
+                    "JSON payload of the command, in the format of command-by-id. Defaults to \"{}\".");
+        AddArgument("reads", 0, UINT16_MAX, &mReadWeight, "Relative weight of reads in the mix. Defaults to 1.");
+        AddArgument("writes", 0, UINT16_MAX, &mWriteWeight, "Relative weight of writes in the mix. Defaults to 0.");
+        AddArgument("invokes", 0, UINT16_MAX, &mInvokeWeight, "Relative weight of invokes in the mix. Defaults to 0.");
+        AddArgument("subscriptions", 0, UINT16_MAX, &mSubscriptionsPerNode,
+                    "Number of subscriptions to the attribute held open on each node during the run. Defaults to 0.");
+        AddArgument("min-interval", 0, UINT16_MAX, &mMinIntervalSecs,
+                    "Minimum interval of the subscriptions, in seconds. Defaults to 0.");
+        AddArgument("max-interval", 0, UINT16_MAX, &mMaxIntervalSecs,
+                    "Maximum interval of the subscriptions, in seconds. Defaults to 10.");
+        AddArgument("rate", 0, UINT32_MAX, &mRate,
+                    "Target number of operations started per second, over all the nodes. 0, the default, starts an operation as "
+                    "soon as another one completes.");
+        AddArgument("concurrency", 1, UINT16_MAX, &mConcurrency, "Maximum number of operations in flight. Defaults to 8.");
+        AddArgument("duration", 1, UINT16_MAX, &mDurationSecs,
+                    "Time during which operations are started, in seconds. Defaults to 10.");
+        AddArgument("timeout", 0, UINT16_MAX, &mTimeoutSecs,
+                    "Time allowed on top of the duration to connect to the nodes and complete the operations in flight, in "
+                    "seconds. Defaults to 30.");
+        AddArgument("shard-count", 1, chip::Controller::ShardRouter::kMaxShardCount, &mShardCount,
+                    "Number of chip-tool processes the nodes are split over. Each process only generates load against the nodes "
+                    "of its shard. Defaults to 1.");
+        AddArgument("shard-index", 0, chip::Controller::ShardRouter::kMaxShardCount - 1, &mShardIndex,
+                    "Shard of this process, from 0 to shard-count - 1. Defaults to 0.");
+        AddArgument("shard-by-fabric", 0, 1, &mShardByFabric,
+                    "Keep all the nodes of the fabric on the same shard instead of spreading them. Defaults to 0.");
+    }
+
+    /////////// CHIPCommand Interface /////////
+    CHIP_ERROR RunCommand() override;
+    chip::System::Clock::Timeout GetWaitDuration() const override
+    {
+        return chip::System::Clock::Seconds16(static_cast<uint16_t>(
+            std::min<uint32_t>(mDurationSecs.ValueOr(10) + mTimeoutSecs.ValueOr(30), UINT16_MAX)));
+    }
+    void Shutdown() override;
+
+    /////////// LoadOperation Interface /////////
+    void OnOperationRecorded(LoadOperationType type, chip::System::Clock::Microseconds64 latency, CHIP_ERROR error);
+    void OnOperationDone(LoadOperation * operation);
+    void OnSubscriptionReport() { mSubscriptionReports++; }
+
+    chip::EndpointId GetEndpointId() const { return mEndpointId; }
+    chip::ClusterId GetClusterId() const { return mClusterId.ValueOr(chip::app::Clusters::OnOff::Id); }
+    chip::AttributeId GetAttributeId() const { return mAttributeId.ValueOr(chip::app::Clusters::OnOff::Attributes::OnOff::Id); }
+    chip::CommandId GetCommandId() const { return mCommandId.ValueOr(chip::app::Clusters::OnOff::Commands::Toggle::Id); }
+    uint16_t GetMinIntervalSecs() const { return mMinIntervalSecs.ValueOr(0); }
+    uint16_t GetMaxIntervalSecs() const { return mMaxIntervalSecs.ValueOr(10); }
+    const CustomArgument & GetWriteValue() const { return *mWriteData; }
+    const CustomArgument & GetCommandPayload() const { return *mCommandData; }
+
+private:
+    friend struct LoadNode;
+
+    // Period of the timer that starts the operations due at the target rate and ends the run.
+    static constexpr chip::System::Clock::Milliseconds32 kTickInterval = chip::System::Clock::Milliseconds32(10);
+
+    struct Stats
+    {
+        std::vector<uint32_t> latenciesUs;
+        uint32_t errors = 0;
+    };
+
+    static void OnDeviceConnectedFn(void * context, chip::Messaging::ExchangeManager & exchangeMgr,
+                                    chip::SessionHandle & sessionHandle);
+    static void OnDeviceConnectionFailureFn(void * context, const chip::ScopedNodeId & peerId, CHIP_ERROR error);
+    static void OnTick(chip::System::Layer * layer, void * context);
+
+    void OnNodeConnectionDone();
+    void StartLoad();
+    void Pump();
+    LoadOperationType NextOperationType();
+    CHIP_ERROR StartOperation(LoadOperationType type, LoadNode & node);
+    void Finish();
+    Json::Value BuildReport(chip::System::Clock::Microseconds64 elapsed) const;
+    void Reset();
+
+    chip::NodeId mFirstNodeId;
+    chip::EndpointId mEndpointId;
+    chip::Optional<uint16_t> mNodeCount;
+    chip::Optional<chip::ClusterId> mClusterId;
+    chip::Optional<chip::AttributeId> mAttributeId;
+    chip::Optional<chip::CommandId> mCommandId;
+    chip::Optional<char *> mWriteValue;
+    chip::Optional<char *> mCommandPayload;
+    chip::Optional<uint16_t> mReadWeight;
+    chip::Optional<uint16_t> mWriteWeight;
+    chip::Optional<uint16_t> mInvokeWeight;
+    chip::Optional<uint16_t> mSubscriptionsPerNode;
+    chip::Optional<uint16_t> mMinIntervalSecs;
+    chip::Optional<uint16_t> mMaxIntervalSecs;
+    chip::Optional<uint32_t> mRate;
+    chip::Optional<uint16_t> mConcurrency;
+    chip::Optional<uint16_t> mDurationSecs;
+    chip::Optional<uint16_t> mTimeoutSecs;
+    chip::Optional<uint8_t> mShardCount;
+    chip::Optional<uint8_t> mShardIndex;
+    chip::Optional<bool> mShardByFabric;
+
+    std::unique_ptr<CustomArgument> mWriteData;
+    std::unique_ptr<CustomArgument> mCommandData;
+
+    std::vector<std::unique_ptr<LoadNode>> mNodes;
+    std::vector<std::unique_ptr<LoadOperation>> mOperations;
+    size_t mPendingConnections = 0;
+    size_t mConnectedNodes     = 0;
+    size_t mNextNode           = 0;
+
+    uint32_t mWeights[static_cast<size_t>(LoadOperationType::kCount)] = {};
+    uint32_t mTotalWeight                                             = 0;
+    uint32_t mNextOperation                                           = 0;
+
+    bool mRunning                                  = false;
+    chip::System::Clock::Microseconds64 mStartTime = chip::System::Clock::Microseconds64(0);
+    chip::System::Clock::Microseconds64 mEndTime   = chip::System::Clock::Microseconds64(0);
+    uint64_t mOperationsStarted                    = 0;
+    size_t mOperationsInFlight                     = 0;
+    uint64_t mSubscriptionReports                  = 0;
+    Stats mStats[static_cast<size_t>(LoadOperationType::kCount)];
+};
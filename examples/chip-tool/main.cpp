@@ -22,6 +22,7 @@
 #include "commands/discover/Commands.h"
 #include "commands/group/Commands.h"
 #include "commands/interactive/Commands.h"
+#include "commands/load/Commands.h"
 #include "commands/pairing/Commands.h"
 #include "commands/payload/Commands.h"
 #include "commands/storage/Commands.h"
@@ -44,6 +45,7 @@ int main(int argc, char * argv[])
     registerCommandsGroup(commands, &credIssuerCommands);
     registerClusters(commands, &credIssuerCommands);
     registerCommandsStorage(commands);
+    registerCommandsLoad(commands, &credIssuerCommands);
 
     return commands.Run(argc, argv);
 }
@@ -0,0 +1,235 @@
+/*
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "FleetDataModel.h"
+
+#include <app-common/zap-generated/ids/Attributes.h>
+#include <app-common/zap-generated/ids/Clusters.h>
+#include <app-common/zap-generated/ids/Commands.h>
+#include <crypto/RandUtils.h>
+#include <lib/support/CHIPMemString.h>
+
+#include <cinttypes>
+#include <stdio.h>
+#include <string.h>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters;
+using chip::Protocols::InteractionModel::Status;
+
+namespace {
+
+constexpr EndpointId kRootEndpoint  = 0;
+constexpr EndpointId kOnOffEndpoint = 1;
+
+} // namespace
+
+void FleetDataModel::Init(NodeId nodeId, VendorId vendorId, uint16_t productId)
+{
+    mAttributeCount = 0;
+    mClusterCount   = 0;
+
+    char serialNumber[kMaxStringLength + 1];
+    snprintf(serialNumber, sizeof(serialNumber), "%016" PRIX64, nodeId);
+
+    AddCluster(kRootEndpoint, Basic::Id, 1);
+    AddUnsigned(kRootEndpoint, Basic::Id, Basic::Attributes::DataModelRevision::Id, 1);
+    AddString(kRootEndpoint, Basic::Id, Basic::Attributes::VendorName::Id, "TEST_VENDOR");
+    AddUnsigned(kRootEndpoint, Basic::Id, Basic::Attributes::VendorID::Id, to_underlying(vendorId));
+    AddString(kRootEndpoint, Basic::Id, Basic::Attributes::ProductName::Id, "Fleet Node");
+    AddUnsigned(kRootEndpoint, Basic::Id, Basic::Attributes::ProductID::Id, productId);
+    AddString(kRootEndpoint, Basic::Id, Basic::Attributes::NodeLabel::Id, "", true /* writable */);
+    AddString(kRootEndpoint, Basic::Id, Basic::Attributes::Location::Id, "XX", true /* writable */);
+    AddUnsigned(kRootEndpoint, Basic::Id, Basic::Attributes::HardwareVersion::Id, 0);
+    AddUnsigned(kRootEndpoint, Basic::Id, Basic::Attributes::SoftwareVersion::Id, 1);
+    AddString(kRootEndpoint, Basic::Id, Basic::Attributes::SerialNumber::Id, serialNumber);
+
+    AddCluster(kOnOffEndpoint, OnOff::Id, 4);
+    AddAttribute(kOnOffEndpoint, OnOff::Id, OnOff::Attributes::OnOff::Id, Type::kBoolean)->mUnsignedValue = 0;
+}
+
+void FleetDataModel::AddCluster(EndpointId endpoint, ClusterId cluster, uint16_t revision)
+{
+    VerifyOrDie(mClusterCount < kMaxClusters);
+    mClusters[mClusterCount++] = { ConcreteClusterPath(endpoint, cluster), Crypto::GetRandU32() };
+
+    AddUnsigned(endpoint, cluster, Globals::Attributes::FeatureMap::Id, 0);
+    AddUnsigned(endpoint, cluster, Globals::Attributes::ClusterRevision::Id, revision);
+}
+
+FleetDataModel::Attribute * FleetDataModel::AddAttribute(EndpointId endpoint, ClusterId cluster, AttributeId attribute, Type type,
+                                                         bool writable)
+{
+    VerifyOrDie(mAttributeCount < kMaxAttributes);
+    Attribute & entry     = mAttributes[mAttributeCount++];
+    entry.mPath           = ConcreteAttributePath(endpoint, cluster, attribute);
+    entry.mType           = type;
+    entry.mWritable       = writable;
+    entry.mUnsignedValue  = 0;
+    entry.mStringValue[0] = '\0';
+    return &entry;
+}
+
+void FleetDataModel::AddUnsigned(EndpointId endpoint, ClusterId cluster, AttributeId attribute, uint64_t value)
+{
+    AddAttribute(endpoint, cluster, attribute, Type::kUnsigned)->mUnsignedValue = value;
+}
+
+void FleetDataModel::AddString(EndpointId endpoint, ClusterId cluster, AttributeId attribute, const char * value, bool writable)
+{
+    Attribute * entry = AddAttribute(endpoint, cluster, attribute, Type::kString, writable);
+    Platform::CopyString(entry->mStringValue, value);
+}
+
+FleetDataModel::Attribute * FleetDataModel::FindAttribute(const ConcreteAttributePath & path)
+{
+    for (size_t i = 0; i < mAttributeCount; i++)
+    {
+        if (mAttributes[i].mPath == path)
+        {
+            return &mAttributes[i];
+        }
+    }
+    return nullptr;
+}
+
+const FleetDataModel::Attribute * FleetDataModel::FindAttribute(const ConcreteAttributePath & path) const
+{
+    return const_cast<FleetDataModel *>(this)->FindAttribute(path);
+}
+
+FleetDataModel::Cluster * FleetDataModel::FindCluster(const ConcreteClusterPath & path)
+{
+    for (size_t i = 0; i < mClusterCount; i++)
+    {
+        if (mClusters[i].mPath == path)
+        {
+            return &mClusters[i];
+        }
+    }
+    return nullptr;
+}
+
+const FleetDataModel::Cluster * FleetDataModel::FindCluster(const ConcreteClusterPath & path) const
+{
+    return const_cast<FleetDataModel *>(this)->FindCluster(path);
+}
+
+DataVersion FleetDataModel::GetDataVersion(const ConcreteAttributePath & path) const
+{
+    const Cluster * cluster = FindCluster(path);
+    VerifyOrDie(cluster != nullptr);
+    return cluster->mDataVersion;
+}
+
+Status FleetDataModel::CheckPath(const ConcreteAttributePath & path) const
+{
+    if (FindAttribute(path) != nullptr)
+    {
+        return Status::Success;
+    }
+    if (FindCluster(path) != nullptr)
+    {
+        return Status::UnsupportedAttribute;
+    }
+    for (size_t i = 0; i < mClusterCount; i++)
+    {
+        if (mClusters[i].mPath.mEndpointId == path.mEndpointId)
+        {
+            return Status::UnsupportedCluster;
+        }
+    }
+    return Status::UnsupportedEndpoint;
+}
+
+CHIP_ERROR FleetDataModel::Encode(const Attribute & attribute, TLV::TLVWriter & writer, TLV::Tag tag) const
+{
+    switch (attribute.mType)
+    {
+    case Type::kBoolean:
+        return writer.PutBoolean(tag, attribute.mUnsignedValue != 0);
+    case Type::kUnsigned:
+        return writer.Put(tag, attribute.mUnsignedValue);
+    case Type::kString:
+        return writer.PutString(tag, attribute.mStringValue);
+    }
+    return CHIP_ERROR_INTERNAL;
+}
+
+Status FleetDataModel::Write(const ConcreteAttributePath & path, TLV::TLVReader & reader, bool & changed)
+{
+    changed = false;
+
+    Attribute * attribute = FindAttribute(path);
+    if (attribute == nullptr)
+    {
+        return CheckPath(path);
+    }
+    VerifyOrReturnError(attribute->mWritable, Status::UnsupportedWrite);
+
+    // Only strings are writable so far.
+    CharSpan value;
+    VerifyOrReturnError(attribute->mType == Type::kString && reader.Get(value) == CHIP_NO_ERROR, Status::InvalidDataType);
+    VerifyOrReturnError(value.size() <= kMaxStringLength, Status::ConstraintError);
+
+    changed = !value.data_equal(CharSpan::fromCharString(attribute->mStringValue));
+    if (changed)
+    {
+        memcpy(attribute->mStringValue, value.data(), value.size());
+        attribute->mStringValue[value.size()] = '\0';
+        FindCluster(path)->mDataVersion++;
+    }
+    return Status::Success;
+}
+
+Status FleetDataModel::Invoke(const ConcreteCommandPath & path, ConcreteAttributePath & changedPath, bool & changed)
+{
+    changed = false;
+
+    if (FindCluster(path) == nullptr)
+    {
+        return CheckPath(ConcreteAttributePath(path.mEndpointId, path.mClusterId, Globals::Attributes::ClusterRevision::Id));
+    }
+    VerifyOrReturnError(path.mClusterId == OnOff::Id, Status::UnsupportedCommand);
+
+    changedPath           = ConcreteAttributePath(path.mEndpointId, OnOff::Id, OnOff::Attributes::OnOff::Id);
+    Attribute * attribute = FindAttribute(changedPath);
+    bool onOff            = attribute->mUnsignedValue != 0;
+
+    switch (path.mCommandId)
+    {
+    case OnOff::Commands::Off::Id:
+        changed = onOff;
+        break;
+    case OnOff::Commands::On::Id:
+        changed = !onOff;
+        break;
+    case OnOff::Commands::Toggle::Id:
+        changed = true;
+        break;
+    default:
+        return Status::UnsupportedCommand;
+    }
+
+    if (changed)
+    {
+        attribute->mUnsignedValue = onOff ? 0 : 1;
+        FindCluster(path)->mDataVersion++;
+    }
+    return Status::Success;
+}
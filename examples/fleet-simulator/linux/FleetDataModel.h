@@ -0,0 +1,108 @@
+/*
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/ConcreteAttributePath.h>
+#include <app/ConcreteCommandPath.h>
+#include <lib/core/CHIPTLV.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/CodeUtils.h>
+#include <protocols/interaction_model/StatusCode.h>
+
+/**
+ * The in-memory data model of a virtual node: a Basic Information cluster on the root endpoint and an On/Off
+ * cluster on endpoint 1, with scalar and string attributes only. It stands in for the ember attribute storage,
+ * which is global to the process and cannot back several nodes.
+ */
+class FleetDataModel
+{
+public:
+    static constexpr size_t kMaxStringLength = 32;
+
+    enum class Type : uint8_t
+    {
+        kBoolean,
+        kUnsigned,
+        kString,
+    };
+
+    struct Attribute
+    {
+        chip::app::ConcreteAttributePath mPath;
+        Type mType;
+        bool mWritable;
+        uint64_t mUnsignedValue;
+        char mStringValue[kMaxStringLength + 1];
+    };
+
+    struct Cluster
+    {
+        chip::app::ConcreteClusterPath mPath;
+        chip::DataVersion mDataVersion;
+    };
+
+    void Init(chip::NodeId nodeId, chip::VendorId vendorId, uint16_t productId);
+
+    size_t GetAttributeCount() const { return mAttributeCount; }
+    const Attribute & GetAttribute(size_t index) const { return mAttributes[index]; }
+
+    /**
+     * The data version of the cluster of the given attribute, which must exist.
+     */
+    chip::DataVersion GetDataVersion(const chip::app::ConcreteAttributePath & path) const;
+
+    /**
+     * The status of a read or write of a concrete path that does not exist, or Success when it does.
+     */
+    chip::Protocols::InteractionModel::Status CheckPath(const chip::app::ConcreteAttributePath & path) const;
+
+    CHIP_ERROR Encode(const Attribute & attribute, chip::TLV::TLVWriter & writer, chip::TLV::Tag tag) const;
+
+    /**
+     * Write an attribute from its TLV encoded value. changed is set when the value differs from the previous one.
+     */
+    chip::Protocols::InteractionModel::Status Write(const chip::app::ConcreteAttributePath & path, chip::TLV::TLVReader & reader,
+                                                    bool & changed);
+
+    /**
+     * Invoke a command of the On/Off cluster. changedPath is set to the attribute changed by the command, if any.
+     */
+    chip::Protocols::InteractionModel::Status Invoke(const chip::app::ConcreteCommandPath & path,
+                                                     chip::app::ConcreteAttributePath & changedPath, bool & changed);
+
+private:
+    static constexpr size_t kMaxAttributes = 16;
+    static constexpr size_t kMaxClusters   = 2;
+
+    void AddCluster(chip::EndpointId endpoint, chip::ClusterId cluster, uint16_t revision);
+    Attribute * AddAttribute(chip::EndpointId endpoint, chip::ClusterId cluster, chip::AttributeId attribute, Type type,
+                             bool writable = false);
+    void AddUnsigned(chip::EndpointId endpoint, chip::ClusterId cluster, chip::AttributeId attribute, uint64_t value);
+    void AddString(chip::EndpointId endpoint, chip::ClusterId cluster, chip::AttributeId attribute, const char * value,
+                   bool writable = false);
+
+    Attribute * FindAttribute(const chip::app::ConcreteAttributePath & path);
+    const Attribute * FindAttribute(const chip::app::ConcreteAttributePath & path) const;
+    Cluster * FindCluster(const chip::app::ConcreteClusterPath & path);
+    const Cluster * FindCluster(const chip::app::ConcreteClusterPath & path) const;
+
+    Attribute mAttributes[kMaxAttributes];
+    size_t mAttributeCount = 0;
+    Cluster mClusters[kMaxClusters];
+    size_t mClusterCount = 0;
+};
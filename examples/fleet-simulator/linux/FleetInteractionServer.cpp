@@ -0,0 +1,651 @@
+/*
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "FleetInteractionServer.h"
+
+#include <app/InteractionModelTimeout.h>
+#include <app/MessageDef/InvokeRequestMessage.h>
+#include <app/MessageDef/InvokeResponseMessage.h>
+#include <app/MessageDef/ReadRequestMessage.h>
+#include <app/MessageDef/ReportDataMessage.h>
+#include <app/MessageDef/SubscribeRequestMessage.h>
+#include <app/MessageDef/SubscribeResponseMessage.h>
+#include <app/MessageDef/WriteRequestMessage.h>
+#include <app/MessageDef/WriteResponseMessage.h>
+#include <app/StatusResponse.h>
+#include <crypto/RandUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <protocols/interaction_model/Constants.h>
+#include <system/TLVPacketBufferBackingStore.h>
+
+using namespace chip;
+using namespace chip::app;
+using chip::Messaging::ExchangeContext;
+using chip::Messaging::SendMessageFlags;
+using chip::Protocols::InteractionModel::MsgType;
+using chip::Protocols::InteractionModel::Status;
+
+namespace {
+
+// Optional fields of Interaction Model messages read as CHIP_END_OF_TLV when absent.
+CHIP_ERROR AllowAbsent(CHIP_ERROR err)
+{
+    return (err == CHIP_END_OF_TLV) ? CHIP_NO_ERROR : err;
+}
+
+template <typename RequestParser>
+CHIP_ERROR ParseAttributePaths(const RequestParser & request, AttributePathParams (&paths)[FleetInteractionServer::kMaxPaths],
+                               size_t & pathCount)
+{
+    pathCount = 0;
+
+    AttributePathIBs::Parser pathsParser;
+    CHIP_ERROR err = request.GetAttributeRequests(&pathsParser);
+    VerifyOrReturnError(err != CHIP_END_OF_TLV, CHIP_NO_ERROR);
+    ReturnErrorOnFailure(err);
+
+    TLV::TLVReader reader;
+    pathsParser.GetReader(&reader);
+    while (CHIP_NO_ERROR == (err = reader.Next()))
+    {
+        VerifyOrReturnError(pathCount < FleetInteractionServer::kMaxPaths, CHIP_IM_GLOBAL_STATUS(PathsExhausted));
+
+        AttributePathIB::Parser path;
+        ReturnErrorOnFailure(path.Init(reader));
+        ReturnErrorOnFailure(path.ParsePath(paths[pathCount++]));
+    }
+    return AllowAbsent(err);
+}
+
+CHIP_ERROR EncodeAttributePath(AttributePathIB::Builder & builder, const ConcreteAttributePath & path)
+{
+    builder.Endpoint(path.mEndpointId).Cluster(path.mClusterId).Attribute(path.mAttributeId).EndOfAttributePathIB();
+    return builder.GetError();
+}
+
+} // namespace
+
+CHIP_ERROR FleetInteractionServer::Init(Messaging::ExchangeManager * exchangeManager, FleetDataModel * dataModel)
+{
+    VerifyOrReturnError(exchangeManager != nullptr && dataModel != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mExchangeManager = exchangeManager;
+    mDataModel       = dataModel;
+    return mExchangeManager->RegisterUnsolicitedMessageHandlerForProtocol(Protocols::InteractionModel::Id, this);
+}
+
+void FleetInteractionServer::Shutdown()
+{
+    VerifyOrReturn(mExchangeManager != nullptr);
+
+    mExchangeManager->GetSessionManager()->SystemLayer()->CancelTimer(OnReportTimer, this);
+    for (auto & subscription : mSubscriptions)
+    {
+        if (subscription.mState != SubscriptionState::kFree)
+        {
+            ReleaseSubscription(subscription);
+        }
+    }
+    mExchangeManager->UnregisterUnsolicitedMessageHandlerForProtocol(Protocols::InteractionModel::Id);
+    mExchangeManager = nullptr;
+}
+
+size_t FleetInteractionServer::GetSubscriptionCount() const
+{
+    size_t count = 0;
+    for (const auto & subscription : mSubscriptions)
+    {
+        if (subscription.mState != SubscriptionState::kFree)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+CHIP_ERROR FleetInteractionServer::OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                                     System::PacketBufferHandle && payload)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    if (payloadHeader.HasMessageType(MsgType::StatusResponse))
+    {
+        return HandleStatusResponse(ec, std::move(payload));
+    }
+
+    if (payloadHeader.HasMessageType(MsgType::ReadRequest))
+    {
+        err = HandleReadRequest(ec, std::move(payload));
+    }
+    else if (payloadHeader.HasMessageType(MsgType::SubscribeRequest))
+    {
+        err = HandleSubscribeRequest(ec, std::move(payload));
+    }
+    else if (payloadHeader.HasMessageType(MsgType::WriteRequest))
+    {
+        err = HandleWriteRequest(ec, std::move(payload));
+    }
+    else if (payloadHeader.HasMessageType(MsgType::InvokeCommandRequest))
+    {
+        err = HandleInvokeRequest(ec, std::move(payload));
+    }
+    else if (payloadHeader.HasMessageType(MsgType::TimedRequest))
+    {
+        // The write or invoke that follows arrives on the same exchange.
+        err = StatusResponse::Send(Status::Success, ec, true /* aExpectResponse */);
+    }
+    else
+    {
+        err = CHIP_ERROR_INVALID_MESSAGE_TYPE;
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to process message type 0x%x: %" CHIP_ERROR_FORMAT, payloadHeader.GetMessageType(),
+                     err.Format());
+        StatusIB status(err);
+        if (!err.IsIMStatus())
+        {
+            status.mStatus = Status::InvalidAction;
+        }
+        StatusResponse::Send(status.mStatus, ec, false /* aExpectResponse */);
+    }
+    return err;
+}
+
+void FleetInteractionServer::OnExchangeClosing(ExchangeContext * ec)
+{
+    // The exchange of a report closed before the subscriber responded to it.
+    Subscription * subscription = FindSubscription(ec);
+    if (subscription != nullptr)
+    {
+        subscription->mExchange = nullptr;
+        ReleaseSubscription(*subscription);
+    }
+}
+
+CHIP_ERROR FleetInteractionServer::HandleReadRequest(ExchangeContext * ec, System::PacketBufferHandle && payload)
+{
+    System::PacketBufferTLVReader reader;
+    reader.Init(std::move(payload));
+
+    ReadRequestMessage::Parser request;
+    ReturnErrorOnFailure(request.Init(reader));
+
+    AttributePathParams paths[kMaxPaths];
+    size_t pathCount;
+    ReturnErrorOnFailure(ParseAttributePaths(request, paths, pathCount));
+
+    System::PacketBufferHandle report;
+    ReturnErrorOnFailure(BuildReport(paths, pathCount, true /* includeData */, NullOptional, report));
+    return ec->SendMessage(MsgType::ReportData, std::move(report));
+}
+
+CHIP_ERROR FleetInteractionServer::HandleSubscribeRequest(ExchangeContext * ec, System::PacketBufferHandle && payload)
+{
+    System::PacketBufferTLVReader reader;
+    reader.Init(std::move(payload));
+
+    SubscribeRequestMessage::Parser request;
+    ReturnErrorOnFailure(request.Init(reader));
+
+    bool keepSubscriptions;
+    uint16_t minIntervalSecs;
+    uint16_t maxIntervalSecs;
+    ReturnErrorOnFailure(request.GetKeepSubscriptions(&keepSubscriptions));
+    ReturnErrorOnFailure(request.GetMinIntervalFloorSeconds(&minIntervalSecs));
+    ReturnErrorOnFailure(request.GetMaxIntervalCeilingSeconds(&maxIntervalSecs));
+    VerifyOrReturnError(minIntervalSecs <= maxIntervalSecs, CHIP_IM_GLOBAL_STATUS(InvalidAction));
+
+    if (!keepSubscriptions)
+    {
+        const ScopedNodeId subscriber = ec->GetSessionHandle()->GetPeer();
+        for (auto & subscription : mSubscriptions)
+        {
+            if (subscription.mState != SubscriptionState::kFree && subscription.mSession &&
+                subscription.mSession->GetPeer() == subscriber)
+            {
+                ReleaseSubscription(subscription);
+            }
+        }
+    }
+
+    Subscription * subscription = nullptr;
+    for (auto & candidate : mSubscriptions)
+    {
+        if (candidate.mState == SubscriptionState::kFree)
+        {
+            subscription = &candidate;
+            break;
+        }
+    }
+    VerifyOrReturnError(subscription != nullptr, CHIP_IM_GLOBAL_STATUS(ResourceExhausted));
+
+    // Event paths are not supported, so there has to be some attribute path.
+    ReturnErrorOnFailure(ParseAttributePaths(request, subscription->mPaths, subscription->mPathCount));
+    VerifyOrReturnError(subscription->mPathCount > 0, CHIP_IM_GLOBAL_STATUS(InvalidAction));
+
+    subscription->mSubscriptionId  = Crypto::GetRandU32();
+    subscription->mMinIntervalSecs = minIntervalSecs;
+    subscription->mMaxIntervalSecs = maxIntervalSecs;
+    subscription->mDirty           = false;
+
+    System::PacketBufferHandle report;
+    ReturnErrorOnFailure(BuildReport(subscription->mPaths, subscription->mPathCount, true /* includeData */,
+                                     MakeOptional(subscription->mSubscriptionId), report));
+    ec->UseSuggestedResponseTimeout(kExpectedIMProcessingTime);
+    ReturnErrorOnFailure(ec->SendMessage(MsgType::ReportData, std::move(report), SendMessageFlags::kExpectResponse));
+
+    subscription->mSession.Grab(ec->GetSessionHandle());
+    subscription->mExchange = ec;
+    subscription->mState    = SubscriptionState::kAwaitingPrimingResponse;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR FleetInteractionServer::HandleStatusResponse(ExchangeContext * ec, System::PacketBufferHandle && payload)
+{
+    Subscription * subscription = FindSubscription(ec);
+    VerifyOrReturnError(subscription != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    // The exchange closes once this returns, unless the subscribe response is sent on it.
+    subscription->mExchange = nullptr;
+
+    CHIP_ERROR status = CHIP_NO_ERROR;
+    CHIP_ERROR err    = StatusResponse::ProcessStatusResponse(std::move(payload), status);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = status;
+    }
+    if (err == CHIP_NO_ERROR && subscription->mState == SubscriptionState::kAwaitingPrimingResponse)
+    {
+        err = SendSubscribeResponse(ec, *subscription);
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        ReleaseSubscription(*subscription);
+        return err;
+    }
+
+    subscription->mState = SubscriptionState::kIdle;
+    ScheduleReports();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR FleetInteractionServer::SendSubscribeResponse(ExchangeContext * ec, Subscription & subscription)
+{
+    System::PacketBufferHandle packet = System::PacketBufferHandle::New(kMaxSecureSduLengthBytes);
+    VerifyOrReturnError(!packet.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+    System::PacketBufferTLVWriter writer;
+    writer.Init(std::move(packet));
+
+    SubscribeResponseMessage::Builder response;
+    ReturnErrorOnFailure(response.Init(&writer));
+    response.SubscriptionId(subscription.mSubscriptionId)
+        .MaxInterval(subscription.mMaxIntervalSecs)
+        .EndOfSubscribeResponseMessage();
+    ReturnErrorOnFailure(response.GetError());
+    ReturnErrorOnFailure(writer.Finalize(&packet));
+
+    subscription.mLastReportTime = System::SystemClock().GetMonotonicTimestamp();
+    return ec->SendMessage(MsgType::SubscribeResponse, std::move(packet));
+}
+
+CHIP_ERROR FleetInteractionServer::HandleWriteRequest(ExchangeContext * ec, System::PacketBufferHandle && payload)
+{
+    System::PacketBufferTLVReader reader;
+    reader.Init(std::move(payload));
+
+    WriteRequestMessage::Parser request;
+    ReturnErrorOnFailure(request.Init(reader));
+
+    bool suppressResponse = false;
+    bool moreChunks       = false;
+    ReturnErrorOnFailure(AllowAbsent(request.GetSuppressResponse(&suppressResponse)));
+    ReturnErrorOnFailure(AllowAbsent(request.GetMoreChunkedMessages(&moreChunks)));
+    VerifyOrReturnError(!moreChunks, CHIP_IM_GLOBAL_STATUS(InvalidAction));
+
+    AttributeDataIBs::Parser writeRequests;
+    ReturnErrorOnFailure(request.GetWriteRequests(&writeRequests));
+
+    System::PacketBufferHandle packet = System::PacketBufferHandle::New(kMaxSecureSduLengthBytes);
+    VerifyOrReturnError(!packet.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+    System::PacketBufferTLVWriter writer;
+    writer.Init(std::move(packet));
+
+    WriteResponseMessage::Builder response;
+    ReturnErrorOnFailure(response.Init(&writer));
+    AttributeStatusIBs::Builder & writeResponses = response.CreateWriteResponses();
+    ReturnErrorOnFailure(response.GetError());
+
+    CHIP_ERROR err;
+    TLV::TLVReader dataReader;
+    writeRequests.GetReader(&dataReader);
+    while (CHIP_NO_ERROR == (err = dataReader.Next()))
+    {
+        AttributeDataIB::Parser data;
+        ReturnErrorOnFailure(data.Init(dataReader));
+
+        // Wildcard writes are not supported.
+        AttributePathIB::Parser pathParser;
+        ConcreteAttributePath path;
+        ReturnErrorOnFailure(data.GetPath(&pathParser));
+        ReturnErrorOnFailure(pathParser.GetEndpoint(&path.mEndpointId));
+        ReturnErrorOnFailure(pathParser.GetCluster(&path.mClusterId));
+        ReturnErrorOnFailure(pathParser.GetAttribute(&path.mAttributeId));
+
+        TLV::TLVReader valueReader;
+        bool changed;
+        ReturnErrorOnFailure(data.GetData(&valueReader));
+        const Status status = mDataModel->Write(path, valueReader, changed);
+        if (changed)
+        {
+            MarkDirty(path);
+        }
+
+        AttributeStatusIB::Builder & attributeStatus = writeResponses.CreateAttributeStatus();
+        ReturnErrorOnFailure(writeResponses.GetError());
+        ReturnErrorOnFailure(EncodeAttributePath(attributeStatus.CreatePath(), path));
+        StatusIB::Builder & statusBuilder = attributeStatus.CreateErrorStatus();
+        ReturnErrorOnFailure(attributeStatus.GetError());
+        ReturnErrorOnFailure(statusBuilder.EncodeStatusIB(StatusIB(status)).GetError());
+        ReturnErrorOnFailure(attributeStatus.EndOfAttributeStatusIB().GetError());
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+    ReturnErrorOnFailure(writeResponses.EndOfAttributeStatuses().GetError());
+    ReturnErrorOnFailure(response.EndOfWriteResponseMessage().GetError());
+    VerifyOrReturnError(!suppressResponse, CHIP_NO_ERROR);
+
+    ReturnErrorOnFailure(writer.Finalize(&packet));
+    return ec->SendMessage(MsgType::WriteResponse, std::move(packet));
+}
+
+CHIP_ERROR FleetInteractionServer::HandleInvokeRequest(ExchangeContext * ec, System::PacketBufferHandle && payload)
+{
+    System::PacketBufferTLVReader reader;
+    reader.Init(std::move(payload));
+
+    InvokeRequestMessage::Parser request;
+    ReturnErrorOnFailure(request.Init(reader));
+
+    bool suppressResponse = false;
+    ReturnErrorOnFailure(AllowAbsent(request.GetSuppressResponse(&suppressResponse)));
+
+    InvokeRequests::Parser invokeRequests;
+    ReturnErrorOnFailure(request.GetInvokeRequests(&invokeRequests));
+
+    System::PacketBufferHandle packet = System::PacketBufferHandle::New(kMaxSecureSduLengthBytes);
+    VerifyOrReturnError(!packet.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+    System::PacketBufferTLVWriter writer;
+    writer.Init(std::move(packet));
+
+    InvokeResponseMessage::Builder response;
+    ReturnErrorOnFailure(response.Init(&writer));
+    response.SuppressResponse(suppressResponse);
+    InvokeResponseIBs::Builder & invokeResponses = response.CreateInvokeResponses();
+    ReturnErrorOnFailure(response.GetError());
+
+    CHIP_ERROR err;
+    TLV::TLVReader commandReader;
+    invokeRequests.GetReader(&commandReader);
+    while (CHIP_NO_ERROR == (err = commandReader.Next()))
+    {
+        CommandDataIB::Parser command;
+        ReturnErrorOnFailure(command.Init(commandReader));
+
+        // None of the supported commands has fields.
+        CommandPathIB::Parser pathParser;
+        ConcreteCommandPath path(0, 0, 0);
+        ReturnErrorOnFailure(command.GetPath(&pathParser));
+        ReturnErrorOnFailure(pathParser.GetEndpointId(&path.mEndpointId));
+        ReturnErrorOnFailure(pathParser.GetClusterId(&path.mClusterId));
+        ReturnErrorOnFailure(pathParser.GetCommandId(&path.mCommandId));
+
+        ConcreteAttributePath changedPath;
+        bool changed;
+        const Status status = mDataModel->Invoke(path, changedPath, changed);
+        if (changed)
+        {
+            MarkDirty(changedPath);
+        }
+
+        InvokeResponseIB::Builder & invokeResponse = invokeResponses.CreateInvokeResponse();
+        ReturnErrorOnFailure(invokeResponses.GetError());
+        CommandStatusIB::Builder & commandStatus = invokeResponse.CreateStatus();
+        ReturnErrorOnFailure(invokeResponse.GetError());
+        ReturnErrorOnFailure(commandStatus.CreatePath().Encode(path));
+        StatusIB::Builder & statusBuilder = commandStatus.CreateErrorStatus();
+        ReturnErrorOnFailure(commandStatus.GetError());
+        ReturnErrorOnFailure(statusBuilder.EncodeStatusIB(StatusIB(status)).GetError());
+        ReturnErrorOnFailure(commandStatus.EndOfCommandStatusIB().GetError());
+        ReturnErrorOnFailure(invokeResponse.EndOfInvokeResponseIB().GetError());
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+    ReturnErrorOnFailure(invokeResponses.EndOfInvokeResponses().GetError());
+    ReturnErrorOnFailure(response.EndOfInvokeResponseMessage().GetError());
+    VerifyOrReturnError(!suppressResponse, CHIP_NO_ERROR);
+
+    ReturnErrorOnFailure(writer.Finalize(&packet));
+    return ec->SendMessage(MsgType::InvokeCommandResponse, std::move(packet));
+}
+
+CHIP_ERROR FleetInteractionServer::BuildReport(const AttributePathParams * paths, size_t pathCount, bool includeData,
+                                               const Optional<SubscriptionId> & subscriptionId, System::PacketBufferHandle & report)
+{
+    // Reports are never chunked: they have to fit in a single message, which the small data model always does.
+    System::PacketBufferHandle packet = System::PacketBufferHandle::New(kMaxSecureSduLengthBytes);
+    VerifyOrReturnError(!packet.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+    System::PacketBufferTLVWriter writer;
+    writer.Init(std::move(packet));
+
+    ReportDataMessage::Builder reportData;
+    ReturnErrorOnFailure(reportData.Init(&writer));
+    if (subscriptionId.HasValue())
+    {
+        reportData.SubscriptionId(subscriptionId.Value());
+    }
+
+    AttributeReportIBs::Builder & attributeReports = reportData.CreateAttributeReportIBs();
+    ReturnErrorOnFailure(reportData.GetError());
+    for (size_t i = 0; includeData && i < pathCount; i++)
+    {
+        ReturnErrorOnFailure(EncodeAttributes(paths[i], attributeReports));
+    }
+    ReturnErrorOnFailure(attributeReports.EndOfAttributeReportIBs().GetError());
+
+    // Only the reports of a subscription are acknowledged.
+    if (!subscriptionId.HasValue())
+    {
+        reportData.SuppressResponse(true);
+    }
+    ReturnErrorOnFailure(reportData.EndOfReportDataMessage().GetError());
+    return writer.Finalize(&report);
+}
+
+CHIP_ERROR FleetInteractionServer::EncodeAttributes(const AttributePathParams & path,
+                                                    AttributeReportIBs::Builder & attributeReports)
+{
+    if (!path.IsWildcardPath())
+    {
+        const ConcreteAttributePath concretePath(path.mEndpointId, path.mClusterId, path.mAttributeId);
+        const Status status = mDataModel->CheckPath(concretePath);
+        if (status != Status::Success)
+        {
+            return attributeReports.EncodeAttributeStatus(ConcreteReadAttributePath(concretePath), StatusIB(status));
+        }
+    }
+
+    for (size_t i = 0; i < mDataModel->GetAttributeCount(); i++)
+    {
+        const FleetDataModel::Attribute & attribute = mDataModel->GetAttribute(i);
+        if (!path.IsAttributePathSupersetOf(attribute.mPath))
+        {
+            continue;
+        }
+
+        AttributeReportIB::Builder & attributeReport = attributeReports.CreateAttributeReport();
+        ReturnErrorOnFailure(attributeReports.GetError());
+        AttributeDataIB::Builder & attributeData = attributeReport.CreateAttributeData();
+        ReturnErrorOnFailure(attributeReport.GetError());
+        attributeData.DataVersion(mDataModel->GetDataVersion(attribute.mPath));
+        ReturnErrorOnFailure(EncodeAttributePath(attributeData.CreatePath(), attribute.mPath));
+        ReturnErrorOnFailure(mDataModel->Encode(attribute, *attributeData.GetWriter(),
+                                                TLV::ContextTag(to_underlying(AttributeDataIB::Tag::kData))));
+        ReturnErrorOnFailure(attributeData.EndOfAttributeDataIB().GetError());
+        ReturnErrorOnFailure(attributeReport.EndOfAttributeReportIB().GetError());
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR FleetInteractionServer::SendSubscriptionReport(Subscription & subscription)
+{
+    System::PacketBufferHandle report;
+    ReturnErrorOnFailure(BuildReport(subscription.mPaths, subscription.mPathCount, subscription.mDirty,
+                                     MakeOptional(subscription.mSubscriptionId), report));
+
+    ExchangeContext * ec = mExchangeManager->NewContext(subscription.mSession.Get().Value(), this);
+    VerifyOrReturnError(ec != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    ec->UseSuggestedResponseTimeout(kExpectedIMProcessingTime);
+    CHIP_ERROR err = ec->SendMessage(MsgType::ReportData, std::move(report), SendMessageFlags::kExpectResponse);
+    if (err != CHIP_NO_ERROR)
+    {
+        ec->Close();
+        return err;
+    }
+
+    subscription.mExchange       = ec;
+    subscription.mState          = SubscriptionState::kAwaitingReportResponse;
+    subscription.mDirty          = false;
+    subscription.mLastReportTime = System::SystemClock().GetMonotonicTimestamp();
+    return CHIP_NO_ERROR;
+}
+
+void FleetInteractionServer::MarkDirty(const ConcreteAttributePath & path)
+{
+    for (auto & subscription : mSubscriptions)
+    {
+        for (size_t i = 0; subscription.mState != SubscriptionState::kFree && i < subscription.mPathCount; i++)
+        {
+            if (subscription.mPaths[i].IsAttributePathSupersetOf(path))
+            {
+                subscription.mDirty = true;
+                break;
+            }
+        }
+    }
+    ScheduleReports();
+}
+
+void FleetInteractionServer::ScheduleReports()
+{
+    // A single timer serves all the subscriptions of the node, armed for the earliest report due.
+    System::Layer * systemLayer = mExchangeManager->GetSessionManager()->SystemLayer();
+    systemLayer->CancelTimer(OnReportTimer, this);
+
+    bool reportPending = false;
+    System::Clock::Timestamp nextReportTime;
+    for (const auto & subscription : mSubscriptions)
+    {
+        if (subscription.mState != SubscriptionState::kIdle)
+        {
+            continue;
+        }
+
+        const System::Clock::Timestamp reportTime = subscription.mLastReportTime +
+            System::Clock::Seconds16(subscription.mDirty ? subscription.mMinIntervalSecs : subscription.mMaxIntervalSecs);
+        if (!reportPending || reportTime < nextReportTime)
+        {
+            nextReportTime = reportTime;
+            reportPending  = true;
+        }
+    }
+    VerifyOrReturn(reportPending);
+
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+    const System::Clock::Timeout delay =
+        (nextReportTime > now) ? std::chrono::duration_cast<System::Clock::Timeout>(nextReportTime - now) : System::Clock::kZero;
+    CHIP_ERROR err = systemLayer->StartTimer(delay, OnReportTimer, this);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to schedule subscription reports: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+void FleetInteractionServer::OnReportTimer(System::Layer * layer, void * context)
+{
+    auto * server                      = static_cast<FleetInteractionServer *>(context);
+    const System::Clock::Timestamp now = System::SystemClock().GetMonotonicTimestamp();
+
+    for (auto & subscription : server->mSubscriptions)
+    {
+        if (subscription.mState != SubscriptionState::kIdle)
+        {
+            continue;
+        }
+        if (!subscription.mSession)
+        {
+            server->ReleaseSubscription(subscription);
+            continue;
+        }
+
+        const uint16_t intervalSecs = subscription.mDirty ? subscription.mMinIntervalSecs : subscription.mMaxIntervalSecs;
+        if (now < subscription.mLastReportTime + System::Clock::Seconds16(intervalSecs))
+        {
+            continue;
+        }
+
+        CHIP_ERROR err = server->SendSubscriptionReport(subscription);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DataManagement, "Failed to report subscription 0x%08" PRIx32 ": %" CHIP_ERROR_FORMAT,
+                         subscription.mSubscriptionId, err.Format());
+            server->ReleaseSubscription(subscription);
+        }
+    }
+
+    server->ScheduleReports();
+}
+
+void FleetInteractionServer::ReleaseSubscription(Subscription & subscription)
+{
+    if (subscription.mExchange != nullptr)
+    {
+        ExchangeContext * ec   = subscription.mExchange;
+        subscription.mExchange = nullptr;
+        ec->Abort();
+    }
+    subscription.mSession.Release();
+    subscription.mState = SubscriptionState::kFree;
+}
+
+FleetInteractionServer::Subscription * FleetInteractionServer::FindSubscription(ExchangeContext * ec)
+{
+    for (auto & subscription : mSubscriptions)
+    {
+        if (subscription.mState != SubscriptionState::kFree && subscription.mExchange == ec)
+        {
+            return &subscription;
+        }
+    }
+    return nullptr;
+}
@@ -0,0 +1,112 @@
+/*
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include "FleetDataModel.h"
+
+#include <app/AttributePathParams.h>
+#include <app/MessageDef/AttributeReportIBs.h>
+#include <messaging/ExchangeContext.h>
+#include <messaging/ExchangeDelegate.h>
+#include <messaging/ExchangeMgr.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+#include <transport/SessionHolder.h>
+
+/**
+ * A minimal Interaction Model responder for the data model of a virtual node.
+ *
+ * The InteractionModelEngine is a process wide singleton bound to one exchange manager, so every virtual node serves
+ * reads, subscriptions, writes and invokes through its own instance of this class instead. It covers what controllers
+ * exercise at scale: attribute paths with wildcards, subscriptions with their min and max intervals, and status
+ * responses to writes and invokes. Events, chunked messages, data version filters and access control are not
+ * supported, and timed requests are accepted without their timeout being enforced.
+ */
+class FleetInteractionServer : public chip::Messaging::UnsolicitedMessageHandler, public chip::Messaging::ExchangeDelegate
+{
+public:
+    static constexpr size_t kMaxPaths         = 8;
+    static constexpr size_t kMaxSubscriptions = 8;
+
+    CHIP_ERROR Init(chip::Messaging::ExchangeManager * exchangeManager, FleetDataModel * dataModel);
+    void Shutdown();
+
+    size_t GetSubscriptionCount() const;
+
+    //// UnsolicitedMessageHandler Implementation ////
+    CHIP_ERROR OnUnsolicitedMessageReceived(const chip::PayloadHeader & payloadHeader,
+                                            chip::Messaging::ExchangeDelegate *& newDelegate) override
+    {
+        newDelegate = this;
+        return CHIP_NO_ERROR;
+    }
+
+    //// ExchangeDelegate Implementation ////
+    CHIP_ERROR OnMessageReceived(chip::Messaging::ExchangeContext * ec, const chip::PayloadHeader & payloadHeader,
+                                 chip::System::PacketBufferHandle && payload) override;
+    void OnResponseTimeout(chip::Messaging::ExchangeContext * ec) override {}
+    void OnExchangeClosing(chip::Messaging::ExchangeContext * ec) override;
+
+private:
+    enum class SubscriptionState : uint8_t
+    {
+        kFree,
+        kAwaitingPrimingResponse,
+        kIdle,
+        kAwaitingReportResponse,
+    };
+
+    struct Subscription
+    {
+        SubscriptionState mState = SubscriptionState::kFree;
+        chip::SubscriptionId mSubscriptionId;
+        chip::SessionHolder mSession;
+        chip::Messaging::ExchangeContext * mExchange = nullptr;
+        chip::app::AttributePathParams mPaths[kMaxPaths];
+        size_t mPathCount;
+        uint16_t mMinIntervalSecs;
+        uint16_t mMaxIntervalSecs;
+        bool mDirty;
+        chip::System::Clock::Timestamp mLastReportTime;
+    };
+
+    CHIP_ERROR HandleReadRequest(chip::Messaging::ExchangeContext * ec, chip::System::PacketBufferHandle && payload);
+    CHIP_ERROR HandleSubscribeRequest(chip::Messaging::ExchangeContext * ec, chip::System::PacketBufferHandle && payload);
+    CHIP_ERROR HandleWriteRequest(chip::Messaging::ExchangeContext * ec, chip::System::PacketBufferHandle && payload);
+    CHIP_ERROR HandleInvokeRequest(chip::Messaging::ExchangeContext * ec, chip::System::PacketBufferHandle && payload);
+    CHIP_ERROR HandleStatusResponse(chip::Messaging::ExchangeContext * ec, chip::System::PacketBufferHandle && payload);
+
+    // Build a report of the attributes matched by the paths, or of none when includeData is false.
+    CHIP_ERROR BuildReport(const chip::app::AttributePathParams * paths, size_t pathCount, bool includeData,
+                           const chip::Optional<chip::SubscriptionId> & subscriptionId, chip::System::PacketBufferHandle & report);
+    CHIP_ERROR EncodeAttributes(const chip::app::AttributePathParams & path,
+                                chip::app::AttributeReportIBs::Builder & attributeReports);
+    CHIP_ERROR SendSubscribeResponse(chip::Messaging::ExchangeContext * ec, Subscription & subscription);
+    CHIP_ERROR SendSubscriptionReport(Subscription & subscription);
+
+    void MarkDirty(const chip::app::ConcreteAttributePath & path);
+    void ScheduleReports();
+    void ReleaseSubscription(Subscription & subscription);
+    Subscription * FindSubscription(chip::Messaging::ExchangeContext * ec);
+
+    static void OnReportTimer(chip::System::Layer * layer, void * context);
+
+    chip::Messaging::ExchangeManager * mExchangeManager = nullptr;
+    FleetDataModel * mDataModel                         = nullptr;
+    Subscription mSubscriptions[kMaxSubscriptions];
+};
@@ -0,0 +1,124 @@
+/*
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "FleetNode.h"
+
+#include <credentials/CHIPCert.h>
+#include <lib/dnssd/Advertiser.h>
+#include <lib/support/BufferWriter.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/TestGroupData.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/CHIPDeviceLayer.h>
+
+using namespace chip;
+
+CHIP_ERROR FleetNode::Init(const Params & params, Controller::ExampleOperationalCredentialsIssuer & issuer)
+{
+    mParams = params;
+    mDataModel.Init(mParams.nodeId, mParams.vendorId, mParams.productId);
+
+    ReturnErrorOnFailure(mOpCertStore.Init(&mStorage));
+
+    FabricTable::InitParams fabricTableParams;
+    fabricTableParams.storage     = &mStorage;
+    fabricTableParams.opCertStore = &mOpCertStore;
+    ReturnErrorOnFailure(mFabricTable.Init(fabricTableParams));
+
+    mGroupDataProvider.SetStorageDelegate(&mStorage);
+    ReturnErrorOnFailure(mGroupDataProvider.Init());
+    ReturnErrorOnFailure(mSessionResumptionStorage.Init(&mStorage));
+    ReturnErrorOnFailure(InitFabric(issuer));
+
+    ReturnErrorOnFailure(mTransports.Init(Transport::UdpListenParameters(DeviceLayer::UDPEndPointManager())
+                                              .SetAddressType(Inet::IPAddressType::kIPv6)
+                                              .SetListenPort(mParams.port)));
+    ReturnErrorOnFailure(
+        mSessionManager.Init(&DeviceLayer::SystemLayer(), &mTransports, &mMessageCounterManager, &mStorage, &mFabricTable));
+    ReturnErrorOnFailure(mExchangeManager.Init(&mSessionManager));
+    ReturnErrorOnFailure(mMessageCounterManager.Init(&mExchangeManager));
+    ReturnErrorOnFailure(mCASEServer.ListenForSessionEstablishment(&mExchangeManager, &mSessionManager, &mFabricTable,
+                                                                   &mSessionResumptionStorage, nullptr, &mGroupDataProvider));
+    return mInteractionServer.Init(&mExchangeManager, &mDataModel);
+}
+
+CHIP_ERROR FleetNode::InitFabric(Controller::ExampleOperationalCredentialsIssuer & issuer)
+{
+    Platform::ScopedMemoryBuffer<uint8_t> noc;
+    Platform::ScopedMemoryBuffer<uint8_t> icac;
+    Platform::ScopedMemoryBuffer<uint8_t> rcac;
+    VerifyOrReturnError(noc.Alloc(Credentials::kMaxDERCertLength), CHIP_ERROR_NO_MEMORY);
+    VerifyOrReturnError(icac.Alloc(Credentials::kMaxDERCertLength), CHIP_ERROR_NO_MEMORY);
+    VerifyOrReturnError(rcac.Alloc(Credentials::kMaxDERCertLength), CHIP_ERROR_NO_MEMORY);
+
+    MutableByteSpan nocSpan(noc.Get(), Credentials::kMaxDERCertLength);
+    MutableByteSpan icacSpan(icac.Get(), Credentials::kMaxDERCertLength);
+    MutableByteSpan rcacSpan(rcac.Get(), Credentials::kMaxDERCertLength);
+
+    // The operational key is generated by the node itself, as if it had answered a CSR request during commissioning.
+    ReturnErrorOnFailure(mOperationalKeypair.Initialize());
+    ReturnErrorOnFailure(issuer.GenerateNOCChainAfterValidation(mParams.nodeId, mParams.fabricId, CATValues{},
+                                                                mOperationalKeypair.Pubkey(), rcacSpan, icacSpan, nocSpan));
+
+    ReturnErrorOnFailure(mFabricTable.AddNewPendingTrustedRootCert(rcacSpan));
+    ReturnErrorOnFailure(mFabricTable.AddNewPendingFabricWithProvidedOpKey(nocSpan, icacSpan, to_underlying(mParams.vendorId),
+                                                                           &mOperationalKeypair, true /* externally owned */,
+                                                                           &mFabricIndex));
+    ReturnErrorOnFailure(mFabricTable.CommitPendingFabricData());
+
+    // Use the same IPK as the controllers of chip-tool, for CASE to derive the same session keys on both ends.
+    const FabricInfo * fabricInfo = mFabricTable.FindFabricWithIndex(mFabricIndex);
+    VerifyOrReturnError(fabricInfo != nullptr, CHIP_ERROR_INTERNAL);
+
+    uint8_t compressedFabricId[sizeof(uint64_t)];
+    MutableByteSpan compressedFabricIdSpan(compressedFabricId);
+    ReturnErrorOnFailure(fabricInfo->GetCompressedFabricIdBytes(compressedFabricIdSpan));
+    return Credentials::SetSingleIpkEpochKey(&mGroupDataProvider, mFabricIndex, GroupTesting::DefaultIpkValue::GetDefaultIpk(),
+                                             compressedFabricIdSpan);
+}
+
+CHIP_ERROR FleetNode::Advertise()
+{
+    const FabricInfo * fabricInfo = mFabricTable.FindFabricWithIndex(mFabricIndex);
+    VerifyOrReturnError(fabricInfo != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    // Nodes have no network interface of their own, so a MAC address is made up from the node id for the host name.
+    uint8_t mac[sizeof(NodeId)];
+    Encoding::BigEndian::BufferWriter(mac, sizeof(mac)).Put64(mParams.nodeId);
+
+    const auto params = Dnssd::OperationalAdvertisingParameters()
+                            .SetPeerId(fabricInfo->GetPeerId())
+                            .SetMac(ByteSpan(mac))
+                            .SetPort(mParams.port)
+                            .SetInterfaceId(Inet::InterfaceId::Null())
+                            .SetLocalMRPConfig(GetLocalMRPConfig())
+                            .EnableIpV4(false);
+    return Dnssd::ServiceAdvertiser::Instance().Advertise(params);
+}
+
+void FleetNode::Shutdown()
+{
+    mInteractionServer.Shutdown();
+    mCASEServer.Shutdown();
+    mMessageCounterManager.Shutdown();
+    mExchangeManager.Shutdown();
+    mSessionManager.Shutdown();
+    mTransports.Close();
+    mFabricTable.Shutdown();
+    mGroupDataProvider.Finish();
+    mOpCertStore.Finish();
+}
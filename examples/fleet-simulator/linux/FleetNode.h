@@ -0,0 +1,90 @@
+/*
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include "FleetDataModel.h"
+#include "FleetInteractionServer.h"
+
+#include <controller/ExampleOperationalCredentialsIssuer.h>
+#include <credentials/FabricTable.h>
+#include <credentials/GroupDataProviderImpl.h>
+#include <credentials/PersistentStorageOpCertStore.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <messaging/ExchangeMgr.h>
+#include <protocols/secure_channel/CASEServer.h>
+#include <protocols/secure_channel/MessageCounterManager.h>
+#include <protocols/secure_channel/SimpleSessionResumptionStorage.h>
+#include <transport/SessionManager.h>
+#include <transport/TransportMgr.h>
+#include <transport/raw/UDP.h>
+
+/**
+ * A virtual node of the fleet: an operational identity on a fabric, reachable over CASE on its own UDP port, with its
+ * own session, exchange and subscription state in front of a FleetDataModel.
+ *
+ * Nodes are already commissioned when they start: their operational certificates are issued directly by the
+ * commissioner of the fabric, so controllers benchmark against them without pairing a thousand devices first.
+ * Everything a node stores lives in memory and is lost when the process exits.
+ */
+class FleetNode
+{
+public:
+    struct Params
+    {
+        chip::NodeId nodeId     = chip::kUndefinedNodeId;
+        chip::FabricId fabricId = chip::kUndefinedFabricId;
+        chip::VendorId vendorId = chip::VendorId::TestVendor1;
+        uint16_t productId      = 0;
+        uint16_t port           = 0;
+    };
+
+    CHIP_ERROR Init(const Params & params, chip::Controller::ExampleOperationalCredentialsIssuer & issuer);
+    void Shutdown();
+
+    /**
+     * Advertise the operational service of the node. The caller finalizes the service update once every node of the
+     * fleet has been advertised.
+     */
+    CHIP_ERROR Advertise();
+
+    chip::NodeId GetNodeId() const { return mParams.nodeId; }
+    size_t GetSubscriptionCount() const { return mInteractionServer.GetSubscriptionCount(); }
+
+private:
+    CHIP_ERROR InitFabric(chip::Controller::ExampleOperationalCredentialsIssuer & issuer);
+
+    Params mParams;
+    chip::FabricIndex mFabricIndex = chip::kUndefinedFabricIndex;
+
+    chip::TestPersistentStorageDelegate mStorage;
+    chip::Credentials::PersistentStorageOpCertStore mOpCertStore;
+    chip::Crypto::P256Keypair mOperationalKeypair;
+    chip::FabricTable mFabricTable;
+    chip::Credentials::GroupDataProviderImpl mGroupDataProvider;
+    chip::SimpleSessionResumptionStorage mSessionResumptionStorage;
+
+    chip::TransportMgr<chip::Transport::UDP> mTransports;
+    chip::SessionManager mSessionManager;
+    chip::Messaging::ExchangeManager mExchangeManager;
+    chip::secure_channel::MessageCounterManager mMessageCounterManager;
+    chip::CASEServer mCASEServer;
+
+    FleetDataModel mDataModel;
+    FleetInteractionServer mInteractionServer;
+};
@@ -0,0 +1,36 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Project configuration file for the fleet simulator.
+ *
+ *          This file is included both as the project configuration of CHIP
+ *          and as the project configuration of the Inet layer.
+ *
+ */
+
+#pragma once
+
+// include the CHIPProjectConfig from config/standalone
+#include <CHIPProjectConfig.h>
+
+// Every virtual node listens on a UDP endpoint of its own. The select()
+// based system layer cannot watch descriptors beyond FD_SETSIZE (1024),
+// which bounds the number of nodes a single process can host.
+#define INET_CONFIG_NUM_UDP_ENDPOINTS 1016
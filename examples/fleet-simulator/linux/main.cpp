@@ -0,0 +1,245 @@
+/*
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "FleetNode.h"
+
+#include <platform/CHIPDeviceLayer.h>
+#include <platform/PlatformManager.h>
+
+#include <config/PersistentStorage.h>
+#include <controller/ExampleOperationalCredentialsIssuer.h>
+#include <inet/InetConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/dnssd/Advertiser.h>
+#include <lib/support/CHIPArgParser.hpp>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <memory>
+#include <vector>
+
+using chip::ArgParser::HelpOptions;
+using chip::ArgParser::OptionDef;
+using chip::ArgParser::OptionSet;
+using chip::ArgParser::PrintArgError;
+
+namespace {
+
+// Every node listens on a UDP endpoint of its own; the remaining endpoints are left to minimal mDNS, which opens a
+// couple of them per network interface.
+constexpr size_t kReservedUdpEndpoints = 16;
+constexpr uint32_t kMaxNodeCount       = INET_CONFIG_NUM_UDP_ENDPOINTS - kReservedUdpEndpoints;
+
+constexpr chip::System::Clock::Seconds16 kStatsInterval(30);
+
+enum
+{
+    kOption_NodeCount        = 0x1000,
+    kOption_FirstNodeId      = 0x1001,
+    kOption_BasePort         = 0x1002,
+    kOption_FabricId         = 0x1003,
+    kOption_CommissionerName = 0x1004,
+    kOption_VendorId         = 0x1005,
+    kOption_ProductId        = 0x1006,
+};
+
+struct FleetOptions
+{
+    uint32_t nodeCount            = 10;
+    chip::NodeId firstNodeId      = 0x1000;
+    uint16_t basePort             = 5640;
+    chip::FabricId fabricId       = 1;
+    const char * commissionerName = "alpha";
+    uint16_t vendorId             = chip::to_underlying(chip::VendorId::TestVendor1);
+    uint16_t productId            = 0x8001;
+};
+
+FleetOptions gOptions;
+std::vector<std::unique_ptr<FleetNode>> gNodes;
+
+bool HandleOption(const char * aProgram, OptionSet * aOptions, int aIdentifier, const char * aName, const char * aValue)
+{
+    bool retval = true;
+
+    switch (aIdentifier)
+    {
+    case kOption_NodeCount:
+        retval = chip::ArgParser::ParseInt(aValue, gOptions.nodeCount) && gOptions.nodeCount > 0 &&
+            gOptions.nodeCount <= kMaxNodeCount;
+        break;
+    case kOption_FirstNodeId:
+        retval = chip::ArgParser::ParseInt(aValue, gOptions.firstNodeId, 0) && chip::IsOperationalNodeId(gOptions.firstNodeId);
+        break;
+    case kOption_BasePort:
+        retval = chip::ArgParser::ParseInt(aValue, gOptions.basePort) && gOptions.basePort > 0;
+        break;
+    case kOption_FabricId:
+        retval = chip::ArgParser::ParseInt(aValue, gOptions.fabricId, 0) && gOptions.fabricId != chip::kUndefinedFabricId;
+        break;
+    case kOption_CommissionerName:
+        gOptions.commissionerName = aValue;
+        break;
+    case kOption_VendorId:
+        retval = chip::ArgParser::ParseInt(aValue, gOptions.vendorId, 0);
+        break;
+    case kOption_ProductId:
+        retval = chip::ArgParser::ParseInt(aValue, gOptions.productId, 0);
+        break;
+    default:
+        PrintArgError("%s: INTERNAL ERROR: Unhandled option: %s\n", aProgram, aName);
+        return false;
+    }
+
+    if (!retval)
+    {
+        PrintArgError("%s: invalid value specified for %s: %s\n", aProgram, aName, aValue);
+    }
+    return retval;
+}
+
+OptionDef sOptionDefs[] = {
+    { "node-count", chip::ArgParser::kArgumentRequired, kOption_NodeCount },
+    { "first-node-id", chip::ArgParser::kArgumentRequired, kOption_FirstNodeId },
+    { "base-port", chip::ArgParser::kArgumentRequired, kOption_BasePort },
+    { "fabric-id", chip::ArgParser::kArgumentRequired, kOption_FabricId },
+    { "commissioner-name", chip::ArgParser::kArgumentRequired, kOption_CommissionerName },
+    { "vendor-id", chip::ArgParser::kArgumentRequired, kOption_VendorId },
+    { "product-id", chip::ArgParser::kArgumentRequired, kOption_ProductId },
+    {},
+};
+
+const char * sOptionHelp = "  --node-count <count>\n"
+                           "       The number of nodes to simulate, 10 by default. A process hosts at most one node per UDP\n"
+                           "       endpoint of the Inet layer: run several processes for larger fleets.\n"
+                           "\n"
+                           "  --first-node-id <id>\n"
+                           "       The node id of the first node, 0x1000 by default. Nodes get consecutive node ids.\n"
+                           "\n"
+                           "  --base-port <port>\n"
+                           "       The UDP port of the first node, 5640 by default. Nodes get consecutive ports.\n"
+                           "\n"
+                           "  --fabric-id <id>\n"
+                           "       The fabric the nodes are commissioned into, 1 by default as for the alpha identity of\n"
+                           "       chip-tool.\n"
+                           "\n"
+                           "  --commissioner-name <name>\n"
+                           "       The chip-tool commissioner whose root certificate issues the node certificates, alpha by\n"
+                           "       default. chip-tool must have run once with that identity to create its keys.\n"
+                           "\n"
+                           "  --vendor-id <id>\n"
+                           "  --product-id <id>\n"
+                           "       The Vendor ID and Product ID reported by the Basic Information cluster of the nodes.\n"
+                           "\n";
+
+OptionSet sFleetOptions = { HandleOption, sOptionDefs, "FLEET OPTIONS", sOptionHelp };
+
+HelpOptions sHelpOptions("chip-fleet-simulator", "Usage: chip-fleet-simulator [options]", "1.0");
+
+OptionSet * sAllOptions[] = { &sFleetOptions, &sHelpOptions, nullptr };
+
+void LogStats(chip::System::Layer * layer, void * context)
+{
+    size_t subscriptionCount = 0;
+    for (const auto & node : gNodes)
+    {
+        subscriptionCount += node->GetSubscriptionCount();
+    }
+    ChipLogProgress(NotSpecified, "Fleet of %u nodes serving %u subscriptions", static_cast<unsigned>(gNodes.size()),
+                    static_cast<unsigned>(subscriptionCount));
+
+    layer->StartTimer(kStatsInterval, LogStats, context);
+}
+
+CHIP_ERROR StartFleet()
+{
+    VerifyOrReturnError(gOptions.basePort + gOptions.nodeCount - 1 <= UINT16_MAX, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(chip::IsOperationalNodeId(gOptions.firstNodeId + gOptions.nodeCount - 1), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The operational certificates of the nodes chain to the root of the chip-tool commissioner, so chip-tool
+    // establishes CASE with them without commissioning them first.
+    static PersistentStorage commissionerStorage;
+    static chip::Controller::ExampleOperationalCredentialsIssuer issuer;
+    ReturnErrorOnFailure(commissionerStorage.Init(gOptions.commissionerName));
+    ReturnErrorOnFailure(issuer.Initialize(commissionerStorage));
+
+    auto & advertiser = chip::Dnssd::ServiceAdvertiser::Instance();
+    ReturnErrorOnFailure(advertiser.Init(chip::DeviceLayer::UDPEndPointManager()));
+    ReturnErrorOnFailure(advertiser.RemoveServices());
+
+    gNodes.reserve(gOptions.nodeCount);
+    for (uint32_t i = 0; i < gOptions.nodeCount; i++)
+    {
+        FleetNode::Params params;
+        params.nodeId    = gOptions.firstNodeId + i;
+        params.fabricId  = gOptions.fabricId;
+        params.vendorId  = static_cast<chip::VendorId>(gOptions.vendorId);
+        params.productId = gOptions.productId;
+        params.port      = static_cast<uint16_t>(gOptions.basePort + i);
+
+        auto node      = std::make_unique<FleetNode>();
+        CHIP_ERROR err = node->Init(params, issuer);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(NotSpecified, "Failed to start node 0x" ChipLogFormatX64 " on port %u: %" CHIP_ERROR_FORMAT,
+                         ChipLogValueX64(params.nodeId), params.port, err.Format());
+            node->Shutdown();
+            return err;
+        }
+        ReturnErrorOnFailure(node->Advertise());
+        gNodes.push_back(std::move(node));
+    }
+    ReturnErrorOnFailure(advertiser.FinalizeServiceUpdate());
+
+    const chip::NodeId lastNodeId = gOptions.firstNodeId + gOptions.nodeCount - 1;
+    ChipLogProgress(NotSpecified, "Started %u nodes 0x" ChipLogFormatX64 " to 0x" ChipLogFormatX64 " on ports %u to %u",
+                    static_cast<unsigned>(gOptions.nodeCount), ChipLogValueX64(gOptions.firstNodeId), ChipLogValueX64(lastNodeId),
+                    gOptions.basePort, static_cast<unsigned>(gOptions.basePort + gOptions.nodeCount - 1));
+    return chip::DeviceLayer::SystemLayer().StartTimer(kStatsInterval, LogStats, nullptr);
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    if (chip::Platform::MemoryInit() != CHIP_NO_ERROR)
+    {
+        fprintf(stderr, "FAILED to initialize memory\n");
+        return 1;
+    }
+
+    if (chip::DeviceLayer::PlatformMgr().InitChipStack() != CHIP_NO_ERROR)
+    {
+        fprintf(stderr, "FAILED to initialize chip stack\n");
+        return 1;
+    }
+
+    if (!chip::ArgParser::ParseArgs(argv[0], argc, argv, sAllOptions))
+    {
+        return 1;
+    }
+
+    CHIP_ERROR err = StartFleet();
+    if (err != CHIP_NO_ERROR)
+    {
+        fprintf(stderr, "FAILED to start the fleet: %s\n", chip::ErrorStr(err));
+        return 1;
+    }
+
+    chip::DeviceLayer::PlatformMgr().RunEventLoop();
+
+    return 0;
+}
@@ -23,6 +23,7 @@
 #include <app/util/util.h>
 #include <json/json.h>
 #include <ota-provider-common/BdxOtaSender.h>
+#include <ota-provider-common/BdxOtaSenderPool.h>
 #include <ota-provider-common/OTAProviderExample.h>
 
 #include "AppMain.h"
@@ -44,9 +45,11 @@ using namespace chip::app::Clusters::OtaSoftwareUpdateProvider;
 constexpr chip::EndpointId kOtaProviderEndpoint = 0;
 
 constexpr uint16_t kOptionUpdateAction              = 'a';
+constexpr uint16_t kOptionBusyDelaySec              = 'b';
 constexpr uint16_t kOptionUserConsentNeeded         = 'c';
 constexpr uint16_t kOptionFilepath                  = 'f';
 constexpr uint16_t kOptionImageUri                  = 'i';
+constexpr uint16_t kOptionMaxConcurrentTransfers    = 'm';
 constexpr uint16_t kOptionOtaImageList              = 'o';
 constexpr uint16_t kOptionDelayedApplyActionTimeSec = 'p';
 constexpr uint16_t kOptionQueryImageStatus          = 'q';
@@ -58,6 +61,7 @@ constexpr uint16_t kOptionPollInterval              = 'P';
 
 OTAProviderExample gOtaProvider;
 chip::ota::DefaultOTAProviderUserConsent gUserConsentProvider;
+BdxOtaSenderPool gBdxOtaSenderPool;
 
 // Global variables used for passing the CLI arguments to the OTAProviderExample object
 static OTAQueryStatus gQueryImageStatus              = OTAQueryStatus::kUpdateAvailable;
@@ -72,6 +76,8 @@ static bool gUserConsentNeeded                       = false;
 static uint32_t gIgnoreQueryImageCount               = 0;
 static uint32_t gIgnoreApplyUpdateCount              = 0;
 static uint32_t gPollInterval                        = 0;
+static uint16_t gMaxConcurrentTransfers              = 1;
+static uint32_t gBusyDelaySec                        = BdxOtaSenderPool::kDefaultBusyDelaySec;
 
 // Parses the JSON filepath and extracts DeviceSoftwareVersionModel parameters
 static bool ParseJsonFileAndPopulateCandidates(const char * filepath,
@@ -246,6 +252,22 @@ bool HandleOptions(const char * aProgram, OptionSet * aOptions, int aIdentifier,
     case kOptionPollInterval:
         gPollInterval = static_cast<uint32_t>(strtoul(aValue, NULL, 0));
         break;
+    case kOptionMaxConcurrentTransfers: {
+        unsigned long value = strtoul(aValue, NULL, 0);
+        if (value == 0 || value > UINT16_MAX)
+        {
+            PrintArgError("%s: ERROR: Invalid maxConcurrentTransfers parameter:  %s\n", aProgram, aValue);
+            retval = false;
+        }
+        else
+        {
+            gMaxConcurrentTransfers = static_cast<uint16_t>(value);
+        }
+        break;
+    }
+    case kOptionBusyDelaySec:
+        gBusyDelaySec = static_cast<uint32_t>(strtoul(aValue, NULL, 0));
+        break;
 
     default:
         PrintArgError("%s: INTERNAL ERROR: Unhandled option: %s\n", aProgram, aName);
@@ -258,9 +280,11 @@ bool HandleOptions(const char * aProgram, OptionSet * aOptions, int aIdentifier,
 
 OptionDef cmdLineOptionsDef[] = {
     { "applyUpdateAction", chip::ArgParser::kArgumentRequired, kOptionUpdateAction },
+    { "busyDelaySec", chip::ArgParser::kArgumentRequired, kOptionBusyDelaySec },
     { "userConsentNeeded", chip::ArgParser::kNoArgument, kOptionUserConsentNeeded },
     { "filepath", chip::ArgParser::kArgumentRequired, kOptionFilepath },
     { "imageUri", chip::ArgParser::kArgumentRequired, kOptionImageUri },
+    { "maxConcurrentTransfers", chip::ArgParser::kArgumentRequired, kOptionMaxConcurrentTransfers },
     { "otaImageList", chip::ArgParser::kArgumentRequired, kOptionOtaImageList },
     { "delayedApplyActionTimeSec", chip::ArgParser::kArgumentRequired, kOptionDelayedApplyActionTimeSec },
     { "queryImageStatus", chip::ArgParser::kArgumentRequired, kOptionQueryImageStatus },
@@ -276,6 +300,10 @@ OptionSet cmdLineOptions = { HandleOptions, cmdLineOptionsDef, "PROGRAM OPTIONS"
                              "  -a, --applyUpdateAction <proceed | awaitNextAction | discontinue>\n"
                              "        Value for the Action field in the first ApplyUpdateResponse.\n"
                              "        For all subsequent responses, the value of proceed will be used.\n"
+                             "  -b, --busyDelaySec <time in seconds>\n"
+                             "        Base value for the DelayedActionTime field of QueryImageResponses sent when\n"
+                             "        --maxConcurrentTransfers transfers are already in progress. Requestors deferred\n"
+                             "        later are given multiples of this delay so that their retries are spread out.\n"
                              "  -c, --userConsentNeeded\n"
                              "        If supplied, value of the UserConsentNeeded field in the QueryImageResponse\n"
                              "        is set to true. This is only applicable if value of the RequestorCanConsent\n"
@@ -286,6 +314,8 @@ OptionSet cmdLineOptions = { HandleOptions, cmdLineOptionsDef, "PROGRAM OPTIONS"
                              "  -i, --imageUri <uri>\n"
                              "        Value for the ImageURI field in the QueryImageResponse.\n"
                              "        If none is supplied, a valid URI is generated.\n"
+                             "  -m, --maxConcurrentTransfers <count>\n"
+                             "        Maximum number of BDX transfers served at the same time. Defaults to 1.\n"
                              "  -o, --otaImageList <file path>\n"
                              "        Path to a file containing a list of OTA images\n"
                              "  -p, --delayedApplyActionTimeSec <time in seconds>\n"
@@ -317,10 +347,21 @@ void ApplicationInit()
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
 
-    BdxOtaSender * bdxOtaSender = gOtaProvider.GetBdxOtaSender();
-    VerifyOrReturn(bdxOtaSender != nullptr);
+    chip::Messaging::UnsolicitedMessageHandler * bdxHandler = gOtaProvider.GetBdxOtaSender();
+    if (gMaxConcurrentTransfers > 1)
+    {
+        err = gBdxOtaSenderPool.Init(&chip::DeviceLayer::SystemLayer(), gMaxConcurrentTransfers, gBusyDelaySec);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(SoftwareUpdate, "Cannot initialize BDX sender pool: %" CHIP_ERROR_FORMAT, err.Format());
+            return;
+        }
+        gOtaProvider.SetTransferAdmission(&gBdxOtaSenderPool);
+        bdxHandler = &gBdxOtaSenderPool;
+    }
+
     err = chip::Server::GetInstance().GetExchangeManager().RegisterUnsolicitedMessageHandlerForProtocol(chip::Protocols::BDX::Id,
-                                                                                                        bdxOtaSender);
+                                                                                                        bdxHandler);
     if (err != CHIP_NO_ERROR)
     {
         ChipLogDetail(SoftwareUpdate, "RegisterUnsolicitedMessageHandler failed: %s", chip::ErrorStr(err));
@@ -24,8 +24,6 @@
 #include <messaging/Flags.h>
 #include <protocols/bdx/BdxTransferSession.h>
 
-#include <fstream>
-
 using chip::bdx::StatusCode;
 using chip::bdx::TransferControlFlags;
 using chip::bdx::TransferSession;
@@ -122,8 +120,32 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
         memcpy(mFileDesignator, fd, fdl);
         mFileDesignator[fdl] = 0;
 
+        // The image is mapped once and shared with every other transfer serving the same file
+        mImage = OTAImageCache::Instance().Acquire(mFileDesignator);
+        if (mImage == nullptr)
+        {
+            ChipLogError(BDX, "OTA file open failed");
+            mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown);
+        }
+
         break;
     }
+    case TransferSession::OutputEventType::kQueryWithSkipReceived: {
+        // A requestor resuming an interrupted download skips the part of the image it already has. Skipping up to the end of the
+        // image yields an empty last block.
+        uint64_t remaining = 0;
+        if (mImage != nullptr && mImage->GetData().size() > mTransfer.GetStartOffset() + mNumBytesSent)
+        {
+            remaining = mImage->GetData().size() - mTransfer.GetStartOffset() - mNumBytesSent;
+        }
+        if (mTransfer.GetTransferLength() > 0)
+        {
+            remaining = chip::min(remaining, mTransfer.GetTransferLength() - mNumBytesSent);
+        }
+        mNumBytesSent = static_cast<uint32_t>(mNumBytesSent + chip::min(event.bytesToSkip.BytesToSkip, remaining));
+        ChipLogDetail(BDX, "Skipping to offset %" PRIu32, mNumBytesSent);
+    }
+        FALLTHROUGH;
     case TransferSession::OutputEventType::kQueryReceived: {
         TransferSession::BlockData blockData;
         uint16_t blockSize   = mTransfer.GetTransferBlockSize();
@@ -136,37 +158,29 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
             bytesToRead = static_cast<uint16_t>(mTransfer.GetTransferLength() - mNumBytesSent);
         }
 
-        chip::System::PacketBufferHandle blockBuf = chip::System::PacketBufferHandle::New(bytesToRead);
-        if (blockBuf.IsNull())
-        {
-            // TODO(#13981): AbortTransfer() needs to support GeneralStatusCode failures as well as BDX specific errors.
-            mTransfer.AbortTransfer(StatusCode::kUnknown);
-            return;
-        }
+        VerifyOrReturn(mImage != nullptr, mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown));
 
-        std::ifstream otaFile(mFileDesignator, std::ifstream::in);
-        if (!otaFile.good())
+        chip::ByteSpan image = mImage->GetData();
+        uint64_t offset      = mTransfer.GetStartOffset() + mNumBytesSent;
+        if (offset > image.size())
         {
-            ChipLogError(BDX, "OTA file open failed");
+            ChipLogError(BDX, "OTA file read failed");
             mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown);
             return;
         }
-
-        otaFile.seekg(mNumBytesSent);
-        otaFile.read(reinterpret_cast<char *>(blockBuf->Start()), bytesToRead);
-        if (!(otaFile.good() || otaFile.eof()))
+        if (bytesToRead > image.size() - offset)
         {
-            ChipLogError(BDX, "OTA file read failed");
-            mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown);
-            return;
+            // cast should be safe because of condition above
+            bytesToRead = static_cast<uint16_t>(image.size() - offset);
         }
 
-        blockData.Data   = blockBuf->Start();
-        blockData.Length = static_cast<size_t>(otaFile.gcount());
+        // TransferSession copies the block into its outgoing message, so it can be read straight from the shared mapping
+        blockData.Data   = image.data() + offset;
+        blockData.Length = bytesToRead;
         blockData.IsEof  = (blockData.Length < blockSize) ||
-            (mNumBytesSent + static_cast<uint64_t>(blockData.Length) == mTransfer.GetTransferLength() || (otaFile.peek() == EOF));
+            (mNumBytesSent + static_cast<uint64_t>(blockData.Length) == mTransfer.GetTransferLength() ||
+             (offset + blockData.Length == image.size()));
         mNumBytesSent = static_cast<uint32_t>(mNumBytesSent + blockData.Length);
-        otaFile.close();
 
         err = mTransfer.PrepareBlock(blockData);
         if (err != CHIP_NO_ERROR)
@@ -209,6 +223,8 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
  */
 void BdxOtaSender::Reset()
 {
+    bool wasInUse = mInitialized;
+
     mFabricIndex.ClearValue();
     mNodeId.ClearValue();
     Responder::ResetTransfer();
@@ -218,7 +234,18 @@ void BdxOtaSender::Reset()
         mExchangeCtx = nullptr;
     }
 
+    if (mImage != nullptr)
+    {
+        OTAImageCache::Instance().Release(mImage);
+        mImage = nullptr;
+    }
+
     mInitialized  = false;
     mNumBytesSent = 0;
     memset(mFileDesignator, 0, chip::bdx::kMaxFileDesignatorLen);
+
+    if (wasInUse && mTransferEndedHandler != nullptr)
+    {
+        mTransferEndedHandler(this, mTransferEndedContext);
+    }
 }
@@ -15,6 +15,7 @@
  *    limitations under the License.
  */
 
+#include <ota-provider-common/OTAImageCache.h>
 #include <protocols/bdx/BdxTransferSession.h>
 #include <protocols/bdx/TransferFacilitator.h>
 
@@ -25,18 +26,43 @@ class BdxOtaSender : public chip::bdx::Responder
 public:
     BdxOtaSender();
 
+    // Called whenever a transfer that was initialized with InitializeTransfer() ends, successfully or not.
+    using TransferEndedHandler = void (*)(BdxOtaSender * sender, void * context);
+
     // Initializes BDX transfer-related metadata. Should always be called first.
     CHIP_ERROR InitializeTransfer(chip::FabricIndex fabricIndex, chip::NodeId nodeId);
 
+    void SetTransferEndedHandler(TransferEndedHandler handler, void * context)
+    {
+        mTransferEndedHandler = handler;
+        mTransferEndedContext = context;
+    }
+
+    // Whether InitializeTransfer() has been called and the transfer has not ended yet.
+    bool IsInUse() const { return mInitialized; }
+
+    // Whether the requestor has sent its ReceiveInit, as opposed to a transfer that is only reserved.
+    bool HasTransferStarted() const { return mImage != nullptr; }
+
+    bool IsServing(chip::FabricIndex fabricIndex, chip::NodeId nodeId) const
+    {
+        return mInitialized && mFabricIndex.ValueOr(chip::kUndefinedFabricIndex) == fabricIndex &&
+            mNodeId.ValueOr(chip::kUndefinedNodeId) == nodeId;
+    }
+
+    // Ends the current transfer, if any.
+    void Reset();
+
 private:
     // Inherited from bdx::TransferFacilitator
     void HandleTransferSessionOutput(chip::bdx::TransferSession::OutputEvent & event) override;
 
-    void Reset();
-
     // Null-terminated string representing file designator
     char mFileDesignator[chip::bdx::kMaxFileDesignatorLen];
 
+    // Image being served, shared with every other transfer of the same file
+    const OTAImageCache::Image * mImage = nullptr;
+
     uint32_t mNumBytesSent = 0;
 
     bool mInitialized = false;
@@ -44,4 +70,7 @@ private:
     chip::Optional<chip::FabricIndex> mFabricIndex;
 
     chip::Optional<chip::NodeId> mNodeId;
+
+    TransferEndedHandler mTransferEndedHandler = nullptr;
+    void * mTransferEndedContext               = nullptr;
 };
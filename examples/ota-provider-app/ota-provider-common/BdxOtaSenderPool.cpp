@@ -0,0 +1,185 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <ota-provider-common/BdxOtaSenderPool.h>
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/ScopedNodeId.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <messaging/ExchangeContext.h>
+
+using chip::BitFlags;
+using chip::FabricIndex;
+using chip::NodeId;
+using chip::bdx::TransferControlFlags;
+
+constexpr uint16_t BdxOtaSenderPool::kDefaultMaxConcurrentTransfers;
+constexpr uint32_t BdxOtaSenderPool::kDefaultBusyDelaySec;
+
+CHIP_ERROR BdxOtaSenderPool::Init(chip::System::Layer * systemLayer, uint16_t maxConcurrentTransfers, uint32_t busyDelaySec)
+{
+    VerifyOrReturnError(systemLayer != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(maxConcurrentTransfers > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mSlots.empty(), CHIP_ERROR_INCORRECT_STATE);
+
+    mSystemLayer = systemLayer;
+    mPacer.Init(maxConcurrentTransfers, busyDelaySec);
+
+    mSlots.resize(maxConcurrentTransfers);
+    for (auto & slot : mSlots)
+    {
+        slot.sender.reset(new BdxOtaSender());
+        slot.sender->SetTransferEndedHandler(HandleTransferEnded, this);
+    }
+
+    ChipLogProgress(BDX, "Serving up to %u concurrent OTA transfers", static_cast<unsigned>(maxConcurrentTransfers));
+    return CHIP_NO_ERROR;
+}
+
+void BdxOtaSenderPool::Shutdown()
+{
+    for (auto & slot : mSlots)
+    {
+        slot.sender->Reset();
+    }
+    mSlots.clear();
+    mSystemLayer = nullptr;
+}
+
+CHIP_ERROR BdxOtaSenderPool::ReserveTransfer(FabricIndex fabricIndex, NodeId nodeId, uint16_t maxBlockSize,
+                                             chip::System::Clock::Timeout timeout, chip::System::Clock::Timeout pollFreq,
+                                             uint32_t & delayedActionTimeSec)
+{
+    VerifyOrReturnError(mSystemLayer != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    ReclaimStaleReservations();
+
+    // A requestor querying again abandons the transfer it may still hold
+    Slot * slot = FindSlot(fabricIndex, nodeId);
+    if (slot != nullptr)
+    {
+        slot->sender->Reset();
+    }
+
+    if (!mPacer.TryAdmit(delayedActionTimeSec))
+    {
+        ChipLogProgress(BDX, "%u transfers in progress, deferring node " ChipLogFormatX64 " by %" PRIu32 "s",
+                        static_cast<unsigned>(mPacer.GetActiveTransfers()), ChipLogValueX64(nodeId), delayedActionTimeSec);
+        return CHIP_ERROR_BUSY;
+    }
+
+    slot = FindFreeSlot();
+    if (slot == nullptr)
+    {
+        // The pacer admits no more transfers than there are slots
+        mPacer.OnTransferEnded();
+        return CHIP_ERROR_INTERNAL;
+    }
+
+    CHIP_ERROR err = slot->sender->InitializeTransfer(fabricIndex, nodeId);
+    if (err != CHIP_NO_ERROR)
+    {
+        mPacer.OnTransferEnded();
+        return err;
+    }
+
+    BitFlags<TransferControlFlags> bdxFlags;
+    bdxFlags.Set(TransferControlFlags::kReceiverDrive);
+    err = slot->sender->PrepareForTransfer(mSystemLayer, chip::bdx::TransferRole::kSender, bdxFlags, maxBlockSize, timeout,
+                                           pollFreq);
+    if (err != CHIP_NO_ERROR)
+    {
+        // Releases the admission through HandleTransferEnded()
+        slot->sender->Reset();
+        return err;
+    }
+
+    slot->reservedUntil = chip::System::SystemClock().GetMonotonicTimestamp() + timeout;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BdxOtaSenderPool::OnUnsolicitedMessageReceived(const chip::PayloadHeader & payloadHeader,
+                                                          chip::Messaging::ExchangeDelegate *& newDelegate)
+{
+    // The sender serving the exchange is only known once the exchange, and so the peer, exists
+    newDelegate = this;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR BdxOtaSenderPool::OnMessageReceived(chip::Messaging::ExchangeContext * ec, const chip::PayloadHeader & payloadHeader,
+                                               chip::System::PacketBufferHandle && payload)
+{
+    VerifyOrReturnError(ec != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    chip::ScopedNodeId peer = ec->GetSessionHandle()->GetPeer();
+    Slot * slot             = FindSlot(peer.GetFabricIndex(), peer.GetNodeId());
+    if (slot == nullptr)
+    {
+        ChipLogError(BDX, "No OTA transfer reserved for node " ChipLogFormatX64, ChipLogValueX64(peer.GetNodeId()));
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
+
+    // The sender owns the exchange for the rest of the transfer
+    chip::Messaging::ExchangeDelegate * sender = slot->sender.get();
+    ec->SetDelegate(sender);
+    return sender->OnMessageReceived(ec, payloadHeader, std::move(payload));
+}
+
+void BdxOtaSenderPool::HandleTransferEnded(BdxOtaSender * sender, void * context)
+{
+    VerifyOrReturn(context != nullptr);
+    static_cast<BdxOtaSenderPool *>(context)->mPacer.OnTransferEnded();
+}
+
+BdxOtaSenderPool::Slot * BdxOtaSenderPool::FindSlot(FabricIndex fabricIndex, NodeId nodeId)
+{
+    for (auto & slot : mSlots)
+    {
+        if (slot.sender->IsServing(fabricIndex, nodeId))
+        {
+            return &slot;
+        }
+    }
+    return nullptr;
+}
+
+BdxOtaSenderPool::Slot * BdxOtaSenderPool::FindFreeSlot()
+{
+    for (auto & slot : mSlots)
+    {
+        if (!slot.sender->IsInUse())
+        {
+            return &slot;
+        }
+    }
+    return nullptr;
+}
+
+void BdxOtaSenderPool::ReclaimStaleReservations()
+{
+    chip::System::Clock::Timestamp now = chip::System::SystemClock().GetMonotonicTimestamp();
+    for (auto & slot : mSlots)
+    {
+        // Admitted requestors that never started their download would otherwise hold their slot forever
+        if (slot.sender->IsInUse() && !slot.sender->HasTransferStarted() && now > slot.reservedUntil)
+        {
+            ChipLogProgress(BDX, "Reclaiming unused OTA transfer reservation");
+            slot.sender->Reset();
+        }
+    }
+}
@@ -0,0 +1,88 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <messaging/ExchangeDelegate.h>
+#include <ota-provider-common/BdxOtaSender.h>
+#include <ota-provider-common/OTAProviderExample.h>
+#include <ota-provider-common/OTATransferPacer.h>
+#include <system/SystemClock.h>
+
+#include <memory>
+#include <vector>
+
+/**
+ * Serves several BDX transfers at once, one BdxOtaSender per requestor, up to a configurable limit.
+ *
+ * The pool is registered as the unsolicited message handler for the BDX protocol. Incoming ReceiveInit messages are routed to the
+ * sender reserved for the requesting node when its QueryImage was admitted. Requestors that cannot be admitted are paced through
+ * the QueryImageResponse DelayedActionTime (see OTATransferPacer). All senders serving the same file share a single mapping of it
+ * (see OTAImageCache).
+ */
+class BdxOtaSenderPool : public OTAProviderExample::TransferAdmission,
+                         public chip::Messaging::UnsolicitedMessageHandler,
+                         public chip::Messaging::ExchangeDelegate
+{
+public:
+    static constexpr uint16_t kDefaultMaxConcurrentTransfers = 8;
+    static constexpr uint32_t kDefaultBusyDelaySec           = 30;
+
+    /**
+     * @param[in] systemLayer             The layer used to poll the transfer sessions
+     * @param[in] maxConcurrentTransfers  Maximum number of transfers served at the same time
+     * @param[in] busyDelaySec            DelayedActionTime handed to the first requestors that cannot be admitted. Requestors
+     *                                    deferred later are given multiples of this delay.
+     */
+    CHIP_ERROR Init(chip::System::Layer * systemLayer, uint16_t maxConcurrentTransfers = kDefaultMaxConcurrentTransfers,
+                    uint32_t busyDelaySec = kDefaultBusyDelaySec);
+    void Shutdown();
+
+    //////////// OTAProviderExample::TransferAdmission Implementation ///////////////
+    CHIP_ERROR ReserveTransfer(chip::FabricIndex fabricIndex, chip::NodeId nodeId, uint16_t maxBlockSize,
+                               chip::System::Clock::Timeout timeout, chip::System::Clock::Timeout pollFreq,
+                               uint32_t & delayedActionTimeSec) override;
+
+    uint16_t GetActiveTransfers() const { return mPacer.GetActiveTransfers(); }
+
+private:
+    struct Slot
+    {
+        std::unique_ptr<BdxOtaSender> sender;
+        // Deadline for the requestor to start the transfer, after which the reservation is reclaimed
+        chip::System::Clock::Timestamp reservedUntil;
+    };
+
+    //////////// UnsolicitedMessageHandler Implementation ///////////////
+    CHIP_ERROR OnUnsolicitedMessageReceived(const chip::PayloadHeader & payloadHeader,
+                                            chip::Messaging::ExchangeDelegate *& newDelegate) override;
+
+    //////////// ExchangeDelegate Implementation ///////////////
+    CHIP_ERROR OnMessageReceived(chip::Messaging::ExchangeContext * ec, const chip::PayloadHeader & payloadHeader,
+                                 chip::System::PacketBufferHandle && payload) override;
+    void OnResponseTimeout(chip::Messaging::ExchangeContext * ec) override {}
+
+    static void HandleTransferEnded(BdxOtaSender * sender, void * context);
+
+    Slot * FindSlot(chip::FabricIndex fabricIndex, chip::NodeId nodeId);
+    Slot * FindFreeSlot();
+    void ReclaimStaleReservations();
+
+    chip::System::Layer * mSystemLayer = nullptr;
+    std::vector<Slot> mSlots;
+    OTATransferPacer mPacer;
+};
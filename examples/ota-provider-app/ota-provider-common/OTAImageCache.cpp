@@ -0,0 +1,100 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <ota-provider-common/OTAImageCache.h>
+
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+OTAImageCache & OTAImageCache::Instance()
+{
+    static OTAImageCache sInstance;
+    return sInstance;
+}
+
+const OTAImageCache::Image * OTAImageCache::Acquire(const char * path)
+{
+    for (auto & image : mImages)
+    {
+        if (image.mPath == path)
+        {
+            image.mRefCount++;
+            return &image;
+        }
+    }
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        ChipLogError(BDX, "Cannot open OTA image %s", path);
+        return nullptr;
+    }
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0)
+    {
+        ChipLogError(BDX, "Cannot get size of OTA image %s", path);
+        close(fd);
+        return nullptr;
+    }
+
+    size_t size = static_cast<size_t>(fileStat.st_size);
+    void * data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping stays valid after the descriptor is closed.
+    close(fd);
+
+    if (data == MAP_FAILED)
+    {
+        ChipLogError(BDX, "Cannot map OTA image %s", path);
+        return nullptr;
+    }
+
+    // Transfers read the image front to back.
+    madvise(data, size, MADV_SEQUENTIAL);
+
+    mImages.emplace_back();
+    Image & image   = mImages.back();
+    image.mPath     = path;
+    image.mData     = static_cast<const uint8_t *>(data);
+    image.mSize     = size;
+    image.mRefCount = 1;
+
+    ChipLogDetail(BDX, "Mapped OTA image %s (%u bytes)", path, static_cast<unsigned>(size));
+    return &image;
+}
+
+void OTAImageCache::Release(const Image * image)
+{
+    for (auto it = mImages.begin(); it != mImages.end(); ++it)
+    {
+        if (&(*it) != image)
+        {
+            continue;
+        }
+
+        if (--it->mRefCount == 0)
+        {
+            munmap(const_cast<uint8_t *>(it->mData), it->mSize);
+            mImages.erase(it);
+        }
+        return;
+    }
+}
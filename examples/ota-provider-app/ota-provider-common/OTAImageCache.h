@@ -0,0 +1,73 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/support/Span.h>
+
+#include <list>
+#include <string>
+
+/**
+ * Read-only, reference-counted cache of OTA image files.
+ *
+ * Each image is memory-mapped once and shared by every BDX transfer serving it, so that concurrent transfers do not each open
+ * and re-read the file for every block. The mapping is released when the last transfer using it releases its reference.
+ *
+ * Not thread-safe: must only be used from the CHIP event loop.
+ */
+class OTAImageCache
+{
+public:
+    class Image
+    {
+    public:
+        chip::ByteSpan GetData() const { return chip::ByteSpan(mData, mSize); }
+        const char * GetPath() const { return mPath.c_str(); }
+
+    private:
+        friend class OTAImageCache;
+
+        std::string mPath;
+        const uint8_t * mData = nullptr;
+        size_t mSize          = 0;
+        uint32_t mRefCount    = 0;
+    };
+
+    static OTAImageCache & Instance();
+
+    /**
+     * Return the image stored at the given path, mapping it if it is not already cached. Each successful call must be balanced by
+     * a call to Release().
+     *
+     * @return nullptr if the file cannot be opened or mapped
+     */
+    const Image * Acquire(const char * path);
+
+    /**
+     * Drop a reference obtained from Acquire(). The image is unmapped once no references remain.
+     */
+    void Release(const Image * image);
+
+    /**
+     * Number of images currently mapped.
+     */
+    size_t GetMappedImageCount() const { return mImages.size(); }
+
+private:
+    std::list<Image> mImages;
+};
@@ -228,6 +228,26 @@ bool OTAProviderExample::ParseOTAHeader(OTAImageHeaderParser & parser, const cha
     return true;
 }
 
+CHIP_ERROR OTAProviderExample::PrepareTransfer(app::CommandHandler * commandObj, uint32_t & delayedActionTimeSec)
+{
+    FabricIndex fabricIndex = commandObj->GetSubjectDescriptor().fabricIndex;
+    NodeId nodeId           = commandObj->GetSubjectDescriptor().subject;
+
+    if (mTransferAdmission != nullptr)
+    {
+        return mTransferAdmission->ReserveTransfer(fabricIndex, nodeId, kMaxBdxBlockSize, kBdxTimeout,
+                                                   chip::System::Clock::Milliseconds32(mPollInterval), delayedActionTimeSec);
+    }
+
+    // Without an admission policy, only a single transfer can be served at a time
+    VerifyOrReturnError(mBdxOtaSender.InitializeTransfer(fabricIndex, nodeId) == CHIP_NO_ERROR, CHIP_ERROR_BUSY);
+
+    BitFlags<TransferControlFlags> bdxFlags;
+    bdxFlags.Set(TransferControlFlags::kReceiverDrive);
+    return mBdxOtaSender.PrepareForTransfer(&chip::DeviceLayer::SystemLayer(), chip::bdx::TransferRole::kSender, bdxFlags,
+                                            kMaxBdxBlockSize, kBdxTimeout, chip::System::Clock::Milliseconds32(mPollInterval));
+}
+
 void OTAProviderExample::SendQueryImageResponse(app::CommandHandler * commandObj, const app::ConcreteCommandPath & commandPath,
                                                 const QueryImage::DecodableType & commandData)
 {
@@ -237,6 +257,7 @@ void OTAProviderExample::SendQueryImageResponse(app::CommandHandler * commandObj
     bool requestorCanConsent             = commandData.requestorCanConsent.ValueOr(false);
     uint8_t updateToken[kUpdateTokenLen] = { 0 };
     char strBuf[kUpdateTokenStrLen]      = { 0 };
+    uint32_t delayedActionTimeSec        = mDelayedQueryActionTimeSec;
 
     // Set fields specific for an available status response
     if (mQueryImageStatus == OTAQueryStatus::kUpdateAvailable)
@@ -269,37 +290,31 @@ void OTAProviderExample::SendQueryImageResponse(app::CommandHandler * commandObj
         }
 
         // Initialize the transfer session in prepartion for a BDX transfer
-        BitFlags<TransferControlFlags> bdxFlags;
-        bdxFlags.Set(TransferControlFlags::kReceiverDrive);
-        if (mBdxOtaSender.InitializeTransfer(commandObj->GetSubjectDescriptor().fabricIndex,
-                                             commandObj->GetSubjectDescriptor().subject) == CHIP_NO_ERROR)
+        CHIP_ERROR error = PrepareTransfer(commandObj, delayedActionTimeSec);
+        if (error == CHIP_NO_ERROR)
         {
-            CHIP_ERROR error =
-                mBdxOtaSender.PrepareForTransfer(&chip::DeviceLayer::SystemLayer(), chip::bdx::TransferRole::kSender, bdxFlags,
-                                                 kMaxBdxBlockSize, kBdxTimeout, chip::System::Clock::Milliseconds32(mPollInterval));
-            if (error != CHIP_NO_ERROR)
-            {
-                ChipLogError(SoftwareUpdate, "Cannot prepare for transfer: %" CHIP_ERROR_FORMAT, error.Format());
-                commandObj->AddStatus(commandPath, Status::Failure);
-                return;
-            }
-
             response.imageURI.Emplace(chip::CharSpan::fromCharString(mImageUri));
             response.softwareVersion.Emplace(mSoftwareVersion);
             response.softwareVersionString.Emplace(chip::CharSpan::fromCharString(mSoftwareVersionString));
             response.updateToken.Emplace(chip::ByteSpan(updateToken));
         }
-        else
+        else if (error == CHIP_ERROR_BUSY)
         {
             // Another BDX transfer in progress
             mQueryImageStatus = OTAQueryStatus::kBusy;
         }
+        else
+        {
+            ChipLogError(SoftwareUpdate, "Cannot prepare for transfer: %" CHIP_ERROR_FORMAT, error.Format());
+            commandObj->AddStatus(commandPath, Status::Failure);
+            return;
+        }
     }
 
     // Delay action time is only applicable when the provider is busy
     if (mQueryImageStatus == OTAQueryStatus::kBusy)
     {
-        response.delayedActionTime.Emplace(mDelayedQueryActionTimeSec);
+        response.delayedActionTime.Emplace(delayedActionTimeSec);
     }
 
     // Set remaining fields common to all status types
@@ -42,6 +42,28 @@ public:
     static constexpr size_t kFilepathBufLen      = 256;
     static constexpr size_t kUriMaxLen           = 256;
 
+    /**
+     * Admission control for BDX transfers. When set, QueryImage requests are admitted through it instead of the single built-in
+     * BdxOtaSender, which allows several requestors to download images at the same time.
+     */
+    class TransferAdmission
+    {
+    public:
+        virtual ~TransferAdmission() = default;
+
+        /**
+         * Reserve a BDX transfer for the requestor and prepare it to receive the requestor's ReceiveInit.
+         *
+         * @param[out] delayedActionTimeSec  Set when CHIP_ERROR_BUSY is returned: how long the requestor should wait before
+         *                                   querying again
+         *
+         * @return CHIP_ERROR_BUSY if the maximum number of concurrent transfers is reached
+         */
+        virtual CHIP_ERROR ReserveTransfer(chip::FabricIndex fabricIndex, chip::NodeId nodeId, uint16_t maxBlockSize,
+                                           chip::System::Clock::Timeout timeout, chip::System::Clock::Timeout pollFreq,
+                                           uint32_t & delayedActionTimeSec) = 0;
+    };
+
     typedef struct DeviceSoftwareVersionModel
     {
         chip::VendorId vendorId;
@@ -70,6 +92,7 @@ public:
     void SetOTAFilePath(const char * path);
     void SetImageUri(const char * imageUri);
     BdxOtaSender * GetBdxOtaSender() { return &mBdxOtaSender; }
+    void SetTransferAdmission(TransferAdmission * admission) { mTransferAdmission = admission; }
 
     void SetOTACandidates(std::vector<OTAProviderExample::DeviceSoftwareVersionModel> candidates);
     void SetIgnoreQueryImageCount(uint32_t count) { mIgnoreQueryImageCount = count; }
@@ -108,7 +131,13 @@ private:
     SendQueryImageResponse(chip::app::CommandHandler * commandObj, const chip::app::ConcreteCommandPath & commandPath,
                            const chip::app::Clusters::OtaSoftwareUpdateProvider::Commands::QueryImage::DecodableType & commandData);
 
+    /**
+     * Prepares a BDX transfer for the requestor. Sets mQueryImageStatus to kBusy if the transfer cannot be served right now.
+     */
+    CHIP_ERROR PrepareTransfer(chip::app::CommandHandler * commandObj, uint32_t & delayedActionTimeSec);
+
     BdxOtaSender mBdxOtaSender;
+    TransferAdmission * mTransferAdmission = nullptr;
     std::vector<DeviceSoftwareVersionModel> mCandidates;
     char mOTAFilePath[kFilepathBufLen]; // null-terminated
     char mImageUri[kUriMaxLen];
@@ -0,0 +1,91 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/support/CodeUtils.h>
+
+#include <stdint.h>
+
+/**
+ * Admission control for concurrent OTA transfers.
+ *
+ * At most `maxConcurrentTransfers` transfers are admitted at a time. Requestors that cannot be admitted are told to come back
+ * later through the QueryImageResponse DelayedActionTime. Rather than handing every deferred requestor the same delay (which
+ * makes them all retry at once), deferred requestors are spread over successive retry windows, each window sized to the number
+ * of transfers that can run concurrently.
+ */
+class OTATransferPacer
+{
+public:
+    static constexpr uint32_t kMaxDelayedActionTimeSec = 60 * 60;
+
+    void Init(uint16_t maxConcurrentTransfers, uint32_t busyDelaySec)
+    {
+        mMaxConcurrentTransfers = maxConcurrentTransfers > 0 ? maxConcurrentTransfers : 1;
+        mBusyDelaySec           = busyDelaySec > 0 ? busyDelaySec : 1;
+        mActiveTransfers        = 0;
+        mDeferredRequestors     = 0;
+    }
+
+    /**
+     * Try to admit a new transfer.
+     *
+     * @param[out] delayedActionTimeSec  When the transfer is not admitted, the time the requestor should wait before querying again
+     *
+     * @return true if the transfer was admitted and must later be balanced by a call to OnTransferEnded()
+     */
+    bool TryAdmit(uint32_t & delayedActionTimeSec)
+    {
+        if (mActiveTransfers < mMaxConcurrentTransfers)
+        {
+            mActiveTransfers++;
+            delayedActionTimeSec = 0;
+            return true;
+        }
+
+        uint32_t window = mDeferredRequestors / mMaxConcurrentTransfers;
+        uint64_t delay  = static_cast<uint64_t>(mBusyDelaySec) * (window + 1);
+        delayedActionTimeSec =
+            (delay > kMaxDelayedActionTimeSec) ? static_cast<uint32_t>(kMaxDelayedActionTimeSec) : static_cast<uint32_t>(delay);
+        mDeferredRequestors++;
+        return false;
+    }
+
+    /**
+     * Record the end of an admitted transfer. Each completion lets one deferred requestor move up a retry window.
+     */
+    void OnTransferEnded()
+    {
+        VerifyOrReturn(mActiveTransfers > 0);
+        mActiveTransfers--;
+        if (mDeferredRequestors > 0)
+        {
+            mDeferredRequestors--;
+        }
+    }
+
+    uint16_t GetActiveTransfers() const { return mActiveTransfers; }
+    uint16_t GetMaxConcurrentTransfers() const { return mMaxConcurrentTransfers; }
+    uint32_t GetDeferredRequestors() const { return mDeferredRequestors; }
+
+private:
+    uint16_t mMaxConcurrentTransfers = 1;
+    uint16_t mActiveTransfers        = 0;
+    uint32_t mBusyDelaySec           = 1;
+    uint32_t mDeferredRequestors     = 0;
+};
@@ -0,0 +1,368 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Stress test for serving many OTA requestors at once: a few hundred in-process BDX receivers download the same image
+ *      from a small number of concurrent senders, with admission and retry pacing done by OTATransferPacer and all
+ *      senders reading from the image shared through OTAImageCache.
+ */
+
+#include <ota-provider-common/OTAImageCache.h>
+#include <ota-provider-common/OTATransferPacer.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <protocols/bdx/BdxTransferSession.h>
+#include <transport/raw/MessageHeader.h>
+
+#include <nlunit-test.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace ::chip;
+using namespace ::chip::bdx;
+
+namespace {
+
+constexpr uint32_t kNumRequestors           = 300;
+constexpr uint16_t kMaxConcurrentTransfers  = 8;
+constexpr uint32_t kBusyDelaySec            = 10;
+constexpr uint16_t kBlockSize               = 1024;
+constexpr size_t kImageSize                 = 16 * 1024 + 123;
+constexpr uint32_t kBlocksPerSecond         = 4;
+constexpr uint32_t kMaxSimulatedSeconds     = 24 * 60 * 60;
+constexpr System::Clock::Timestamp kNoTime  = System::Clock::kZero;
+const System::Clock::Timeout kBdxTimeout    = System::Clock::Seconds16(5 * 60);
+
+struct Requestor
+{
+    TransferSession session;
+    std::vector<uint8_t> received;
+    uint32_t nextQuerySec = 0;
+    uint32_t deferrals    = 0;
+    bool done             = false;
+    bool downloading      = false;
+};
+
+struct Sender
+{
+    TransferSession session;
+    const OTAImageCache::Image * image = nullptr;
+    Requestor * requestor              = nullptr;
+    uint64_t bytesSent                 = 0;
+};
+
+// Moves the pending message of one session to the other, as the exchange layer would
+bool Deliver(TransferSession & from, TransferSession & to)
+{
+    TransferSession::OutputEvent event;
+    from.PollOutput(event, kNoTime);
+    VerifyOrReturnValue(event.EventType == TransferSession::OutputEventType::kMsgToSend, false);
+
+    PayloadHeader payloadHeader;
+    payloadHeader.SetMessageType(event.msgTypeData.ProtocolId, event.msgTypeData.MessageType);
+    return to.HandleMessageReceived(payloadHeader, std::move(event.MsgData), kNoTime) == CHIP_NO_ERROR;
+}
+
+bool StartDownload(Requestor & requestor, Sender & sender, const char * imagePath)
+{
+    BitFlags<TransferControlFlags> senderOpts;
+    senderOpts.Set(TransferControlFlags::kReceiverDrive);
+    VerifyOrReturnValue(sender.session.WaitForTransfer(TransferRole::kSender, senderOpts, kBlockSize, kBdxTimeout) ==
+                            CHIP_NO_ERROR,
+                        false);
+
+    TransferSession::TransferInitData initData;
+    initData.TransferCtlFlags = TransferControlFlags::kReceiverDrive;
+    initData.MaxBlockSize     = kBlockSize;
+    initData.FileDesignator   = reinterpret_cast<const uint8_t *>(imagePath);
+    initData.FileDesLength    = static_cast<uint16_t>(strlen(imagePath));
+    VerifyOrReturnValue(requestor.session.StartTransfer(TransferRole::kReceiver, initData, kBdxTimeout) == CHIP_NO_ERROR, false);
+    VerifyOrReturnValue(Deliver(requestor.session, sender.session), false);
+
+    TransferSession::OutputEvent event;
+    sender.session.PollOutput(event, kNoTime);
+    VerifyOrReturnValue(event.EventType == TransferSession::OutputEventType::kInitReceived, false);
+
+    char path[kMaxFileDesignatorLen] = { 0 };
+    VerifyOrReturnValue(event.transferInitData.FileDesLength < sizeof(path), false);
+    memcpy(path, event.transferInitData.FileDesignator, event.transferInitData.FileDesLength);
+    sender.image = OTAImageCache::Instance().Acquire(path);
+    VerifyOrReturnValue(sender.image != nullptr, false);
+
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode  = TransferControlFlags::kReceiverDrive;
+    acceptData.MaxBlockSize = sender.session.GetTransferBlockSize();
+    VerifyOrReturnValue(sender.session.AcceptTransfer(acceptData) == CHIP_NO_ERROR, false);
+    VerifyOrReturnValue(Deliver(sender.session, requestor.session), false);
+
+    requestor.session.PollOutput(event, kNoTime);
+    VerifyOrReturnValue(event.EventType == TransferSession::OutputEventType::kAcceptReceived, false);
+
+    sender.requestor      = &requestor;
+    sender.bytesSent      = 0;
+    requestor.downloading = true;
+    return true;
+}
+
+// Runs one BlockQuery/Block round trip, plus the final BlockAckEOF. Sets `finished` once the image is fully received.
+bool TransferBlock(Sender & sender, bool & finished)
+{
+    Requestor & requestor = *sender.requestor;
+    finished              = false;
+
+    VerifyOrReturnValue(requestor.session.PrepareBlockQuery() == CHIP_NO_ERROR, false);
+    VerifyOrReturnValue(Deliver(requestor.session, sender.session), false);
+
+    TransferSession::OutputEvent event;
+    sender.session.PollOutput(event, kNoTime);
+    VerifyOrReturnValue(event.EventType == TransferSession::OutputEventType::kQueryReceived, false);
+
+    ByteSpan image = sender.image->GetData();
+    size_t length  = chip::min<size_t>(sender.session.GetTransferBlockSize(), image.size() - sender.bytesSent);
+
+    TransferSession::BlockData blockData;
+    blockData.Data   = image.data() + sender.bytesSent;
+    blockData.Length = length;
+    blockData.IsEof  = (sender.bytesSent + length == image.size());
+    sender.bytesSent += length;
+    VerifyOrReturnValue(sender.session.PrepareBlock(blockData) == CHIP_NO_ERROR, false);
+    VerifyOrReturnValue(Deliver(sender.session, requestor.session), false);
+
+    requestor.session.PollOutput(event, kNoTime);
+    VerifyOrReturnValue(event.EventType == TransferSession::OutputEventType::kBlockReceived, false);
+    requestor.received.insert(requestor.received.end(), event.blockdata.Data, event.blockdata.Data + event.blockdata.Length);
+    VerifyOrReturnValue(event.blockdata.IsEof, true);
+
+    VerifyOrReturnValue(requestor.session.PrepareBlockAck() == CHIP_NO_ERROR, false);
+    VerifyOrReturnValue(Deliver(requestor.session, sender.session), false);
+    sender.session.PollOutput(event, kNoTime);
+    VerifyOrReturnValue(event.EventType == TransferSession::OutputEventType::kAckEOFReceived, false);
+
+    finished = true;
+    return true;
+}
+
+void EndDownload(Sender & sender)
+{
+    OTAImageCache::Instance().Release(sender.image);
+    sender.image = nullptr;
+    sender.session.Reset();
+    sender.requestor->session.Reset();
+    sender.requestor->downloading = false;
+    sender.requestor->done        = true;
+    sender.requestor              = nullptr;
+}
+
+void TestManyConcurrentRequestors(nlTestSuite * inSuite, void * inContext)
+{
+    // Write a test image with a recognizable pattern
+    char imagePath[] = "/tmp/ota-concurrent-XXXXXX";
+    int fd           = mkstemp(imagePath);
+    NL_TEST_ASSERT(inSuite, fd >= 0);
+    VerifyOrReturn(fd >= 0);
+
+    std::vector<uint8_t> image(kImageSize);
+    for (size_t i = 0; i < image.size(); i++)
+    {
+        image[i] = static_cast<uint8_t>((i * 31) ^ (i >> 8));
+    }
+    NL_TEST_ASSERT(inSuite, write(fd, image.data(), image.size()) == static_cast<ssize_t>(image.size()));
+    close(fd);
+
+    OTATransferPacer pacer;
+    pacer.Init(kMaxConcurrentTransfers, kBusyDelaySec);
+
+    std::vector<Requestor> requestors(kNumRequestors);
+    std::vector<Sender> senders(kMaxConcurrentTransfers);
+    uint32_t completed      = 0;
+    uint32_t maxDelaySec    = 0;
+    uint16_t peakConcurrent = 0;
+    uint32_t now            = 0;
+
+    for (; completed < kNumRequestors && now < kMaxSimulatedSeconds; now++)
+    {
+        // Requestors whose DelayedActionTime elapsed query the provider again
+        for (auto & requestor : requestors)
+        {
+            if (requestor.done || requestor.downloading || requestor.nextQuerySec > now)
+            {
+                continue;
+            }
+
+            uint32_t delaySec = 0;
+            if (!pacer.TryAdmit(delaySec))
+            {
+                NL_TEST_ASSERT(inSuite, delaySec >= kBusyDelaySec);
+                requestor.nextQuerySec = now + delaySec;
+                requestor.deferrals++;
+                maxDelaySec = chip::max(maxDelaySec, delaySec);
+                continue;
+            }
+
+            Sender * freeSender = nullptr;
+            for (auto & sender : senders)
+            {
+                if (sender.requestor == nullptr)
+                {
+                    freeSender = &sender;
+                    break;
+                }
+            }
+            // The pacer never admits more transfers than there are senders
+            NL_TEST_ASSERT(inSuite, freeSender != nullptr);
+            VerifyOrReturn(freeSender != nullptr);
+            NL_TEST_ASSERT(inSuite, StartDownload(requestor, *freeSender, imagePath));
+        }
+
+        peakConcurrent = chip::max(peakConcurrent, pacer.GetActiveTransfers());
+        NL_TEST_ASSERT(inSuite, pacer.GetActiveTransfers() <= kMaxConcurrentTransfers);
+        // However many transfers are running, the image is mapped once
+        NL_TEST_ASSERT(inSuite, OTAImageCache::Instance().GetMappedImageCount() <= 1);
+
+        // Every running transfer makes some progress
+        for (auto & sender : senders)
+        {
+            for (uint32_t i = 0; i < kBlocksPerSecond && sender.requestor != nullptr; i++)
+            {
+                bool finished = false;
+                NL_TEST_ASSERT(inSuite, TransferBlock(sender, finished));
+                if (finished)
+                {
+                    NL_TEST_ASSERT(inSuite, sender.requestor->received == image);
+                    EndDownload(sender);
+                    pacer.OnTransferEnded();
+                    completed++;
+                }
+            }
+        }
+    }
+
+    NL_TEST_ASSERT(inSuite, completed == kNumRequestors);
+    NL_TEST_ASSERT(inSuite, peakConcurrent == kMaxConcurrentTransfers);
+    NL_TEST_ASSERT(inSuite, pacer.GetActiveTransfers() == 0);
+    NL_TEST_ASSERT(inSuite, maxDelaySec <= OTATransferPacer::kMaxDelayedActionTimeSec);
+    NL_TEST_ASSERT(inSuite, OTAImageCache::Instance().GetMappedImageCount() == 0);
+
+    // Pacing spreads retries so that a deferred requestor finds a free slot when it comes back
+    for (const auto & requestor : requestors)
+    {
+        NL_TEST_ASSERT(inSuite, requestor.deferrals <= 1);
+    }
+
+    printf("%u requestors served in %u simulated seconds, at most %u at a time, longest deferral %us\n", kNumRequestors, now,
+           peakConcurrent, maxDelaySec);
+
+    unlink(imagePath);
+}
+
+void TestImageCacheSharing(nlTestSuite * inSuite, void * inContext)
+{
+    char imagePath[] = "/tmp/ota-cache-XXXXXX";
+    int fd           = mkstemp(imagePath);
+    NL_TEST_ASSERT(inSuite, fd >= 0);
+    VerifyOrReturn(fd >= 0);
+    const uint8_t content[] = { 1, 2, 3, 4, 5 };
+    NL_TEST_ASSERT(inSuite, write(fd, content, sizeof(content)) == static_cast<ssize_t>(sizeof(content)));
+    close(fd);
+
+    OTAImageCache & cache              = OTAImageCache::Instance();
+    const OTAImageCache::Image * first = cache.Acquire(imagePath);
+    const OTAImageCache::Image * again = cache.Acquire(imagePath);
+    NL_TEST_ASSERT(inSuite, first != nullptr);
+    NL_TEST_ASSERT(inSuite, first == again);
+    NL_TEST_ASSERT(inSuite, cache.GetMappedImageCount() == 1);
+    NL_TEST_ASSERT(inSuite, first->GetData().data_equal(ByteSpan(content)));
+
+    cache.Release(first);
+    NL_TEST_ASSERT(inSuite, cache.GetMappedImageCount() == 1);
+    cache.Release(again);
+    NL_TEST_ASSERT(inSuite, cache.GetMappedImageCount() == 0);
+
+    NL_TEST_ASSERT(inSuite, cache.Acquire("/nonexistent/ota.bin") == nullptr);
+    NL_TEST_ASSERT(inSuite, cache.GetMappedImageCount() == 0);
+
+    unlink(imagePath);
+}
+
+void TestPacerWindows(nlTestSuite * inSuite, void * inContext)
+{
+    OTATransferPacer pacer;
+    pacer.Init(2, 30);
+
+    uint32_t delaySec = 0;
+    NL_TEST_ASSERT(inSuite, pacer.TryAdmit(delaySec) && delaySec == 0);
+    NL_TEST_ASSERT(inSuite, pacer.TryAdmit(delaySec) && delaySec == 0);
+
+    // Deferred requestors are spread over windows as large as the number of concurrent transfers
+    NL_TEST_ASSERT(inSuite, !pacer.TryAdmit(delaySec) && delaySec == 30);
+    NL_TEST_ASSERT(inSuite, !pacer.TryAdmit(delaySec) && delaySec == 30);
+    NL_TEST_ASSERT(inSuite, !pacer.TryAdmit(delaySec) && delaySec == 60);
+    NL_TEST_ASSERT(inSuite, pacer.GetDeferredRequestors() == 3);
+
+    // A completed transfer frees a slot and moves the deferred requestors up
+    pacer.OnTransferEnded();
+    NL_TEST_ASSERT(inSuite, pacer.GetDeferredRequestors() == 2);
+    NL_TEST_ASSERT(inSuite, pacer.TryAdmit(delaySec) && delaySec == 0);
+    NL_TEST_ASSERT(inSuite, !pacer.TryAdmit(delaySec) && delaySec == 60);
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("TestPacerWindows", TestPacerWindows),
+    NL_TEST_DEF("TestImageCacheSharing", TestImageCacheSharing),
+    NL_TEST_DEF("TestManyConcurrentRequestors", TestManyConcurrentRequestors),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+int TestSetup(void * inContext)
+{
+    return (chip::Platform::MemoryInit() == CHIP_NO_ERROR) ? SUCCESS : FAILURE;
+}
+
+int TestTeardown(void * inContext)
+{
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+} // namespace
+
+int TestOTAConcurrentTransfers()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "OTAConcurrentTransfers",
+        &sTests[0],
+        TestSetup,
+        TestTeardown
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestOTAConcurrentTransfers)
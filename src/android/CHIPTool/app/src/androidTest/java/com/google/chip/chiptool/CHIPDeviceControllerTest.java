@@ -4,10 +4,15 @@ import static org.junit.Assert.assertEquals;
 import static org.junit.Assert.assertNotNull;
 
 import android.content.Context;
+import android.util.Log;
 import androidx.test.ext.junit.runners.AndroidJUnit4;
 import androidx.test.platform.app.InstrumentationRegistry;
 import chip.devicecontroller.ChipDeviceController;
+import chip.devicecontroller.ChipStructs;
 import chip.devicecontroller.PaseVerifierParams;
+import chip.devicecontroller.model.ChipAttributePath;
+import java.io.ByteArrayOutputStream;
+import java.util.List;
 import org.junit.Test;
 import org.junit.runner.RunWith;
 
@@ -35,4 +40,53 @@ public class CHIPDeviceControllerTest {
     assertEquals(params.getSetupPincode(), setupPincode);
     assertNotNull(params.getPakeVerifier());
   }
+
+  /** Measures how long decoding a long list of structs, as found in large reports, takes. */
+  @Test
+  public void DecodeLargeListAttributeBenchmark() {
+    final int entryCount = 1000;
+    final int iterations = 20;
+    final long descriptorClusterId = 0x001DL;
+    final long deviceTypeListAttributeId = 0x0000L;
+
+    // An anonymous array of { 0: uint16 type, 1: uint16 revision } structures.
+    ByteArrayOutputStream tlv = new ByteArrayOutputStream();
+    tlv.write(0x16);
+    for (int i = 0; i < entryCount; i++) {
+      tlv.write(0x15);
+      tlv.write(0x25);
+      tlv.write(0x00);
+      tlv.write(i & 0xFF);
+      tlv.write((i >> 8) & 0xFF);
+      tlv.write(0x25);
+      tlv.write(0x01);
+      tlv.write(0x01);
+      tlv.write(0x00);
+      tlv.write(0x18);
+    }
+    tlv.write(0x18);
+    byte[] tlvBytes = tlv.toByteArray();
+
+    Context appContext = InstrumentationRegistry.getInstrumentation().getTargetContext();
+    ChipDeviceController chipDeviceController = ChipClient.INSTANCE.getDeviceController(appContext);
+    ChipAttributePath path =
+        ChipAttributePath.newInstance(0, descriptorClusterId, deviceTypeListAttributeId);
+
+    long start = System.nanoTime();
+    List<?> value = null;
+    for (int i = 0; i < iterations; i++) {
+      value = (List<?>) chipDeviceController.decodeAttributeValue(path, tlvBytes);
+    }
+    long elapsedMicros = (System.nanoTime() - start) / 1000;
+    Log.i(
+        "CHIPDeviceControllerTest",
+        "Decoded " + entryCount + " list entries in " + elapsedMicros / iterations + " us");
+
+    assertNotNull(value);
+    assertEquals(entryCount, value.size());
+    ChipStructs.DescriptorClusterDeviceTypeStruct last =
+        (ChipStructs.DescriptorClusterDeviceTypeStruct) value.get(entryCount - 1);
+    assertEquals(Integer.valueOf(entryCount - 1), last.type);
+    assertEquals(Integer.valueOf(1), last.revision);
+  }
 }
@@ -165,6 +165,16 @@ void AttributePathExpandIterator::ResetCurrentCluster()
     Next();
 }
 
+void AttributePathExpandIterator::SkipCurrentCluster()
+{
+    // Same as ResetCurrentCluster, there is nothing to skip unless we are expanding the wildcard attribute ids of a cluster.
+    VerifyOrReturn(mpAttributePath != nullptr && mpAttributePath->mValue.HasWildcardAttributeId());
+
+    // Mark all the attributes of the current cluster as visited, the next call to Next() will then move to the next cluster.
+    mAttributeIndex       = mEndAttributeIndex;
+    mGlobalAttributeIndex = mGlobalAttributeEndIndex;
+}
+
 bool AttributePathExpandIterator::Next()
 {
     for (; mpAttributePath != nullptr; (mpAttributePath = mpAttributePath->mpNext, mEndpointIndex = UINT16_MAX))
@@ -97,6 +97,15 @@ public:
      */
     void ResetCurrentCluster();
 
+    /**
+     * Skip the remaining attributes of the current cluster if we are in the middle of expanding a wildcard attribute id for some
+     * cluster, so that the following Next() call moves on to the next cluster.
+     *
+     * This lets the reporting engine skip a whole cluster it knows has nothing to report, e.g. when the data version of the
+     * cluster matches a data version filter, without visiting each of its attributes.
+     */
+    void SkipCurrentCluster();
+
     /**
      * Returns if the iterator is valid (not exhausted). An iterator is exhausted if and only if:
      * - Next() is called after iterating last path.
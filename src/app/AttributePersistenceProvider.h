@@ -69,6 +69,28 @@ public:
      */
     virtual CHIP_ERROR ReadValue(const ConcreteAttributePath & aPath, const EmberAfAttributeMetadata * aMetadata,
                                  MutableByteSpan & aValue) = 0;
+
+    /**
+     * Write to non-volatile memory the values whose writes have been
+     * deferred, if any.  Providers that write values synchronously have
+     * nothing to do.
+     */
+    virtual CHIP_ERROR Flush() { return CHIP_NO_ERROR; }
+
+    /**
+     * Notify the provider that the persisted attributes of an endpoint are
+     * about to be read, one ReadValue call each, so that it can load them all
+     * at once.  Every call is followed by a call to EndEndpointRestore for the
+     * same endpoint.  Providers that store each value separately have nothing
+     * to do.
+     */
+    virtual void BeginEndpointRestore(EndpointId aEndpointId) {}
+
+    /**
+     * Notify the provider that the persisted attributes of an endpoint have
+     * all been read.
+     */
+    virtual void EndEndpointRestore(EndpointId aEndpointId) {}
 };
 
 /**
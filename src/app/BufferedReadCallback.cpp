@@ -26,9 +26,23 @@
 #include <app/InteractionModelEngine.h>
 #include <lib/support/ScopedBuffer.h>
 
+#include <algorithm>
+#include <cstring>
+
 namespace chip {
 namespace app {
 
+namespace {
+
+// Room reserved for each list item: the item itself, which fits within an IPv6 MTU since it was received over the wire,
+// along with the end of the array.
+constexpr size_t kListItemReservation = kMaxSecureSduLengthBytes + 1;
+
+// Length of the control octet that starts the anonymous array.
+constexpr size_t kListStartLength = 1;
+
+} // namespace
+
 void BufferedReadCallback::OnReportBegin()
 {
     mCallback.OnReportBegin();
@@ -45,91 +59,99 @@ void BufferedReadCallback::OnReportEnd()
     mCallback.OnReportEnd();
 }
 
-CHIP_ERROR BufferedReadCallback::GenerateListTLV(TLV::ScopedBufferTLVReader & aReader)
+CHIP_ERROR BufferedReadCallback::ReserveBufferedList(size_t aSize)
 {
-    TLV::TLVType outerType;
-    Platform::ScopedMemoryBuffer<uint8_t> backingBuffer;
+    size_t required = mBufferedListLength + aSize;
+    if (required <= mBufferedListCapacity)
+    {
+        return CHIP_NO_ERROR;
+    }
 
     //
-    // To generate the final reconstituted list, we need to allocate a contiguous
-    // buffer than can hold the entirety of its contents. To do so, we need to figure out
-    // how big a buffer to allocate. This requires walking the buffered list items and computing their TLV sizes,
-    // summing them all up and adding a bit of slop to account for the TLV array the list elements will go into.
-    //
-    // The alternative was to use a PacketBufferTLVWriter backed by chained packet buffers to
-    // write out the list - this would have removed the need for this first pass. However,
-    // we cannot actually back a TLVReader with a chained buffer since that violates the ability
-    // for us to create readers off-of readers. Each reader would assume exclusive ownership of the chained
-    // buffer and mutate the state within TLVPacketBufferBackingStore, preventing shared use.
-    //
-    // To avoid that, a single contiguous buffer is the best likely approach for now.
+    // Grow geometrically, so that the items of a list are only copied a constant number of times on average
+    // as it grows.
     //
-    uint32_t totalBufSize = 0;
-    for (size_t i = 0; i < mBufferedList.size(); i++)
+    size_t capacity = std::max(mBufferedListCapacity * 2, required);
+
+    Platform::ScopedMemoryBuffer<uint8_t> buffer;
+    VerifyOrReturnError(buffer.Alloc(capacity).Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    if (mBufferedListLength > 0)
     {
-        totalBufSize += mBufferedList[i]->TotalLength();
+        memcpy(buffer.Get(), mBufferedList.Get(), mBufferedListLength);
     }
 
+    mBufferedList         = std::move(buffer);
+    mBufferedListCapacity = capacity;
+    return CHIP_NO_ERROR;
+}
+
+void BufferedReadCallback::ClearBufferedList()
+{
+    mBufferedList.Free();
+    mBufferedListLength   = 0;
+    mBufferedListCapacity = 0;
+}
+
+CHIP_ERROR BufferedReadCallback::ResetBufferedList()
+{
+    TLV::TLVWriter writer;
+    TLV::TLVType outerType;
+
+    mBufferedListLength = 0;
+
     //
-    // Size of the start container and end container are just 1 byte each, but, let's just be safe.
+    // Make room for the start of the array, the first item and the end of the array right away, so that buffering
+    // the first item does not grow the buffer again.
     //
-    totalBufSize += 4;
-
-    backingBuffer.Calloc(totalBufSize);
-    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    ReturnErrorOnFailure(ReserveBufferedList(kListStartLength + kListItemReservation));
 
-    TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), totalBufSize);
+    writer.Init(mBufferedList.Get(), mBufferedListCapacity);
     ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, outerType));
+    mBufferedListLength = writer.GetLengthWritten();
 
-    for (auto & bufHandle : mBufferedList)
-    {
-        System::PacketBufferTLVReader reader;
-
-        reader.Init(std::move(bufHandle));
+    return CHIP_NO_ERROR;
+}
 
-        ReturnErrorOnFailure(reader.Next());
-        ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), reader));
+CHIP_ERROR BufferedReadCallback::GenerateListTLV(TLV::TLVReader & aReader)
+{
+    //
+    // AppendItem chunks are only ever sent after a ReplaceAll one, but let's still deliver a well-formed list
+    // if that does not hold.
+    //
+    if (mBufferedListLength == 0)
+    {
+        ReturnErrorOnFailure(ResetBufferedList());
     }
 
-    ReturnErrorOnFailure(writer.EndContainer(outerType));
-
-    writer.Finalize(backingBuffer);
+    //
+    // The array was started when the list was reset, and BufferListItem always leaves room for its end.
+    //
+    VerifyOrReturnError(mBufferedListLength < mBufferedListCapacity, CHIP_ERROR_INTERNAL);
+    mBufferedList[mBufferedListLength++] = static_cast<uint8_t>(TLV::TLVElementType::EndOfContainer);
 
-    aReader.Init(std::move(backingBuffer), totalBufSize);
+    aReader.Init(mBufferedList.Get(), mBufferedListLength);
 
     return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR BufferedReadCallback::BufferListItem(TLV::TLVReader & reader)
 {
-    System::PacketBufferTLVWriter writer;
-    System::PacketBufferHandle handle;
+    TLV::TLVWriter writer;
+
+    if (mBufferedListLength == 0)
+    {
+        ReturnErrorOnFailure(ResetBufferedList());
+    }
 
     //
-    // We conservatively allocate a packet buffer as big as an IPv6 MTU (since we're buffering
-    // data received over the wire, which should always fit within that).
-    //
-    // We could have snapshotted the reader at its current position, advanced it past the current element
-    // and computed the delta in its read point to figure out the size of the element before allocating
-    // our target buffer. However, the reader's current position is already set past the control octet
-    // and the tag. Consequently, the computed size is always going to omit the sizes of these two parts of the
-    // TLV element. Since the tag can vary in size, for now, let's just do the safe thing. In the future, if this is a problem,
-    // we can improve this.
+    // We don't know the size of the item up front: the reader's current position is already set past its control octet
+    // and tag, so we conservatively reserve room for the largest one.
     //
-    handle = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
-    VerifyOrReturnError(!handle.IsNull(), CHIP_ERROR_NO_MEMORY);
-
-    writer.Init(std::move(handle), false);
+    ReturnErrorOnFailure(ReserveBufferedList(kListItemReservation));
 
+    writer.Init(mBufferedList.Get() + mBufferedListLength, mBufferedListCapacity - mBufferedListLength - 1);
     ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), reader));
-    ReturnErrorOnFailure(writer.Finalize(&handle));
-
-    // Compact the buffer down to a more reasonably sized packet buffer
-    // if we can.
-    //
-    handle.RightSize();
-
-    mBufferedList.push_back(std::move(handle));
+    mBufferedListLength += writer.GetLengthWritten();
 
     return CHIP_NO_ERROR;
 }
@@ -142,7 +164,7 @@ CHIP_ERROR BufferedReadCallback::BufferData(const ConcreteDataAttributePath & aP
         TLV::TLVType outerContainer;
 
         VerifyOrReturnError(apData->GetType() == TLV::kTLVType_Array, CHIP_ERROR_INVALID_TLV_ELEMENT);
-        mBufferedList.clear();
+        ReturnErrorOnFailure(ResetBufferedList());
 
         ReturnErrorOnFailure(apData->EnterContainer(outerContainer));
 
@@ -201,7 +223,7 @@ CHIP_ERROR BufferedReadCallback::DispatchBufferedData(const ConcreteAttributePat
     }
 
     StatusIB statusIB;
-    TLV::ScopedBufferTLVReader reader;
+    TLV::TLVReader reader;
 
     ReturnErrorOnFailure(GenerateListTLV(reader));
 
@@ -219,9 +241,9 @@ CHIP_ERROR BufferedReadCallback::DispatchBufferedData(const ConcreteAttributePat
     mCallback.OnAttributeData(mBufferedPath, &reader, statusIB);
 
     //
-    // Clear out our buffered contents to free up allocated buffers, and reset the buffered path.
+    // Clear out our buffered contents to free up the allocated buffer, and reset the buffered path.
     //
-    mBufferedList.clear();
+    ClearBufferedList();
     mBufferedPath = ConcreteDataAttributePath();
     return CHIP_NO_ERROR;
 }
@@ -23,7 +23,7 @@
 #include "system/TLVPacketBufferBackingStore.h"
 #include <app/AttributePathParams.h>
 #include <app/ReadClient.h>
-#include <vector>
+#include <lib/support/ScopedBuffer.h>
 
 namespace chip {
 namespace app {
@@ -42,9 +42,24 @@ public:
 
 private:
     /*
-     * Generates the reconsistuted TLV array from the stored individual list elements
+     * Terminates the buffered TLV array and initializes the reader over it, positioned on the array.
      */
-    CHIP_ERROR GenerateListTLV(TLV::ScopedBufferTLVReader & reader);
+    CHIP_ERROR GenerateListTLV(TLV::TLVReader & reader);
+
+    /*
+     * Discards the buffered list items, and starts a new, empty, TLV array.
+     */
+    CHIP_ERROR ResetBufferedList();
+
+    /*
+     * Frees the buffered list.
+     */
+    void ClearBufferedList();
+
+    /*
+     * Makes sure that the buffered list has room for aSize more bytes, growing it if needed.
+     */
+    CHIP_ERROR ReserveBufferedList(size_t aSize);
 
     /*
      * Dispatch any buffered list data if we need to. Buffered data will only be dispatched if:
@@ -71,7 +86,7 @@ private:
     void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override;
     void OnError(CHIP_ERROR aError) override
     {
-        mBufferedList.clear();
+        ClearBufferedList();
         return mCallback.OnError(aError);
     }
 
@@ -108,15 +123,23 @@ private:
         return mCallback.GetHighestReceivedEventNumber(aEventNumber);
     }
     /*
-     * Given a reader positioned at a list element, allocate a packet buffer, copy the list item where
-     * the reader is positioned into that buffer and add it to our buffered list for tracking.
+     * Given a reader positioned at a list element, append the list item where the reader is positioned
+     * to our buffered list.
      *
      * This should be called in list index order starting from the lowest index that needs to be buffered.
      *
      */
     CHIP_ERROR BufferListItem(TLV::TLVReader & reader);
     ConcreteDataAttributePath mBufferedPath;
-    std::vector<System::PacketBufferHandle> mBufferedList;
+
+    //
+    // The buffered list items, appended one after the other to a TLV array in a single growing buffer, so that
+    // the list can be delivered straight from it, without allocating or copying each item separately. The end of
+    // the array is only written when the list is delivered.
+    //
+    Platform::ScopedMemoryBuffer<uint8_t> mBufferedList;
+    size_t mBufferedListLength   = 0;
+    size_t mBufferedListCapacity = 0;
     Callback & mCallback;
 };
 
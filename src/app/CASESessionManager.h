@@ -101,10 +101,15 @@ public:
     void UpdatePeerAddress(ScopedNodeId peerId) override;
 
 private:
+    // BindingManager notifies peers that already have a CASE session without going through FindOrEstablishSession.
+    friend class BindingManager;
+
     OperationalSessionSetup * FindExistingSessionSetup(const ScopedNodeId & peerId, bool forAddressUpdate = false) const;
 
     Optional<SessionHandle> FindExistingSession(const ScopedNodeId & peerId) const;
 
+    Messaging::ExchangeManager * GetExchangeManager() const { return mConfig.sessionInitParams.exchangeMgr; }
+
     CASESessionManagerConfig mConfig;
 };
 
@@ -33,7 +33,6 @@
 #include <app/util/MatterCallbacks.h>
 #include <credentials/GroupDataProvider.h>
 #include <lib/core/CHIPTLVData.hpp>
-#include <lib/core/CHIPTLVUtilities.hpp>
 #include <lib/support/TypeTraits.h>
 #include <platform/LockTracker.h>
 #include <protocols/secure_channel/Constants.h>
@@ -61,6 +60,10 @@ CHIP_ERROR CommandHandler::AllocateBuffer()
 
         mInvokeResponseBuilder.CreateInvokeResponses();
         ReturnErrorOnFailure(mInvokeResponseBuilder.GetError());
+
+        // Keep space for closing the message, whatever the responses encoded
+        ReturnErrorOnFailure(mCommandMessageWriter.ReserveBuffer(kReservedSizeForTLVEncodingOverhead));
+        mResponseCount   = 0;
         mBufferAllocated = true;
     }
 
@@ -114,14 +117,7 @@ Status CommandHandler::ProcessInvokeRequest(System::PacketBufferHandle && payloa
     VerifyOrReturnError(mTimedRequest == isTimedInvoke, Status::UnsupportedAccess);
     invokeRequests.GetReader(&invokeRequestsReader);
 
-    {
-        // We don't support handling multiple commands but the protocol is ready to support it in the future, reject all of them and
-        // IM Engine will send a status response.
-        size_t commandCount = 0;
-        TLV::Utilities::Count(invokeRequestsReader, commandCount, false /* recurse */);
-        VerifyOrReturnError(commandCount == 1, Status::InvalidAction);
-    }
-
+    // Each command of the request gets its own response (data or status), in as many invoke response messages as needed.
     while (CHIP_NO_ERROR == (err = invokeRequestsReader.Next()))
     {
         VerifyOrReturnError(TLV::AnonymousTag() == invokeRequestsReader.GetTag(), Status::InvalidAction);
@@ -155,14 +151,62 @@ Status CommandHandler::ProcessInvokeRequest(System::PacketBufferHandle && payloa
 CHIP_ERROR CommandHandler::OnMessageReceived(Messaging::ExchangeContext * apExchangeContext, const PayloadHeader & aPayloadHeader,
                                              System::PacketBufferHandle && aPayload)
 {
-    ChipLogDetail(DataManagement, "CommandHandler: Unexpected message type %d", aPayloadHeader.GetMessageType());
-    StatusResponse::Send(Status::InvalidAction, mExchangeCtx.Get(), false /*aExpectResponse*/);
-    return CHIP_ERROR_INVALID_MESSAGE_TYPE;
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    // The only message we expect is the status response acknowledging an invoke response chunk.
+    if (mPendingChunks.IsNull() || !aPayloadHeader.HasMessageType(Protocols::InteractionModel::MsgType::StatusResponse))
+    {
+        ChipLogDetail(DataManagement, "CommandHandler: Unexpected message type %d", aPayloadHeader.GetMessageType());
+        StatusResponse::Send(Status::InvalidAction, mExchangeCtx.Get(), false /*aExpectResponse*/);
+        err = CHIP_ERROR_INVALID_MESSAGE_TYPE;
+        // Outside of sending chunks, the response is still to be sent.
+        VerifyOrReturnError(!mPendingChunks.IsNull(), err);
+    }
+    else
+    {
+        CHIP_ERROR statusError = CHIP_NO_ERROR;
+        err                    = StatusResponse::ProcessStatusResponse(std::move(aPayload), statusError);
+        if (err == CHIP_NO_ERROR)
+        {
+            err = statusError;
+        }
+        if (err == CHIP_NO_ERROR)
+        {
+            err = SendNextChunk();
+        }
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to send invoke response chunk: %" CHIP_ERROR_FORMAT, err.Format());
+        mPendingChunks = nullptr;
+    }
+
+    if (mPendingChunks.IsNull())
+    {
+        Close();
+    }
+    return err;
+}
+
+void CommandHandler::OnResponseTimeout(Messaging::ExchangeContext * apExchangeContext)
+{
+    //
+    // The only responses we expect on this EC are the status responses acknowledging invoke response chunks.
+    //
+    VerifyOrDie(!mPendingChunks.IsNull());
+
+    ChipLogError(DataManagement,
+                 "Time out! failed to receive status response for invoke response chunk from Exchange: " ChipLogFormatExchange,
+                 ChipLogValueExchange(apExchangeContext));
+    mPendingChunks = nullptr;
+    Close();
 }
 
 void CommandHandler::Close()
 {
     mSuppressResponse = false;
+    mPendingChunks    = nullptr;
     MoveToState(State::AwaitingDestruction);
 
     // We must finish all async work before we can shut down a CommandHandler. The actual CommandHandler MUST finish their work
@@ -205,6 +249,11 @@ void CommandHandler::DecrementHoldOff()
             {
                 ChipLogError(DataManagement, "Failed to send command response: %" CHIP_ERROR_FORMAT, err.Format());
             }
+            else if (!mPendingChunks.IsNull())
+            {
+                // Stay around until the peer has received all the chunks of the response.
+                return;
+            }
         }
     }
 
@@ -216,20 +265,73 @@ CHIP_ERROR CommandHandler::SendCommandResponse()
     System::PacketBufferHandle commandPacket;
 
     VerifyOrReturnError(mPendingWork == 0, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
+    // Once a chunk has been queued, the last message is sent even if it ends up with no response.
+    VerifyOrReturnError(mState == State::AddedCommand || (mState == State::Idle && !mPendingChunks.IsNull()),
+                        CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mExchangeCtx, CHIP_ERROR_INCORRECT_STATE);
 
     ReturnErrorOnFailure(Finalize(commandPacket));
-    ReturnErrorOnFailure(
-        mExchangeCtx->SendMessage(Protocols::InteractionModel::MsgType::InvokeCommandResponse, std::move(commandPacket)));
-    // The ExchangeContext is automatically freed here, and it makes mpExchangeCtx be temporarily dangling, but in
-    // all cases, we are going to call Close immediately after this function, which nulls out mpExchangeCtx.
+    mPendingChunks.AddToEnd(std::move(commandPacket));
+
+    return SendNextChunk();
+}
+
+CHIP_ERROR CommandHandler::SendNextChunk()
+{
+    using namespace Messaging;
+
+    VerifyOrReturnError(!mPendingChunks.IsNull(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mExchangeCtx, CHIP_ERROR_INCORRECT_STATE);
+
+    System::PacketBufferHandle commandPacket = mPendingChunks.PopHead();
+    const bool moreChunks                    = !mPendingChunks.IsNull();
+
+    if (moreChunks)
+    {
+        mExchangeCtx->UseSuggestedResponseTimeout(app::kExpectedIMProcessingTime);
+    }
+
+    ReturnErrorOnFailure(mExchangeCtx->SendMessage(Protocols::InteractionModel::MsgType::InvokeCommandResponse,
+                                                   std::move(commandPacket),
+                                                   moreChunks ? SendMessageFlags::kExpectResponse : SendMessageFlags::kNone));
+    // After the last chunk, the ExchangeContext is automatically freed here, and it makes mpExchangeCtx be temporarily dangling,
+    // but in all cases, we are going to call Close immediately after this function, which nulls out mpExchangeCtx.
 
     MoveToState(State::CommandSent);
 
     return CHIP_NO_ERROR;
 }
 
+bool CommandHandler::StartNextChunkIfFull(CHIP_ERROR aError)
+{
+    VerifyOrReturnValue(aError == CHIP_ERROR_NO_MEMORY || aError == CHIP_ERROR_BUFFER_TOO_SMALL, false);
+
+    // A response not fitting in a message of its own would not fit in the next one either.
+    VerifyOrReturnValue(mState == State::AddedCommand && mResponseCount > 0, false);
+
+    // Group commands get no response, so there is nothing to chunk.
+    VerifyOrReturnValue(mExchangeCtx && !mExchangeCtx->IsGroupExchangeContext(), false);
+
+    System::PacketBufferHandle commandPacket;
+    CHIP_ERROR err = Finalize(commandPacket, /* aMoreChunkedMessages = */ true);
+    if (err == CHIP_NO_ERROR)
+    {
+        mPendingChunks.AddToEnd(std::move(commandPacket));
+        mBufferAllocated = false;
+        MoveToState(State::Idle);
+        err = AllocateBuffer();
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to start new invoke response chunk: %" CHIP_ERROR_FORMAT, err.Format());
+        return false;
+    }
+
+    ChipLogDetail(DataManagement, "Invoke response message full, continuing in a new chunk");
+    return true;
+}
+
 namespace {
 // We use this when the sender did not actually provide a CommandFields struct,
 // to avoid downstream consumers having to worry about cases when there is or is
@@ -453,6 +555,29 @@ Status CommandHandler::ProcessGroupCommandDataIB(CommandDataIB::Parser & aComman
 }
 
 CHIP_ERROR CommandHandler::AddStatusInternal(const ConcreteCommandPath & aCommandPath, const StatusIB & aStatus)
+{
+    // Checked here so that a failure below always comes from encoding this status, which can then be rolled back.
+    VerifyOrReturnError(mState == State::Idle || mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
+
+    CHIP_ERROR err = TryAddStatusInternal(aCommandPath, aStatus);
+    if (err != CHIP_NO_ERROR)
+    {
+        RollbackResponse();
+
+        // The responses to the other commands of the invoke request may have filled the message: retry in a new one.
+        if (StartNextChunkIfFull(err))
+        {
+            err = TryAddStatusInternal(aCommandPath, aStatus);
+            if (err != CHIP_NO_ERROR)
+            {
+                RollbackResponse();
+            }
+        }
+    }
+    return err;
+}
+
+CHIP_ERROR CommandHandler::TryAddStatusInternal(const ConcreteCommandPath & aCommandPath, const StatusIB & aStatus)
 {
     ReturnErrorOnFailure(PrepareStatus(aCommandPath));
     CommandStatusIB::Builder & commandStatus = mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().GetStatus();
@@ -482,11 +607,11 @@ CHIP_ERROR CommandHandler::PrepareCommand(const ConcreteCommandPath & aCommandPa
 {
     ReturnErrorOnFailure(AllocateBuffer());
 
-    mInvokeResponseBuilder.Checkpoint(mBackupWriter);
     //
-    // We must not be in the middle of preparing a command, or having prepared or sent one.
+    // We must not be in the middle of preparing a command, or having sent the response.
     //
-    VerifyOrReturnError(mState == State::Idle, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mState == State::Idle || mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
+    mInvokeResponseBuilder.Checkpoint(mBackupWriter);
     MoveToState(State::Preparing);
     InvokeResponseIBs::Builder & invokeResponses = mInvokeResponseBuilder.GetInvokeResponses();
     InvokeResponseIB::Builder & invokeResponse   = invokeResponses.CreateInvokeResponse();
@@ -516,8 +641,7 @@ CHIP_ERROR CommandHandler::FinishCommand(bool aStartDataStruct)
     }
     ReturnErrorOnFailure(commandData.EndOfCommandDataIB().GetError());
     ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().EndOfInvokeResponseIB().GetError());
-    ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().EndOfInvokeResponses().GetError());
-    ReturnErrorOnFailure(mInvokeResponseBuilder.EndOfInvokeResponseMessage().GetError());
+    mResponseCount++;
     MoveToState(State::AddedCommand);
     return CHIP_NO_ERROR;
 }
@@ -526,9 +650,10 @@ CHIP_ERROR CommandHandler::PrepareStatus(const ConcreteCommandPath & aCommandPat
 {
     ReturnErrorOnFailure(AllocateBuffer());
     //
-    // We must not be in the middle of preparing a command, or having prepared or sent one.
+    // We must not be in the middle of preparing a command, or having sent the response.
     //
-    VerifyOrReturnError(mState == State::Idle, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mState == State::Idle || mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
+    mInvokeResponseBuilder.Checkpoint(mBackupWriter);
     MoveToState(State::Preparing);
     InvokeResponseIBs::Builder & invokeResponses = mInvokeResponseBuilder.GetInvokeResponses();
     InvokeResponseIB::Builder & invokeResponse   = invokeResponses.CreateInvokeResponse();
@@ -548,8 +673,7 @@ CHIP_ERROR CommandHandler::FinishStatus()
     ReturnErrorOnFailure(
         mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().GetStatus().EndOfCommandStatusIB().GetError());
     ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().GetInvokeResponse().EndOfInvokeResponseIB().GetError());
-    ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().EndOfInvokeResponses().GetError());
-    ReturnErrorOnFailure(mInvokeResponseBuilder.EndOfInvokeResponseMessage().GetError());
+    mResponseCount++;
     MoveToState(State::AddedCommand);
     return CHIP_NO_ERROR;
 }
@@ -559,9 +683,8 @@ CHIP_ERROR CommandHandler::RollbackResponse()
     VerifyOrReturnError(mState == State::Preparing || mState == State::AddingCommand, CHIP_ERROR_INCORRECT_STATE);
     mInvokeResponseBuilder.Rollback(mBackupWriter);
     mInvokeResponseBuilder.ResetError();
-    // Note: We only support one command per request, so we reset the state to Idle here, need to review the states when adding
-    // supports of having multiple requests in the same transaction.
-    MoveToState(State::Idle);
+    // The responses encoded before this one are kept.
+    MoveToState(mResponseCount > 0 ? State::AddedCommand : State::Idle);
     return CHIP_NO_ERROR;
 }
 
@@ -611,9 +734,16 @@ CommandHandler::Handle::Handle(CommandHandler * handle)
     }
 }
 
-CHIP_ERROR CommandHandler::Finalize(System::PacketBufferHandle & commandPacket)
+CHIP_ERROR CommandHandler::Finalize(System::PacketBufferHandle & commandPacket, bool aMoreChunkedMessages)
 {
-    VerifyOrReturnError(mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mState == State::AddedCommand || (mState == State::Idle && mBufferAllocated), CHIP_ERROR_INCORRECT_STATE);
+    ReturnErrorOnFailure(mCommandMessageWriter.UnreserveBuffer(kReservedSizeForTLVEncodingOverhead));
+    ReturnErrorOnFailure(mInvokeResponseBuilder.GetInvokeResponses().EndOfInvokeResponses().GetError());
+    if (aMoreChunkedMessages)
+    {
+        mInvokeResponseBuilder.MoreChunkedMessages(true);
+    }
+    ReturnErrorOnFailure(mInvokeResponseBuilder.EndOfInvokeResponseMessage().GetError());
     return mCommandMessageWriter.Finalize(&commandPacket);
 }
 
@@ -204,6 +204,16 @@ public:
             // The state guarantees that either we can rollback or we don't have to rollback the buffer, so we don't care about the
             // return value of RollbackResponse.
             RollbackResponse();
+
+            // The responses to the other commands of the invoke request may have filled the message: retry in a new one.
+            if (StartNextChunkIfFull(err))
+            {
+                err = TryAddResponseData(aRequestCommandPath, aData);
+                if (err != CHIP_NO_ERROR)
+                {
+                    RollbackResponse();
+                }
+            }
         }
         return err;
     }
@@ -281,13 +291,7 @@ private:
     CHIP_ERROR OnMessageReceived(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
                                  System::PacketBufferHandle && payload) override;
 
-    void OnResponseTimeout(Messaging::ExchangeContext * ec) override
-    {
-        //
-        // We're not expecting responses to any messages we send out on this EC.
-        //
-        VerifyOrDie(false);
-    }
+    void OnResponseTimeout(Messaging::ExchangeContext * ec) override;
 
     enum class State
     {
@@ -332,12 +336,32 @@ private:
     /*
      * Allocates a packet buffer used for encoding an invoke response payload.
      *
-     * This can be called multiple times safely, as it will only allocate the buffer once for the lifetime
-     * of this object.
+     * This can be called multiple times safely, as it will only allocate the buffer once for each
+     * invoke response message.
      */
     CHIP_ERROR AllocateBuffer();
 
-    CHIP_ERROR Finalize(System::PacketBufferHandle & commandPacket);
+    /*
+     * Closes the invoke response message being encoded. aMoreChunkedMessages is true if the responses to the
+     * invoke request continue in another message.
+     */
+    CHIP_ERROR Finalize(System::PacketBufferHandle & commandPacket, bool aMoreChunkedMessages = false);
+
+    /**
+     * Called when encoding a response failed with aError, after the response was rolled back.
+     *
+     * If the failure is due to the current message being full with the responses to the other commands of the invoke
+     * request, finalizes that message and queues it for transmission, then starts a new one.
+     *
+     * @return true if the response should be encoded again in the new message.
+     */
+    bool StartNextChunkIfFull(CHIP_ERROR aError);
+
+    /**
+     * Sends the next queued invoke response message. The peer is expected to acknowledge all but the last message with a
+     * status response before the next one is sent.
+     */
+    CHIP_ERROR SendNextChunk();
 
     /**
      * Called internally to signal the completion of all work on this object, gracefully close the
@@ -359,6 +383,7 @@ private:
     Protocols::InteractionModel::Status ProcessGroupCommandDataIB(CommandDataIB::Parser & aCommandElement);
     CHIP_ERROR SendCommandResponse();
     CHIP_ERROR AddStatusInternal(const ConcreteCommandPath & aCommandPath, const StatusIB & aStatus);
+    CHIP_ERROR TryAddStatusInternal(const ConcreteCommandPath & aCommandPath, const StatusIB & aStatus);
 
     /**
      * If this function fails, it may leave our TLV buffer in an inconsistent state.  Callers should snapshot as needed before
@@ -394,6 +419,31 @@ private:
     chip::System::PacketBufferTLVWriter mCommandMessageWriter;
     TLV::TLVWriter mBackupWriter;
     bool mBufferAllocated = false;
+
+    // Number of responses completely encoded in the message being built.
+    size_t mResponseCount = 0;
+
+    // Finalized invoke response messages waiting to be sent, as a packet buffer chain.
+    System::PacketBufferHandle mPendingChunks;
+
+    //
+    // The encoded size of the fields closing an invoke response message:
+    //
+    //  InvokeResponseMessage =
+    //  {
+    //      InvokeResponses =
+    //      [
+    //          ...
+    //      ],                            <-- 1 byte  "kReservedSizeForEndOfContainer"
+    //      moreChunkedMessages = true,   <-- 2 bytes "kReservedSizeForMoreChunksFlag"
+    //      InteractionModelRevision = 1, <-- 3 bytes "kReservedSizeForIMRevision"
+    //  }                                 <-- 1 byte  "kReservedSizeForEndOfContainer"
+    //
+    static constexpr uint16_t kReservedSizeForMoreChunksFlag = 1 + 1;
+    static constexpr uint16_t kReservedSizeForEndOfContainer = 1;
+    static constexpr uint16_t kReservedSizeForIMRevision     = 1 + 1 + 1;
+    static constexpr uint16_t kReservedSizeForTLVEncodingOverhead =
+        2 * kReservedSizeForEndOfContainer + kReservedSizeForMoreChunksFlag + kReservedSizeForIMRevision;
 };
 
 } // namespace app
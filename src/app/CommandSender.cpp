@@ -55,6 +55,9 @@ CHIP_ERROR CommandSender::AllocateBuffer()
         mInvokeRequestBuilder.CreateInvokeRequests();
         ReturnErrorOnFailure(mInvokeRequestBuilder.GetError());
 
+        // Keep space for closing the message, whatever the commands encoded
+        ReturnErrorOnFailure(mCommandMessageWriter.ReserveBuffer(kReservedSizeForTLVEncodingOverhead));
+
         mBufferAllocated = true;
     }
 
@@ -162,9 +165,17 @@ CHIP_ERROR CommandSender::OnMessageReceived(Messaging::ExchangeContext * apExcha
 
     if (aPayloadHeader.HasMessageType(MsgType::InvokeCommandResponse))
     {
-        err = ProcessInvokeResponse(std::move(aPayload));
+        bool moreChunkedMessages = false;
+        err                      = ProcessInvokeResponse(std::move(aPayload), moreChunkedMessages);
         SuccessOrExit(err);
         sendStatusResponse = false;
+
+        if (moreChunkedMessages)
+        {
+            // Acknowledge the chunk to get the next one.
+            SuccessOrExit(err = StatusResponse::Send(Status::Success, apExchangeContext, true /*aExpectResponse*/));
+            MoveToState(State::CommandSent);
+        }
     }
     else if (aPayloadHeader.HasMessageType(MsgType::StatusResponse))
     {
@@ -201,7 +212,7 @@ exit:
     return err;
 }
 
-CHIP_ERROR CommandSender::ProcessInvokeResponse(System::PacketBufferHandle && payload)
+CHIP_ERROR CommandSender::ProcessInvokeResponse(System::PacketBufferHandle && payload, bool & moreChunkedMessages)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
     System::PacketBufferTLVReader reader;
@@ -219,6 +230,15 @@ CHIP_ERROR CommandSender::ProcessInvokeResponse(System::PacketBufferHandle && pa
 
     ReturnErrorOnFailure(invokeResponseMessage.GetSuppressResponse(&suppressResponse));
     ReturnErrorOnFailure(invokeResponseMessage.GetInvokeResponses(&invokeResponses));
+
+    err = invokeResponseMessage.GetMoreChunkedMessages(&moreChunkedMessages);
+    if (err == CHIP_END_OF_TLV)
+    {
+        moreChunkedMessages = false;
+        err                 = CHIP_NO_ERROR;
+    }
+    ReturnErrorOnFailure(err);
+
     invokeResponses.GetReader(&invokeResponsesReader);
 
     while (CHIP_NO_ERROR == (err = invokeResponsesReader.Next()))
@@ -337,7 +357,7 @@ CHIP_ERROR CommandSender::ProcessInvokeResponseIB(InvokeResponseIB::Parser & aIn
             }
             else
             {
-                mpCallback->OnError(this, statusIB.ToChipError());
+                mpCallback->OnCommandError(this, ConcreteCommandPath(endpointId, clusterId, commandId), statusIB);
             }
         }
     }
@@ -349,9 +369,12 @@ CHIP_ERROR CommandSender::PrepareCommand(const CommandPathParams & aCommandPathP
     ReturnErrorOnFailure(AllocateBuffer());
 
     //
-    // We must not be in the middle of preparing a command, or having prepared or sent one.
+    // We must not be in the middle of preparing a command, or having sent the request.
     //
-    VerifyOrReturnError(mState == State::Idle, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mState == State::Idle || mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
+    mInvokeRequestBuilder.Checkpoint(mBackupWriter);
+    MoveToState(State::AddingCommand);
+
     InvokeRequests::Builder & invokeRequests = mInvokeRequestBuilder.GetInvokeRequests();
     CommandDataIB::Builder & invokeRequest   = invokeRequests.CreateCommandData();
     ReturnErrorOnFailure(invokeRequests.GetError());
@@ -365,7 +388,6 @@ CHIP_ERROR CommandSender::PrepareCommand(const CommandPathParams & aCommandPathP
                                                                        TLV::kTLVType_Structure, mDataElementContainerType));
     }
 
-    MoveToState(State::AddingCommand);
     return CHIP_NO_ERROR;
 }
 
@@ -383,14 +405,23 @@ CHIP_ERROR CommandSender::FinishCommand(bool aEndDataStruct)
     }
 
     ReturnErrorOnFailure(commandData.EndOfCommandDataIB().GetError());
-    ReturnErrorOnFailure(mInvokeRequestBuilder.GetInvokeRequests().EndOfInvokeRequests().GetError());
-    ReturnErrorOnFailure(mInvokeRequestBuilder.EndOfInvokeRequestMessage().GetError());
 
+    mCommandCount++;
     MoveToState(State::AddedCommand);
 
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR CommandSender::RollbackRequest()
+{
+    VerifyOrReturnError(mState == State::AddingCommand, CHIP_ERROR_INCORRECT_STATE);
+    mInvokeRequestBuilder.Rollback(mBackupWriter);
+    mInvokeRequestBuilder.ResetError();
+    // The commands encoded before this one are kept.
+    MoveToState(mCommandCount > 0 ? State::AddedCommand : State::Idle);
+    return CHIP_NO_ERROR;
+}
+
 TLV::TLVWriter * CommandSender::GetCommandDataIBTLVWriter()
 {
     if (mState != State::AddingCommand)
@@ -419,6 +450,9 @@ CHIP_ERROR CommandSender::FinishCommand(const Optional<uint16_t> & aTimedInvokeT
 CHIP_ERROR CommandSender::Finalize(System::PacketBufferHandle & commandPacket)
 {
     VerifyOrReturnError(mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
+    ReturnErrorOnFailure(mCommandMessageWriter.UnreserveBuffer(kReservedSizeForTLVEncodingOverhead));
+    ReturnErrorOnFailure(mInvokeRequestBuilder.GetInvokeRequests().EndOfInvokeRequests().GetError());
+    ReturnErrorOnFailure(mInvokeRequestBuilder.EndOfInvokeRequestMessage().GetError());
     return mCommandMessageWriter.Finalize(&commandPacket);
 }
 
@@ -97,6 +97,24 @@ public:
          */
         virtual void OnError(const CommandSender * apCommandSender, CHIP_ERROR aError) {}
 
+        /**
+         * OnCommandError will be called for each command of the request the server responded to with a failure status. The
+         * other commands of the request are not affected.
+         *
+         * The default implementation reports the failure through OnError, which does not convey which command failed.
+         *
+         * The CommandSender object MUST continue to exist after this call is completed. The application shall wait until it
+         * receives an OnDone call to destroy and free the object.
+         *
+         * @param[in] apCommandSender The command sender object that initiated the command transaction.
+         * @param[in] aPath           The command path field in invoke command response.
+         * @param[in] aStatusIB       The failure status, possibly including a cluster-specific one.
+         */
+        virtual void OnCommandError(CommandSender * apCommandSender, const ConcreteCommandPath & aPath, const StatusIB & aStatusIB)
+        {
+            OnError(apCommandSender, aStatusIB.ToChipError());
+        }
+
         /**
          * OnDone will be called when CommandSender has finished all work and is safe to destroy and free the
          * allocated CommandSender object.
@@ -122,6 +140,11 @@ public:
      * If callbacks are passed the only one that will be called in a group sesttings is the onDone
      */
     CommandSender(Callback * apCallback, Messaging::ExchangeManager * apExchangeMgr, bool aIsTimedRequest = false);
+
+    /*
+     * Commands are added to the request one after the other, each with a PrepareCommand / FinishCommand pair or an
+     * AddRequestData call, and are all sent in the same invoke request. The server responds to each of them.
+     */
     CHIP_ERROR PrepareCommand(const CommandPathParams & aCommandPathParams, bool aStartDataStruct = true);
     CHIP_ERROR FinishCommand(bool aEndDataStruct = true);
     TLV::TLVWriter * GetCommandDataIBTLVWriter();
@@ -131,6 +154,9 @@ public:
      * object that can be encoded using the DataModel::Encode machinery and
      * exposes the right command id will work.
      *
+     * If the command does not fit in the request along with the commands already added, CHIP_ERROR_NO_MEMORY or
+     * CHIP_ERROR_BUFFER_TOO_SMALL is returned and the request is left as it was, ready to be sent.
+     *
      * @param [in] aCommandPath  The path of the command being requested.
      * @param [in] aData         The data for the request.
      */
@@ -156,6 +182,11 @@ public:
 
     CHIP_ERROR FinishCommand(const Optional<uint16_t> & aTimedInvokeTimeoutMs);
 
+    /**
+     * Number of commands added to the request.
+     */
+    size_t GetCommandCount() const { return mCommandCount; }
+
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     /**
      * Version of AddRequestData that allows sending a message that is
@@ -176,13 +207,36 @@ private:
     CHIP_ERROR AddRequestDataInternal(const CommandPathParams & aCommandPath, const CommandDataT & aData,
                                       const Optional<uint16_t> & aTimedInvokeTimeoutMs)
     {
-        ReturnErrorOnFailure(PrepareCommand(aCommandPath, /* aStartDataStruct = */ false));
+        // Checked here so that a failure below always comes from encoding this command, which can then be rolled back.
+        VerifyOrReturnError(mState == State::Idle || mState == State::AddedCommand, CHIP_ERROR_INCORRECT_STATE);
+
+        CHIP_ERROR err = PrepareCommand(aCommandPath, /* aStartDataStruct = */ false);
+        if (err == CHIP_NO_ERROR)
+        {
+            err = TryAddRequestData(aData, aTimedInvokeTimeoutMs);
+        }
+        if (err != CHIP_NO_ERROR)
+        {
+            // Keep the commands added before this one, so that the request can still be sent.
+            RollbackRequest();
+        }
+        return err;
+    }
+
+    template <typename CommandDataT>
+    CHIP_ERROR TryAddRequestData(const CommandDataT & aData, const Optional<uint16_t> & aTimedInvokeTimeoutMs)
+    {
         TLV::TLVWriter * writer = GetCommandDataIBTLVWriter();
         VerifyOrReturnError(writer != nullptr, CHIP_ERROR_INCORRECT_STATE);
         ReturnErrorOnFailure(DataModel::Encode(*writer, TLV::ContextTag(to_underlying(CommandDataIB::Tag::kFields)), aData));
         return FinishCommand(aTimedInvokeTimeoutMs);
     }
 
+    /**
+     * Rollback the request to before encoding the current command (before calling PrepareCommand)
+     */
+    CHIP_ERROR RollbackRequest();
+
 public:
     // Sends a queued up command request to the target encapsulated by the secureSession handle.
     //
@@ -216,7 +270,7 @@ private:
     {
         Idle,                ///< Default state that the object starts out in, where no work has commenced
         AddingCommand,       ///< In the process of adding a command.
-        AddedCommand,        ///< A command has been completely encoded and is awaiting transmission.
+        AddedCommand,        ///< At least one command has been completely encoded and is awaiting transmission.
         AwaitingTimedStatus, ///< Sent a Timed Request and waiting for response.
         CommandSent,         ///< The command has been sent successfully.
         ResponseReceived,    ///< Received a response to our invoke and request and processing the response.
@@ -256,7 +310,7 @@ private:
      */
     void Abort();
 
-    CHIP_ERROR ProcessInvokeResponse(System::PacketBufferHandle && payload);
+    CHIP_ERROR ProcessInvokeResponse(System::PacketBufferHandle && payload, bool & moreChunkedMessages);
     CHIP_ERROR ProcessInvokeResponseIB(InvokeResponseIB::Parser & aInvokeResponse);
 
     // Send our queued-up Invoke Request message.  Assumes the exchange is ready
@@ -265,6 +319,24 @@ private:
 
     CHIP_ERROR Finalize(System::PacketBufferHandle & commandPacket);
 
+    //
+    // The encoded size of the fields closing an invoke request message:
+    //
+    //  InvokeRequestMessage =
+    //  {
+    //      ...
+    //      InvokeRequests =
+    //      [
+    //          ...
+    //      ],                            <-- 1 byte  "kReservedSizeForEndOfContainer"
+    //      InteractionModelRevision = 1, <-- 3 bytes "kReservedSizeForIMRevision"
+    //  }                                 <-- 1 byte  "kReservedSizeForEndOfContainer"
+    //
+    static constexpr uint16_t kReservedSizeForEndOfContainer = 1;
+    static constexpr uint16_t kReservedSizeForIMRevision     = 1 + 1 + 1;
+    static constexpr uint16_t kReservedSizeForTLVEncodingOverhead =
+        kReservedSizeForEndOfContainer + kReservedSizeForIMRevision + kReservedSizeForEndOfContainer;
+
     Messaging::ExchangeHolder mExchangeCtx;
     Callback * mpCallback                      = nullptr;
     Messaging::ExchangeManager * mpExchangeMgr = nullptr;
@@ -282,7 +354,9 @@ private:
 
     State mState = State::Idle;
     chip::System::PacketBufferTLVWriter mCommandMessageWriter;
+    TLV::TLVWriter mBackupWriter;
     bool mBufferAllocated = false;
+    size_t mCommandCount  = 0;
 };
 
 } // namespace app
@@ -27,9 +27,9 @@ CHIP_ERROR DefaultAttributePersistenceProvider::WriteValue(const ConcreteAttribu
 {
     VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    // TODO: we may want to have a small cache for values that change a lot, so
-    // we only write them once a bunch of changes happen or on timer or
-    // shutdown.
+    // Values that change a lot can be cached by wrapping this provider in a
+    // DeferredAttributePersistenceProvider, which only writes them on timer,
+    // after a bunch of changes or on shutdown.
     DefaultStorageKeyAllocator key;
     if (!CanCastTo<uint16_t>(aValue.size()))
     {
@@ -48,27 +48,33 @@ CHIP_ERROR DefaultAttributePersistenceProvider::ReadValue(const ConcreteAttribut
     uint16_t size = static_cast<uint16_t>(min(aValue.size(), static_cast<size_t>(UINT16_MAX)));
     ReturnErrorOnFailure(mStorage->SyncGetKeyValue(key.AttributeValue(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId),
                                                    aValue.data(), size));
+    aValue.reduce_size(size);
+    return ValidateValue(aMetadata, aValue);
+}
+
+CHIP_ERROR DefaultAttributePersistenceProvider::ValidateValue(const EmberAfAttributeMetadata * aMetadata, const ByteSpan & aValue)
+{
+    size_t size               = aValue.size();
     EmberAfAttributeType type = aMetadata->attributeType;
     if (emberAfIsStringAttributeType(type))
     {
         // Ensure that we've read enough bytes that we are not ending up with
         // un-initialized memory.  Should have read length + 1 (for the length
         // byte).
-        VerifyOrReturnError(size >= emberAfStringLength(aValue.data()) + 1, CHIP_ERROR_INCORRECT_STATE);
+        VerifyOrReturnError(size >= 1 && size >= emberAfStringLength(aValue.data()) + 1u, CHIP_ERROR_INCORRECT_STATE);
     }
     else if (emberAfIsLongStringAttributeType(type))
     {
         // Ensure that we've read enough bytes that we are not ending up with
         // un-initialized memory.  Should have read length + 2 (for the length
         // bytes).
-        VerifyOrReturnError(size >= emberAfLongStringLength(aValue.data()) + 2, CHIP_ERROR_INCORRECT_STATE);
+        VerifyOrReturnError(size >= 2 && size >= emberAfLongStringLength(aValue.data()) + 2u, CHIP_ERROR_INCORRECT_STATE);
     }
     else
     {
         // Ensure we got the expected number of bytes for all other types.
         VerifyOrReturnError(size == aMetadata->size, CHIP_ERROR_INCORRECT_STATE);
     }
-    aValue.reduce_size(size);
     return CHIP_NO_ERROR;
 }
 
@@ -55,6 +55,9 @@ public:
                          MutableByteSpan & aValue) override;
 
 protected:
+    // Check that a value read from storage is consistent with the attribute metadata.
+    static CHIP_ERROR ValidateValue(const EmberAfAttributeMetadata * aMetadata, const ByteSpan & aValue);
+
     PersistentStorageDelegate * mStorage;
 };
 
@@ -0,0 +1,221 @@
+/*
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/DeferredAttributePersistenceProvider.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <string.h>
+
+namespace chip {
+namespace app {
+
+CHIP_ERROR DeferredAttributePersistenceProvider::Init(AttributePersistenceProvider & persister, System::Layer & systemLayer,
+                                                      System::Clock::Milliseconds32 flushInterval, size_t flushThreshold)
+{
+    VerifyOrReturnError(flushThreshold > 0 && flushThreshold <= kMaxPendingWrites, CHIP_ERROR_INVALID_ARGUMENT);
+
+    mPersister      = &persister;
+    mSystemLayer    = &systemLayer;
+    mFlushInterval  = flushInterval;
+    mFlushThreshold = flushThreshold;
+    return CHIP_NO_ERROR;
+}
+
+void DeferredAttributePersistenceProvider::Shutdown()
+{
+    VerifyOrReturn(mPersister != nullptr);
+
+    Flush();
+
+    // Writes that failed again are dropped.
+    mSystemLayer->CancelTimer(OnFlushTimer, this);
+    for (auto & pendingWrite : mPendingWrites)
+    {
+        pendingWrite.mPending = false;
+    }
+    mPendingWriteCount = 0;
+
+    mPersister   = nullptr;
+    mSystemLayer = nullptr;
+}
+
+CHIP_ERROR DeferredAttributePersistenceProvider::WriteValue(const ConcreteAttributePath & aPath,
+                                                            const EmberAfAttributeMetadata * aMetadata, const ByteSpan & aValue)
+{
+    VerifyOrReturnError(mPersister != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    PendingWrite * pendingWrite = FindPendingWrite(aPath);
+    if (aValue.size() > kMaxValueSize)
+    {
+        // Drop any pending write of the attribute, which would overwrite this value when flushed.
+        if (pendingWrite != nullptr)
+        {
+            pendingWrite->mPending = false;
+            mPendingWriteCount--;
+        }
+        return mPersister->WriteValue(aPath, aMetadata, aValue);
+    }
+
+    if (pendingWrite == nullptr)
+    {
+        pendingWrite = AllocatePendingWrite();
+        VerifyOrReturnError(pendingWrite != nullptr, mPersister->WriteValue(aPath, aMetadata, aValue));
+        pendingWrite->mPath = aPath;
+    }
+    pendingWrite->mMetadata  = aMetadata;
+    pendingWrite->mValueSize = aValue.size();
+    memcpy(pendingWrite->mValue, aValue.data(), aValue.size());
+
+    // The value is buffered whatever the outcome of the flush, which logs the writes that fail. These are only retried
+    // once the flush interval has elapsed, rather than on every attribute change while the storage keeps failing.
+    if (mPendingWriteCount >= mFlushThreshold)
+    {
+        FlushPendingWrites(false /* aRetryFailedWrites */);
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DeferredAttributePersistenceProvider::ReadValue(const ConcreteAttributePath & aPath,
+                                                           const EmberAfAttributeMetadata * aMetadata, MutableByteSpan & aValue)
+{
+    VerifyOrReturnError(mPersister != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    const PendingWrite * pendingWrite = FindPendingWrite(aPath);
+    if (pendingWrite == nullptr)
+    {
+        return mPersister->ReadValue(aPath, aMetadata, aValue);
+    }
+    return CopySpanToMutableSpan(ByteSpan(pendingWrite->mValue, pendingWrite->mValueSize), aValue);
+}
+
+CHIP_ERROR DeferredAttributePersistenceProvider::Flush()
+{
+    VerifyOrReturnError(mPersister != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    return FlushPendingWrites(true /* aRetryFailedWrites */);
+}
+
+CHIP_ERROR DeferredAttributePersistenceProvider::FlushPendingWrites(bool aRetryFailedWrites)
+{
+    if (aRetryFailedWrites)
+    {
+        mSystemLayer->CancelTimer(OnFlushTimer, this);
+    }
+
+    // A write that fails stays pending, and is retried by the next flush that retries failed writes.
+    CHIP_ERROR firstError = CHIP_NO_ERROR;
+    for (auto & pendingWrite : mPendingWrites)
+    {
+        if (!pendingWrite.mPending || (pendingWrite.mFailed && !aRetryFailedWrites))
+        {
+            continue;
+        }
+
+        ByteSpan value(pendingWrite.mValue, pendingWrite.mValueSize);
+        CHIP_ERROR err = mPersister->WriteValue(pendingWrite.mPath, pendingWrite.mMetadata, value);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DataManagement, "Failed to store attribute " ChipLogFormatMEI "/" ChipLogFormatMEI ": %" CHIP_ERROR_FORMAT,
+                         ChipLogValueMEI(pendingWrite.mPath.mClusterId), ChipLogValueMEI(pendingWrite.mPath.mAttributeId),
+                         err.Format());
+            firstError           = (firstError == CHIP_NO_ERROR) ? err : firstError;
+            pendingWrite.mFailed = true;
+            continue;
+        }
+        pendingWrite.mPending = false;
+        pendingWrite.mFailed  = false;
+        mPendingWriteCount--;
+    }
+
+    if (!aRetryFailedWrites)
+    {
+        // The timer started by the first pending write, or by the last retry, keeps running for the writes left.
+        if (mPendingWriteCount == 0)
+        {
+            mSystemLayer->CancelTimer(OnFlushTimer, this);
+        }
+        return firstError;
+    }
+
+    // Retry the failed writes once the flush interval has elapsed again.
+    if (mPendingWriteCount > 0)
+    {
+        CHIP_ERROR err = mSystemLayer->StartTimer(mFlushInterval, OnFlushTimer, this);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DataManagement, "Failed to schedule the retry of %u attribute writes: %" CHIP_ERROR_FORMAT,
+                         static_cast<unsigned>(mPendingWriteCount), err.Format());
+        }
+    }
+    return firstError;
+}
+
+void DeferredAttributePersistenceProvider::BeginEndpointRestore(EndpointId aEndpointId)
+{
+    VerifyOrReturn(mPersister != nullptr);
+    mPersister->BeginEndpointRestore(aEndpointId);
+}
+
+void DeferredAttributePersistenceProvider::EndEndpointRestore(EndpointId aEndpointId)
+{
+    VerifyOrReturn(mPersister != nullptr);
+    mPersister->EndEndpointRestore(aEndpointId);
+}
+
+DeferredAttributePersistenceProvider::PendingWrite *
+DeferredAttributePersistenceProvider::FindPendingWrite(const ConcreteAttributePath & aPath)
+{
+    for (auto & pendingWrite : mPendingWrites)
+    {
+        if (pendingWrite.mPending && pendingWrite.mPath == aPath)
+        {
+            return &pendingWrite;
+        }
+    }
+    return nullptr;
+}
+
+DeferredAttributePersistenceProvider::PendingWrite * DeferredAttributePersistenceProvider::AllocatePendingWrite()
+{
+    for (auto & pendingWrite : mPendingWrites)
+    {
+        if (pendingWrite.mPending)
+        {
+            continue;
+        }
+
+        // The flush interval runs from the first of the pending writes, so that attributes changing continuously
+        // are still written regularly.
+        if (mPendingWriteCount == 0 && mSystemLayer->StartTimer(mFlushInterval, OnFlushTimer, this) != CHIP_NO_ERROR)
+        {
+            return nullptr;
+        }
+        pendingWrite.mPending = true;
+        pendingWrite.mFailed  = false;
+        mPendingWriteCount++;
+        return &pendingWrite;
+    }
+    return nullptr;
+}
+
+void DeferredAttributePersistenceProvider::OnFlushTimer(System::Layer * aLayer, void * aAppState)
+{
+    static_cast<DeferredAttributePersistenceProvider *>(aAppState)->Flush();
+}
+
+} // namespace app
+} // namespace chip
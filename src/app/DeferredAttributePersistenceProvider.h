@@ -0,0 +1,115 @@
+/*
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/AttributePersistenceProvider.h>
+#include <lib/core/CHIPConfig.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayer.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * AttributePersistenceProvider that defers the writes of small attribute
+ * values to another AttributePersistenceProvider, e.g. a
+ * DefaultAttributePersistenceProvider.
+ *
+ * The values written are kept in memory and only written to the underlying
+ * provider, once per attribute however many times it changed, when:
+ *
+ * - the flush interval has elapsed since the first of the pending writes,
+ * - the number of attributes with a pending write reaches the flush
+ *   threshold,
+ * - Flush() or Shutdown() is called.
+ *
+ * A write that fails when flushed stays pending, and is retried once the flush
+ * interval has elapsed again, or by the next call to Flush(); flushes caused
+ * by the threshold do not retry it.  Shutdown() drops the writes that still
+ * fail.
+ *
+ * Reads return the pending value of an attribute, if any.  Values larger than
+ * CHIP_CONFIG_DEFERRED_ATTRIBUTE_PERSISTENCE_MAX_VALUE_SIZE are written
+ * immediately.
+ */
+class DeferredAttributePersistenceProvider : public AttributePersistenceProvider
+{
+public:
+    static constexpr size_t kMaxPendingWrites = CHIP_CONFIG_DEFERRED_ATTRIBUTE_PERSISTENCE_MAX_PENDING_WRITES;
+    static constexpr size_t kMaxValueSize     = CHIP_CONFIG_DEFERRED_ATTRIBUTE_PERSISTENCE_MAX_VALUE_SIZE;
+
+    DeferredAttributePersistenceProvider() {}
+    ~DeferredAttributePersistenceProvider() override { Shutdown(); }
+
+    /**
+     * Passed-in persister and system layer must outlive this object.
+     *
+     * @param[in] persister the provider the writes are deferred to.
+     * @param[in] systemLayer the system layer running the flush timer.
+     * @param[in] flushInterval the maximum time a write is deferred for.
+     * @param[in] flushThreshold the number of attributes with a pending write
+     *            that triggers a flush, at most kMaxPendingWrites.
+     */
+    CHIP_ERROR Init(AttributePersistenceProvider & persister, System::Layer & systemLayer,
+                    System::Clock::Milliseconds32 flushInterval =
+                        System::Clock::Milliseconds32(CHIP_CONFIG_DEFERRED_ATTRIBUTE_PERSISTENCE_FLUSH_INTERVAL_MS),
+                    size_t flushThreshold = kMaxPendingWrites);
+
+    /**
+     * Flush the pending writes and stop deferring writes.  The writes that
+     * fail are dropped.
+     */
+    void Shutdown();
+
+    size_t GetPendingWriteCount() const { return mPendingWriteCount; }
+
+    // AttributePersistenceProvider implementation.
+    CHIP_ERROR WriteValue(const ConcreteAttributePath & aPath, const EmberAfAttributeMetadata * aMetadata,
+                          const ByteSpan & aValue) override;
+    CHIP_ERROR ReadValue(const ConcreteAttributePath & aPath, const EmberAfAttributeMetadata * aMetadata,
+                         MutableByteSpan & aValue) override;
+    CHIP_ERROR Flush() override;
+    void BeginEndpointRestore(EndpointId aEndpointId) override;
+    void EndEndpointRestore(EndpointId aEndpointId) override;
+
+private:
+    struct PendingWrite
+    {
+        bool mPending = false;
+        bool mFailed  = false; // Whether the last write of the value failed.
+        ConcreteAttributePath mPath;
+        const EmberAfAttributeMetadata * mMetadata;
+        uint8_t mValue[kMaxValueSize];
+        size_t mValueSize;
+    };
+
+    CHIP_ERROR FlushPendingWrites(bool aRetryFailedWrites);
+    PendingWrite * FindPendingWrite(const ConcreteAttributePath & aPath);
+    PendingWrite * AllocatePendingWrite();
+
+    static void OnFlushTimer(System::Layer * aLayer, void * aAppState);
+
+    AttributePersistenceProvider * mPersister = nullptr;
+    System::Layer * mSystemLayer              = nullptr;
+    System::Clock::Milliseconds32 mFlushInterval;
+    size_t mFlushThreshold = kMaxPendingWrites;
+
+    PendingWrite mPendingWrites[kMaxPendingWrites];
+    size_t mPendingWriteCount = 0;
+};
+
+} // namespace app
+} // namespace chip
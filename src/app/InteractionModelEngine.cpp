@@ -302,13 +302,6 @@ void InteractionModelEngine::OnDone(CommandHandler & apCommandObj)
 
 void InteractionModelEngine::OnDone(ReadHandler & apReadObj)
 {
-    //
-    // Deleting an item can shift down the contents of the underlying pool storage,
-    // rendering any tracker using positional indexes invalid. Let's reset it,
-    // based on which readHandler we are getting rid of.
-    //
-    mReportingEngine.ResetReadHandlerTracker(&apReadObj);
-
     mReadHandlers.ReleaseObject(&apReadObj);
 }
 
@@ -1208,7 +1201,7 @@ CHIP_ERROR InteractionModelEngine::PushFrontAttributePathList(ObjectList<Attribu
     return err;
 }
 
-void InteractionModelEngine::RemoveDuplicateConcreteAttributePath(ObjectList<AttributePathParams> *& aAttributePaths)
+void InteractionModelEngine::RemoveDuplicateAttributePaths(ObjectList<AttributePathParams> *& aAttributePaths)
 {
     ObjectList<AttributePathParams> * prev = nullptr;
     auto * path1                           = aAttributePaths;
@@ -1216,8 +1209,8 @@ void InteractionModelEngine::RemoveDuplicateConcreteAttributePath(ObjectList<Att
     while (path1 != nullptr)
     {
         bool duplicate = false;
-        // skip all wildcard paths and invalid concrete attribute
-        if (path1->mValue.IsWildcardPath() ||
+        // skip invalid concrete attributes, which are reported with an error status unlike the paths a wildcard expands to
+        if (!path1->mValue.IsWildcardPath() &&
             !emberAfContainsAttribute(path1->mValue.mEndpointId, path1->mValue.mClusterId, path1->mValue.mAttributeId))
         {
             prev  = path1;
@@ -1225,7 +1218,8 @@ void InteractionModelEngine::RemoveDuplicateConcreteAttributePath(ObjectList<Att
             continue;
         }
 
-        // Check whether a wildcard path expands to something that includes this concrete path.
+        // Check whether a wildcard path expands to something that includes this path. Identical wildcard paths are supersets
+        // of each other, and only the first one is discarded since the check is done against the paths that are left.
         for (auto * path2 = aAttributePaths; path2 != nullptr; path2 = path2->mpNext)
         {
             if (path2 == path1)
@@ -182,8 +182,9 @@ public:
                                           AttributePathParams & aAttributePath);
 
     // If a concrete path indicates an attribute that is also referenced by a wildcard path in the request,
-    // the path SHALL be removed from the list.
-    void RemoveDuplicateConcreteAttributePath(ObjectList<AttributePathParams> *& aAttributePaths);
+    // the path SHALL be removed from the list. Wildcard paths covered by another wildcard path in the request
+    // are removed as well, so that overlapping paths neither use the path pool nor report attributes twice.
+    void RemoveDuplicateAttributePaths(ObjectList<AttributePathParams> *& aAttributePaths);
 
     void ReleaseEventPathList(ObjectList<EventPathParams> *& aEventPathList);
 
@@ -420,6 +420,17 @@ void OperationalSessionSetup::PerformAddressUpdate()
 
 void OperationalSessionSetup::OnNodeAddressResolved(const PeerId & peerId, const ResolveResult & result)
 {
+#if INET_CONFIG_ENABLE_TCP_ENDPOINT && CHIP_CONFIG_ENABLE_TCP_TRANSPORT
+    // Prefer TCP when the peer supports it, so that the session can carry messages larger than a UDP packet.
+    if (result.supportsTcp)
+    {
+        UpdateDeviceData(Transport::PeerAddress::TCP(result.address.GetIPAddress(), result.address.GetPort(),
+                                                     result.address.GetInterface()),
+                         result.mrpRemoteConfig);
+        return;
+    }
+#endif // INET_CONFIG_ENABLE_TCP_ENDPOINT && CHIP_CONFIG_ENABLE_TCP_TRANSPORT
+
     UpdateDeviceData(result.address, result.mrpRemoteConfig);
 }
 
@@ -40,6 +40,7 @@
 #include <lib/core/CHIPTLVDebug.hpp>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DLLUtil.h>
+#include <lib/support/IntrusiveList.h>
 #include <lib/support/logging/CHIPLogging.h>
 #include <messaging/ExchangeHolder.h>
 #include <messaging/ExchangeMgr.h>
@@ -71,7 +72,7 @@ class InteractionModelEngine;
  *         for the relevant data, and sending a reply.
  *
  */
-class ReadHandler : public Messaging::ExchangeDelegate
+class ReadHandler : public Messaging::ExchangeDelegate, public IntrusiveListNodeBase<IntrusiveMode::AutoUnlink>
 {
 public:
     using SubjectDescriptor = Access::SubjectDescriptor;
@@ -438,6 +439,9 @@ private:
 
     uint32_t mLastWrittenEventsBytes = 0;
 
+    // When the reporting engine queued this handler with a report to send, cleared once it leaves the queue.
+    Optional<System::Clock::Timestamp> mReportQueuedTime;
+
     // The detailed encoding state for a single attribute, used by list chunking feature.
     // The size of AttributeEncoderState is 2 bytes for now.
     AttributeValueEncoder::AttributeEncodeState mAttributeEncoderState;
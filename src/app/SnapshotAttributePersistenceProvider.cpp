@@ -0,0 +1,310 @@
+/*
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/SnapshotAttributePersistenceProvider.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace app {
+
+namespace {
+
+// A snapshot is an anonymous array with one structure per attribute read
+// during the restore that stored it.  The value is left out for the attributes
+// that have no stored value.
+constexpr TLV::Tag TagCluster()
+{
+    return TLV::ContextTag(1);
+}
+constexpr TLV::Tag TagAttribute()
+{
+    return TLV::ContextTag(2);
+}
+constexpr TLV::Tag TagValue()
+{
+    return TLV::ContextTag(3);
+}
+
+} // namespace
+
+static_assert(SnapshotAttributePersistenceProvider::kMaxSnapshotSize <= UINT16_MAX,
+              "Snapshots must fit in a PersistentStorageDelegate value");
+static_assert(SnapshotAttributePersistenceProvider::kDeletedSnapshotCacheSize > 0,
+              "At least one endpoint must be remembered as having no snapshot");
+
+SnapshotAttributePersistenceProvider::SnapshotAttributePersistenceProvider()
+{
+    for (auto & endpoint : mDeletedSnapshots)
+    {
+        endpoint = kInvalidEndpointId;
+    }
+}
+
+CHIP_ERROR SnapshotAttributePersistenceProvider::WriteValue(const ConcreteAttributePath & aPath,
+                                                            const EmberAfAttributeMetadata * aMetadata, const ByteSpan & aValue)
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    // The snapshot goes first, so that it never holds an older value than the
+    // one stored under the attribute key.
+    ReturnErrorOnFailure(DeleteSnapshot(aPath.mEndpointId));
+    if (mRestoring && aPath.mEndpointId == mRestoreEndpoint)
+    {
+        mNewSnapshotValid = false;
+    }
+    return DefaultAttributePersistenceProvider::WriteValue(aPath, aMetadata, aValue);
+}
+
+CHIP_ERROR SnapshotAttributePersistenceProvider::ReadValue(const ConcreteAttributePath & aPath,
+                                                           const EmberAfAttributeMetadata * aMetadata, MutableByteSpan & aValue)
+{
+    VerifyOrReturnError(mStorage != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    if (!mRestoring || aPath.mEndpointId != mRestoreEndpoint)
+    {
+        return DefaultAttributePersistenceProvider::ReadValue(aPath, aMetadata, aValue);
+    }
+
+    MutableByteSpan buffer = aValue;
+    CHIP_ERROR err         = ReadSnapshotValue(aPath, aMetadata, aValue);
+    if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        // Not in the snapshot: fall back to the attribute key, and store a
+        // new snapshot once the restore completes.
+        mSnapshotStale = true;
+        aValue         = buffer;
+        err            = DefaultAttributePersistenceProvider::ReadValue(aPath, aMetadata, aValue);
+    }
+
+    if (RecordSnapshotValue(aPath, err, aValue) != CHIP_NO_ERROR)
+    {
+        mNewSnapshotValid = false;
+    }
+    return err;
+}
+
+void SnapshotAttributePersistenceProvider::BeginEndpointRestore(EndpointId aEndpointId)
+{
+    VerifyOrReturn(mStorage != nullptr && !mRestoring);
+
+    // Without room for a new snapshot, the attributes are simply read from
+    // their own keys.
+    VerifyOrReturn(mNewSnapshot.Alloc(kMaxSnapshotSize));
+    TLV::TLVType outerType;
+    mNewSnapshotWriter.Init(mNewSnapshot.Get(), kMaxSnapshotSize);
+    if (mNewSnapshotWriter.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, outerType) != CHIP_NO_ERROR)
+    {
+        mNewSnapshot.Free();
+        return;
+    }
+
+    mRestoring        = true;
+    mRestoreEndpoint  = aEndpointId;
+    mNewSnapshotValid = true;
+
+    CHIP_ERROR err  = LoadSnapshot(aEndpointId);
+    mSnapshotLoaded = (err == CHIP_NO_ERROR);
+    mSnapshotStale  = !mSnapshotLoaded;
+    if (err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        SetSnapshotDeleted(aEndpointId, true);
+    }
+    else if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DataManagement, "Failed to load attribute snapshot of endpoint %u: %" CHIP_ERROR_FORMAT, aEndpointId,
+                     err.Format());
+    }
+}
+
+void SnapshotAttributePersistenceProvider::EndEndpointRestore(EndpointId aEndpointId)
+{
+    VerifyOrReturn(mRestoring && aEndpointId == mRestoreEndpoint);
+
+    if (mSnapshotStale && mNewSnapshotValid)
+    {
+        CHIP_ERROR err = StoreSnapshot(aEndpointId);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DataManagement, "Failed to store attribute snapshot of endpoint %u: %" CHIP_ERROR_FORMAT, aEndpointId,
+                         err.Format());
+        }
+    }
+
+    mRestoring       = false;
+    mRestoreEndpoint = kInvalidEndpointId;
+    mSnapshotLoaded  = false;
+    mSnapshot.Free();
+    mNewSnapshot.Free();
+}
+
+CHIP_ERROR SnapshotAttributePersistenceProvider::DeleteSnapshot(EndpointId aEndpointId)
+{
+    VerifyOrReturnError(!IsSnapshotDeleted(aEndpointId), CHIP_NO_ERROR);
+
+    DefaultStorageKeyAllocator key;
+    CHIP_ERROR err = mStorage->SyncDeleteKeyValue(key.AttributeSnapshot(aEndpointId));
+    VerifyOrReturnError(err == CHIP_NO_ERROR || err == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND, err);
+    SetSnapshotDeleted(aEndpointId, true);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SnapshotAttributePersistenceProvider::LoadSnapshot(EndpointId aEndpointId)
+{
+    VerifyOrReturnError(mSnapshot.Alloc(kMaxSnapshotSize), CHIP_ERROR_NO_MEMORY);
+
+    DefaultStorageKeyAllocator key;
+    uint16_t size = static_cast<uint16_t>(kMaxSnapshotSize);
+    ReturnErrorOnFailure(mStorage->SyncGetKeyValue(key.AttributeSnapshot(aEndpointId), mSnapshot.Get(), size));
+
+    TLV::TLVType outerType;
+    mSnapshotStart.Init(mSnapshot.Get(), size);
+    ReturnErrorOnFailure(mSnapshotStart.Next(TLV::kTLVType_Array, TLV::AnonymousTag()));
+    ReturnErrorOnFailure(mSnapshotStart.EnterContainer(outerType));
+    mSnapshotReader = mSnapshotStart;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SnapshotAttributePersistenceProvider::StoreSnapshot(EndpointId aEndpointId)
+{
+    ReturnErrorOnFailure(mNewSnapshotWriter.EndContainer(TLV::kTLVType_NotSpecified));
+    ReturnErrorOnFailure(mNewSnapshotWriter.Finalize());
+
+    DefaultStorageKeyAllocator key;
+    ReturnErrorOnFailure(mStorage->SyncSetKeyValue(key.AttributeSnapshot(aEndpointId), mNewSnapshot.Get(),
+                                                   static_cast<uint16_t>(mNewSnapshotWriter.GetLengthWritten())));
+    SetSnapshotDeleted(aEndpointId, false);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SnapshotAttributePersistenceProvider::FindSnapshotValue(const ConcreteAttributePath & aPath, ByteSpan & aValue)
+{
+    // The attributes are read in the same order on every restore, so the next
+    // entry is usually the one looked for.  Otherwise, scan the rest of the
+    // snapshot, then all of it again.
+    for (int pass = 0; pass < 2; pass++)
+    {
+        CHIP_ERROR err;
+        while ((err = mSnapshotReader.Next()) == CHIP_NO_ERROR)
+        {
+            TLV::TLVType containerType;
+            ClusterId clusterId;
+            AttributeId attributeId;
+            ByteSpan value;
+            bool hasValue = false;
+
+            ReturnErrorOnFailure(mSnapshotReader.EnterContainer(containerType));
+            ReturnErrorOnFailure(mSnapshotReader.Next(TagCluster()));
+            ReturnErrorOnFailure(mSnapshotReader.Get(clusterId));
+            ReturnErrorOnFailure(mSnapshotReader.Next(TagAttribute()));
+            ReturnErrorOnFailure(mSnapshotReader.Get(attributeId));
+            err = mSnapshotReader.Next();
+            if (err == CHIP_NO_ERROR)
+            {
+                VerifyOrReturnError(mSnapshotReader.GetTag() == TagValue(), CHIP_ERROR_INVALID_TLV_TAG);
+                ReturnErrorOnFailure(mSnapshotReader.Get(value));
+                hasValue = true;
+            }
+            else
+            {
+                VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+            }
+            ReturnErrorOnFailure(mSnapshotReader.ExitContainer(containerType));
+
+            if (clusterId == aPath.mClusterId && attributeId == aPath.mAttributeId)
+            {
+                VerifyOrReturnError(hasValue, CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND);
+                aValue = value;
+                return CHIP_NO_ERROR;
+            }
+        }
+        VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+        mSnapshotReader = mSnapshotStart;
+    }
+    return CHIP_ERROR_KEY_NOT_FOUND;
+}
+
+CHIP_ERROR SnapshotAttributePersistenceProvider::ReadSnapshotValue(const ConcreteAttributePath & aPath,
+                                                                   const EmberAfAttributeMetadata * aMetadata,
+                                                                   MutableByteSpan & aValue)
+{
+    VerifyOrReturnError(mSnapshotLoaded, CHIP_ERROR_KEY_NOT_FOUND);
+
+    ByteSpan value;
+    CHIP_ERROR err = FindSnapshotValue(aPath, value);
+    if (err != CHIP_NO_ERROR && err != CHIP_ERROR_KEY_NOT_FOUND && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        // A corrupted snapshot is not used any further.
+        ChipLogError(DataManagement, "Failed to decode attribute snapshot of endpoint %u: %" CHIP_ERROR_FORMAT, mRestoreEndpoint,
+                     err.Format());
+        mSnapshotLoaded = false;
+    }
+    ReturnErrorOnFailure(err);
+
+    // The attribute may have changed type since the snapshot was stored.
+    ReturnErrorOnFailure(CopySpanToMutableSpan(value, aValue));
+    return ValidateValue(aMetadata, aValue);
+}
+
+CHIP_ERROR SnapshotAttributePersistenceProvider::RecordSnapshotValue(const ConcreteAttributePath & aPath, CHIP_ERROR aReadError,
+                                                                     const ByteSpan & aValue)
+{
+    // Attributes that failed to read are left out of the new snapshot, so the
+    // next restore reads them from their own keys again.
+    VerifyOrReturnError(aReadError == CHIP_NO_ERROR || aReadError == CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND, CHIP_NO_ERROR);
+
+    TLV::TLVType containerType;
+    ReturnErrorOnFailure(mNewSnapshotWriter.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, containerType));
+    ReturnErrorOnFailure(mNewSnapshotWriter.Put(TagCluster(), aPath.mClusterId));
+    ReturnErrorOnFailure(mNewSnapshotWriter.Put(TagAttribute(), aPath.mAttributeId));
+    if (aReadError == CHIP_NO_ERROR)
+    {
+        ReturnErrorOnFailure(mNewSnapshotWriter.Put(TagValue(), aValue));
+    }
+    return mNewSnapshotWriter.EndContainer(containerType);
+}
+
+bool SnapshotAttributePersistenceProvider::IsSnapshotDeleted(EndpointId aEndpointId) const
+{
+    for (auto endpoint : mDeletedSnapshots)
+    {
+        if (endpoint == aEndpointId)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void SnapshotAttributePersistenceProvider::SetSnapshotDeleted(EndpointId aEndpointId, bool aDeleted)
+{
+    if (!aDeleted)
+    {
+        for (auto & endpoint : mDeletedSnapshots)
+        {
+            endpoint = (endpoint == aEndpointId) ? kInvalidEndpointId : endpoint;
+        }
+        return;
+    }
+
+    VerifyOrReturn(!IsSnapshotDeleted(aEndpointId));
+    mDeletedSnapshots[mNextDeletedSnapshot] = aEndpointId;
+    mNextDeletedSnapshot                    = (mNextDeletedSnapshot + 1) % kDeletedSnapshotCacheSize;
+}
+
+} // namespace app
+} // namespace chip
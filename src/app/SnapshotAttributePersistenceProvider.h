@@ -0,0 +1,95 @@
+/*
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/DefaultAttributePersistenceProvider.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPTLV.h>
+#include <lib/support/ScopedBuffer.h>
+#include <platform/CHIPDeviceConfig.h>
+
+namespace chip {
+namespace app {
+
+/**
+ * DefaultAttributePersistenceProvider that also keeps, for each endpoint, a
+ * snapshot of the values of all its persisted attributes in a single storage
+ * value, so that restoring an endpoint takes one storage read instead of one
+ * per attribute.
+ *
+ * Each attribute value is still stored under its own key, which remains the
+ * reference:
+ *
+ * - writing an attribute deletes the snapshot of its endpoint, before the
+ *   value itself is written,
+ * - restoring an endpoint whose snapshot is missing, or lacks some of the
+ *   attributes read, reads them from their own keys and then stores a new
+ *   snapshot of the values read.
+ *
+ * The snapshot records the attributes that have no stored value as well, so
+ * that these are not looked up again on the next restore.
+ */
+class SnapshotAttributePersistenceProvider : public DefaultAttributePersistenceProvider
+{
+public:
+    static constexpr size_t kMaxSnapshotSize = CHIP_CONFIG_ATTRIBUTE_SNAPSHOT_MAX_SIZE;
+
+    // Number of endpoints remembered as having no snapshot, whose next
+    // attribute writes need not delete it again: enough for every fixed and
+    // dynamic endpoint of the device.
+    static constexpr size_t kDeletedSnapshotCacheSize =
+        CHIP_CONFIG_ATTRIBUTE_SNAPSHOT_FIXED_ENDPOINT_COUNT + CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT;
+
+    SnapshotAttributePersistenceProvider();
+
+    // AttributePersistenceProvider implementation.
+    CHIP_ERROR WriteValue(const ConcreteAttributePath & aPath, const EmberAfAttributeMetadata * aMetadata,
+                          const ByteSpan & aValue) override;
+    CHIP_ERROR ReadValue(const ConcreteAttributePath & aPath, const EmberAfAttributeMetadata * aMetadata,
+                         MutableByteSpan & aValue) override;
+    void BeginEndpointRestore(EndpointId aEndpointId) override;
+    void EndEndpointRestore(EndpointId aEndpointId) override;
+
+private:
+    CHIP_ERROR DeleteSnapshot(EndpointId aEndpointId);
+    CHIP_ERROR LoadSnapshot(EndpointId aEndpointId);
+    CHIP_ERROR StoreSnapshot(EndpointId aEndpointId);
+    CHIP_ERROR FindSnapshotValue(const ConcreteAttributePath & aPath, ByteSpan & aValue);
+    CHIP_ERROR ReadSnapshotValue(const ConcreteAttributePath & aPath, const EmberAfAttributeMetadata * aMetadata,
+                                 MutableByteSpan & aValue);
+    CHIP_ERROR RecordSnapshotValue(const ConcreteAttributePath & aPath, CHIP_ERROR aReadError, const ByteSpan & aValue);
+
+    bool IsSnapshotDeleted(EndpointId aEndpointId) const;
+    void SetSnapshotDeleted(EndpointId aEndpointId, bool aDeleted);
+
+    // State of the endpoint restore in progress, if any.
+    bool mRestoring             = false;
+    EndpointId mRestoreEndpoint = kInvalidEndpointId;
+    bool mSnapshotLoaded        = false;
+    bool mSnapshotStale         = false;
+    bool mNewSnapshotValid      = false;
+    Platform::ScopedMemoryBuffer<uint8_t> mSnapshot;
+    TLV::TLVReader mSnapshotStart;
+    TLV::TLVReader mSnapshotReader;
+    Platform::ScopedMemoryBuffer<uint8_t> mNewSnapshot;
+    TLV::TLVWriter mNewSnapshotWriter;
+
+    EndpointId mDeletedSnapshots[kDeletedSnapshotCacheSize];
+    size_t mNextDeletedSnapshot = 0;
+};
+
+} // namespace app
+} // namespace chip
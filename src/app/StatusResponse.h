@@ -26,6 +26,8 @@
 namespace chip {
 namespace app {
 static constexpr size_t kMaxSecureSduLengthBytes = 1024;
+// The same headroom below kMaxLargeAppMessageLen, for sessions that allow large payloads.
+static constexpr size_t kMaxLargeSecureSduLengthBytes = kMaxLargeAppMessageLen - (kMaxAppMessageLen - kMaxSecureSduLengthBytes);
 
 class StatusResponse
 {
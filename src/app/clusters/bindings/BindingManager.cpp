@@ -21,6 +21,8 @@
 #include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 
+#include <algorithm>
+
 namespace {
 
 class BindingFabricTableDelegate : public chip::FabricTable::Delegate
@@ -50,6 +52,14 @@ BindingFabricTableDelegate gFabricTableDelegate;
 
 namespace {
 
+struct BoundGroup
+{
+    chip::FabricIndex fabricIndex;
+    chip::GroupId groupId;
+
+    bool operator==(const BoundGroup & other) const { return fabricIndex == other.fabricIndex && groupId == other.groupId; }
+};
+
 } // namespace
 
 namespace chip {
@@ -175,6 +185,10 @@ CHIP_ERROR BindingManager::NotifyBoundClusterChanged(EndpointId endpoint, Cluste
     auto * bindingContext = mPendingNotificationMap.NewPendingNotificationContext(context);
     VerifyOrReturnError(bindingContext != nullptr, CHIP_ERROR_NO_MEMORY);
 
+    // Groups already notified, so that a group bound several times is sent a single message.
+    BoundGroup notifiedGroups[EMBER_BINDING_TABLE_SIZE];
+    size_t notifiedGroupCount = 0;
+
     bindingContext->IncrementConsumersNumber();
 
     for (auto iter = BindingTable::GetInstance().begin(); iter != BindingTable::GetInstance().end(); ++iter)
@@ -183,13 +197,29 @@ CHIP_ERROR BindingManager::NotifyBoundClusterChanged(EndpointId endpoint, Cluste
         {
             if (iter->type == EMBER_UNICAST_BINDING)
             {
+                ScopedNodeId peer(iter->nodeId, iter->fabricIndex);
+                Optional<SessionHandle> session = mInitParams.mCASESessionManager->FindExistingSession(peer);
+                if (session.HasValue())
+                {
+                    // The session is up: notify right away, without queuing the notification or allocating connection
+                    // callbacks.
+                    OperationalDeviceProxy device(mInitParams.mCASESessionManager->GetExchangeManager(), session.Value());
+                    mBoundDeviceChangedHandler(*iter, &device, bindingContext->GetContext());
+                    continue;
+                }
                 error = mPendingNotificationMap.AddPendingNotification(iter.GetIndex(), bindingContext);
                 SuccessOrExit(error);
-                error = EstablishConnection(ScopedNodeId(iter->nodeId, iter->fabricIndex));
+                error = EstablishConnection(peer);
                 SuccessOrExit(error);
             }
             else if (iter->type == EMBER_MULTICAST_BINDING)
             {
+                BoundGroup group{ iter->fabricIndex, iter->groupId };
+                if (std::find(notifiedGroups, notifiedGroups + notifiedGroupCount, group) != notifiedGroups + notifiedGroupCount)
+                {
+                    continue;
+                }
+                notifiedGroups[notifiedGroupCount++] = group;
                 mBoundDeviceChangedHandler(*iter, nullptr, bindingContext->GetContext());
             }
         }
@@ -110,7 +110,8 @@ public:
      * Notify a cluster change to **all** bound devices associated with the (endpoint, cluster) tuple.
      *
      * For unicast bindings with an active session and multicast bindings, the BoundDeviceChangedHandler
-     * will be called before the function returns.
+     * will be called before the function returns. Multicast bindings to the same group are notified once, so that a
+     * single group message is sent.
      *
      * For unicast bindings without an active session, the notification will be queued and a new session will
      * be initiated. The BoundDeviceChangedHandler will be called once the session is established.
@@ -0,0 +1,104 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/DirtyAttributeInbox.h>
+
+#include <lib/support/CodeUtils.h>
+
+#include <string.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+CHIP_ERROR DirtyAttributeInbox::Init()
+{
+    VerifyOrReturnError(!mInitialized, CHIP_NO_ERROR);
+
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+    for (auto & shard : mShards)
+    {
+        ReturnErrorOnFailure(System::Mutex::Init(shard.mLock));
+    }
+#endif // !CHIP_SYSTEM_CONFIG_NO_LOCKING
+
+    mInitialized = true;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR DirtyAttributeInbox::Publish(const ConcreteAttributePath & aPath, bool & aWakeEngine)
+{
+    return PublishInternal(aPath, 0, nullptr, 0, aWakeEngine);
+}
+
+CHIP_ERROR DirtyAttributeInbox::Publish(const ConcreteAttributePath & aPath, EmberAfAttributeType aType, const uint8_t * aValue,
+                                        uint16_t aSize, bool & aWakeEngine)
+{
+    VerifyOrReturnError(aValue != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    return PublishInternal(aPath, aType, aValue, aSize, aWakeEngine);
+}
+
+CHIP_ERROR DirtyAttributeInbox::PublishInternal(const ConcreteAttributePath & aPath, EmberAfAttributeType aType,
+                                                const uint8_t * aValue, uint16_t aSize, bool & aWakeEngine)
+{
+    aWakeEngine = false;
+    VerifyOrReturnError(mInitialized, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(aSize <= CHIP_IM_SERVER_MAX_PUBLISHED_ATTRIBUTE_VALUE_SIZE, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    Shard & shard  = ShardFor(aPath);
+    Entry * entry  = nullptr;
+    bool isNewPath = false;
+
+    shard.mLock.Lock();
+    for (size_t i = 0; i < shard.mCount; i++)
+    {
+        if (shard.mEntries[i].mPath == aPath)
+        {
+            entry = &shard.mEntries[i];
+            break;
+        }
+    }
+    if (entry == nullptr && shard.mCount < kEntriesPerShard)
+    {
+        entry            = &shard.mEntries[shard.mCount++];
+        entry->mPath     = aPath;
+        entry->mHasValue = false;
+        isNewPath        = true;
+    }
+    if (entry != nullptr && aValue != nullptr)
+    {
+        entry->mHasValue  = true;
+        entry->mType      = aType;
+        entry->mValueSize = aSize;
+        memcpy(entry->mValue, aValue, aSize);
+    }
+    shard.mLock.Unlock();
+
+    VerifyOrReturnError(entry != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    // A coalesced change is drained along with the entry it was merged into, which already asked for a drain.
+    if (isNewPath)
+    {
+        aWakeEngine = !mDrainPending.exchange(true);
+    }
+    return CHIP_NO_ERROR;
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -0,0 +1,165 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the inbox collecting attribute changes published from any thread for the reporting engine.
+ *
+ */
+
+#pragma once
+
+#include <app/ConcreteAttributePath.h>
+#include <app/util/attribute-metadata.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <system/SystemMutex.h>
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/*
+ *  @class DirtyAttributeInbox
+ *
+ *  @brief Collects attribute changes published by application threads that do not hold the CHIP stack lock, until the
+ * reporting engine drains them on the CHIP thread.
+ *
+ *         Changes are spread over a few independently locked shards, so that publishers only contend with publishers of
+ * the same shard and never with the CHIP thread processing. Repeated changes of an attribute before the next drain are
+ * coalesced into one entry, keeping the last published value.
+ */
+class DirtyAttributeInbox
+{
+public:
+    struct Entry
+    {
+        ConcreteAttributePath mPath;
+        bool mHasValue             = false;
+        EmberAfAttributeType mType = 0;
+        uint16_t mValueSize        = 0;
+        uint8_t mValue[CHIP_IM_SERVER_MAX_PUBLISHED_ATTRIBUTE_VALUE_SIZE];
+    };
+
+    /**
+     * Initialize the shard locks. Does nothing if already initialized.
+     */
+    CHIP_ERROR Init();
+
+    /**
+     * Publish a change of the given attribute, whose new value is already stored by the application. Can be called from
+     * any thread.
+     *
+     * @param[out] aWakeEngine  Set to true when the change is the first one since the last drain, in which case the caller
+     *                          has to get the inbox drained.
+     *
+     * @retval #CHIP_ERROR_NO_MEMORY if CHIP_IM_SERVER_MAX_NUM_PUBLISHED_ATTRIBUTE_CHANGES distinct attributes are pending.
+     */
+    CHIP_ERROR Publish(const ConcreteAttributePath & aPath, bool & aWakeEngine);
+
+    /**
+     * Same as above, with a new value to write into the attribute storage when the change is drained. A change published
+     * without a value does not drop a value published before.
+     *
+     * @retval #CHIP_ERROR_BUFFER_TOO_SMALL if the value is larger than CHIP_IM_SERVER_MAX_PUBLISHED_ATTRIBUTE_VALUE_SIZE.
+     */
+    CHIP_ERROR Publish(const ConcreteAttributePath & aPath, EmberAfAttributeType aType, const uint8_t * aValue, uint16_t aSize,
+                       bool & aWakeEngine);
+
+    /**
+     * Remove all pending changes, calling aHandler(const Entry &) for each one without holding any lock. Changes published
+     * while draining are either handled by this call or left for the next one. Must only be called from one thread at a time.
+     *
+     * Returns the number of changes handled.
+     */
+    template <typename Handler>
+    size_t Drain(Handler && aHandler)
+    {
+        // Changes published from now on need another drain
+        mDrainPending.store(false);
+
+        size_t drained = 0;
+        for (auto & shard : mShards)
+        {
+            Entry pending[kEntriesPerShard];
+            size_t count = 0;
+
+            shard.mLock.Lock();
+            count = shard.mCount;
+            for (size_t i = 0; i < count; i++)
+            {
+                pending[i] = shard.mEntries[i];
+            }
+            shard.mCount = 0;
+            shard.mLock.Unlock();
+
+            for (size_t i = 0; i < count; i++)
+            {
+                aHandler(pending[i]);
+            }
+            drained += count;
+        }
+        return drained;
+    }
+
+    /**
+     * To be called when the caller told to wake the engine by Publish could not do it, so that the next change tries again.
+     */
+    void CancelWake() { mDrainPending.store(false); }
+
+private:
+    static constexpr size_t kShardCount      = 4;
+    static constexpr size_t kEntriesPerShard = (CHIP_IM_SERVER_MAX_NUM_PUBLISHED_ATTRIBUTE_CHANGES + kShardCount - 1) / kShardCount;
+
+    struct Shard
+    {
+        System::Mutex mLock;
+        size_t mCount = 0;
+        Entry mEntries[kEntriesPerShard];
+    };
+
+    CHIP_ERROR PublishInternal(const ConcreteAttributePath & aPath, EmberAfAttributeType aType, const uint8_t * aValue,
+                               uint16_t aSize, bool & aWakeEngine);
+
+    Shard & ShardFor(const ConcreteAttributePath & aPath)
+    {
+        return mShards[(aPath.mEndpointId * 31u + aPath.mClusterId * 7u + aPath.mAttributeId) % kShardCount];
+    }
+
+    Shard mShards[kShardCount];
+    std::atomic<bool> mDrainPending{ false };
+    bool mInitialized = false;
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
+
+/*
+ * Called on the CHIP thread, with the stack locked, for every change drained from the DirtyAttributeInbox by the reporting
+ * engine. aValue is nullptr when the change was published without a value.
+ *
+ * The default implementation marks the attribute dirty; data model implementations override it to also write the value
+ * and bump the cluster data version.
+ */
+void MatterPublishedAttributeChangeCallback(const chip::app::ConcreteAttributePath & aPath, EmberAfAttributeType aType,
+                                            const uint8_t * aValue, uint16_t aSize);
@@ -28,26 +28,42 @@
 #include <app/RequiredPrivilege.h>
 #include <app/reporting/Engine.h>
 #include <app/util/MatterCallbacks.h>
+#include <platform/CHIPDeviceLayer.h>
 
 using namespace chip::Access;
 
 namespace chip {
 namespace app {
 namespace reporting {
+
+constexpr System::Clock::Milliseconds32 Engine::kMinReportRetryDelay;
+
 CHIP_ERROR Engine::Init()
 {
     mNumReportsInFlight = 0;
-    mCurReadHandlerIdx  = 0;
-    return CHIP_NO_ERROR;
+    return mDirtyAttributeInbox.Init();
 }
 
 void Engine::Shutdown()
 {
+    // Changes published from now on are not reported
+    mDirtyAttributeInbox.Drain([](const DirtyAttributeInbox::Entry &) {});
+
     // Flush out the event buffer synchronously
     ScheduleUrgentEventDeliverySync();
 
+    System::Layer * systemLayer = GetSystemLayer();
+    if (systemLayer != nullptr)
+    {
+        systemLayer->CancelTimer(OnRetryDelayElapsed, this);
+    }
+
+    while (!mReportQueue.Empty())
+    {
+        DequeueReport(*mReportQueue.begin());
+    }
+
     mNumReportsInFlight = 0;
-    mCurReadHandlerIdx  = 0;
     mGlobalDirtySet.ReleaseAll();
 }
 
@@ -133,24 +149,33 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
             if (!apReadHandler->IsPriming())
             {
                 bool concretePathDirty = false;
+                bool clusterDirty      = false;
+                const AttributePathParams clusterPath(readPath.mEndpointId, readPath.mClusterId);
                 // TODO: Optimize this implementation by making the iterator only emit intersected paths.
                 mGlobalDirtySet.ForEachActiveObject([&](auto * dirtyPath) {
+                    // We don't need to worry about paths that were already marked dirty before the last time this read handler
+                    // started a report that it completed: those paths already got reported.
+                    if (dirtyPath->mGeneration <= apReadHandler->mPreviousReportsBeginGeneration)
+                    {
+                        return Loop::Continue;
+                    }
                     if (dirtyPath->IsAttributePathSupersetOf(readPath))
                     {
-                        // We don't need to worry about paths that were already marked dirty before the last time this read handler
-                        // started a report that it completed: those paths already got reported.
-                        if (dirtyPath->mGeneration > apReadHandler->mPreviousReportsBeginGeneration)
-                        {
-                            concretePathDirty = true;
-                            return Loop::Break;
-                        }
+                        concretePathDirty = true;
+                        return Loop::Break;
                     }
+                    clusterDirty = clusterDirty || dirtyPath->Intersects(clusterPath);
                     return Loop::Continue;
                 });
 
                 if (!concretePathDirty)
                 {
-                    // This attribute is not dirty, we just skip this one.
+                    // This attribute is not dirty, we just skip this one, along with the rest of the cluster when none of its
+                    // attributes is dirty.
+                    if (!clusterDirty)
+                    {
+                        apReadHandler->GetAttributePathExpandIterator()->SkipCurrentCluster();
+                    }
                     continue;
                 }
             }
@@ -158,6 +183,8 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
             {
                 if (IsClusterDataVersionMatch(apReadHandler->GetDataVersionFilterList(), readPath))
                 {
+                    // The data version is per cluster, so none of the other attributes of the cluster need to be read either.
+                    apReadHandler->GetAttributePathExpandIterator()->SkipCurrentCluster();
                     continue;
                 }
             }
@@ -448,10 +475,11 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     CHIP_ERROR err = CHIP_NO_ERROR;
     chip::System::PacketBufferTLVWriter reportDataWriter;
     ReportDataMessage::Builder reportDataBuilder;
-    chip::System::PacketBufferHandle bufHandle = System::PacketBufferHandle::New(chip::app::kMaxSecureSduLengthBytes);
-    uint16_t reservedSize                      = 0;
-    bool hasMoreChunks                         = false;
-    bool needCloseReadHandler                  = false;
+    chip::System::PacketBufferHandle bufHandle;
+    size_t maxSduLength       = kMaxSecureSduLengthBytes;
+    uint16_t reservedSize     = 0;
+    bool hasMoreChunks        = false;
+    bool needCloseReadHandler = false;
 
     // Reserved size for the MoreChunks boolean flag, which takes up 1 byte for the control tag and 1 byte for the context tag.
     const uint32_t kReservedSizeForMoreChunksFlag = 1 + 1;
@@ -466,13 +494,26 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     // Reserved size for an empty EventReportIBs, so we can at least check if there are any events need to be reported.
     const uint32_t kReservedSizeForEventReportIBs = 3; // type, tag, end of container
 
+    mLastReportLength = 0;
+
     VerifyOrExit(apReadHandler != nullptr, err = CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrExit(apReadHandler->GetSession() != nullptr, err = CHIP_ERROR_INCORRECT_STATE);
+
+    // Sessions over a stream transport carry the whole report in one message instead of 1280-byte chunks.
+    if (apReadHandler->GetSession()->AllowsLargePayload())
+    {
+        maxSduLength = kMaxLargeSecureSduLengthBytes;
+        bufHandle    = System::PacketBufferHandle::NewLarge(maxSduLength);
+    }
+    else
+    {
+        bufHandle = System::PacketBufferHandle::New(maxSduLength);
+    }
     VerifyOrExit(!bufHandle.IsNull(), err = CHIP_ERROR_NO_MEMORY);
 
-    if (bufHandle->AvailableDataLength() > kMaxSecureSduLengthBytes)
+    if (bufHandle->AvailableDataLength() > maxSduLength)
     {
-        reservedSize = static_cast<uint16_t>(bufHandle->AvailableDataLength() - kMaxSecureSduLengthBytes);
+        reservedSize = static_cast<uint16_t>(bufHandle->AvailableDataLength() - maxSduLength);
     }
 
     reportDataWriter.Init(std::move(bufHandle));
@@ -481,7 +522,7 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     reportDataWriter.ReserveBuffer(mReservedSize);
 #endif
 
-    // Always limit the size of the generated packet to fit within kMaxSecureSduLengthBytes regardless of the available buffer
+    // Always limit the size of the generated packet to fit within maxSduLength regardless of the available buffer
     // capacity.
     // Also, we need to reserve some extra space for the MIC field.
     reportDataWriter.ReserveBuffer(static_cast<uint32_t>(reservedSize + chip::Crypto::CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES));
@@ -552,13 +593,14 @@ CHIP_ERROR Engine::BuildAndSendSingleReportData(ReadHandler * apReadHandler)
     err = reportDataWriter.Finalize(&bufHandle);
     SuccessOrExit(err);
 
-    ChipLogDetail(DataManagement, "<RE> Sending report (payload has %" PRIu32 " bytes)...", reportDataWriter.GetLengthWritten());
+    mLastReportLength = reportDataWriter.GetLengthWritten();
+    ChipLogDetail(DataManagement, "<RE> Sending report (payload has %" PRIu32 " bytes)...", mLastReportLength);
     err = SendReport(apReadHandler, std::move(bufHandle), hasMoreChunks);
     VerifyOrExit(err == CHIP_NO_ERROR,
                  ChipLogError(DataManagement, "<RE> Error sending out report data with %" CHIP_ERROR_FORMAT "!", err.Format()));
 
-    ChipLogDetail(DataManagement, "<RE> ReportsInFlight = %" PRIu32 " with readHandler %" PRIu32 ", RE has %s", mNumReportsInFlight,
-                  mCurReadHandlerIdx, hasMoreChunks ? "more messages" : "no more messages");
+    ChipLogDetail(DataManagement, "<RE> ReportsInFlight = %" PRIu32 " with fabric %u, RE has %s", mNumReportsInFlight,
+                  apReadHandler->GetAccessingFabricIndex(), hasMoreChunks ? "more messages" : "no more messages");
 
 exit:
     if (err != CHIP_NO_ERROR || (apReadHandler->IsType(ReadHandler::InteractionType::Read) && !hasMoreChunks) ||
@@ -582,24 +624,34 @@ void Engine::Run(System::Layer * aSystemLayer, void * apAppState)
     pEngine->Run();
 }
 
-CHIP_ERROR Engine::ScheduleRun()
+void Engine::OnRetryDelayElapsed(System::Layer * aSystemLayer, void * apAppState)
 {
-    if (mRunScheduled)
-    {
-        return CHIP_NO_ERROR;
-    }
+    reinterpret_cast<Engine *>(apAppState)->ScheduleRun();
+}
 
+System::Layer * Engine::GetSystemLayer() const
+{
     Messaging::ExchangeManager * exchangeManager = InteractionModelEngine::GetInstance()->GetExchangeManager();
     if (exchangeManager == nullptr)
     {
-        return CHIP_ERROR_INCORRECT_STATE;
+        return nullptr;
     }
     SessionManager * sessionManager = exchangeManager->GetSessionManager();
     if (sessionManager == nullptr)
     {
-        return CHIP_ERROR_INCORRECT_STATE;
+        return nullptr;
     }
-    System::Layer * systemLayer = sessionManager->SystemLayer();
+    return sessionManager->SystemLayer();
+}
+
+CHIP_ERROR Engine::ScheduleRun()
+{
+    if (mRunScheduled)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    System::Layer * systemLayer = GetSystemLayer();
     if (systemLayer == nullptr)
     {
         return CHIP_ERROR_INCORRECT_STATE;
@@ -609,46 +661,137 @@ CHIP_ERROR Engine::ScheduleRun()
     return CHIP_NO_ERROR;
 }
 
+ReportCandidate Engine::MakeReportCandidate(const ReadHandler & aReadHandler) const
+{
+    ReportCandidate candidate;
+    candidate.mFabricIndex = aReadHandler.GetAccessingFabricIndex();
+    candidate.mQueuedSince = aReadHandler.mReportQueuedTime.Value();
+
+    if (aReadHandler.IsPriming())
+    {
+        candidate.mUrgency = ReportCandidate::Urgency::kPriming;
+    }
+    else if (aReadHandler.mFlags.Has(ReadHandler::ReadHandlerFlags::ForceDirty))
+    {
+        // Established subscriptions are only forced dirty to deliver an urgent event.
+        candidate.mUrgency = ReportCandidate::Urgency::kUrgentEvent;
+    }
+    else if (!aReadHandler.IsDirty())
+    {
+        candidate.mUrgency = ReportCandidate::Urgency::kKeepAlive;
+    }
+    else
+    {
+        candidate.mUrgency = ReportCandidate::Urgency::kDirty;
+    }
+    return candidate;
+}
+
+void Engine::RecordQueueingDelay(const ReportCandidate & aCandidate, System::Clock::Timestamp aNow)
+{
+    ReportQueueingStats & stats         = mReportQueueingStats[static_cast<size_t>(aCandidate.mUrgency)];
+    System::Clock::Milliseconds64 delay = aNow - aCandidate.mQueuedSince;
+
+    stats.mReportCount++;
+    stats.mTotalDelay += delay;
+    stats.mMaxDelay = std::max(stats.mMaxDelay, delay);
+}
+
+void Engine::UpdateReportQueue(ReadHandler & aReadHandler, System::Clock::Timestamp aNow)
+{
+    if (!aReadHandler.IsReportable())
+    {
+        DequeueReport(aReadHandler);
+        return;
+    }
+    if (!aReadHandler.IsInList())
+    {
+        aReadHandler.mReportQueuedTime.SetValue(aNow);
+        mReportQueue.PushBack(&aReadHandler);
+    }
+}
+
+void Engine::DequeueReport(ReadHandler & aReadHandler)
+{
+    if (aReadHandler.IsInList())
+    {
+        mReportQueue.Remove(&aReadHandler);
+    }
+    aReadHandler.mReportQueuedTime.ClearValue();
+}
+
 void Engine::Run()
 {
-    uint32_t numReadHandled = 0;
+    bool hasDeferredReports = false;
+
+    DrainDirtyAttributeInbox();
 
     InteractionModelEngine * imEngine = InteractionModelEngine::GetInstance();
+    System::Clock::Timestamp now      = System::SystemClock().GetMonotonicTimestamp();
+
+    mpReportScheduler->OnRunStarted(now);
 
-    // We may be deallocating read handlers as we go.  Track how many we had
-    // initially, so we make sure to go through all of them.
-    size_t initialAllocated = imEngine->mReadHandlers.Allocated();
-    while ((mNumReportsInFlight < CHIP_IM_MAX_REPORTS_IN_FLIGHT) && (numReadHandled < initialAllocated))
+    // Reports still queued from an earlier run keep their place; handlers with nothing left to send are dropped.
+    imEngine->mReadHandlers.ForEachActiveObject([&](ReadHandler * handler) {
+        UpdateReportQueue(*handler, now);
+        return Loop::Continue;
+    });
+
+    // A handler leaves the queue when its report is sent, so this ends once every queued report was sent or held back.
+    // Handlers may be deallocated as we go, and unlink themselves, so no iterator is kept across a report.
+    while (mNumReportsInFlight < CHIP_IM_MAX_REPORTS_IN_FLIGHT)
     {
-        ReadHandler * readHandler = imEngine->ActiveHandlerAt(mCurReadHandlerIdx % (uint32_t) imEngine->mReadHandlers.Allocated());
-        VerifyOrDie(readHandler != nullptr);
+        ReadHandler * nextHandler = nullptr;
+        ReportCandidate nextCandidate;
+        hasDeferredReports = false;
 
-        if (readHandler->IsReportable())
+        for (auto it = mReportQueue.begin(); it != mReportQueue.end();)
         {
-            mRunningReadHandler = readHandler;
-            CHIP_ERROR err      = BuildAndSendSingleReportData(readHandler);
-            mRunningReadHandler = nullptr;
-            if (err != CHIP_NO_ERROR)
+            ReadHandler & handler = *it;
+            ++it;
+
+            if (!handler.IsReportable())
             {
-                return;
+                DequeueReport(handler);
+                continue;
             }
+
+            ReportCandidate candidate = MakeReportCandidate(handler);
+            if (!mpReportScheduler->IsSendAllowed(candidate))
+            {
+                hasDeferredReports = true;
+            }
+            else if (nextHandler == nullptr || mpReportScheduler->ShouldPrecede(candidate, nextCandidate))
+            {
+                nextHandler   = &handler;
+                nextCandidate = candidate;
+            }
+        }
+
+        if (nextHandler == nullptr)
+        {
+            break;
         }
 
-        numReadHandled++;
-        // If readHandler removed itself from our list, we also decremented
-        // mCurReadHandlerIdx to account for that removal, so it's safe to
-        // increment here.
-        mCurReadHandlerIdx++;
+        RecordQueueingDelay(nextCandidate, now);
+        DequeueReport(*nextHandler);
+
+        CHIP_ERROR err = BuildAndSendSingleReportData(nextHandler);
+        if (err != CHIP_NO_ERROR)
+        {
+            return;
+        }
+
+        mpReportScheduler->OnReportSent(nextCandidate, mLastReportLength);
     }
 
-    //
-    // If our tracker has exceeded the bounds of the handler list, reset it back to 0.
-    // This isn't strictly necessary, but does make it easier to debug issues in this code if they
-    // do arise.
-    //
-    if (mCurReadHandlerIdx >= imEngine->mReadHandlers.Allocated())
+    if (hasDeferredReports)
     {
-        mCurReadHandlerIdx = 0;
+        System::Layer * systemLayer = GetSystemLayer();
+        if (systemLayer != nullptr)
+        {
+            systemLayer->StartTimer(std::max(mpReportScheduler->GetRetryDelay(), kMinReportRetryDelay), OnRetryDelayElapsed, this);
+        }
     }
 
     bool allReadClean = true;
@@ -849,6 +992,66 @@ CHIP_ERROR Engine::SetDirty(AttributePathParams & aAttributePath)
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR Engine::PublishAttributeChange(const ConcreteAttributePath & aPath)
+{
+    bool wakeEngine = false;
+    ReturnErrorOnFailure(mDirtyAttributeInbox.Publish(aPath, wakeEngine));
+    ScheduleDirtyAttributeInboxDrain(wakeEngine);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR Engine::PublishAttributeChange(const ConcreteAttributePath & aPath, EmberAfAttributeType aType, const uint8_t * aValue,
+                                          uint16_t aSize)
+{
+    bool wakeEngine = false;
+    ReturnErrorOnFailure(mDirtyAttributeInbox.Publish(aPath, aType, aValue, aSize, wakeEngine));
+    ScheduleDirtyAttributeInboxDrain(wakeEngine);
+    return CHIP_NO_ERROR;
+}
+
+void Engine::ScheduleDirtyAttributeInboxDrain(bool aWakeEngine)
+{
+    if (!aWakeEngine)
+    {
+        return;
+    }
+
+    // ScheduleRun is not thread-safe, go through the platform event queue instead.
+    DeviceLayer::ChipDeviceEvent event;
+    event.Type                    = DeviceLayer::DeviceEventType::kCallWorkFunct;
+    event.CallWorkFunct.WorkFunct = DrainDirtyAttributeInboxWork;
+    event.CallWorkFunct.Arg       = reinterpret_cast<intptr_t>(this);
+
+    CHIP_ERROR err = DeviceLayer::PlatformMgr().PostEvent(&event);
+    if (err != CHIP_NO_ERROR)
+    {
+        // The changes stay in the inbox until the next run; let the next published change try again.
+        ChipLogError(DataManagement, "Failed to schedule published attribute changes: %" CHIP_ERROR_FORMAT, err.Format());
+        mDirtyAttributeInbox.CancelWake();
+    }
+}
+
+void Engine::DrainDirtyAttributeInboxWork(intptr_t aEngine)
+{
+    Engine * engine = reinterpret_cast<Engine *>(aEngine);
+
+    CHIP_ERROR err = engine->ScheduleRun();
+    if (err != CHIP_NO_ERROR)
+    {
+        // As when posting the event fails: the inbox is only drained by a run, so let the next published change try again.
+        ChipLogError(DataManagement, "Failed to schedule published attribute changes: %" CHIP_ERROR_FORMAT, err.Format());
+        engine->mDirtyAttributeInbox.CancelWake();
+    }
+}
+
+void Engine::DrainDirtyAttributeInbox()
+{
+    mDirtyAttributeInbox.Drain([](const DirtyAttributeInbox::Entry & entry) {
+        MatterPublishedAttributeChangeCallback(entry.mPath, entry.mType, entry.mHasValue ? entry.mValue : nullptr,
+                                               entry.mValueSize);
+    });
+}
+
 CHIP_ERROR Engine::SendReport(ReadHandler * apReadHandler, System::PacketBufferHandle && aPayload, bool aHasMoreChunks)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -972,3 +1175,10 @@ void Engine::ScheduleUrgentEventDeliverySync(Optional<FabricIndex> fabricIndex)
 
 void __attribute__((weak)) MatterPreAttributeReadCallback(const chip::app::ConcreteAttributePath & attributePath) {}
 void __attribute__((weak)) MatterPostAttributeReadCallback(const chip::app::ConcreteAttributePath & attributePath) {}
+void __attribute__((weak))
+MatterPublishedAttributeChangeCallback(const chip::app::ConcreteAttributePath & aPath, EmberAfAttributeType aType,
+                                       const uint8_t * aValue, uint16_t aSize)
+{
+    chip::app::AttributePathParams path(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId);
+    chip::app::InteractionModelEngine::GetInstance()->GetReportingEngine().SetDirty(path);
+}
@@ -27,6 +27,8 @@
 #include <access/AccessControl.h>
 #include <app/MessageDef/ReportDataMessage.h>
 #include <app/ReadHandler.h>
+#include <app/reporting/DirtyAttributeInbox.h>
+#include <app/reporting/ReportScheduler.h>
 #include <app/util/basic-types.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/support/CodeUtils.h>
@@ -86,6 +88,22 @@ public:
      */
     CHIP_ERROR SetDirty(AttributePathParams & aAttributePathParams);
 
+    /**
+     * Thread-safe counterpart of SetDirty: can be called from any thread without holding the CHIP stack lock. The change is
+     * queued, coalesced with the pending changes of the same attribute, and handled at the start of the next Run through
+     * MatterPublishedAttributeChangeCallback.
+     *
+     * @retval #CHIP_ERROR_NO_MEMORY if too many distinct attributes already have pending changes.
+     */
+    CHIP_ERROR PublishAttributeChange(const ConcreteAttributePath & aPath);
+
+    /**
+     * Same as above, with a new value of at most CHIP_IM_SERVER_MAX_PUBLISHED_ATTRIBUTE_VALUE_SIZE bytes to store
+     * before reporting the change.
+     */
+    CHIP_ERROR PublishAttributeChange(const ConcreteAttributePath & aPath, EmberAfAttributeType aType, const uint8_t * aValue,
+                                      uint16_t aSize);
+
     /**
      * @brief
      *  Schedule the event delivery
@@ -93,25 +111,31 @@ public:
      */
     CHIP_ERROR ScheduleEventDelivery(ConcreteEventPath & aPath, uint32_t aBytesWritten);
 
-    /*
-     * Resets the tracker that tracks the currently serviced read handler.
-     * apReadHandler can be non-null to indicate that the reset is due to a
-     * specific ReadHandler being deallocated.
+    /**
+     * Sets the scheduler deciding in which order the pending reports are sent. The scheduler must outlive the engine, or be
+     * replaced before it is destroyed. Passing nullptr restores the default scheduler.
      */
-    void ResetReadHandlerTracker(ReadHandler * apReadHandlerBeingDeleted)
+    void SetReportScheduler(ReportScheduler * apReportScheduler)
     {
-        if (apReadHandlerBeingDeleted == mRunningReadHandler)
-        {
-            // Just decrement, so our increment after we finish running it will
-            // do the right thing.
-            --mCurReadHandlerIdx;
-        }
-        else
+        mpReportScheduler = (apReportScheduler != nullptr) ? apReportScheduler : &mDefaultReportScheduler;
+    }
+
+    DefaultReportScheduler & GetDefaultReportScheduler() { return mDefaultReportScheduler; }
+
+    /**
+     * Time the reports of the given urgency waited between the first run of the engine that found them pending and the run
+     * that sent them.
+     */
+    const ReportQueueingStats & GetReportQueueingStats(ReportCandidate::Urgency aUrgency) const
+    {
+        return mReportQueueingStats[static_cast<size_t>(aUrgency)];
+    }
+
+    void ResetReportQueueingStats()
+    {
+        for (auto & stats : mReportQueueingStats)
         {
-            // No idea what to do here to make the indexing sane.  Just start at
-            // the beginning.  We need to do better here; see
-            // https://github.com/project-chip/connectedhomeip/issues/13809
-            mCurReadHandlerIdx = 0;
+            stats = ReportQueueingStats();
         }
     }
 
@@ -152,6 +176,19 @@ private:
      */
     CHIP_ERROR BuildAndSendSingleReportData(ReadHandler * apReadHandler);
 
+    /**
+     * Describe a read handler that has a report to send for the report scheduler.
+     */
+    ReportCandidate MakeReportCandidate(const ReadHandler & aReadHandler) const;
+
+    void RecordQueueingDelay(const ReportCandidate & aCandidate, System::Clock::Timestamp aNow);
+
+    /**
+     * Queue the read handler if it got a report to send, or drop it from the queue if it no longer has one.
+     */
+    void UpdateReportQueue(ReadHandler & aReadHandler, System::Clock::Timestamp aNow);
+    void DequeueReport(ReadHandler & aReadHandler);
+
     CHIP_ERROR BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Builder & reportDataBuilder, ReadHandler * apReadHandler,
                                                        bool * apHasMoreChunks, bool * apHasEncodedData);
     CHIP_ERROR BuildSingleReportDataEventReports(ReportDataMessage::Builder & reportDataBuilder, ReadHandler * apReadHandler,
@@ -182,6 +219,19 @@ private:
      */
     static void Run(System::Layer * aSystemLayer, void * apAppState);
 
+    /**
+     * Run again once the report scheduler allows the reports it held back to be sent.
+     */
+    static void OnRetryDelayElapsed(System::Layer * aSystemLayer, void * apAppState);
+
+    /**
+     * Shortest wait before running again for held back reports, so that a scheduler asking for no delay does not keep the
+     * engine spinning.
+     */
+    static constexpr System::Clock::Milliseconds32 kMinReportRetryDelay = System::Clock::Milliseconds32(10);
+
+    System::Layer * GetSystemLayer() const;
+
     CHIP_ERROR ScheduleBufferPressureEventDelivery(uint32_t aBytesWritten);
     void GetMinEventLogPosition(uint32_t & aMinLogPosition);
 
@@ -218,6 +268,17 @@ private:
 
     CHIP_ERROR InsertPathIntoDirtySet(const AttributePathParams & aAttributePath);
 
+    /**
+     * Get the published attribute changes handled on the CHIP thread, after the first change since the last drain.
+     */
+    void ScheduleDirtyAttributeInboxDrain(bool aWakeEngine);
+    static void DrainDirtyAttributeInboxWork(intptr_t aEngine);
+
+    /**
+     * Hand the attribute changes published from other threads over to MatterPublishedAttributeChangeCallback.
+     */
+    void DrainDirtyAttributeInbox();
+
     inline void BumpDirtySetGeneration() { mDirtyGeneration++; }
 
     /**
@@ -234,15 +295,21 @@ private:
     uint32_t mNumReportsInFlight = 0;
 
     /**
-     *  Current read handler index
+     * The length of the last report sent by BuildAndSendSingleReportData
      *
      */
-    uint32_t mCurReadHandlerIdx = 0;
+    uint32_t mLastReportLength = 0;
+
+    DefaultReportScheduler mDefaultReportScheduler;
+    ReportScheduler * mpReportScheduler = &mDefaultReportScheduler;
 
     /**
-     * The read handler we're calling BuildAndSendSingleReportData on right now.
+     * The read handlers with a report to send, in the order they were found to have one. A read handler unlinks itself
+     * when it is destroyed.
      */
-    ReadHandler * mRunningReadHandler = nullptr;
+    IntrusiveList<ReadHandler, IntrusiveMode::AutoUnlink> mReportQueue;
+
+    ReportQueueingStats mReportQueueingStats[ReportCandidate::kUrgencyCount];
 
     /**
      *  mGlobalDirtySet is used to track the set of attribute/event paths marked dirty for reporting purposes.
@@ -269,6 +336,11 @@ private:
      */
     uint64_t mDirtyGeneration = 1;
 
+    /**
+     * Attribute changes published from any thread, waiting to be marked dirty on the CHIP thread.
+     */
+    DirtyAttributeInbox mDirtyAttributeInbox;
+
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     uint32_t mReservedSize          = 0;
     uint32_t mMaxAttributesPerChunk = UINT32_MAX;
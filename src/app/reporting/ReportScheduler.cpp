@@ -0,0 +1,140 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/ReportScheduler.h>
+
+#include <algorithm>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+void DefaultReportScheduler::SetBandwidthBudget(uint32_t aBytesPerSecond)
+{
+    mBytesPerSecond = aBytesPerSecond;
+    mAvailableBytes = aBytesPerSecond;
+}
+
+void DefaultReportScheduler::OnRunStarted(System::Clock::Timestamp aNow)
+{
+    System::Clock::Milliseconds64 elapsed = aNow > mLastRefillTime ? aNow - mLastRefillTime : System::Clock::kZero;
+
+    uint64_t missingBytes = static_cast<uint64_t>(mBytesPerSecond - mAvailableBytes);
+    if (mBytesPerSecond == 0 || missingBytes == 0)
+    {
+        mLastRefillTime = aNow;
+        return;
+    }
+
+    // Pay back the budget for the time elapsed since the last refill, without saving up more than one second of it.
+    uint64_t fullRefillMs = (missingBytes * 1000 + mBytesPerSecond - 1) / mBytesPerSecond;
+    if (elapsed.count() >= fullRefillMs)
+    {
+        mAvailableBytes = mBytesPerSecond;
+        mLastRefillTime = aNow;
+        return;
+    }
+
+    // Runs closer together than the time it takes to earn a byte carry that time over, rather than losing it.
+    uint64_t refill = elapsed.count() * mBytesPerSecond / 1000;
+    mAvailableBytes += static_cast<int64_t>(refill);
+    mLastRefillTime += System::Clock::Milliseconds64(refill * 1000 / mBytesPerSecond);
+}
+
+bool DefaultReportScheduler::IsSendAllowed(const ReportCandidate & aCandidate) const
+{
+    if (mBytesPerSecond == 0 || aCandidate.mUrgency >= ReportCandidate::Urgency::kKeepAlive)
+    {
+        return true;
+    }
+    return mAvailableBytes > 0;
+}
+
+bool DefaultReportScheduler::ShouldPrecede(const ReportCandidate & aCandidate, const ReportCandidate & aOther) const
+{
+    if (aCandidate.mUrgency != aOther.mUrgency)
+    {
+        return aCandidate.mUrgency > aOther.mUrgency;
+    }
+
+    uint64_t candidateLastServed = GetLastServed(aCandidate.mFabricIndex);
+    uint64_t otherLastServed     = GetLastServed(aOther.mFabricIndex);
+    if (candidateLastServed != otherLastServed)
+    {
+        return candidateLastServed < otherLastServed;
+    }
+
+    return aCandidate.mQueuedSince < aOther.mQueuedSince;
+}
+
+void DefaultReportScheduler::OnReportSent(const ReportCandidate & aCandidate, uint32_t aLength)
+{
+    mReportsSent++;
+    if (mBytesPerSecond != 0)
+    {
+        mAvailableBytes -= aLength;
+    }
+
+    // Reuse the entry of the fabric, or else the one that was sent a report least recently: forgetting about a fabric only
+    // gives its next report precedence.
+    FabricState * state = &mFabrics[0];
+    for (auto & fabric : mFabrics)
+    {
+        if (fabric.mInUse && fabric.mIndex == aCandidate.mFabricIndex)
+        {
+            state = &fabric;
+            break;
+        }
+        if (!fabric.mInUse || (state->mInUse && fabric.mLastServed < state->mLastServed))
+        {
+            state = &fabric;
+        }
+    }
+
+    state->mInUse      = true;
+    state->mIndex      = aCandidate.mFabricIndex;
+    state->mLastServed = mReportsSent;
+}
+
+System::Clock::Milliseconds32 DefaultReportScheduler::GetRetryDelay() const
+{
+    if (mBytesPerSecond == 0 || mAvailableBytes > 0)
+    {
+        return System::Clock::kZero;
+    }
+
+    // Time until some budget is available again, rounded up.
+    uint64_t missingBytes = static_cast<uint64_t>(-mAvailableBytes) + 1;
+    return System::Clock::Milliseconds32(static_cast<uint32_t>((missingBytes * 1000 + mBytesPerSecond - 1) / mBytesPerSecond));
+}
+
+uint64_t DefaultReportScheduler::GetLastServed(FabricIndex aFabricIndex) const
+{
+    for (const auto & fabric : mFabrics)
+    {
+        if (fabric.mInUse && fabric.mIndex == aFabricIndex)
+        {
+            return fabric.mLastServed;
+        }
+    }
+    return 0;
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -0,0 +1,160 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the scheduler deciding in which order the reporting engine sends the pending reports.
+ *
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/DataModelTypes.h>
+#include <system/SystemClock.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+/**
+ * A read handler that has a report to send, as seen by the ReportScheduler.
+ */
+struct ReportCandidate
+{
+    // From the least to the most urgent.
+    enum class Urgency : uint8_t
+    {
+        // Reports of a read, or priming reports of a subscription, which can be large.
+        kPriming = 0,
+        // Attribute changes or non-urgent events for an established subscription.
+        kDirty,
+        // The max interval of a subscription has elapsed: an (empty) report is due to keep it alive.
+        kKeepAlive,
+        // An urgent event is waiting to be delivered.
+        kUrgentEvent,
+    };
+    static constexpr size_t kUrgencyCount = 4;
+
+    FabricIndex mFabricIndex = kUndefinedFabricIndex;
+    Urgency mUrgency         = Urgency::kPriming;
+    // When the reporting engine first found the handler with a report to send.
+    System::Clock::Timestamp mQueuedSince = System::Clock::kZero;
+};
+
+/**
+ * Time the reports spent waiting to be sent, for one urgency.
+ */
+struct ReportQueueingStats
+{
+    uint32_t mReportCount                     = 0;
+    System::Clock::Milliseconds64 mTotalDelay = System::Clock::kZero;
+    System::Clock::Milliseconds64 mMaxDelay   = System::Clock::kZero;
+};
+
+/**
+ * Interface of the scheduler the reporting engine asks which pending report to send next.
+ *
+ * At each run, the engine calls OnRunStarted, then repeatedly sends a report for the candidate that precedes all the others
+ * allowed to send, until the maximum number of reports in flight is reached. Candidates that are not allowed to send stay
+ * pending, and the engine runs again after GetRetryDelay().
+ */
+class ReportScheduler
+{
+public:
+    virtual ~ReportScheduler() = default;
+
+    virtual void OnRunStarted(System::Clock::Timestamp aNow) = 0;
+
+    /**
+     * Returns whether a report can be sent for the candidate in the current run.
+     */
+    virtual bool IsSendAllowed(const ReportCandidate & aCandidate) const = 0;
+
+    /**
+     * Returns whether the report for aCandidate should be sent before the report for aOther.
+     */
+    virtual bool ShouldPrecede(const ReportCandidate & aCandidate, const ReportCandidate & aOther) const = 0;
+
+    /**
+     * Called after a report of aLength bytes was sent for the candidate.
+     */
+    virtual void OnReportSent(const ReportCandidate & aCandidate, uint32_t aLength) = 0;
+
+    /**
+     * Returns how long the candidates that were not allowed to send should wait before the engine tries again.
+     */
+    virtual System::Clock::Milliseconds32 GetRetryDelay() const = 0;
+};
+
+/**
+ * The report scheduler used by default.
+ *
+ * Reports are sent from the most to the least urgent. Among reports of the same urgency, the fabric that was sent a report least
+ * recently goes first, so that a fabric with many subscriptions cannot starve the others, then the report that has been waiting
+ * for the longest.
+ *
+ * When given a bandwidth budget, reports other than urgent events and keep-alives are held back once the bytes sent exceed the
+ * budget, until enough time has passed to pay them back.
+ */
+class DefaultReportScheduler : public ReportScheduler
+{
+public:
+    explicit DefaultReportScheduler(uint32_t aBytesPerSecond = CHIP_IM_REPORT_BANDWIDTH_BYTES_PER_SECOND)
+    {
+        SetBandwidthBudget(aBytesPerSecond);
+    }
+
+    /**
+     * Sets the number of bytes per second, or 0 not to limit the reports.
+     */
+    void SetBandwidthBudget(uint32_t aBytesPerSecond);
+
+    void OnRunStarted(System::Clock::Timestamp aNow) override;
+    bool IsSendAllowed(const ReportCandidate & aCandidate) const override;
+    bool ShouldPrecede(const ReportCandidate & aCandidate, const ReportCandidate & aOther) const override;
+    void OnReportSent(const ReportCandidate & aCandidate, uint32_t aLength) override;
+    System::Clock::Milliseconds32 GetRetryDelay() const override;
+
+private:
+    struct FabricState
+    {
+        bool mInUse        = false;
+        FabricIndex mIndex = kUndefinedFabricIndex;
+        // Value of mReportsSent when the last report was sent to this fabric.
+        uint64_t mLastServed = 0;
+    };
+
+    // Returns 0 for fabrics that were never sent a report.
+    uint64_t GetLastServed(FabricIndex aFabricIndex) const;
+
+    uint32_t mBytesPerSecond = 0;
+    // At most one second of budget is saved up while idle. This can go negative, since a report is sent as long as some budget
+    // is left, however large it is.
+    int64_t mAvailableBytes                  = 0;
+    // Time up to which the budget was paid back.
+    System::Clock::Timestamp mLastRefillTime = System::Clock::kZero;
+
+    uint64_t mReportsSent = 0;
+    // One more entry for PASE sessions, which have no fabric.
+    FabricState mFabrics[CHIP_CONFIG_MAX_FABRICS + 1];
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -66,3 +66,20 @@ void MatterReportingAttributeChangeCallback(const chip::app::ConcreteAttributePa
  * Same but only with an EndpointId, this is used when adding / enabling an endpoint during runtime.
  */
 void MatterReportingAttributeChangeCallback(chip::EndpointId endpoint);
+
+/*
+ * Thread-safe variant of MatterReportingAttributeChangeCallback, which can be called from any thread without holding the
+ * CHIP stack lock. The change is handled on the CHIP thread the next time the reporting engine runs; repeated changes of
+ * an attribute until then are reported once.
+ *
+ * Returns CHIP_ERROR_NO_MEMORY when too many distinct attributes already have pending changes, in which case the change
+ * has to be reported with MatterReportingAttributeChangeCallback from the CHIP thread instead.
+ */
+CHIP_ERROR MatterPublishAttributeChange(const chip::app::ConcreteAttributePath & aPath);
+
+/*
+ * Same but also writes the new value into the attribute storage, on the CHIP thread. If several values are published
+ * before the change is handled, only the last one is written.
+ */
+CHIP_ERROR MatterPublishAttributeChange(const chip::app::ConcreteAttributePath & aPath, EmberAfAttributeType type,
+                                        const uint8_t * data, uint16_t size);
@@ -44,6 +44,9 @@ namespace chip {
 namespace app {
 namespace {
 
+// TCP is only advertised when the server transports listen on it.
+constexpr bool kTcpSupported = INET_CONFIG_ENABLE_TCP_ENDPOINT && CHIP_CONFIG_ENABLE_TCP_TRANSPORT;
+
 void OnPlatformEvent(const DeviceLayer::ChipDeviceEvent * event)
 {
     if (event->Type == DeviceLayer::DeviceEventType::kDnssdPlatformInitialized
@@ -162,7 +165,7 @@ CHIP_ERROR DnssdServer::AdvertiseOperational()
                                              .SetPort(GetSecuredPort())
                                              .SetInterfaceId(GetInterfaceId())
                                              .SetLocalMRPConfig(GetLocalMRPConfig())
-                                             .SetTcpSupported(Optional<bool>(INET_CONFIG_ENABLE_TCP_ENDPOINT))
+                                             .SetTcpSupported(Optional<bool>(kTcpSupported))
                                              .EnableIpV4(true);
 
         auto & mdnsAdvertiser = chip::Dnssd::ServiceAdvertiser::Instance();
@@ -254,7 +257,7 @@ CHIP_ERROR DnssdServer::Advertise(bool commissionableNode, chip::Dnssd::Commissi
     advertiseParameters.SetRotatingDeviceId(chip::Optional<const char *>::Value(rotatingDeviceIdHexBuffer));
 #endif
 
-    advertiseParameters.SetLocalMRPConfig(GetLocalMRPConfig()).SetTcpSupported(Optional<bool>(INET_CONFIG_ENABLE_TCP_ENDPOINT));
+    advertiseParameters.SetLocalMRPConfig(GetLocalMRPConfig()).SetTcpSupported(Optional<bool>(kTcpSupported));
 
     if (!HaveOperationalCredentials())
     {
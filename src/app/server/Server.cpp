@@ -65,6 +65,9 @@ using chip::Inet::IPAddressType;
 using chip::Transport::BleListenParameters;
 #endif
 using chip::Transport::PeerAddress;
+#if INET_CONFIG_ENABLE_TCP_ENDPOINT && CHIP_CONFIG_ENABLE_TCP_TRANSPORT
+using chip::Transport::TcpListenParameters;
+#endif
 using chip::Transport::UdpListenParameters;
 
 namespace {
@@ -144,7 +147,12 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
     // Set up attribute persistence before we try to bring up the data model
     // handler.
     SuccessOrExit(mAttributePersister.Init(mDeviceStorage));
+#if CHIP_CONFIG_DEFERRED_ATTRIBUTE_PERSISTENCE
+    SuccessOrExit(mDeferredAttributePersister.Init(mAttributePersister, DeviceLayer::SystemLayer()));
+    SetAttributePersistenceProvider(&mDeferredAttributePersister);
+#else
     SetAttributePersistenceProvider(&mAttributePersister);
+#endif // CHIP_CONFIG_DEFERRED_ATTRIBUTE_PERSISTENCE
 
     {
         FabricTable::InitParams fabricTableInitParams;
@@ -188,6 +196,12 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
 #if CONFIG_NETWORK_LAYER_BLE
                                ,
                            BleListenParameters(DeviceLayer::ConnectivityMgr().GetBleLayer())
+#endif
+#if INET_CONFIG_ENABLE_TCP_ENDPOINT && CHIP_CONFIG_ENABLE_TCP_TRANSPORT
+                               ,
+                           TcpListenParameters(DeviceLayer::TCPEndPointManager())
+                               .SetAddressType(IPAddressType::kIPv6)
+                               .SetListenPort(mOperationalServicePort)
 #endif
     );
 
@@ -431,6 +445,9 @@ void Server::Shutdown()
     mTransports.Close();
     mAccessControl.Finish();
     Credentials::SetGroupDataProvider(nullptr);
+#if CHIP_CONFIG_DEFERRED_ATTRIBUTE_PERSISTENCE
+    mDeferredAttributePersister.Shutdown();
+#endif // CHIP_CONFIG_DEFERRED_ATTRIBUTE_PERSISTENCE
     mAttributePersister.Shutdown();
     // TODO(16969): Remove chip::Platform::MemoryInit() call from Server class, it belongs to outer code
     chip::Platform::MemoryShutdown();
@@ -24,6 +24,8 @@
 #include <app/CASEClientPool.h>
 #include <app/CASESessionManager.h>
 #include <app/DefaultAttributePersistenceProvider.h>
+#include <app/DeferredAttributePersistenceProvider.h>
+#include <app/SnapshotAttributePersistenceProvider.h>
 #include <app/FailSafeContext.h>
 #include <app/OperationalSessionSetupPool.h>
 #include <app/TestEventTriggerDelegate.h>
@@ -60,6 +62,9 @@
 #if CONFIG_NETWORK_LAYER_BLE
 #include <transport/raw/BLE.h>
 #endif
+#if INET_CONFIG_ENABLE_TCP_ENDPOINT && CHIP_CONFIG_ENABLE_TCP_TRANSPORT
+#include <transport/raw/TCP.h>
+#endif
 #include <transport/raw/UDP.h>
 
 namespace chip {
@@ -78,6 +83,11 @@ using ServerTransportMgr = chip::TransportMgr<chip::Transport::UDP
 #if CONFIG_NETWORK_LAYER_BLE
                                               ,
                                               chip::Transport::BLE<kMaxBlePendingPackets>
+#endif
+#if INET_CONFIG_ENABLE_TCP_ENDPOINT && CHIP_CONFIG_ENABLE_TCP_TRANSPORT
+                                              ,
+                                              chip::Transport::TCP<CHIP_CONFIG_MAX_ACTIVE_TCP_CONNECTIONS,
+                                                                   CHIP_CONFIG_MAX_TCP_PENDING_PACKETS>
 #endif
                                               >;
 
@@ -506,7 +516,14 @@ private:
     SessionResumptionStorage * mSessionResumptionStorage;
     Credentials::CertificateValidityPolicy * mCertificateValidityPolicy;
     Credentials::GroupDataProvider * mGroupsProvider;
+#if CHIP_CONFIG_ATTRIBUTE_SNAPSHOTS
+    app::SnapshotAttributePersistenceProvider mAttributePersister;
+#else
     app::DefaultAttributePersistenceProvider mAttributePersister;
+#endif // CHIP_CONFIG_ATTRIBUTE_SNAPSHOTS
+#if CHIP_CONFIG_DEFERRED_ATTRIBUTE_PERSISTENCE
+    app::DeferredAttributePersistenceProvider mDeferredAttributePersister;
+#endif // CHIP_CONFIG_DEFERRED_ATTRIBUTE_PERSISTENCE
     GroupDataProviderListener mListener;
     ServerFabricDelegate mFabricDelegate;
 
@@ -244,6 +244,76 @@ void TestNoWildcard(nlTestSuite * apSuite, void * apContext)
     NL_TEST_ASSERT(apSuite, index == ArraySize(paths));
 }
 
+void TestSkipCurrentCluster(nlTestSuite * apSuite, void * apContext)
+{
+    app::ObjectList<app::AttributePathParams> clusInfo1;
+
+    app::ObjectList<app::AttributePathParams> clusInfo2;
+    clusInfo2.mValue.mEndpointId  = Test::kMockEndpoint2;
+    clusInfo2.mValue.mClusterId   = Test::MockClusterId(2);
+    clusInfo2.mValue.mAttributeId = Test::MockAttributeId(1);
+
+    clusInfo1.mpNext = &clusInfo2;
+
+    // The rest of MockClusterId(2) is skipped after its first attribute, while the concrete path is emitted as-is.
+    app::ConcreteAttributePath path;
+    P paths[] = {
+        { kMockEndpoint1, MockClusterId(1), Clusters::Globals::Attributes::ClusterRevision::Id },
+        { kMockEndpoint1, MockClusterId(1), Clusters::Globals::Attributes::FeatureMap::Id },
+        { kMockEndpoint1, MockClusterId(1), Clusters::Globals::Attributes::GeneratedCommandList::Id },
+        { kMockEndpoint1, MockClusterId(1), Clusters::Globals::Attributes::AcceptedCommandList::Id },
+        { kMockEndpoint1, MockClusterId(1), Clusters::Globals::Attributes::AttributeList::Id },
+        { kMockEndpoint1, MockClusterId(2), Clusters::Globals::Attributes::ClusterRevision::Id },
+        { kMockEndpoint2, MockClusterId(1), Clusters::Globals::Attributes::ClusterRevision::Id },
+        { kMockEndpoint2, MockClusterId(1), Clusters::Globals::Attributes::FeatureMap::Id },
+        { kMockEndpoint2, MockClusterId(1), Clusters::Globals::Attributes::GeneratedCommandList::Id },
+        { kMockEndpoint2, MockClusterId(1), Clusters::Globals::Attributes::AcceptedCommandList::Id },
+        { kMockEndpoint2, MockClusterId(1), Clusters::Globals::Attributes::AttributeList::Id },
+        { kMockEndpoint2, MockClusterId(2), Clusters::Globals::Attributes::ClusterRevision::Id },
+        { kMockEndpoint2, MockClusterId(3), Clusters::Globals::Attributes::ClusterRevision::Id },
+        { kMockEndpoint2, MockClusterId(3), Clusters::Globals::Attributes::FeatureMap::Id },
+        { kMockEndpoint2, MockClusterId(3), MockAttributeId(1) },
+        { kMockEndpoint2, MockClusterId(3), MockAttributeId(2) },
+        { kMockEndpoint2, MockClusterId(3), MockAttributeId(3) },
+        { kMockEndpoint2, MockClusterId(3), Clusters::Globals::Attributes::GeneratedCommandList::Id },
+        { kMockEndpoint2, MockClusterId(3), Clusters::Globals::Attributes::AcceptedCommandList::Id },
+        { kMockEndpoint2, MockClusterId(3), Clusters::Globals::Attributes::AttributeList::Id },
+        { kMockEndpoint3, MockClusterId(1), Clusters::Globals::Attributes::ClusterRevision::Id },
+        { kMockEndpoint3, MockClusterId(1), Clusters::Globals::Attributes::FeatureMap::Id },
+        { kMockEndpoint3, MockClusterId(1), MockAttributeId(1) },
+        { kMockEndpoint3, MockClusterId(1), Clusters::Globals::Attributes::GeneratedCommandList::Id },
+        { kMockEndpoint3, MockClusterId(1), Clusters::Globals::Attributes::AcceptedCommandList::Id },
+        { kMockEndpoint3, MockClusterId(1), Clusters::Globals::Attributes::AttributeList::Id },
+        { kMockEndpoint3, MockClusterId(2), Clusters::Globals::Attributes::ClusterRevision::Id },
+        { kMockEndpoint3, MockClusterId(3), Clusters::Globals::Attributes::ClusterRevision::Id },
+        { kMockEndpoint3, MockClusterId(3), Clusters::Globals::Attributes::FeatureMap::Id },
+        { kMockEndpoint3, MockClusterId(3), Clusters::Globals::Attributes::GeneratedCommandList::Id },
+        { kMockEndpoint3, MockClusterId(3), Clusters::Globals::Attributes::AcceptedCommandList::Id },
+        { kMockEndpoint3, MockClusterId(3), Clusters::Globals::Attributes::AttributeList::Id },
+        { kMockEndpoint3, MockClusterId(4), Clusters::Globals::Attributes::ClusterRevision::Id },
+        { kMockEndpoint3, MockClusterId(4), Clusters::Globals::Attributes::FeatureMap::Id },
+        { kMockEndpoint3, MockClusterId(4), Clusters::Globals::Attributes::GeneratedCommandList::Id },
+        { kMockEndpoint3, MockClusterId(4), Clusters::Globals::Attributes::AcceptedCommandList::Id },
+        { kMockEndpoint3, MockClusterId(4), Clusters::Globals::Attributes::AttributeList::Id },
+        { kMockEndpoint2, MockClusterId(2), MockAttributeId(1) },
+    };
+
+    size_t index = 0;
+
+    for (app::AttributePathExpandIterator iter(&clusInfo1); iter.Get(path); iter.Next())
+    {
+        ChipLogDetail(AppServer, "Visited Attribute: 0x%04X / " ChipLogFormatMEI " / " ChipLogFormatMEI, path.mEndpointId,
+                      ChipLogValueMEI(path.mClusterId), ChipLogValueMEI(path.mAttributeId));
+        NL_TEST_ASSERT(apSuite, index < ArraySize(paths) && paths[index] == path);
+        index++;
+        if (path.mClusterId == MockClusterId(2))
+        {
+            iter.SkipCurrentCluster();
+        }
+    }
+    NL_TEST_ASSERT(apSuite, index == ArraySize(paths));
+}
+
 void TestMultipleClusInfo(nlTestSuite * apSuite, void * apContext)
 {
 
@@ -385,6 +455,7 @@ const nlTest sTests[] =
         NL_TEST_DEF("TestWildcardAttribute", TestWildcardAttribute),
         NL_TEST_DEF("TestNoWildcard", TestNoWildcard),
         NL_TEST_DEF("TestMultipleClusInfo", TestMultipleClusInfo),
+        NL_TEST_DEF("TestSkipCurrentCluster", TestSkipCurrentCluster),
         NL_TEST_SENTINEL()
 };
 // clang-format on
@@ -0,0 +1,251 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/CASEClientPool.h>
+#include <app/CASESessionManager.h>
+#include <app/OperationalSessionSetupPool.h>
+#include <app/clusters/bindings/BindingManager.h>
+#include <app/tests/AppTestContext.h>
+#include <app/util/binding-table.h>
+#include <credentials/GroupDataProviderImpl.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/UnitTestContext.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <transport/SessionManager.h>
+
+#include <nlunit-test.h>
+
+using TestContext = chip::Test::AppContext;
+
+using namespace chip;
+
+namespace {
+
+constexpr EndpointId kLocalEndpoint = 1;
+constexpr EndpointId kPeerEndpoint  = 1;
+constexpr ClusterId kBoundCluster   = 0x0006;
+constexpr NodeId kPeerNodeId        = 0x1234;
+constexpr GroupId kGroupId          = 0x0101;
+constexpr GroupId kOtherGroupId     = 0x0102;
+constexpr uint16_t kLocalSessionId  = 10;
+constexpr uint16_t kPeerSessionId   = 11;
+
+// Session setup pool that counts the new CASE sessions requested, and fails all of them.
+class CountingSessionSetupPool : public OperationalSessionSetupPoolDelegate
+{
+public:
+    OperationalSessionSetup * Allocate(DeviceProxyInitParams & params, ScopedNodeId peerId,
+                                       OperationalSessionReleaseDelegate * releaseDelegate) override
+    {
+        mAllocateCount++;
+        return nullptr;
+    }
+
+    void Release(OperationalSessionSetup * device) override {}
+
+    OperationalSessionSetup * FindSessionSetup(ScopedNodeId peerId, bool forAddressUpdate) override { return nullptr; }
+
+    void ReleaseAllSessionSetupsForFabric(FabricIndex fabricIndex) override {}
+
+    void ReleaseAllSessionSetup() override {}
+
+    size_t mAllocateCount = 0;
+};
+
+struct Notifications
+{
+    size_t mConnectedUnicastCount = 0;
+    size_t mMulticastCount        = 0;
+    GroupId mGroups[EMBER_BINDING_TABLE_SIZE];
+};
+
+void BoundDeviceChanged(const EmberBindingTableEntry & binding, OperationalDeviceProxy * peer_device, void * context)
+{
+    Notifications * notifications = static_cast<Notifications *>(context);
+    if (binding.type == EMBER_UNICAST_BINDING)
+    {
+        if (peer_device != nullptr && peer_device->ConnectionReady() && peer_device->GetDeviceId() == binding.nodeId)
+        {
+            notifications->mConnectedUnicastCount++;
+        }
+    }
+    else if (binding.type == EMBER_MULTICAST_BINDING && peer_device == nullptr)
+    {
+        notifications->mGroups[notifications->mMulticastCount++] = binding.groupId;
+    }
+}
+
+TestPersistentStorageDelegate gStorage;
+Credentials::GroupDataProviderImpl gGroupsProvider;
+CASEClientPool<1> gCASEClientPool;
+CountingSessionSetupPool gSessionSetupPool;
+CASESessionManager gCASESessionManager;
+BindingManager gBindingManager;
+
+void ClearBindingTable()
+{
+    BindingTable & table = BindingTable::GetInstance();
+    auto iter            = table.begin();
+    while (iter != table.end())
+    {
+        table.RemoveAt(iter);
+    }
+}
+
+void TestNotifyPeerWithoutSession(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+
+    NL_TEST_ASSERT(apSuite,
+                   BindingTable::GetInstance().Add(EmberBindingTableEntry::ForNode(
+                       ctx.GetBobFabricIndex(), kPeerNodeId, kLocalEndpoint, kPeerEndpoint, MakeOptional(kBoundCluster))) ==
+                       CHIP_NO_ERROR);
+
+    // The notification waits for a new CASE session.
+    Notifications notifications;
+    gSessionSetupPool.mAllocateCount = 0;
+    gBindingManager.NotifyBoundClusterChanged(kLocalEndpoint, kBoundCluster, &notifications);
+    NL_TEST_ASSERT(apSuite, gSessionSetupPool.mAllocateCount > 0);
+    NL_TEST_ASSERT(apSuite, notifications.mConnectedUnicastCount == 0);
+
+    ClearBindingTable();
+}
+
+void TestNotifyConnectedPeer(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+
+    SessionHolder session;
+    NL_TEST_ASSERT(apSuite,
+                   ctx.GetSecureSessionManager().InjectCaseSessionWithTestKey(
+                       session, kLocalSessionId, kPeerSessionId, ctx.GetBobFabric()->GetNodeId(), kPeerNodeId,
+                       ctx.GetBobFabricIndex(), ctx.GetAliceAddress(), CryptoContext::SessionRole::kInitiator) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite,
+                   BindingTable::GetInstance().Add(EmberBindingTableEntry::ForNode(
+                       ctx.GetBobFabricIndex(), kPeerNodeId, kLocalEndpoint, kPeerEndpoint, MakeOptional(kBoundCluster))) ==
+                       CHIP_NO_ERROR);
+
+    // The peer is notified over its session before NotifyBoundClusterChanged returns, and no new CASE session is requested.
+    Notifications notifications;
+    gSessionSetupPool.mAllocateCount = 0;
+    NL_TEST_ASSERT(apSuite,
+                   gBindingManager.NotifyBoundClusterChanged(kLocalEndpoint, kBoundCluster, &notifications) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, notifications.mConnectedUnicastCount == 1);
+    NL_TEST_ASSERT(apSuite, gSessionSetupPool.mAllocateCount == 0);
+
+    // Bindings to other clusters are not notified.
+    NL_TEST_ASSERT(apSuite,
+                   gBindingManager.NotifyBoundClusterChanged(kLocalEndpoint, kBoundCluster + 1, &notifications) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, notifications.mConnectedUnicastCount == 1);
+
+    ClearBindingTable();
+    session.Release();
+    ctx.GetSecureSessionManager().ExpireAllSessions(ScopedNodeId(kPeerNodeId, ctx.GetBobFabricIndex()));
+}
+
+void TestNotifyDuplicateGroupBindings(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+
+    BindingTable & table = BindingTable::GetInstance();
+    NL_TEST_ASSERT(apSuite,
+                   table.Add(EmberBindingTableEntry::ForGroup(ctx.GetBobFabricIndex(), kGroupId, kLocalEndpoint,
+                                                              MakeOptional(kBoundCluster))) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite,
+                   table.Add(EmberBindingTableEntry::ForGroup(ctx.GetBobFabricIndex(), kGroupId, kLocalEndpoint, NullOptional)) ==
+                       CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite,
+                   table.Add(EmberBindingTableEntry::ForGroup(ctx.GetBobFabricIndex(), kOtherGroupId, kLocalEndpoint,
+                                                              MakeOptional(kBoundCluster))) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite,
+                   table.Add(EmberBindingTableEntry::ForGroup(ctx.GetAliceFabricIndex(), kGroupId, kLocalEndpoint,
+                                                              MakeOptional(kBoundCluster))) == CHIP_NO_ERROR);
+
+    // A group bound twice on the same fabric gets a single group message.
+    Notifications notifications;
+    NL_TEST_ASSERT(apSuite,
+                   gBindingManager.NotifyBoundClusterChanged(kLocalEndpoint, kBoundCluster, &notifications) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, notifications.mMulticastCount == 3);
+    NL_TEST_ASSERT(apSuite, notifications.mGroups[0] == kGroupId);
+    NL_TEST_ASSERT(apSuite, notifications.mGroups[1] == kOtherGroupId);
+    NL_TEST_ASSERT(apSuite, notifications.mGroups[2] == kGroupId);
+
+    ClearBindingTable();
+}
+
+int Test_Setup(void * inContext)
+{
+    VerifyOrReturnError(TestContext::Initialize(inContext) == SUCCESS, FAILURE);
+
+    TestContext & ctx = *static_cast<TestContext *>(inContext);
+    gGroupsProvider.SetStorageDelegate(&gStorage);
+    VerifyOrReturnError(gGroupsProvider.Init() == CHIP_NO_ERROR, FAILURE);
+
+    CASESessionManagerConfig config;
+    config.sessionInitParams.sessionManager    = &ctx.GetSecureSessionManager();
+    config.sessionInitParams.exchangeMgr       = &ctx.GetExchangeManager();
+    config.sessionInitParams.fabricTable       = &ctx.GetFabricTable();
+    config.sessionInitParams.clientPool        = &gCASEClientPool;
+    config.sessionInitParams.groupDataProvider = &gGroupsProvider;
+    config.sessionSetupPool                    = &gSessionSetupPool;
+    VerifyOrReturnError(gCASESessionManager.Init(&ctx.GetSystemLayer(), config) == CHIP_NO_ERROR, FAILURE);
+
+    BindingManagerInitParams params;
+    params.mFabricTable        = &ctx.GetFabricTable();
+    params.mCASESessionManager = &gCASESessionManager;
+    params.mStorage            = &gStorage;
+    VerifyOrReturnError(gBindingManager.Init(params) == CHIP_NO_ERROR, FAILURE);
+    gBindingManager.RegisterBoundDeviceChangedHandler(BoundDeviceChanged);
+
+    return SUCCESS;
+}
+
+int Test_Teardown(void * inContext)
+{
+    gGroupsProvider.Finish();
+    return TestContext::Finalize(inContext);
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("TestNotifyPeerWithoutSession", TestNotifyPeerWithoutSession),
+    NL_TEST_DEF("TestNotifyConnectedPeer", TestNotifyConnectedPeer),
+    NL_TEST_DEF("TestNotifyDuplicateGroupBindings", TestNotifyDuplicateGroupBindings),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+// clang-format off
+nlTestSuite sSuite =
+{
+    "TestBindingManager",
+    &sTests[0],
+    Test_Setup,
+    Test_Teardown
+};
+// clang-format on
+
+} // namespace
+
+int TestBindingManager()
+{
+    return chip::ExecuteTestsWithContext<TestContext>(&sSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestBindingManager)
@@ -29,6 +29,7 @@
 #include <lib/support/UnitTestContext.h>
 #include <lib/support/UnitTestRegistration.h>
 #include <nlunit-test.h>
+#include <system/SystemClock.h>
 #include <vector>
 
 using TestContext = chip::Test::AppContext;
@@ -599,10 +600,103 @@ void TestBufferedSequences(nlTestSuite * apSuite, void * apContext)
     });
 }
 
+class LargeListValidator : public BufferedReadCallback::Callback
+{
+public:
+    void OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus) override
+    {
+        Clusters::TestCluster::Attributes::ListStructOctetString::TypeInfo::DecodableType value;
+
+        NL_TEST_ASSERT(gSuite, aPath.mListOp == ConcreteDataAttributePath::ListOperation::ReplaceAll);
+        NL_TEST_ASSERT(gSuite, DataModel::Decode(*apData, value) == CHIP_NO_ERROR);
+
+        auto iter = value.begin();
+        while (iter.Next())
+        {
+            NL_TEST_ASSERT(gSuite, iter.GetValue().member1 == mItemCount);
+            mItemCount++;
+        }
+        NL_TEST_ASSERT(gSuite, iter.GetStatus() == CHIP_NO_ERROR);
+        mListCount++;
+    }
+
+    void OnDone(ReadClient *) override {}
+
+    uint64_t mItemCount = 0;
+    uint32_t mListCount = 0;
+};
+
+void TestLargeChunkedList(nlTestSuite * apSuite, void * apContext)
+{
+    constexpr uint32_t kItemCount  = 1000;
+    constexpr uint32_t kIterations = 10;
+
+    LargeListValidator validator;
+    BufferedReadCallback bufferedCallback(validator);
+    ReadClient::Callback * callback = &bufferedCallback;
+    ConcreteDataAttributePath path(0, Clusters::TestCluster::Id, Clusters::TestCluster::Attributes::ListStructOctetString::Id);
+    System::PacketBufferTLVWriter writer;
+    System::PacketBufferTLVReader reader;
+    System::PacketBufferHandle handle;
+    StatusIB status;
+
+    //
+    // Encode all the chunks up front, so that only the buffering and delivery of the list is measured.
+    //
+    std::vector<System::PacketBufferHandle> chunks;
+    for (uint32_t i = 0; i <= kItemCount; i++)
+    {
+        handle = System::PacketBufferHandle::New(1000);
+        NL_TEST_ASSERT(apSuite, !handle.IsNull());
+        writer.Init(std::move(handle), true);
+
+        if (i == 0)
+        {
+            Clusters::TestCluster::Attributes::ListStructOctetString::TypeInfo::Type value;
+            NL_TEST_ASSERT(apSuite, DataModel::Encode(writer, TLV::AnonymousTag(), value) == CHIP_NO_ERROR);
+        }
+        else
+        {
+            Clusters::TestCluster::Structs::TestListStructOctet::Type listItem;
+            listItem.member1 = i - 1;
+            NL_TEST_ASSERT(apSuite, DataModel::Encode(writer, TLV::AnonymousTag(), listItem) == CHIP_NO_ERROR);
+        }
+
+        NL_TEST_ASSERT(apSuite, writer.Finalize(&handle) == CHIP_NO_ERROR);
+        chunks.push_back(std::move(handle));
+    }
+
+    System::Clock::Microseconds64 elapsed(0);
+    for (uint32_t iteration = 0; iteration < kIterations; iteration++)
+    {
+        validator.mItemCount = 0;
+
+        System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+        callback->OnReportBegin();
+        for (uint32_t i = 0; i <= kItemCount; i++)
+        {
+            path.mListOp = (i == 0) ? ConcreteDataAttributePath::ListOperation::ReplaceAll
+                                    : ConcreteDataAttributePath::ListOperation::AppendItem;
+            reader.Init(chunks[i].Retain());
+            NL_TEST_ASSERT(apSuite, reader.Next() == CHIP_NO_ERROR);
+            callback->OnAttributeData(path, &reader, status);
+        }
+        callback->OnReportEnd();
+        elapsed += System::SystemClock().GetMonotonicMicroseconds64() - start;
+
+        NL_TEST_ASSERT(apSuite, validator.mItemCount == kItemCount);
+    }
+
+    NL_TEST_ASSERT(apSuite, validator.mListCount == kIterations);
+    ChipLogProgress(DataManagement, "Buffered and delivered a %" PRIu32 " item list in %" PRIu64 " us on average", kItemCount,
+                    elapsed.count() / kIterations);
+}
+
 // clang-format off
 const nlTest sTests[] =
 {
     NL_TEST_DEF("TestBufferedSequences", TestBufferedSequences),
+    NL_TEST_DEF("TestLargeChunkedList", TestLargeChunkedList),
     NL_TEST_SENTINEL()
 };
 
@@ -22,6 +22,7 @@
  *
  */
 
+#include <chrono>
 #include <cinttypes>
 
 #include <app/AppConfig.h>
@@ -190,18 +191,28 @@ public:
         onErrorCalledTimes++;
         mError = aError;
     }
+    void OnCommandError(chip::app::CommandSender * apCommandSender, const chip::app::ConcreteCommandPath & aPath,
+                        const chip::app::StatusIB & aStatus) override
+    {
+        onCommandErrorCalledTimes++;
+        mLastErrorPath = aPath;
+        CommandSender::Callback::OnCommandError(apCommandSender, aPath, aStatus);
+    }
     void OnDone(chip::app::CommandSender * apCommandSender) override { onFinalCalledTimes++; }
 
     void ResetCounter()
     {
-        onResponseCalledTimes = 0;
-        onErrorCalledTimes    = 0;
-        onFinalCalledTimes    = 0;
+        onResponseCalledTimes     = 0;
+        onErrorCalledTimes        = 0;
+        onCommandErrorCalledTimes = 0;
+        onFinalCalledTimes        = 0;
     }
 
-    int onResponseCalledTimes = 0;
-    int onErrorCalledTimes    = 0;
-    int onFinalCalledTimes    = 0;
+    int onResponseCalledTimes     = 0;
+    int onErrorCalledTimes        = 0;
+    int onCommandErrorCalledTimes = 0;
+    int onFinalCalledTimes        = 0;
+    ConcreteCommandPath mLastErrorPath{ 0, 0, 0 };
     CHIP_ERROR mError         = CHIP_NO_ERROR;
 } mockCommandSenderDelegate;
 
@@ -244,7 +255,10 @@ public:
     static void TestCommandHandlerWithSendEmptyResponse(nlTestSuite * apSuite, void * apContext);
 
     static void TestCommandHandlerWithProcessReceivedEmptyDataMsg(nlTestSuite * apSuite, void * apContext);
-    static void TestCommandHandlerRejectMultipleCommands(nlTestSuite * apSuite, void * apContext);
+    static void TestCommandSenderMultipleCommandsFlow(nlTestSuite * apSuite, void * apContext);
+    static void TestCommandSenderChunkedResponseFlow(nlTestSuite * apSuite, void * apContext);
+    static void TestCommandSenderRequestFull(nlTestSuite * apSuite, void * apContext);
+    static void BenchmarkBatchedInvoke(nlTestSuite * apSuite, void * apContext);
 
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     static void TestCommandHandlerReleaseWithExchangeClosed(nlTestSuite * apSuite, void * apContext);
@@ -280,6 +294,10 @@ private:
     static void AddInvokeResponseData(nlTestSuite * apSuite, void * apContext, CommandHandler * apCommandHandler,
                                       bool aNeedStatusCode, CommandId aCommandId = kTestCommandIdWithData);
     static void ValidateCommandHandlerWithSendCommand(nlTestSuite * apSuite, void * apContext, bool aNeedStatusCode);
+    // Add as many commands with data as fit in the request of the given sender.  Returns the number of commands added.
+    static size_t FillInvokeRequest(nlTestSuite * apSuite, CommandSender & aCommandSender, size_t aMaxCommands = SIZE_MAX);
+    // Invoke aCommandCount commands, in requests of at most aCommandsPerRequest commands.  Returns the number of requests sent.
+    static size_t InvokeCommands(nlTestSuite * apSuite, TestContext & aCtx, size_t aCommandCount, size_t aCommandsPerRequest);
 };
 
 class TestExchangeDelegate : public Messaging::ExchangeDelegate
@@ -432,17 +450,29 @@ void TestCommandInteraction::AddInvokeRequestData(nlTestSuite * apSuite, void *
 void TestCommandInteraction::AddInvalidInvokeRequestData(nlTestSuite * apSuite, void * apContext, CommandSender * apCommandSender,
                                                          CommandId aCommandId)
 {
-    CHIP_ERROR err         = CHIP_NO_ERROR;
-    auto commandPathParams = MakeTestCommandPath(aCommandId);
+    CHIP_ERROR err = CHIP_NO_ERROR;
 
-    err = apCommandSender->PrepareCommand(commandPathParams);
+    err = apCommandSender->AllocateBuffer();
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
 
-    chip::TLV::TLVWriter * writer = apCommandSender->GetCommandDataIBTLVWriter();
+    // Encode a command without its mandatory path
+    CommandDataIB::Builder & invokeRequest = apCommandSender->mInvokeRequestBuilder.GetInvokeRequests().CreateCommandData();
+    NL_TEST_ASSERT(apSuite, apCommandSender->mInvokeRequestBuilder.GetInvokeRequests().GetError() == CHIP_NO_ERROR);
+
+    chip::TLV::TLVWriter * writer = invokeRequest.GetWriter();
+    chip::TLV::TLVType dummyType  = chip::TLV::kTLVType_NotSpecified;
+    err = writer->StartContainer(chip::TLV::ContextTag(chip::to_underlying(CommandDataIB::Tag::kFields)),
+                                 chip::TLV::kTLVType_Structure, dummyType);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
 
     err = writer->PutBoolean(chip::TLV::ContextTag(1), true);
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
 
+    err = writer->EndContainer(dummyType);
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(apSuite, invokeRequest.EndOfCommandDataIB().GetError() == CHIP_NO_ERROR);
+
     apCommandSender->MoveToState(CommandSender::State::AddedCommand);
 }
 
@@ -532,8 +562,10 @@ void TestCommandInteraction::TestCommandSenderWithSendCommand(nlTestSuite * apSu
     ctx.DrainAndServiceIO();
 
     GenerateInvokeResponse(apSuite, apContext, buf, kTestCommandIdWithData);
-    err = commandSender.ProcessInvokeResponse(std::move(buf));
+    bool moreChunkedMessages = true;
+    err                      = commandSender.ProcessInvokeResponse(std::move(buf), moreChunkedMessages);
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, !moreChunkedMessages);
 }
 
 void TestCommandInteraction::TestCommandHandlerWithSendEmptyCommand(nlTestSuite * apSuite, void * apContext)
@@ -569,8 +601,10 @@ void TestCommandInteraction::TestCommandSenderWithProcessReceivedMsg(nlTestSuite
     System::PacketBufferHandle buf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
 
     GenerateInvokeResponse(apSuite, apContext, buf, kTestCommandIdWithData);
-    err = commandSender.ProcessInvokeResponse(std::move(buf));
+    bool moreChunkedMessages = true;
+    err                      = commandSender.ProcessInvokeResponse(std::move(buf), moreChunkedMessages);
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, !moreChunkedMessages);
 }
 
 void TestCommandInteraction::ValidateCommandHandlerWithSendCommand(nlTestSuite * apSuite, void * apContext, bool aNeedStatusCode)
@@ -616,6 +650,7 @@ void TestCommandInteraction::TestCommandHandlerWithSendSimpleCommandData(nlTestS
 struct Fields
 {
     static constexpr chip::CommandId GetCommandId() { return 4; }
+    static constexpr bool MustUseTimedInvoke() { return false; }
     CHIP_ERROR Encode(TLV::TLVWriter & aWriter, TLV::Tag aTag) const
     {
         TLV::TLVType outerContainerType;
@@ -1289,58 +1324,199 @@ void TestCommandInteraction::TestCommandSenderAbruptDestruction(nlTestSuite * ap
     NL_TEST_ASSERT(apSuite, GetNumActiveHandlerObjects() == 0);
 }
 
-void TestCommandInteraction::TestCommandHandlerRejectMultipleCommands(nlTestSuite * apSuite, void * apContext)
+void TestCommandInteraction::TestCommandSenderMultipleCommandsFlow(nlTestSuite * apSuite, void * apContext)
 {
     TestContext & ctx = *static_cast<TestContext *>(apContext);
     CHIP_ERROR err    = CHIP_NO_ERROR;
 
+    sendResponse        = true;
     isCommandDispatched = false;
     mockCommandSenderDelegate.ResetCounter();
     app::CommandSender commandSender(&mockCommandSenderDelegate, &ctx.GetExchangeManager());
 
-    {
-        // Command ID is not important here, since the command handler should reject the commands without handling it.
-        auto commandPathParams = MakeTestCommandPath(kTestCommandIdCommandSpecificResponse);
+    // A status response, a failure for a command that does not exist and a data response, all in the same request.
+    AddInvokeRequestData(apSuite, apContext, &commandSender, kTestCommandIdWithData);
+    AddInvokeRequestData(apSuite, apContext, &commandSender, kTestNonExistCommandId);
+    AddInvokeRequestData(apSuite, apContext, &commandSender, kTestCommandIdCommandSpecificResponse);
+    NL_TEST_ASSERT(apSuite, commandSender.GetCommandCount() == 3);
 
-        commandSender.AllocateBuffer();
+    Test::MessageCapturer messageLog(ctx);
+    messageLog.mCaptureStandaloneAcks = false;
 
-        // CommandSender does not support sending multiple commands with public API, so we craft a message manaully.
-        for (int i = 0; i < 2; i++)
-        {
-            InvokeRequests::Builder & invokeRequests = commandSender.mInvokeRequestBuilder.GetInvokeRequests();
-            CommandDataIB::Builder & invokeRequest   = invokeRequests.CreateCommandData();
-            NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == invokeRequests.GetError());
-            CommandPathIB::Builder & path = invokeRequest.CreatePath();
-            NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == invokeRequest.GetError());
-            NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == path.Encode(commandPathParams));
-            NL_TEST_ASSERT(
-                apSuite,
-                CHIP_NO_ERROR ==
-                    invokeRequest.GetWriter()->StartContainer(TLV::ContextTag(to_underlying(CommandDataIB::Tag::kFields)),
-                                                              TLV::kTLVType_Structure, commandSender.mDataElementContainerType));
-            NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == invokeRequest.GetWriter()->PutBoolean(chip::TLV::ContextTag(1), true));
-            NL_TEST_ASSERT(apSuite,
-                           CHIP_NO_ERROR == invokeRequest.GetWriter()->EndContainer(commandSender.mDataElementContainerType));
-            NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == invokeRequest.EndOfCommandDataIB().GetError());
-        }
+    err = commandSender.SendCommandRequest(ctx.GetSessionBobToAlice());
+    NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
 
-        NL_TEST_ASSERT(apSuite,
-                       CHIP_NO_ERROR == commandSender.mInvokeRequestBuilder.GetInvokeRequests().EndOfInvokeRequests().GetError());
-        NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == commandSender.mInvokeRequestBuilder.EndOfInvokeRequestMessage().GetError());
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(apSuite,
+                   mockCommandSenderDelegate.onResponseCalledTimes == 2 && mockCommandSenderDelegate.onFinalCalledTimes == 1 &&
+                       mockCommandSenderDelegate.onCommandErrorCalledTimes == 1 &&
+                       mockCommandSenderDelegate.onErrorCalledTimes == 1);
+    NL_TEST_ASSERT(apSuite, mockCommandSenderDelegate.mError == CHIP_IM_GLOBAL_STATUS(UnsupportedCommand));
+    NL_TEST_ASSERT(apSuite,
+                   mockCommandSenderDelegate.mLastErrorPath == ConcreteCommandPath(kTestEndpointId, kTestClusterId,
+                                                                                   kTestNonExistCommandId));
+    NL_TEST_ASSERT(apSuite, chip::isCommandDispatched);
+
+    // One request, one response
+    NL_TEST_ASSERT(apSuite, messageLog.MessageCount() == 2);
+    NL_TEST_ASSERT(apSuite, messageLog.IsMessageType(0, InteractionModel::MsgType::InvokeCommandRequest));
+    NL_TEST_ASSERT(apSuite, messageLog.IsMessageType(1, InteractionModel::MsgType::InvokeCommandResponse));
+
+    NL_TEST_ASSERT(apSuite, GetNumActiveHandlerObjects() == 0);
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+
+size_t TestCommandInteraction::FillInvokeRequest(nlTestSuite * apSuite, CommandSender & aCommandSender, size_t aMaxCommands)
+{
+    size_t count = 0;
+    CHIP_ERROR err;
 
-        commandSender.MoveToState(app::CommandSender::State::AddedCommand);
+    while (count < aMaxCommands &&
+           (err = aCommandSender.AddRequestData(MakeTestCommandPath(kTestCommandIdWithData), Fields())) == CHIP_NO_ERROR)
+    {
+        count++;
     }
 
-    err = commandSender.SendCommandRequest(ctx.GetSessionBobToAlice());
+    if (count < aMaxCommands)
+    {
+        // The request is full, the command that did not fit has been rolled back.
+        NL_TEST_ASSERT(apSuite, err == CHIP_ERROR_NO_MEMORY || err == CHIP_ERROR_BUFFER_TOO_SMALL);
+    }
+    NL_TEST_ASSERT(apSuite, aCommandSender.GetCommandCount() == count);
+    return count;
+}
+
+void TestCommandInteraction::TestCommandSenderRequestFull(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+
+    app::CommandSender commandSender(&mockCommandSenderDelegate, &ctx.GetExchangeManager());
+
+    size_t count = FillInvokeRequest(apSuite, commandSender);
+    NL_TEST_ASSERT(apSuite, count > 1);
+    NL_TEST_ASSERT(apSuite, commandSender.mState == CommandSender::State::AddedCommand);
+
+    // The full request is still a valid message holding all the commands that fit
+    System::PacketBufferHandle commandPacket;
+    NL_TEST_ASSERT(apSuite, commandSender.Finalize(commandPacket) == CHIP_NO_ERROR);
+
+    System::PacketBufferTLVReader reader;
+    InvokeRequestMessage::Parser invokeRequestMessage;
+    InvokeRequests::Parser invokeRequests;
+    TLV::TLVReader invokeRequestsReader;
+    reader.Init(std::move(commandPacket));
+    NL_TEST_ASSERT(apSuite, invokeRequestMessage.Init(reader) == CHIP_NO_ERROR);
+#if CHIP_CONFIG_IM_ENABLE_SCHEMA_CHECK
+    NL_TEST_ASSERT(apSuite, invokeRequestMessage.CheckSchemaValidity() == CHIP_NO_ERROR);
+#endif
+    NL_TEST_ASSERT(apSuite, invokeRequestMessage.GetInvokeRequests(&invokeRequests) == CHIP_NO_ERROR);
+    invokeRequests.GetReader(&invokeRequestsReader);
+
+    size_t parsedCount = 0;
+    NL_TEST_ASSERT(apSuite, TLV::Utilities::Count(invokeRequestsReader, parsedCount, false /* recurse */) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, parsedCount == count);
+}
+
+void TestCommandInteraction::TestCommandSenderChunkedResponseFlow(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(apContext);
+    CHIP_ERROR err    = CHIP_NO_ERROR;
+
+    sendResponse = true;
+    mockCommandSenderDelegate.ResetCounter();
+    app::CommandSender commandSender(&mockCommandSenderDelegate, &ctx.GetExchangeManager());
 
+    // Each status response is larger than the command it answers, so the responses to a full request can't fit in one message.
+    size_t count = FillInvokeRequest(apSuite, commandSender);
+
+    Test::MessageCapturer messageLog(ctx);
+    messageLog.mCaptureStandaloneAcks = false;
+
+    err = commandSender.SendCommandRequest(ctx.GetSessionBobToAlice());
     NL_TEST_ASSERT(apSuite, err == CHIP_NO_ERROR);
 
     ctx.DrainAndServiceIO();
 
     NL_TEST_ASSERT(apSuite,
-                   mockCommandSenderDelegate.onResponseCalledTimes == 0 && mockCommandSenderDelegate.onFinalCalledTimes == 1 &&
-                       mockCommandSenderDelegate.onErrorCalledTimes == 1);
-    NL_TEST_ASSERT(apSuite, !chip::isCommandDispatched);
+                   mockCommandSenderDelegate.onResponseCalledTimes == static_cast<int>(count) &&
+                       mockCommandSenderDelegate.onFinalCalledTimes == 1 && mockCommandSenderDelegate.onErrorCalledTimes == 0);
+
+    // Request, then the response chunks, each one but the last acknowledged by a status response
+    size_t responseCount = 0;
+    for (size_t i = 1; i < messageLog.MessageCount(); i += 2)
+    {
+        NL_TEST_ASSERT(apSuite, messageLog.IsMessageType(i, InteractionModel::MsgType::InvokeCommandResponse));
+        responseCount++;
+        if (i + 1 < messageLog.MessageCount())
+        {
+            NL_TEST_ASSERT(apSuite, messageLog.IsMessageType(i + 1, InteractionModel::MsgType::StatusResponse));
+        }
+    }
+    NL_TEST_ASSERT(apSuite, messageLog.IsMessageType(0, InteractionModel::MsgType::InvokeCommandRequest));
+    NL_TEST_ASSERT(apSuite, messageLog.MessageCount() % 2 == 0);
+    NL_TEST_ASSERT(apSuite, responseCount > 1);
+
+    NL_TEST_ASSERT(apSuite, GetNumActiveHandlerObjects() == 0);
+    NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+
+size_t TestCommandInteraction::InvokeCommands(nlTestSuite * apSuite, TestContext & aCtx, size_t aCommandCount,
+                                              size_t aCommandsPerRequest)
+{
+    size_t requestCount = 0;
+
+    mockCommandSenderDelegate.ResetCounter();
+    for (size_t invoked = 0; invoked < aCommandCount; requestCount++)
+    {
+        app::CommandSender commandSender(&mockCommandSenderDelegate, &aCtx.GetExchangeManager());
+
+        invoked += FillInvokeRequest(apSuite, commandSender, std::min(aCommandsPerRequest, aCommandCount - invoked));
+        NL_TEST_ASSERT(apSuite, commandSender.SendCommandRequest(aCtx.GetSessionBobToAlice()) == CHIP_NO_ERROR);
+
+        aCtx.DrainAndServiceIO();
+    }
+
+    NL_TEST_ASSERT(apSuite, mockCommandSenderDelegate.onResponseCalledTimes == static_cast<int>(aCommandCount));
+    NL_TEST_ASSERT(apSuite, mockCommandSenderDelegate.onFinalCalledTimes == static_cast<int>(requestCount));
+    NL_TEST_ASSERT(apSuite, mockCommandSenderDelegate.onErrorCalledTimes == 0);
+    return requestCount;
+}
+
+// Invoke the same commands one per request, then batched in as few requests as possible, and compare the throughput.
+void TestCommandInteraction::BenchmarkBatchedInvoke(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx              = *static_cast<TestContext *>(apContext);
+    constexpr size_t kCommandCount = 600;
+
+    sendResponse = true;
+
+    auto run = [&](size_t commandsPerRequest, size_t & requestCount, size_t & messageCount) {
+        ctx.GetLoopback().mSentMessageCount = 0;
+        auto start                          = std::chrono::steady_clock::now();
+
+        requestCount = InvokeCommands(apSuite, ctx, kCommandCount, commandsPerRequest);
+
+        auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        messageCount  = ctx.GetLoopback().mSentMessageCount;
+        return static_cast<uint64_t>(kCommandCount) * 1000000 / std::max<uint64_t>(static_cast<uint64_t>(duration.count()), 1);
+    };
+
+    size_t singleRequests, singleMessages, batchedRequests, batchedMessages;
+    uint64_t singleRate  = run(1, singleRequests, singleMessages);
+    uint64_t batchedRate = run(SIZE_MAX, batchedRequests, batchedMessages);
+
+    ChipLogProgress(DataManagement, "Invoking %u commands: %u requests, %u messages, %u commands/s with one command per request",
+                    static_cast<unsigned>(kCommandCount), static_cast<unsigned>(singleRequests),
+                    static_cast<unsigned>(singleMessages), static_cast<unsigned>(singleRate));
+    ChipLogProgress(DataManagement, "Invoking %u commands: %u requests, %u messages, %u commands/s with batched requests",
+                    static_cast<unsigned>(kCommandCount), static_cast<unsigned>(batchedRequests),
+                    static_cast<unsigned>(batchedMessages), static_cast<unsigned>(batchedRate));
+
+    NL_TEST_ASSERT(apSuite, singleRequests == kCommandCount);
+    // dozens of commands fit in a request
+    NL_TEST_ASSERT(apSuite, batchedRequests * 20 < singleRequests);
+    NL_TEST_ASSERT(apSuite, batchedMessages * 10 < singleMessages);
 
     NL_TEST_ASSERT(apSuite, GetNumActiveHandlerObjects() == 0);
     NL_TEST_ASSERT(apSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
@@ -1402,7 +1578,10 @@ const nlTest sTests[] =
     NL_TEST_DEF("TestCommandHandlerWithSendSimpleStatusCode", chip::app::TestCommandInteraction::TestCommandHandlerWithSendSimpleStatusCode),
     NL_TEST_DEF("TestCommandHandlerWithProcessReceivedNotExistCommand", chip::app::TestCommandInteraction::TestCommandHandlerWithProcessReceivedNotExistCommand),
     NL_TEST_DEF("TestCommandHandlerWithProcessReceivedEmptyDataMsg", chip::app::TestCommandInteraction::TestCommandHandlerWithProcessReceivedEmptyDataMsg),
-    NL_TEST_DEF("TestCommandHandlerRejectMultipleCommands", chip::app::TestCommandInteraction::TestCommandHandlerRejectMultipleCommands),
+    NL_TEST_DEF("TestCommandSenderMultipleCommandsFlow", chip::app::TestCommandInteraction::TestCommandSenderMultipleCommandsFlow),
+    NL_TEST_DEF("TestCommandSenderRequestFull", chip::app::TestCommandInteraction::TestCommandSenderRequestFull),
+    NL_TEST_DEF("TestCommandSenderChunkedResponseFlow", chip::app::TestCommandInteraction::TestCommandSenderChunkedResponseFlow),
+    NL_TEST_DEF("BenchmarkBatchedInvoke", chip::app::TestCommandInteraction::BenchmarkBatchedInvoke),
 
 #if CONFIG_BUILD_FOR_HOST_UNIT_TEST
     NL_TEST_DEF("TestCommandHandlerReleaseWithExchangeClosed", chip::app::TestCommandInteraction::TestCommandHandlerReleaseWithExchangeClosed),
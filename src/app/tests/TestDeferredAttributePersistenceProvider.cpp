@@ -0,0 +1,323 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the DeferredAttributePersistenceProvider, along with a count of the
+ *      storage writes of a level transition.
+ *
+ */
+
+#include <app-common/zap-generated/attribute-type.h>
+#include <app/DefaultAttributePersistenceProvider.h>
+#include <app/DeferredAttributePersistenceProvider.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <transport/raw/tests/NetworkTestHelpers.h>
+
+#include <nlunit-test.h>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+chip::Test::IOContext gIOContext;
+
+/// Counts the writes reaching the storage, and fails them while mWriteError is set.
+class CountingStorageDelegate : public TestPersistentStorageDelegate
+{
+public:
+    CHIP_ERROR SyncSetKeyValue(const char * key, const void * value, uint16_t size) override
+    {
+        mAttemptCount++;
+        VerifyOrReturnError(mWriteError == CHIP_NO_ERROR, mWriteError);
+        mWriteCount++;
+        return TestPersistentStorageDelegate::SyncSetKeyValue(key, value, size);
+    }
+
+    size_t mAttemptCount   = 0;
+    size_t mWriteCount     = 0;
+    CHIP_ERROR mWriteError = CHIP_NO_ERROR;
+};
+
+const EmberAfAttributeMetadata kCurrentLevelMetadata = { .attributeId   = 0x0000,
+                                                          .attributeType = ZCL_INT8U_ATTRIBUTE_TYPE,
+                                                          .size          = 1,
+                                                          .mask          = ATTRIBUTE_MASK_NONVOLATILE,
+                                                          .defaultValue  = EmberAfDefaultOrMinMaxAttributeValue(uint32_t(0)) };
+
+ConcreteAttributePath CurrentLevelPath(EndpointId endpoint)
+{
+    return ConcreteAttributePath(endpoint, 0x0008 /* LevelControl */, kCurrentLevelMetadata.attributeId);
+}
+
+CHIP_ERROR WriteLevel(AttributePersistenceProvider & provider, EndpointId endpoint, uint8_t level)
+{
+    return provider.WriteValue(CurrentLevelPath(endpoint), &kCurrentLevelMetadata, ByteSpan(&level, sizeof(level)));
+}
+
+uint8_t ReadLevel(AttributePersistenceProvider & provider, EndpointId endpoint)
+{
+    uint8_t level = 0;
+    MutableByteSpan value(&level, sizeof(level));
+    VerifyOrReturnError(provider.ReadValue(CurrentLevelPath(endpoint), &kCurrentLevelMetadata, value) == CHIP_NO_ERROR, 0);
+    return level;
+}
+
+/// Simulates a level-control transition from 0 to 254 over 10 seconds, changing CurrentLevel every 100ms, and returns
+/// the number of storage writes it caused.
+size_t RunLevelTransition(nlTestSuite * apSuite, System::Clock::Internal::MockClock & mockClock,
+                          AttributePersistenceProvider & provider, CountingStorageDelegate & storage)
+{
+    constexpr unsigned kTickCount = 100;
+
+    const size_t initialWriteCount = storage.mWriteCount;
+    for (unsigned tick = 1; tick <= kTickCount; tick++)
+    {
+        mockClock.AdvanceMonotonic(100_ms);
+        gIOContext.DriveIO();
+        NL_TEST_ASSERT(apSuite, WriteLevel(provider, 1, static_cast<uint8_t>(tick * 254 / kTickCount)) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(apSuite, provider.Flush() == CHIP_NO_ERROR);
+    return storage.mWriteCount - initialWriteCount;
+}
+
+void TestReadPendingValue(nlTestSuite * apSuite, void * apContext)
+{
+    CountingStorageDelegate storage;
+    DefaultAttributePersistenceProvider persister;
+    DeferredAttributePersistenceProvider provider;
+    NL_TEST_ASSERT(apSuite, persister.Init(&storage) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, provider.Init(persister, gIOContext.GetSystemLayer()) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(apSuite, WriteLevel(provider, 1, 10) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, WriteLevel(provider, 1, 20) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, storage.mWriteCount == 0);
+    NL_TEST_ASSERT(apSuite, provider.GetPendingWriteCount() == 1);
+    NL_TEST_ASSERT(apSuite, ReadLevel(provider, 1) == 20);
+    NL_TEST_ASSERT(apSuite, ReadLevel(persister, 1) == 0);
+
+    NL_TEST_ASSERT(apSuite, provider.Flush() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, storage.mWriteCount == 1);
+    NL_TEST_ASSERT(apSuite, provider.GetPendingWriteCount() == 0);
+    NL_TEST_ASSERT(apSuite, ReadLevel(persister, 1) == 20);
+    NL_TEST_ASSERT(apSuite, ReadLevel(provider, 1) == 20);
+
+    // Shutting down flushes the pending writes
+    NL_TEST_ASSERT(apSuite, WriteLevel(provider, 1, 30) == CHIP_NO_ERROR);
+    provider.Shutdown();
+    NL_TEST_ASSERT(apSuite, storage.mWriteCount == 2);
+    NL_TEST_ASSERT(apSuite, ReadLevel(persister, 1) == 30);
+    NL_TEST_ASSERT(apSuite, WriteLevel(provider, 1, 40) == CHIP_ERROR_INCORRECT_STATE);
+}
+
+void TestFlushThreshold(nlTestSuite * apSuite, void * apContext)
+{
+    CountingStorageDelegate storage;
+    DefaultAttributePersistenceProvider persister;
+    DeferredAttributePersistenceProvider provider;
+    NL_TEST_ASSERT(apSuite, persister.Init(&storage) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, provider.Init(persister, gIOContext.GetSystemLayer(), 1000_ms32, 0) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(apSuite,
+                   provider.Init(persister, gIOContext.GetSystemLayer(), 1000_ms32,
+                                 DeferredAttributePersistenceProvider::kMaxPendingWrites + 1) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(apSuite, provider.Init(persister, gIOContext.GetSystemLayer(), 1000_ms32, 2) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(apSuite, WriteLevel(provider, 1, 10) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, WriteLevel(provider, 1, 11) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, storage.mWriteCount == 0);
+    NL_TEST_ASSERT(apSuite, WriteLevel(provider, 2, 20) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, storage.mWriteCount == 2);
+    NL_TEST_ASSERT(apSuite, provider.GetPendingWriteCount() == 0);
+    NL_TEST_ASSERT(apSuite, ReadLevel(persister, 1) == 11);
+    NL_TEST_ASSERT(apSuite, ReadLevel(persister, 2) == 20);
+}
+
+void TestLargeValueWriteThrough(nlTestSuite * apSuite, void * apContext)
+{
+    CountingStorageDelegate storage;
+    DefaultAttributePersistenceProvider persister;
+    DeferredAttributePersistenceProvider provider;
+    NL_TEST_ASSERT(apSuite, persister.Init(&storage) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, provider.Init(persister, gIOContext.GetSystemLayer()) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(apSuite, WriteLevel(provider, 1, 10) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, provider.GetPendingWriteCount() == 1);
+
+    // A value too large to be deferred is written at once, and replaces the pending one
+    uint8_t largeValue[DeferredAttributePersistenceProvider::kMaxValueSize + 1] = { 42 };
+    NL_TEST_ASSERT(apSuite,
+                   provider.WriteValue(CurrentLevelPath(1), &kCurrentLevelMetadata, ByteSpan(largeValue)) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, storage.mWriteCount == 1);
+    NL_TEST_ASSERT(apSuite, provider.GetPendingWriteCount() == 0);
+    NL_TEST_ASSERT(apSuite, provider.Flush() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, storage.mWriteCount == 1);
+}
+
+void TestFailedWriteRetry(nlTestSuite * apSuite, void * apContext)
+{
+    System::Clock::ClockBase * const savedClock = &System::SystemClock();
+    System::Clock::Internal::MockClock mockClock;
+    System::Clock::Internal::SetSystemClockForTesting(&mockClock);
+
+    CountingStorageDelegate storage;
+    DefaultAttributePersistenceProvider persister;
+    DeferredAttributePersistenceProvider provider;
+    NL_TEST_ASSERT(apSuite, persister.Init(&storage) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, provider.Init(persister, gIOContext.GetSystemLayer(), 1000_ms32) == CHIP_NO_ERROR);
+
+    // A failed write stays pending
+    storage.mWriteError = CHIP_ERROR_PERSISTED_STORAGE_FAILED;
+    NL_TEST_ASSERT(apSuite, WriteLevel(provider, 1, 10) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, WriteLevel(provider, 2, 20) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, provider.Flush() == CHIP_ERROR_PERSISTED_STORAGE_FAILED);
+    NL_TEST_ASSERT(apSuite, provider.GetPendingWriteCount() == 2);
+    NL_TEST_ASSERT(apSuite, ReadLevel(provider, 1) == 10);
+
+    // and is retried once the flush interval has elapsed again
+    storage.mWriteError = CHIP_NO_ERROR;
+    mockClock.AdvanceMonotonic(999_ms);
+    gIOContext.DriveIO();
+    NL_TEST_ASSERT(apSuite, storage.mWriteCount == 0);
+    mockClock.AdvanceMonotonic(1_ms);
+    gIOContext.DriveIO();
+    NL_TEST_ASSERT(apSuite, storage.mWriteCount == 2);
+    NL_TEST_ASSERT(apSuite, provider.GetPendingWriteCount() == 0);
+    NL_TEST_ASSERT(apSuite, ReadLevel(persister, 1) == 10);
+    NL_TEST_ASSERT(apSuite, ReadLevel(persister, 2) == 20);
+
+    // Writes still failing on shutdown are dropped
+    storage.mWriteError = CHIP_ERROR_PERSISTED_STORAGE_FAILED;
+    NL_TEST_ASSERT(apSuite, WriteLevel(provider, 1, 30) == CHIP_NO_ERROR);
+    provider.Shutdown();
+    NL_TEST_ASSERT(apSuite, provider.GetPendingWriteCount() == 0);
+    storage.mWriteError = CHIP_NO_ERROR;
+    NL_TEST_ASSERT(apSuite, ReadLevel(persister, 1) == 10);
+
+    System::Clock::Internal::SetSystemClockForTesting(savedClock);
+}
+
+void TestFailedWriteThreshold(nlTestSuite * apSuite, void * apContext)
+{
+    System::Clock::ClockBase * const savedClock = &System::SystemClock();
+    System::Clock::Internal::MockClock mockClock;
+    System::Clock::Internal::SetSystemClockForTesting(&mockClock);
+
+    CountingStorageDelegate storage;
+    DefaultAttributePersistenceProvider persister;
+    DeferredAttributePersistenceProvider provider;
+    NL_TEST_ASSERT(apSuite, persister.Init(&storage) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, provider.Init(persister, gIOContext.GetSystemLayer(), 1000_ms32, 2) == CHIP_NO_ERROR);
+
+    // A value is buffered even if the flush it causes fails
+    storage.mWriteError = CHIP_ERROR_PERSISTED_STORAGE_FAILED;
+    NL_TEST_ASSERT(apSuite, WriteLevel(provider, 1, 10) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, WriteLevel(provider, 2, 20) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, storage.mAttemptCount == 2);
+    NL_TEST_ASSERT(apSuite, provider.GetPendingWriteCount() == 2);
+
+    // The failed writes are not retried by the next flushes caused by the threshold
+    storage.mWriteError = CHIP_NO_ERROR;
+    NL_TEST_ASSERT(apSuite, WriteLevel(provider, 1, 11) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, WriteLevel(provider, 3, 30) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, storage.mAttemptCount == 3);
+    NL_TEST_ASSERT(apSuite, provider.GetPendingWriteCount() == 2);
+    NL_TEST_ASSERT(apSuite, ReadLevel(persister, 3) == 30);
+    NL_TEST_ASSERT(apSuite, ReadLevel(provider, 1) == 11);
+
+    // but once the flush interval has elapsed
+    mockClock.AdvanceMonotonic(1000_ms);
+    gIOContext.DriveIO();
+    NL_TEST_ASSERT(apSuite, storage.mAttemptCount == 5);
+    NL_TEST_ASSERT(apSuite, provider.GetPendingWriteCount() == 0);
+    NL_TEST_ASSERT(apSuite, ReadLevel(persister, 1) == 11);
+    NL_TEST_ASSERT(apSuite, ReadLevel(persister, 2) == 20);
+
+    provider.Shutdown();
+    System::Clock::Internal::SetSystemClockForTesting(savedClock);
+}
+
+void TestLevelTransition(nlTestSuite * apSuite, void * apContext)
+{
+    System::Clock::ClockBase * const savedClock = &System::SystemClock();
+    System::Clock::Internal::MockClock mockClock;
+    System::Clock::Internal::SetSystemClockForTesting(&mockClock);
+
+    CountingStorageDelegate directStorage;
+    DefaultAttributePersistenceProvider directPersister;
+    NL_TEST_ASSERT(apSuite, directPersister.Init(&directStorage) == CHIP_NO_ERROR);
+    const size_t directWriteCount = RunLevelTransition(apSuite, mockClock, directPersister, directStorage);
+    NL_TEST_ASSERT(apSuite, directWriteCount == 100);
+
+    CountingStorageDelegate deferredStorage;
+    DefaultAttributePersistenceProvider persister;
+    DeferredAttributePersistenceProvider provider;
+    NL_TEST_ASSERT(apSuite, persister.Init(&deferredStorage) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, provider.Init(persister, gIOContext.GetSystemLayer(), 1000_ms32) == CHIP_NO_ERROR);
+    const size_t deferredWriteCount = RunLevelTransition(apSuite, mockClock, provider, deferredStorage);
+
+    // One write per flush interval, and the last value once the transition completes
+    NL_TEST_ASSERT(apSuite, deferredWriteCount >= 10 && deferredWriteCount <= 11);
+    NL_TEST_ASSERT(apSuite, ReadLevel(persister, 1) == 254);
+
+    ChipLogProgress(Test, "Storage writes during a 10s level transition: %u direct, %u deferred with a 1s flush interval",
+                    static_cast<unsigned>(directWriteCount), static_cast<unsigned>(deferredWriteCount));
+
+    provider.Shutdown();
+    System::Clock::Internal::SetSystemClockForTesting(savedClock);
+}
+
+int Initialize(void * apContext)
+{
+    return (gIOContext.Init() == CHIP_NO_ERROR) ? SUCCESS : FAILURE;
+}
+
+int Finalize(void * apContext)
+{
+    gIOContext.Shutdown();
+    return SUCCESS;
+}
+
+} // namespace
+
+int TestDeferredAttributePersistenceProvider()
+{
+    static nlTest sTests[] = {
+        NL_TEST_DEF("TestReadPendingValue", TestReadPendingValue),
+        NL_TEST_DEF("TestFlushThreshold", TestFlushThreshold),
+        NL_TEST_DEF("TestLargeValueWriteThrough", TestLargeValueWriteThrough),
+        NL_TEST_DEF("TestFailedWriteRetry", TestFailedWriteRetry),
+        NL_TEST_DEF("TestFailedWriteThreshold", TestFailedWriteThreshold),
+        NL_TEST_DEF("TestLevelTransition", TestLevelTransition),
+        NL_TEST_SENTINEL(),
+    };
+
+    nlTestSuite theSuite = {
+        "DeferredAttributePersistenceProvider",
+        &sTests[0],
+        Initialize,
+        Finalize,
+    };
+    nlTestRunner(&theSuite, nullptr);
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestDeferredAttributePersistenceProvider)
@@ -0,0 +1,363 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests and a publisher throughput benchmark for the DirtyAttributeInbox.
+ *
+ */
+
+#include <app/reporting/DirtyAttributeInbox.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <nlunit-test.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::reporting;
+
+namespace {
+
+constexpr EmberAfAttributeType kInt32uType = 0x23;
+
+ConcreteAttributePath SensorPath(size_t index)
+{
+    return ConcreteAttributePath(static_cast<EndpointId>(index + 1), 0x0402 /* TemperatureMeasurement */, 0 /* MeasuredValue */);
+}
+
+void TestCoalescing(nlTestSuite * apSuite, void * apContext)
+{
+    DirtyAttributeInbox inbox;
+    bool wake;
+    NL_TEST_ASSERT(apSuite, inbox.Init() == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(apSuite, inbox.Publish(SensorPath(0), wake) == CHIP_NO_ERROR && wake);
+    NL_TEST_ASSERT(apSuite, inbox.Publish(SensorPath(0), wake) == CHIP_NO_ERROR && !wake);
+    NL_TEST_ASSERT(apSuite, inbox.Publish(SensorPath(1), wake) == CHIP_NO_ERROR && !wake);
+    NL_TEST_ASSERT(apSuite, inbox.Publish(SensorPath(0), wake) == CHIP_NO_ERROR && !wake);
+
+    size_t sensor0Count = 0;
+    size_t drained      = inbox.Drain([&](const DirtyAttributeInbox::Entry & entry) {
+        sensor0Count += (entry.mPath == SensorPath(0)) ? 1 : 0;
+        NL_TEST_ASSERT(apSuite, !entry.mHasValue);
+    });
+    NL_TEST_ASSERT(apSuite, drained == 2);
+    NL_TEST_ASSERT(apSuite, sensor0Count == 1);
+
+    // The first change after a drain asks for another one
+    NL_TEST_ASSERT(apSuite, inbox.Drain([](const DirtyAttributeInbox::Entry &) {}) == 0);
+    NL_TEST_ASSERT(apSuite, inbox.Publish(SensorPath(0), wake) == CHIP_NO_ERROR && wake);
+}
+
+void TestLastValueWins(nlTestSuite * apSuite, void * apContext)
+{
+    DirtyAttributeInbox inbox;
+    bool wake;
+    NL_TEST_ASSERT(apSuite, inbox.Init() == CHIP_NO_ERROR);
+
+    for (uint32_t value = 1; value <= 3; value++)
+    {
+        NL_TEST_ASSERT(apSuite,
+                       inbox.Publish(SensorPath(0), kInt32uType, reinterpret_cast<const uint8_t *>(&value), sizeof(value), wake) ==
+                           CHIP_NO_ERROR);
+    }
+    // A change without value keeps the pending value
+    NL_TEST_ASSERT(apSuite, inbox.Publish(SensorPath(0), wake) == CHIP_NO_ERROR);
+
+    size_t drained = inbox.Drain([&](const DirtyAttributeInbox::Entry & entry) {
+        uint32_t value = 0;
+        NL_TEST_ASSERT(apSuite, entry.mHasValue);
+        NL_TEST_ASSERT(apSuite, entry.mType == kInt32uType);
+        NL_TEST_ASSERT(apSuite, entry.mValueSize == sizeof(value));
+        memcpy(&value, entry.mValue, sizeof(value));
+        NL_TEST_ASSERT(apSuite, value == 3);
+    });
+    NL_TEST_ASSERT(apSuite, drained == 1);
+
+    uint8_t tooLarge[CHIP_IM_SERVER_MAX_PUBLISHED_ATTRIBUTE_VALUE_SIZE + 1] = {};
+    NL_TEST_ASSERT(apSuite,
+                   inbox.Publish(SensorPath(0), kInt32uType, tooLarge, sizeof(tooLarge), wake) == CHIP_ERROR_BUFFER_TOO_SMALL);
+}
+
+void TestFull(nlTestSuite * apSuite, void * apContext)
+{
+    DirtyAttributeInbox inbox;
+    bool wake;
+    NL_TEST_ASSERT(apSuite, inbox.Init() == CHIP_NO_ERROR);
+
+    size_t published = 0;
+    while (inbox.Publish(SensorPath(published), wake) == CHIP_NO_ERROR)
+    {
+        published++;
+        NL_TEST_ASSERT(apSuite, published <= CHIP_IM_SERVER_MAX_NUM_PUBLISHED_ATTRIBUTE_CHANGES);
+    }
+    NL_TEST_ASSERT(apSuite, published > 0);
+
+    // Pending attributes can still change
+    NL_TEST_ASSERT(apSuite, inbox.Publish(SensorPath(0), wake) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(apSuite, inbox.Drain([](const DirtyAttributeInbox::Entry &) {}) == published);
+    NL_TEST_ASSERT(apSuite, inbox.Publish(SensorPath(published), wake) == CHIP_NO_ERROR && wake);
+}
+
+/// Stands for the CHIP thread: runs its event loop with the stack lock held, then waits for events for up to a
+/// millisecond. Publishing through the inbox wakes it up, like the work posted by the reporting engine.
+class ChipThread
+{
+public:
+    std::mutex & StackLock() { return mStackLock; }
+
+    void Wake()
+    {
+        std::lock_guard<std::mutex> lock(mWakeLock);
+        mWakePending = true;
+        mCondition.notify_one();
+    }
+
+    template <typename Work>
+    void Run(std::atomic<bool> & aStop, Work && aWork)
+    {
+        while (!aStop.load())
+        {
+            {
+                std::lock_guard<std::mutex> stackLock(mStackLock);
+                // Handling timers, messages and reports
+                auto busyUntil = std::chrono::steady_clock::now() + std::chrono::microseconds(100);
+                while (std::chrono::steady_clock::now() < busyUntil)
+                {
+                }
+                aWork();
+            }
+
+            std::unique_lock<std::mutex> lock(mWakeLock);
+            mCondition.wait_for(lock, std::chrono::milliseconds(1), [this] { return mWakePending; });
+            mWakePending = false;
+        }
+    }
+
+private:
+    std::mutex mStackLock;
+    std::mutex mWakeLock;
+    std::condition_variable mCondition;
+    bool mWakePending = false;
+};
+
+struct BenchmarkResult
+{
+    std::chrono::microseconds duration;
+    size_t handled;       // changes handled on the CHIP thread
+    bool lastValuesMatch; // the last value handled for every sensor is the last one published
+};
+
+constexpr size_t kSensorsPerPublisher  = 4;
+constexpr uint32_t kUpdatesPerSensor   = 50000;
+constexpr size_t kMaxPublisherCount    = 16;
+constexpr size_t kSensorCount          = kSensorsPerPublisher * kMaxPublisherCount;
+constexpr uint32_t kUpdatesPerRunTotal = kSensorsPerPublisher * kUpdatesPerSensor;
+
+/// Stands for MatterReportingAttributeChangeCallback: bumps the cluster data version and checks the change against the
+/// paths of the subscriptions.
+class Subscriptions
+{
+public:
+    void MarkDirty(size_t aSensor, uint32_t aValue)
+    {
+        mLastValues[aSensor] = aValue;
+        mDataVersions[aSensor]++;
+        for (auto & path : mInterestedPaths)
+        {
+            if (path == SensorPath(aSensor))
+            {
+                mDirtyCount++;
+            }
+        }
+    }
+
+    uint32_t LastValue(size_t aSensor) const { return mLastValues[aSensor]; }
+
+private:
+    uint32_t mLastValues[kSensorCount]   = {};
+    uint32_t mDataVersions[kSensorCount] = {};
+    ConcreteAttributePath mInterestedPaths[kSensorCount / 2];
+    size_t mDirtyCount = 0;
+};
+
+/// Run publisher threads updating their sensors with [aPublish] while the CHIP thread runs [aChipWork].
+template <typename Publish, typename ChipWork>
+BenchmarkResult RunPublishers(ChipThread & aChipThread, size_t aPublisherCount, Publish && aPublish, ChipWork && aChipWork)
+{
+    std::atomic<bool> stop{ false };
+    BenchmarkResult result = { std::chrono::microseconds(0), 0, true };
+
+    std::thread chipThread([&] { aChipThread.Run(stop, aChipWork); });
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> publishers;
+    for (size_t p = 0; p < aPublisherCount; p++)
+    {
+        publishers.emplace_back([&, p] {
+            for (uint32_t value = 1; value <= kUpdatesPerSensor; value++)
+            {
+                for (size_t s = p * kSensorsPerPublisher; s < (p + 1) * kSensorsPerPublisher; s++)
+                {
+                    aPublish(s, value);
+                }
+            }
+        });
+    }
+    for (auto & publisher : publishers)
+    {
+        publisher.join();
+    }
+    result.duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    stop.store(true);
+    aChipThread.Wake();
+    chipThread.join();
+    return result;
+}
+
+/// Publishers update their sensors through the inbox, which the CHIP thread drains.
+BenchmarkResult RunInbox(size_t aPublisherCount)
+{
+    DirtyAttributeInbox inbox;
+    ChipThread chipThread;
+    Subscriptions subscriptions;
+    size_t handled = 0;
+
+    inbox.Init();
+
+    auto drain = [&] {
+        handled += inbox.Drain([&](const DirtyAttributeInbox::Entry & entry) {
+            uint32_t value;
+            memcpy(&value, entry.mValue, sizeof(value));
+            subscriptions.MarkDirty(static_cast<size_t>(entry.mPath.mEndpointId - 1), value);
+        });
+    };
+    auto publish = [&](size_t sensor, uint32_t value) {
+        bool wake = false;
+        while (inbox.Publish(SensorPath(sensor), kInt32uType, reinterpret_cast<const uint8_t *>(&value), sizeof(value), wake) !=
+               CHIP_NO_ERROR)
+        {
+            std::this_thread::yield();
+        }
+        if (wake)
+        {
+            chipThread.Wake();
+        }
+    };
+
+    BenchmarkResult result = RunPublishers(chipThread, aPublisherCount, publish, drain);
+    drain();
+
+    result.handled = handled;
+    for (size_t s = 0; s < aPublisherCount * kSensorsPerPublisher; s++)
+    {
+        result.lastValuesMatch = result.lastValuesMatch && (subscriptions.LastValue(s) == kUpdatesPerSensor);
+    }
+    return result;
+}
+
+/// Publishers take the stack lock for every update, as required by MatterReportingAttributeChangeCallback.
+BenchmarkResult RunStackLock(size_t aPublisherCount)
+{
+    ChipThread chipThread;
+    Subscriptions subscriptions;
+    size_t handled = 0;
+
+    auto publish = [&](size_t sensor, uint32_t value) {
+        std::lock_guard<std::mutex> lock(chipThread.StackLock());
+        subscriptions.MarkDirty(sensor, value);
+        handled++;
+    };
+
+    BenchmarkResult result = RunPublishers(chipThread, aPublisherCount, publish, [] {});
+
+    result.handled = handled;
+    for (size_t s = 0; s < aPublisherCount * kSensorsPerPublisher; s++)
+    {
+        result.lastValuesMatch = result.lastValuesMatch && (subscriptions.LastValue(s) == kUpdatesPerSensor);
+    }
+    return result;
+}
+
+void BenchmarkConcurrentPublishers(nlTestSuite * apSuite, void * apContext)
+{
+    for (size_t publisherCount = 1; publisherCount <= kMaxPublisherCount; publisherCount *= 2)
+    {
+        const uint64_t updates = static_cast<uint64_t>(publisherCount) * kUpdatesPerRunTotal;
+
+        BenchmarkResult locked = RunStackLock(publisherCount);
+        BenchmarkResult inbox  = RunInbox(publisherCount);
+
+        ChipLogProgress(DataManagement,
+                        "%2u publishers: stack lock %9u updates/s, %8u handled; inbox %9u updates/s, %8u handled",
+                        static_cast<unsigned>(publisherCount),
+                        static_cast<unsigned>(updates * 1000000u / static_cast<uint64_t>(locked.duration.count() + 1)),
+                        static_cast<unsigned>(locked.handled),
+                        static_cast<unsigned>(updates * 1000000u / static_cast<uint64_t>(inbox.duration.count() + 1)),
+                        static_cast<unsigned>(inbox.handled));
+
+        NL_TEST_ASSERT(apSuite, locked.lastValuesMatch);
+        NL_TEST_ASSERT(apSuite, inbox.lastValuesMatch);
+        NL_TEST_ASSERT(apSuite, locked.handled == updates);
+        // Repeated updates are coalesced
+        NL_TEST_ASSERT(apSuite, inbox.handled <= updates);
+    }
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("TestCoalescing", TestCoalescing),
+    NL_TEST_DEF("TestLastValueWins", TestLastValueWins),
+    NL_TEST_DEF("TestFull", TestFull),
+    NL_TEST_DEF("BenchmarkConcurrentPublishers", BenchmarkConcurrentPublishers),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+} // namespace
+
+int TestDirtyAttributeInbox()
+{
+    // clang-format off
+    nlTestSuite theSuite =
+    {
+        "TestDirtyAttributeInbox",
+        &sTests[0],
+        nullptr,
+        nullptr
+    };
+    // clang-format on
+
+    nlTestRunner(&theSuite, nullptr);
+
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestDirtyAttributeInbox)
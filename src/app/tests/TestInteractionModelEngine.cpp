@@ -47,7 +47,7 @@ class TestInteractionModelEngine
 {
 public:
     static void TestAttributePathParamsPushRelease(nlTestSuite * apSuite, void * apContext);
-    static void TestRemoveDuplicateConcreteAttribute(nlTestSuite * apSuite, void * apContext);
+    static void TestRemoveDuplicateAttributePaths(nlTestSuite * apSuite, void * apContext);
     static int GetAttributePathListLength(ObjectList<AttributePathParams> * apattributePathParamsList);
 };
 
@@ -100,7 +100,7 @@ void TestInteractionModelEngine::TestAttributePathParamsPushRelease(nlTestSuite
     NL_TEST_ASSERT(apSuite, GetAttributePathListLength(attributePathParamsList) == 0);
 }
 
-void TestInteractionModelEngine::TestRemoveDuplicateConcreteAttribute(nlTestSuite * apSuite, void * apContext)
+void TestInteractionModelEngine::TestRemoveDuplicateAttributePaths(nlTestSuite * apSuite, void * apContext)
 {
     TestContext & ctx = *static_cast<TestContext *>(apContext);
     CHIP_ERROR err    = CHIP_NO_ERROR;
@@ -127,7 +127,7 @@ void TestInteractionModelEngine::TestRemoveDuplicateConcreteAttribute(nlTestSuit
     InteractionModelEngine::GetInstance()->PushFrontAttributePathList(attributePathParamsList, attributePathParams1);
     InteractionModelEngine::GetInstance()->PushFrontAttributePathList(attributePathParamsList, attributePathParams2);
     InteractionModelEngine::GetInstance()->PushFrontAttributePathList(attributePathParamsList, attributePathParams3);
-    InteractionModelEngine::GetInstance()->RemoveDuplicateConcreteAttributePath(attributePathParamsList);
+    InteractionModelEngine::GetInstance()->RemoveDuplicateAttributePaths(attributePathParamsList);
     NL_TEST_ASSERT(apSuite, GetAttributePathListLength(attributePathParamsList) == 3);
     InteractionModelEngine::GetInstance()->ReleaseAttributePathList(attributePathParamsList);
 
@@ -147,7 +147,7 @@ void TestInteractionModelEngine::TestRemoveDuplicateConcreteAttribute(nlTestSuit
     InteractionModelEngine::GetInstance()->PushFrontAttributePathList(attributePathParamsList, attributePathParams1);
     InteractionModelEngine::GetInstance()->PushFrontAttributePathList(attributePathParamsList, attributePathParams2);
     InteractionModelEngine::GetInstance()->PushFrontAttributePathList(attributePathParamsList, attributePathParams3);
-    InteractionModelEngine::GetInstance()->RemoveDuplicateConcreteAttributePath(attributePathParamsList);
+    InteractionModelEngine::GetInstance()->RemoveDuplicateAttributePaths(attributePathParamsList);
     NL_TEST_ASSERT(apSuite, GetAttributePathListLength(attributePathParamsList) == 1);
     InteractionModelEngine::GetInstance()->ReleaseAttributePathList(attributePathParamsList);
 
@@ -155,7 +155,7 @@ void TestInteractionModelEngine::TestRemoveDuplicateConcreteAttribute(nlTestSuit
     InteractionModelEngine::GetInstance()->PushFrontAttributePathList(attributePathParamsList, attributePathParams2);
     InteractionModelEngine::GetInstance()->PushFrontAttributePathList(attributePathParamsList, attributePathParams1);
     InteractionModelEngine::GetInstance()->PushFrontAttributePathList(attributePathParamsList, attributePathParams3);
-    InteractionModelEngine::GetInstance()->RemoveDuplicateConcreteAttributePath(attributePathParamsList);
+    InteractionModelEngine::GetInstance()->RemoveDuplicateAttributePaths(attributePathParamsList);
     NL_TEST_ASSERT(apSuite, GetAttributePathListLength(attributePathParamsList) == 1);
     InteractionModelEngine::GetInstance()->ReleaseAttributePathList(attributePathParamsList);
 
@@ -163,7 +163,7 @@ void TestInteractionModelEngine::TestRemoveDuplicateConcreteAttribute(nlTestSuit
     InteractionModelEngine::GetInstance()->PushFrontAttributePathList(attributePathParamsList, attributePathParams2);
     InteractionModelEngine::GetInstance()->PushFrontAttributePathList(attributePathParamsList, attributePathParams3);
     InteractionModelEngine::GetInstance()->PushFrontAttributePathList(attributePathParamsList, attributePathParams1);
-    InteractionModelEngine::GetInstance()->RemoveDuplicateConcreteAttributePath(attributePathParamsList);
+    InteractionModelEngine::GetInstance()->RemoveDuplicateAttributePaths(attributePathParamsList);
     NL_TEST_ASSERT(apSuite, GetAttributePathListLength(attributePathParamsList) == 1);
     InteractionModelEngine::GetInstance()->ReleaseAttributePathList(attributePathParamsList);
 
@@ -183,7 +183,7 @@ void TestInteractionModelEngine::TestRemoveDuplicateConcreteAttribute(nlTestSuit
     InteractionModelEngine::GetInstance()->PushFrontAttributePathList(attributePathParamsList, attributePathParams1);
     InteractionModelEngine::GetInstance()->PushFrontAttributePathList(attributePathParamsList, attributePathParams2);
     InteractionModelEngine::GetInstance()->PushFrontAttributePathList(attributePathParamsList, attributePathParams3);
-    InteractionModelEngine::GetInstance()->RemoveDuplicateConcreteAttributePath(attributePathParamsList);
+    InteractionModelEngine::GetInstance()->RemoveDuplicateAttributePaths(attributePathParamsList);
     NL_TEST_ASSERT(apSuite, GetAttributePathListLength(attributePathParamsList) == 3);
     InteractionModelEngine::GetInstance()->ReleaseAttributePathList(attributePathParamsList);
 
@@ -199,12 +199,28 @@ void TestInteractionModelEngine::TestRemoveDuplicateConcreteAttribute(nlTestSuit
     attributePathParams3.mClusterId   = kInvalidClusterId;
     attributePathParams3.mAttributeId = Test::MockAttributeId(3);
 
-    // Wildcards cannot be deduplicated.
+    // 1st path is wildcard endpoint, cluster and attribute, the other wildcard paths are covered by it and would be removed.
     InteractionModelEngine::GetInstance()->PushFrontAttributePathList(attributePathParamsList, attributePathParams1);
     InteractionModelEngine::GetInstance()->PushFrontAttributePathList(attributePathParamsList, attributePathParams2);
     InteractionModelEngine::GetInstance()->PushFrontAttributePathList(attributePathParamsList, attributePathParams3);
-    InteractionModelEngine::GetInstance()->RemoveDuplicateConcreteAttributePath(attributePathParamsList);
-    NL_TEST_ASSERT(apSuite, GetAttributePathListLength(attributePathParamsList) == 3);
+    InteractionModelEngine::GetInstance()->RemoveDuplicateAttributePaths(attributePathParamsList);
+    NL_TEST_ASSERT(apSuite, GetAttributePathListLength(attributePathParamsList) == 1);
+    NL_TEST_ASSERT(apSuite, attributePathParamsList->mValue == attributePathParams1);
+    InteractionModelEngine::GetInstance()->ReleaseAttributePathList(attributePathParamsList);
+
+    // Wildcard paths that only intersect cannot be deduplicated.
+    InteractionModelEngine::GetInstance()->PushFrontAttributePathList(attributePathParamsList, attributePathParams2);
+    InteractionModelEngine::GetInstance()->PushFrontAttributePathList(attributePathParamsList, attributePathParams3);
+    InteractionModelEngine::GetInstance()->RemoveDuplicateAttributePaths(attributePathParamsList);
+    NL_TEST_ASSERT(apSuite, GetAttributePathListLength(attributePathParamsList) == 2);
+    InteractionModelEngine::GetInstance()->ReleaseAttributePathList(attributePathParamsList);
+
+    // The same wildcard path requested twice is kept once.
+    InteractionModelEngine::GetInstance()->PushFrontAttributePathList(attributePathParamsList, attributePathParams2);
+    InteractionModelEngine::GetInstance()->PushFrontAttributePathList(attributePathParamsList, attributePathParams2);
+    InteractionModelEngine::GetInstance()->RemoveDuplicateAttributePaths(attributePathParamsList);
+    NL_TEST_ASSERT(apSuite, GetAttributePathListLength(attributePathParamsList) == 1);
+    NL_TEST_ASSERT(apSuite, attributePathParamsList->mValue == attributePathParams2);
     InteractionModelEngine::GetInstance()->ReleaseAttributePathList(attributePathParamsList);
 
     attributePathParams1.mEndpointId  = kInvalidEndpointId;
@@ -218,9 +234,30 @@ void TestInteractionModelEngine::TestRemoveDuplicateConcreteAttribute(nlTestSuit
     // 1st path is wildcard endpoint, 2nd path is invalid attribute
     InteractionModelEngine::GetInstance()->PushFrontAttributePathList(attributePathParamsList, attributePathParams1);
     InteractionModelEngine::GetInstance()->PushFrontAttributePathList(attributePathParamsList, attributePathParams2);
-    InteractionModelEngine::GetInstance()->RemoveDuplicateConcreteAttributePath(attributePathParamsList);
+    InteractionModelEngine::GetInstance()->RemoveDuplicateAttributePaths(attributePathParamsList);
     NL_TEST_ASSERT(apSuite, GetAttributePathListLength(attributePathParamsList) == 2);
     InteractionModelEngine::GetInstance()->ReleaseAttributePathList(attributePathParamsList);
+
+    // A controller subscribing to a whole cluster on an endpoint, to one of its attributes on every endpoint, to attributes
+    // these already cover, and to an attribute of another cluster, with the wildcard paths repeated. Only the first two
+    // wildcard paths and the attribute of the other cluster are kept.
+    AttributePathParams subscribedPaths[] = {
+        AttributePathParams(Test::kMockEndpoint3, Test::MockClusterId(2)),
+        AttributePathParams(Test::MockClusterId(2), Test::MockAttributeId(1)),
+        AttributePathParams(Test::kMockEndpoint3, Test::MockClusterId(2), Test::MockAttributeId(1)),
+        AttributePathParams(Test::kMockEndpoint3, Test::MockClusterId(2), Test::MockAttributeId(2)),
+        AttributePathParams(Test::kMockEndpoint2, Test::MockClusterId(2), Test::MockAttributeId(1)),
+        AttributePathParams(Test::kMockEndpoint2, Test::MockClusterId(3), Test::MockAttributeId(1)),
+        AttributePathParams(Test::kMockEndpoint3, Test::MockClusterId(2)),
+        AttributePathParams(Test::MockClusterId(2), Test::MockAttributeId(1)),
+    };
+    for (auto & path : subscribedPaths)
+    {
+        InteractionModelEngine::GetInstance()->PushFrontAttributePathList(attributePathParamsList, path);
+    }
+    InteractionModelEngine::GetInstance()->RemoveDuplicateAttributePaths(attributePathParamsList);
+    NL_TEST_ASSERT(apSuite, GetAttributePathListLength(attributePathParamsList) == 3);
+    InteractionModelEngine::GetInstance()->ReleaseAttributePathList(attributePathParamsList);
 }
 
 } // namespace app
@@ -232,7 +269,7 @@ namespace {
 const nlTest sTests[] =
         {
                 NL_TEST_DEF("TestAttributePathParamsPushRelease", chip::app::TestInteractionModelEngine::TestAttributePathParamsPushRelease),
-                NL_TEST_DEF("TestRemoveDuplicateConcreteAttribute", chip::app::TestInteractionModelEngine::TestRemoveDuplicateConcreteAttribute),
+                NL_TEST_DEF("TestRemoveDuplicateAttributePaths", chip::app::TestInteractionModelEngine::TestRemoveDuplicateAttributePaths),
                 NL_TEST_SENTINEL()
         };
 // clang-format on
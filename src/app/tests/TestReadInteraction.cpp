@@ -1777,7 +1777,8 @@ void TestReadInteraction::TestSubscribeWildcard(nlTestSuite * apSuite, void * ap
     readPrepareParams.mEventPathParamsListSize = 0;
 
     std::unique_ptr<chip::app::AttributePathParams[]> attributePathParams(new chip::app::AttributePathParams[2]);
-    // Subscribe to full wildcard paths, repeat twice to ensure chunking.
+    // Subscribe to the full wildcard path twice. The repeated path is dropped by the read handler, so attributes are only
+    // reported once.
     readPrepareParams.mpAttributePathParamsList    = attributePathParams.get();
     readPrepareParams.mAttributePathParamsListSize = 2;
 
@@ -1799,10 +1800,9 @@ void TestReadInteraction::TestSubscribeWildcard(nlTestSuite * apSuite, void * ap
 
         NL_TEST_ASSERT(apSuite, delegate.mGotReport);
 
-        // We have 29 attributes in our mock attribute storage. And we subscribed twice.
-        // And attribute 3/2/4 is a list with 6 elements and list chunking is applied to it, thus we should receive ( 29 + 6 ) * 2 =
-        // 70 attribute data in total.
-        NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 70);
+        // We have 29 attributes in our mock attribute storage. And attribute 3/2/4 is a list with 6 elements and list chunking is
+        // applied to it, thus we should receive 29 + 6 = 35 attribute data in total.
+        NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 35);
         NL_TEST_ASSERT(apSuite, engine->GetNumActiveReadHandlers(ReadHandler::InteractionType::Subscribe) == 1);
         NL_TEST_ASSERT(apSuite, engine->ActiveHandlerAt(0) != nullptr);
         delegate.mpReadHandler = engine->ActiveHandlerAt(0);
@@ -1824,8 +1824,8 @@ void TestReadInteraction::TestSubscribeWildcard(nlTestSuite * apSuite, void * ap
             ctx.DrainAndServiceIO();
 
             NL_TEST_ASSERT(apSuite, delegate.mGotReport);
-            // We subscribed wildcard path twice, so we will receive two reports here.
-            NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 2);
+            // The repeated wildcard path was dropped, so we will receive a single report here.
+            NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 1);
         }
 
         // Set a endpoint dirty
@@ -1849,11 +1849,11 @@ void TestReadInteraction::TestSubscribeWildcard(nlTestSuite * apSuite, void * ap
             ctx.DrainAndServiceIO();
 
             NL_TEST_ASSERT(apSuite, delegate.mGotReport);
-            // Mock endpoint3 has 13 attributes in total, and we subscribed twice.
-            // And attribute 3/2/4 is a list with 6 elements and list chunking is applied to it, thus we should receive ( 13 + 6 ) *
-            // 2 = 28 attribute data in total.
+            // Mock endpoint3 has 13 attributes in total.
+            // And attribute 3/2/4 is a list with 6 elements and list chunking is applied to it, thus we should receive 13 + 6 = 19
+            // attribute data in total.
             ChipLogError(DataManagement, "RESPO: %d\n", delegate.mNumAttributeResponse);
-            NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 38);
+            NL_TEST_ASSERT(apSuite, delegate.mNumAttributeResponse == 19);
         }
     }
 
@@ -0,0 +1,254 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/ReportScheduler.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+using namespace chip;
+using namespace chip::app::reporting;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+constexpr size_t kFabricCount            = 5;
+constexpr size_t kSubscriptionsPerFabric = 10;
+constexpr size_t kCandidateCount         = kFabricCount * kSubscriptionsPerFabric;
+
+struct PendingReport
+{
+    ReportCandidate mCandidate;
+    bool mPending = false;
+};
+
+// Subscriptions queued fabric by fabric, so that a scheduler serving the oldest report first would drain fabric 1 before the
+// others.
+void QueueReports(PendingReport (&aReports)[kCandidateCount], ReportCandidate::Urgency aUrgency)
+{
+    for (size_t i = 0; i < kCandidateCount; i++)
+    {
+        aReports[i].mCandidate.mFabricIndex = static_cast<FabricIndex>(i / kSubscriptionsPerFabric + 1);
+        aReports[i].mCandidate.mUrgency     = aUrgency;
+        aReports[i].mCandidate.mQueuedSince = System::Clock::Milliseconds64(i);
+        aReports[i].mPending                = true;
+    }
+}
+
+// Picks the next report the way the reporting engine does, or returns nullptr if none is allowed to send.
+PendingReport * PickNext(ReportScheduler & aScheduler, PendingReport (&aReports)[kCandidateCount])
+{
+    PendingReport * next = nullptr;
+    for (auto & report : aReports)
+    {
+        if (!report.mPending || !aScheduler.IsSendAllowed(report.mCandidate))
+        {
+            continue;
+        }
+        if (next == nullptr || aScheduler.ShouldPrecede(report.mCandidate, next->mCandidate))
+        {
+            next = &report;
+        }
+    }
+    return next;
+}
+
+void TestFabricFairness(nlTestSuite * apSuite, void * apContext)
+{
+    DefaultReportScheduler scheduler(0);
+    PendingReport reports[kCandidateCount];
+    QueueReports(reports, ReportCandidate::Urgency::kDirty);
+    scheduler.OnRunStarted(System::Clock::kZero);
+
+    // Every fabric gets a report out before any fabric gets a second one.
+    for (size_t round = 0; round < kSubscriptionsPerFabric; round++)
+    {
+        bool served[kFabricCount + 1] = {};
+        for (size_t i = 0; i < kFabricCount; i++)
+        {
+            PendingReport * next = PickNext(scheduler, reports);
+            NL_TEST_ASSERT(apSuite, next != nullptr);
+            VerifyOrReturn(next != nullptr);
+
+            FabricIndex fabricIndex = next->mCandidate.mFabricIndex;
+            NL_TEST_ASSERT(apSuite, !served[fabricIndex]);
+            served[fabricIndex] = true;
+
+            next->mPending = false;
+            scheduler.OnReportSent(next->mCandidate, 100);
+        }
+    }
+    NL_TEST_ASSERT(apSuite, PickNext(scheduler, reports) == nullptr);
+}
+
+void TestOldestReportFirst(nlTestSuite * apSuite, void * apContext)
+{
+    DefaultReportScheduler scheduler(0);
+    PendingReport reports[kCandidateCount];
+    QueueReports(reports, ReportCandidate::Urgency::kDirty);
+
+    // Within a fabric, reports go out in the order they were queued.
+    for (size_t i = 0; i < kSubscriptionsPerFabric; i++)
+    {
+        reports[i].mCandidate.mQueuedSince = System::Clock::Milliseconds64(kSubscriptionsPerFabric - i);
+    }
+
+    PendingReport * next = PickNext(scheduler, reports);
+    NL_TEST_ASSERT(apSuite, next == &reports[kSubscriptionsPerFabric - 1]);
+}
+
+void TestUrgencyOrder(nlTestSuite * apSuite, void * apContext)
+{
+    DefaultReportScheduler scheduler(0);
+    PendingReport reports[kCandidateCount];
+    QueueReports(reports, ReportCandidate::Urgency::kPriming);
+
+    reports[10].mCandidate.mUrgency = ReportCandidate::Urgency::kDirty;
+    reports[20].mCandidate.mUrgency = ReportCandidate::Urgency::kKeepAlive;
+    reports[49].mCandidate.mUrgency = ReportCandidate::Urgency::kUrgentEvent;
+
+    const size_t expectedOrder[] = { 49, 20, 10, 0 };
+    for (size_t expected : expectedOrder)
+    {
+        PendingReport * next = PickNext(scheduler, reports);
+        NL_TEST_ASSERT(apSuite, next == &reports[expected]);
+        VerifyOrReturn(next != nullptr);
+
+        next->mPending = false;
+        scheduler.OnReportSent(next->mCandidate, 100);
+    }
+}
+
+void TestBandwidthBudget(nlTestSuite * apSuite, void * apContext)
+{
+    DefaultReportScheduler scheduler(1000);
+    PendingReport reports[kCandidateCount];
+    QueueReports(reports, ReportCandidate::Urgency::kDirty);
+    scheduler.OnRunStarted(System::Clock::kZero);
+
+    // A report is sent as long as some budget is left, however large it is.
+    PendingReport * next = PickNext(scheduler, reports);
+    NL_TEST_ASSERT(apSuite, next != nullptr);
+    VerifyOrReturn(next != nullptr);
+    next->mPending = false;
+    scheduler.OnReportSent(next->mCandidate, 1200);
+
+    NL_TEST_ASSERT(apSuite, PickNext(scheduler, reports) == nullptr);
+    // 201 bytes are missing, paid back in 201 ms.
+    NL_TEST_ASSERT(apSuite, scheduler.GetRetryDelay() == 201_ms32);
+
+    // Keep-alives and urgent events are not held back.
+    reports[30].mCandidate.mUrgency = ReportCandidate::Urgency::kKeepAlive;
+    reports[40].mCandidate.mUrgency = ReportCandidate::Urgency::kUrgentEvent;
+    NL_TEST_ASSERT(apSuite, PickNext(scheduler, reports) == &reports[40]);
+    reports[40].mPending = false;
+    NL_TEST_ASSERT(apSuite, PickNext(scheduler, reports) == &reports[30]);
+    reports[30].mPending = false;
+
+    scheduler.OnRunStarted(100_ms64);
+    NL_TEST_ASSERT(apSuite, PickNext(scheduler, reports) == nullptr);
+    NL_TEST_ASSERT(apSuite, scheduler.GetRetryDelay() == 101_ms32);
+
+    scheduler.OnRunStarted(201_ms64);
+    NL_TEST_ASSERT(apSuite, PickNext(scheduler, reports) != nullptr);
+    NL_TEST_ASSERT(apSuite, scheduler.GetRetryDelay() == System::Clock::kZero);
+
+    // No more than one second of budget is saved up while idle.
+    scheduler.OnRunStarted(60000_ms64);
+    next = PickNext(scheduler, reports);
+    NL_TEST_ASSERT(apSuite, next != nullptr);
+    VerifyOrReturn(next != nullptr);
+    next->mPending = false;
+    scheduler.OnReportSent(next->mCandidate, 1000);
+    NL_TEST_ASSERT(apSuite, PickNext(scheduler, reports) == nullptr);
+}
+
+void TestBandwidthBudgetFrequentRuns(nlTestSuite * apSuite, void * apContext)
+{
+    DefaultReportScheduler scheduler(10);
+    PendingReport reports[kCandidateCount];
+    QueueReports(reports, ReportCandidate::Urgency::kDirty);
+    scheduler.OnRunStarted(System::Clock::kZero);
+
+    PendingReport * next = PickNext(scheduler, reports);
+    NL_TEST_ASSERT(apSuite, next != nullptr);
+    VerifyOrReturn(next != nullptr);
+    next->mPending = false;
+    scheduler.OnReportSent(next->mCandidate, 20);
+
+    // Runs every 50 ms each earn half a byte, which adds up rather than being lost.
+    for (uint64_t time = 50; time <= 1050; time += 50)
+    {
+        scheduler.OnRunStarted(System::Clock::Milliseconds64(time));
+        NL_TEST_ASSERT(apSuite, PickNext(scheduler, reports) == nullptr);
+    }
+    scheduler.OnRunStarted(1100_ms64);
+    NL_TEST_ASSERT(apSuite, PickNext(scheduler, reports) != nullptr);
+}
+
+void TestNoBandwidthBudget(nlTestSuite * apSuite, void * apContext)
+{
+    DefaultReportScheduler scheduler(0);
+    PendingReport reports[kCandidateCount];
+    QueueReports(reports, ReportCandidate::Urgency::kPriming);
+    scheduler.OnRunStarted(System::Clock::kZero);
+
+    for (size_t i = 0; i < kCandidateCount; i++)
+    {
+        PendingReport * next = PickNext(scheduler, reports);
+        NL_TEST_ASSERT(apSuite, next != nullptr);
+        VerifyOrReturn(next != nullptr);
+        next->mPending = false;
+        scheduler.OnReportSent(next->mCandidate, 100000);
+    }
+    NL_TEST_ASSERT(apSuite, scheduler.GetRetryDelay() == System::Clock::kZero);
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("TestFabricFairness", TestFabricFairness),
+    NL_TEST_DEF("TestOldestReportFirst", TestOldestReportFirst),
+    NL_TEST_DEF("TestUrgencyOrder", TestUrgencyOrder),
+    NL_TEST_DEF("TestBandwidthBudget", TestBandwidthBudget),
+    NL_TEST_DEF("TestBandwidthBudgetFrequentRuns", TestBandwidthBudgetFrequentRuns),
+    NL_TEST_DEF("TestNoBandwidthBudget", TestNoBandwidthBudget),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+// clang-format off
+nlTestSuite sSuite =
+{
+    "TestReportScheduler",
+    &sTests[0],
+    nullptr,
+    nullptr,
+};
+// clang-format on
+
+} // namespace
+
+int TestReportScheduler()
+{
+    nlTestRunner(&sSuite, nullptr);
+    return (nlTestRunnerStats(&sSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestReportScheduler)
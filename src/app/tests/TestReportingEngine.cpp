@@ -56,9 +56,12 @@ public:
     static void TestBuildAndSendSingleReportData(nlTestSuite * apSuite, void * apContext);
     static void TestMergeOverlappedAttributePath(nlTestSuite * apSuite, void * apContext);
     static void TestMergeAttributePathWhenDirtySetPoolExhausted(nlTestSuite * apSuite, void * apContext);
+    static void TestReportFabricFairness(nlTestSuite * apSuite, void * apContext);
+    static void TestReportBandwidthBudget(nlTestSuite * apSuite, void * apContext);
 
 private:
     static bool InsertToDirtySet(const AttributePathParams & aPath);
+    static void CreateReadHandler(nlTestSuite * apSuite, Messaging::ExchangeContext * apExchangeCtx);
 
     struct ExpectedDirtySetContent : public AttributePathParams
     {
@@ -121,6 +124,51 @@ public:
     chip::app::ReadHandler::ApplicationCallback * GetAppCallback() override { return nullptr; }
 };
 
+// Records the fabric of each report the engine sends.
+class RecordingReportScheduler : public DefaultReportScheduler
+{
+public:
+    explicit RecordingReportScheduler(uint32_t aBytesPerSecond) : DefaultReportScheduler(aBytesPerSecond) {}
+
+    void OnReportSent(const ReportCandidate & aCandidate, uint32_t aLength) override
+    {
+        if (mSentCount < ArraySize(mSentFabrics))
+        {
+            mSentFabrics[mSentCount] = aCandidate.mFabricIndex;
+        }
+        mSentCount++;
+        DefaultReportScheduler::OnReportSent(aCandidate, aLength);
+    }
+
+    FabricIndex mSentFabrics[8] = {};
+    size_t mSentCount           = 0;
+};
+
+// Adds a read handler to the interaction model engine, with its priming report to send over the session of the exchange.
+void TestReportingEngine::CreateReadHandler(nlTestSuite * apSuite, Messaging::ExchangeContext * apExchangeCtx)
+{
+    System::PacketBufferTLVWriter writer;
+    System::PacketBufferHandle readRequestbuf = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSize);
+    ReadRequestMessage::Builder readRequestBuilder;
+
+    writer.Init(std::move(readRequestbuf));
+    NL_TEST_ASSERT(apSuite, readRequestBuilder.Init(&writer) == CHIP_NO_ERROR);
+    AttributePathIBs::Builder & attributePathListBuilder = readRequestBuilder.CreateAttributeRequests();
+    AttributePathIB::Builder & attributePathBuilder      = attributePathListBuilder.CreatePath();
+    attributePathBuilder.Node(1).Endpoint(kTestEndpointId).Cluster(kTestClusterId).Attribute(kTestFieldId1).EndOfAttributePathIB();
+    attributePathListBuilder.EndOfAttributePathIBs();
+    readRequestBuilder.IsFabricFiltered(false).EndOfReadRequestMessage();
+    NL_TEST_ASSERT(apSuite, readRequestBuilder.GetError() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, writer.Finalize(&readRequestbuf) == CHIP_NO_ERROR);
+
+    InteractionModelEngine * imEngine = InteractionModelEngine::GetInstance();
+    ReadHandler * readHandler =
+        imEngine->GetReadHandlerPool().CreateObject(*imEngine, apExchangeCtx, ReadHandler::InteractionType::Read);
+    NL_TEST_ASSERT(apSuite, readHandler != nullptr);
+    VerifyOrReturn(readHandler != nullptr);
+    readHandler->OnInitialRequest(std::move(readRequestbuf));
+}
+
 void TestReportingEngine::TestBuildAndSendSingleReportData(nlTestSuite * apSuite, void * apContext)
 {
     TestContext & ctx = *static_cast<TestContext *>(apContext);
@@ -321,6 +369,93 @@ void TestReportingEngine::TestMergeAttributePathWhenDirtySetPoolExhausted(nlTest
     InteractionModelEngine::GetInstance()->GetReportingEngine().Shutdown();
 }
 
+void TestReportingEngine::TestReportFabricFairness(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx                 = *static_cast<TestContext *>(apContext);
+    InteractionModelEngine * imEngine = InteractionModelEngine::GetInstance();
+    NL_TEST_ASSERT(apSuite, imEngine->Init(&ctx.GetExchangeManager(), &ctx.GetFabricTable()) == CHIP_NO_ERROR);
+
+    Engine & engine = imEngine->GetReportingEngine();
+    RecordingReportScheduler scheduler(0);
+    engine.SetReportScheduler(&scheduler);
+
+    // Both reports of the first fabric are queued before those of the second one, yet the fabrics take turns.
+    TestExchangeDelegate delegate;
+    CreateReadHandler(apSuite, ctx.NewExchangeToAlice(&delegate));
+    CreateReadHandler(apSuite, ctx.NewExchangeToAlice(&delegate));
+    CreateReadHandler(apSuite, ctx.NewExchangeToBob(&delegate));
+    CreateReadHandler(apSuite, ctx.NewExchangeToBob(&delegate));
+    NL_TEST_ASSERT(apSuite, imEngine->GetReadHandlerPool().Allocated() == 4);
+
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(apSuite, scheduler.mSentCount == 4);
+    NL_TEST_ASSERT(apSuite, scheduler.mSentFabrics[0] == ctx.GetBobFabricIndex());
+    NL_TEST_ASSERT(apSuite, scheduler.mSentFabrics[1] == ctx.GetAliceFabricIndex());
+    NL_TEST_ASSERT(apSuite, scheduler.mSentFabrics[2] == ctx.GetBobFabricIndex());
+    NL_TEST_ASSERT(apSuite, scheduler.mSentFabrics[3] == ctx.GetAliceFabricIndex());
+    NL_TEST_ASSERT(apSuite, imEngine->GetReadHandlerPool().Allocated() == 0);
+
+    engine.SetReportScheduler(nullptr);
+    engine.Shutdown();
+}
+
+void TestReportingEngine::TestReportBandwidthBudget(nlTestSuite * apSuite, void * apContext)
+{
+    TestContext & ctx                 = *static_cast<TestContext *>(apContext);
+    InteractionModelEngine * imEngine = InteractionModelEngine::GetInstance();
+    NL_TEST_ASSERT(apSuite, imEngine->Init(&ctx.GetExchangeManager(), &ctx.GetFabricTable()) == CHIP_NO_ERROR);
+
+    System::Clock::ClockBase * const savedClock = &System::SystemClock();
+    System::Clock::Internal::MockClock mockClock;
+    System::Clock::Internal::SetSystemClockForTesting(&mockClock);
+
+    Engine & engine = imEngine->GetReportingEngine();
+    RecordingReportScheduler scheduler(10);
+    engine.SetReportScheduler(&scheduler);
+    engine.ResetReportQueueingStats();
+
+    TestExchangeDelegate delegate;
+    CreateReadHandler(apSuite, ctx.NewExchangeToAlice(&delegate));
+    CreateReadHandler(apSuite, ctx.NewExchangeToAlice(&delegate));
+    CreateReadHandler(apSuite, ctx.NewExchangeToAlice(&delegate));
+
+    // The first report uses up the budget, the others wait for the retry timer.
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(apSuite, scheduler.mSentCount == 1);
+    NL_TEST_ASSERT(apSuite, imEngine->GetReadHandlerPool().Allocated() == 2);
+
+    System::Clock::Milliseconds32 retryDelay = scheduler.GetRetryDelay();
+    NL_TEST_ASSERT(apSuite, retryDelay > Engine::kMinReportRetryDelay);
+
+    // The timer fires on one pass of the IO loop, and the run it schedules goes on the next one.
+    mockClock.AdvanceMonotonic(retryDelay - System::Clock::Milliseconds32(1));
+    ctx.GetIOContext().DriveIO();
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(apSuite, scheduler.mSentCount == 1);
+
+    mockClock.AdvanceMonotonic(System::Clock::Milliseconds32(1));
+    ctx.GetIOContext().DriveIO();
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(apSuite, scheduler.mSentCount == 2);
+    NL_TEST_ASSERT(apSuite, imEngine->GetReadHandlerPool().Allocated() == 1);
+
+    // Reads are priming reports; the second one was queued for the whole retry delay.
+    const ReportQueueingStats & stats = engine.GetReportQueueingStats(ReportCandidate::Urgency::kPriming);
+    NL_TEST_ASSERT(apSuite, stats.mReportCount == 2);
+    NL_TEST_ASSERT(apSuite, stats.mTotalDelay == retryDelay);
+    NL_TEST_ASSERT(apSuite, stats.mMaxDelay == retryDelay);
+
+    // Without a budget, the last report goes out on the next run.
+    engine.SetReportScheduler(nullptr);
+    NL_TEST_ASSERT(apSuite, engine.ScheduleRun() == CHIP_NO_ERROR);
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(apSuite, imEngine->GetReadHandlerPool().Allocated() == 0);
+
+    engine.Shutdown();
+    System::Clock::Internal::SetSystemClockForTesting(savedClock);
+}
+
 } // namespace reporting
 } // namespace app
 } // namespace chip
@@ -332,6 +467,8 @@ const nlTest sTests[] =
     NL_TEST_DEF("CheckBuildAndSendSingleReportData", chip::app::reporting::TestReportingEngine::TestBuildAndSendSingleReportData),
     NL_TEST_DEF("TestMergeOverlappedAttributePath", chip::app::reporting::TestReportingEngine::TestMergeOverlappedAttributePath),
     NL_TEST_DEF("TestMergeAttributePathWhenDirtySetPoolExhausted", chip::app::reporting::TestReportingEngine::TestMergeAttributePathWhenDirtySetPoolExhausted),
+    NL_TEST_DEF("TestReportFabricFairness", chip::app::reporting::TestReportingEngine::TestReportFabricFairness),
+    NL_TEST_DEF("TestReportBandwidthBudget", chip::app::reporting::TestReportingEngine::TestReportBandwidthBudget),
     NL_TEST_SENTINEL()
 };
 // clang-format on
@@ -0,0 +1,372 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the SnapshotAttributePersistenceProvider, along with a count of the
+ *      storage reads needed to restore the attributes of a bridge at boot.
+ *
+ */
+
+#include <app-common/zap-generated/attribute-type.h>
+#include <app/DefaultAttributePersistenceProvider.h>
+#include <app/SnapshotAttributePersistenceProvider.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <system/SystemClock.h>
+
+#include <nlunit-test.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+/// Counts the reads reaching the storage.
+class CountingStorageDelegate : public TestPersistentStorageDelegate
+{
+public:
+    CHIP_ERROR SyncGetKeyValue(const char * key, void * buffer, uint16_t & size) override
+    {
+        mReadCount++;
+        return TestPersistentStorageDelegate::SyncGetKeyValue(key, buffer, size);
+    }
+
+    bool HasSnapshot(EndpointId endpoint)
+    {
+        DefaultStorageKeyAllocator key;
+        return HasKey(key.AttributeSnapshot(endpoint));
+    }
+
+    size_t mReadCount = 0;
+};
+
+struct TestAttribute
+{
+    ClusterId mClusterId;
+    EmberAfAttributeMetadata mMetadata;
+};
+
+constexpr TestAttribute Int8uAttribute(ClusterId clusterId, AttributeId attributeId)
+{
+    return { clusterId,
+             { .attributeId   = attributeId,
+               .attributeType = ZCL_INT8U_ATTRIBUTE_TYPE,
+               .size          = 1,
+               .mask          = ATTRIBUTE_MASK_NONVOLATILE,
+               .defaultValue  = EmberAfDefaultOrMinMaxAttributeValue(uint32_t(0)) } };
+}
+
+constexpr size_t kStringAttributeIndex = 8;
+constexpr size_t kUnsetAttributeIndex  = 9;
+
+// The persisted attributes of a simulated endpoint: attribute 9 is never
+// written, so restores find no stored value for it.
+const TestAttribute kAttributes[] = {
+    Int8uAttribute(0x0006, 0x4003),
+    Int8uAttribute(0x0008, 0x0000),
+    Int8uAttribute(0x0008, 0x0010),
+    Int8uAttribute(0x0008, 0x0011),
+    Int8uAttribute(0x0008, 0x0012),
+    Int8uAttribute(0x0008, 0x0013),
+    Int8uAttribute(0x0008, 0x0014),
+    Int8uAttribute(0x0008, 0x4000),
+    { 0x0028,
+      { .attributeId   = 0x0005,
+        .attributeType = ZCL_CHAR_STRING_ATTRIBUTE_TYPE,
+        .size          = 33,
+        .mask          = ATTRIBUTE_MASK_NONVOLATILE,
+        .defaultValue  = EmberAfDefaultOrMinMaxAttributeValue(static_cast<uint8_t *>(nullptr)) } },
+    Int8uAttribute(0x0300, 0x4010),
+};
+constexpr size_t kAttributeCount = ArraySize(kAttributes);
+
+ConcreteAttributePath AttributePath(EndpointId endpoint, size_t index)
+{
+    return ConcreteAttributePath(endpoint, kAttributes[index].mClusterId, kAttributes[index].mMetadata.attributeId);
+}
+
+/// The value of an attribute, as an integer or as a Pascal-style string.
+struct AttributeValue
+{
+    uint8_t mBytes[34];
+    size_t mSize;
+    CHIP_ERROR mError;
+
+    void Set(EndpointId endpoint, size_t index, uint8_t generation)
+    {
+        if (index == kStringAttributeIndex)
+        {
+            int length = snprintf(reinterpret_cast<char *>(&mBytes[1]), sizeof(mBytes) - 1, "Light %u.%u", endpoint, generation);
+            mBytes[0]  = static_cast<uint8_t>(length);
+            mSize      = static_cast<size_t>(length) + 1;
+        }
+        else
+        {
+            mBytes[0] = static_cast<uint8_t>(endpoint + index + generation);
+            mSize     = 1;
+        }
+        mError = CHIP_NO_ERROR;
+    }
+
+    bool operator==(const AttributeValue & other) const
+    {
+        VerifyOrReturnError(mError == other.mError, false);
+        return mError != CHIP_NO_ERROR || (mSize == other.mSize && memcmp(mBytes, other.mBytes, mSize) == 0);
+    }
+};
+
+CHIP_ERROR WriteAttribute(AttributePersistenceProvider & provider, EndpointId endpoint, size_t index, uint8_t generation = 0)
+{
+    AttributeValue value;
+    value.Set(endpoint, index, generation);
+    return provider.WriteValue(AttributePath(endpoint, index), &kAttributes[index].mMetadata, ByteSpan(value.mBytes, value.mSize));
+}
+
+CHIP_ERROR WriteEndpoint(AttributePersistenceProvider & provider, EndpointId endpoint)
+{
+    for (size_t index = 0; index < kAttributeCount; index++)
+    {
+        if (index != kUnsetAttributeIndex)
+        {
+            ReturnErrorOnFailure(WriteAttribute(provider, endpoint, index));
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
+/// Reads back the persisted attributes of an endpoint the way emAfLoadAttributeDefaults does at boot.
+void RestoreEndpoint(AttributePersistenceProvider & provider, EndpointId endpoint, AttributeValue (&values)[kAttributeCount],
+                     size_t attributeCount = kAttributeCount)
+{
+    provider.BeginEndpointRestore(endpoint);
+    for (size_t index = 0; index < attributeCount; index++)
+    {
+        MutableByteSpan bytes(values[index].mBytes, kAttributes[index].mMetadata.size);
+        values[index].mError = provider.ReadValue(AttributePath(endpoint, index), &kAttributes[index].mMetadata, bytes);
+        values[index].mSize  = bytes.size();
+    }
+    provider.EndEndpointRestore(endpoint);
+}
+
+/// Checks restored values against the ones written by WriteEndpoint, with the attribute at `changedIndex`, if any,
+/// written again with `generation`.
+void CheckEndpoint(nlTestSuite * apSuite, EndpointId endpoint, const AttributeValue (&values)[kAttributeCount],
+                   size_t changedIndex = kAttributeCount, uint8_t generation = 0)
+{
+    for (size_t index = 0; index < kAttributeCount; index++)
+    {
+        AttributeValue expected;
+        expected.Set(endpoint, index, (index == changedIndex) ? generation : 0);
+        if (index == kUnsetAttributeIndex)
+        {
+            expected.mError = CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND;
+        }
+        NL_TEST_ASSERT(apSuite, values[index] == expected);
+    }
+}
+
+void TestSnapshotRestore(nlTestSuite * apSuite, void * apContext)
+{
+    CountingStorageDelegate storage;
+    SnapshotAttributePersistenceProvider provider;
+    AttributeValue values[kAttributeCount];
+    NL_TEST_ASSERT(apSuite, provider.Init(&storage) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, WriteEndpoint(provider, 1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, !storage.HasSnapshot(1));
+
+    // The first restore reads each attribute from its own key, and stores a snapshot of them
+    RestoreEndpoint(provider, 1, values);
+    CheckEndpoint(apSuite, 1, values);
+    NL_TEST_ASSERT(apSuite, storage.mReadCount == 1 + kAttributeCount);
+    NL_TEST_ASSERT(apSuite, storage.HasSnapshot(1));
+
+    // The next ones only read the snapshot, including for the attribute with no stored value
+    storage.mReadCount = 0;
+    RestoreEndpoint(provider, 1, values);
+    CheckEndpoint(apSuite, 1, values);
+    NL_TEST_ASSERT(apSuite, storage.mReadCount == 1);
+
+    // So does a new provider, as after a reboot
+    SnapshotAttributePersistenceProvider rebootedProvider;
+    NL_TEST_ASSERT(apSuite, rebootedProvider.Init(&storage) == CHIP_NO_ERROR);
+    storage.mReadCount = 0;
+    RestoreEndpoint(rebootedProvider, 1, values);
+    CheckEndpoint(apSuite, 1, values);
+    NL_TEST_ASSERT(apSuite, storage.mReadCount == 1);
+
+    // Reads outside of a restore use the attribute keys
+    uint8_t value = 0;
+    MutableByteSpan bytes(&value, sizeof(value));
+    storage.mReadCount = 0;
+    NL_TEST_ASSERT(apSuite, rebootedProvider.ReadValue(AttributePath(1, 0), &kAttributes[0].mMetadata, bytes) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, storage.mReadCount == 1);
+    NL_TEST_ASSERT(apSuite, value == 1);
+}
+
+void TestSnapshotInvalidation(nlTestSuite * apSuite, void * apContext)
+{
+    CountingStorageDelegate storage;
+    SnapshotAttributePersistenceProvider provider;
+    AttributeValue values[kAttributeCount];
+    NL_TEST_ASSERT(apSuite, provider.Init(&storage) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, WriteEndpoint(provider, 1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, WriteEndpoint(provider, 2) == CHIP_NO_ERROR);
+    RestoreEndpoint(provider, 1, values);
+    RestoreEndpoint(provider, 2, values);
+    NL_TEST_ASSERT(apSuite, storage.HasSnapshot(1) && storage.HasSnapshot(2));
+
+    // Writing an attribute deletes the snapshot of its endpoint only
+    SnapshotAttributePersistenceProvider rebootedProvider;
+    NL_TEST_ASSERT(apSuite, rebootedProvider.Init(&storage) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, WriteAttribute(rebootedProvider, 1, kStringAttributeIndex, 1) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, !storage.HasSnapshot(1));
+    NL_TEST_ASSERT(apSuite, storage.HasSnapshot(2));
+
+    // The restore reads the attribute keys again, and stores a new snapshot with the value written
+    storage.mReadCount = 0;
+    RestoreEndpoint(rebootedProvider, 1, values);
+    CheckEndpoint(apSuite, 1, values, kStringAttributeIndex, 1);
+    NL_TEST_ASSERT(apSuite, storage.mReadCount == 1 + kAttributeCount);
+    NL_TEST_ASSERT(apSuite, storage.HasSnapshot(1));
+
+    NL_TEST_ASSERT(apSuite, WriteAttribute(rebootedProvider, 1, kStringAttributeIndex, 2) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, !storage.HasSnapshot(1));
+    RestoreEndpoint(rebootedProvider, 1, values);
+
+    storage.mReadCount = 0;
+    RestoreEndpoint(rebootedProvider, 1, values);
+    CheckEndpoint(apSuite, 1, values, kStringAttributeIndex, 2);
+    NL_TEST_ASSERT(apSuite, storage.mReadCount == 1);
+    RestoreEndpoint(rebootedProvider, 2, values);
+    CheckEndpoint(apSuite, 2, values);
+}
+
+void TestSnapshotMissingAttribute(nlTestSuite * apSuite, void * apContext)
+{
+    CountingStorageDelegate storage;
+    SnapshotAttributePersistenceProvider provider;
+    AttributeValue values[kAttributeCount];
+    NL_TEST_ASSERT(apSuite, provider.Init(&storage) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(apSuite, WriteEndpoint(provider, 1) == CHIP_NO_ERROR);
+    RestoreEndpoint(provider, 1, values, kAttributeCount - 2);
+
+    // Attributes added since the snapshot was stored, e.g. by a firmware update, are read from their own keys
+    storage.mReadCount = 0;
+    RestoreEndpoint(provider, 1, values);
+    CheckEndpoint(apSuite, 1, values);
+    NL_TEST_ASSERT(apSuite, storage.mReadCount == 1 + 2);
+
+    storage.mReadCount = 0;
+    RestoreEndpoint(provider, 1, values);
+    CheckEndpoint(apSuite, 1, values);
+    NL_TEST_ASSERT(apSuite, storage.mReadCount == 1);
+}
+
+void TestBootRestore(nlTestSuite * apSuite, void * apContext)
+{
+    constexpr EndpointId kEndpointCount = 200;
+    AttributeValue values[kAttributeCount];
+
+    // Restoring every attribute from its own key
+    CountingStorageDelegate directStorage;
+    DefaultAttributePersistenceProvider directProvider;
+    NL_TEST_ASSERT(apSuite, directProvider.Init(&directStorage) == CHIP_NO_ERROR);
+    for (EndpointId endpoint = 1; endpoint <= kEndpointCount; endpoint++)
+    {
+        NL_TEST_ASSERT(apSuite, WriteEndpoint(directProvider, endpoint) == CHIP_NO_ERROR);
+    }
+    System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+    for (EndpointId endpoint = 1; endpoint <= kEndpointCount; endpoint++)
+    {
+        RestoreEndpoint(directProvider, endpoint, values);
+        CheckEndpoint(apSuite, endpoint, values);
+    }
+    System::Clock::Microseconds64 directTime = System::SystemClock().GetMonotonicMicroseconds64() - start;
+    NL_TEST_ASSERT(apSuite, directStorage.mReadCount == kEndpointCount * kAttributeCount);
+
+    // Restoring from the snapshots stored on the first boot
+    CountingStorageDelegate snapshotStorage;
+    SnapshotAttributePersistenceProvider firstBootProvider;
+    NL_TEST_ASSERT(apSuite, firstBootProvider.Init(&snapshotStorage) == CHIP_NO_ERROR);
+    for (EndpointId endpoint = 1; endpoint <= kEndpointCount; endpoint++)
+    {
+        NL_TEST_ASSERT(apSuite, WriteEndpoint(firstBootProvider, endpoint) == CHIP_NO_ERROR);
+        RestoreEndpoint(firstBootProvider, endpoint, values);
+    }
+    SnapshotAttributePersistenceProvider snapshotProvider;
+    NL_TEST_ASSERT(apSuite, snapshotProvider.Init(&snapshotStorage) == CHIP_NO_ERROR);
+    snapshotStorage.mReadCount = 0;
+    start                      = System::SystemClock().GetMonotonicMicroseconds64();
+    for (EndpointId endpoint = 1; endpoint <= kEndpointCount; endpoint++)
+    {
+        RestoreEndpoint(snapshotProvider, endpoint, values);
+        CheckEndpoint(apSuite, endpoint, values);
+    }
+    System::Clock::Microseconds64 snapshotTime = System::SystemClock().GetMonotonicMicroseconds64() - start;
+    NL_TEST_ASSERT(apSuite, snapshotStorage.mReadCount == kEndpointCount);
+
+    ChipLogProgress(Test,
+                    "Restoring %u endpoints of %u attributes: %u storage reads in %" PRIu64 "us, %u in %" PRIu64
+                    "us with snapshots",
+                    static_cast<unsigned>(kEndpointCount), static_cast<unsigned>(kAttributeCount),
+                    static_cast<unsigned>(directStorage.mReadCount), directTime.count(),
+                    static_cast<unsigned>(snapshotStorage.mReadCount), snapshotTime.count());
+}
+
+int Initialize(void * apContext)
+{
+    return (Platform::MemoryInit() == CHIP_NO_ERROR) ? SUCCESS : FAILURE;
+}
+
+int Finalize(void * apContext)
+{
+    Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+} // namespace
+
+int TestSnapshotAttributePersistenceProvider()
+{
+    static nlTest sTests[] = {
+        NL_TEST_DEF("TestSnapshotRestore", TestSnapshotRestore),
+        NL_TEST_DEF("TestSnapshotInvalidation", TestSnapshotInvalidation),
+        NL_TEST_DEF("TestSnapshotMissingAttribute", TestSnapshotMissingAttribute),
+        NL_TEST_DEF("TestBootRestore", TestBootRestore),
+        NL_TEST_SENTINEL(),
+    };
+
+    nlTestSuite theSuite = {
+        "SnapshotAttributePersistenceProvider",
+        &sTests[0],
+        Initialize,
+        Finalize,
+    };
+    nlTestRunner(&theSuite, nullptr);
+    return (nlTestRunnerStats(&theSuite));
+}
+
+CHIP_REGISTER_TEST_SUITE(TestSnapshotAttributePersistenceProvider)
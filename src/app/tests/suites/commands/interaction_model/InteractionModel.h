@@ -28,6 +28,8 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/UnitTestUtils.h>
 
+#include <vector>
+
 constexpr uint8_t kMaxAllowedPaths = 10;
 
 class InteractionModelConfig
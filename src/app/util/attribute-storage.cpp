@@ -910,6 +910,13 @@ bool emberAfEndpointEnableDisable(EndpointId endpoint, bool enable)
 
     if (currentlyEnabled != enable)
     {
+        // Write out the deferred attribute values whenever endpoints come and go, e.g. the dynamic endpoints of a bridge.
+        auto * attrStorage = app::GetAttributePersistenceProvider();
+        if (attrStorage != nullptr)
+        {
+            attrStorage->Flush();
+        }
+
         if (enable)
         {
             initializeEndpoint(&(emAfEndpoints[index]));
@@ -1217,6 +1224,10 @@ void emAfLoadAttributeDefaults(EndpointId endpoint, bool ignoreStorage, Optional
         }
         de = &(emAfEndpoints[ep]);
 
+        // Let the provider load all the persisted attributes of the endpoint at
+        // once, when it has any.
+        bool restoringEndpoint = false;
+
         for (clusterI = 0; clusterI < de->endpointType->clusterCount; clusterI++)
         {
             const EmberAfCluster * cluster = &(de->endpointType->cluster[clusterI]);
@@ -1245,6 +1256,11 @@ void emAfLoadAttributeDefaults(EndpointId endpoint, bool ignoreStorage, Optional
                 if (!ignoreStorage && am->IsAutomaticallyPersisted())
                 {
                     VerifyOrDie(attrStorage && "Attribute persistence needs a persistence provider");
+                    if (!restoringEndpoint)
+                    {
+                        attrStorage->BeginEndpointRestore(de->endpoint);
+                        restoringEndpoint = true;
+                    }
                     MutableByteSpan bytes(attrData);
                     CHIP_ERROR err = attrStorage->ReadValue(
                         app::ConcreteAttributePath(de->endpoint, cluster->clusterId, am->attributeId), am, bytes);
@@ -1332,6 +1348,10 @@ void emAfLoadAttributeDefaults(EndpointId endpoint, bool ignoreStorage, Optional
                 }
             }
         }
+        if (restoringEndpoint)
+        {
+            attrStorage->EndEndpointRestore(de->endpoint);
+        }
         if (endpoint != EMBER_BROADCAST_ENDPOINT)
         {
             break;
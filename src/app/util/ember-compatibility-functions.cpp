@@ -1140,3 +1140,34 @@ void MatterReportingAttributeChangeCallback(EndpointId endpoint)
 
     InteractionModelEngine::GetInstance()->GetReportingEngine().SetDirty(info);
 }
+
+CHIP_ERROR MatterPublishAttributeChange(const ConcreteAttributePath & aPath)
+{
+    return InteractionModelEngine::GetInstance()->GetReportingEngine().PublishAttributeChange(aPath);
+}
+
+CHIP_ERROR MatterPublishAttributeChange(const ConcreteAttributePath & aPath, EmberAfAttributeType type, const uint8_t * data,
+                                        uint16_t size)
+{
+    return InteractionModelEngine::GetInstance()->GetReportingEngine().PublishAttributeChange(aPath, type, data, size);
+}
+
+void MatterPublishedAttributeChangeCallback(const ConcreteAttributePath & aPath, EmberAfAttributeType aType, const uint8_t * aValue,
+                                            uint16_t aSize)
+{
+    if (aValue == nullptr)
+    {
+        MatterReportingAttributeChangeCallback(aPath);
+        return;
+    }
+
+    // Writing the attribute reports the change, if the value is different.
+    EmberAfStatus status =
+        emberAfWriteAttribute(aPath.mEndpointId, aPath.mClusterId, aPath.mAttributeId, const_cast<uint8_t *>(aValue), aType);
+    if (status != EMBER_ZCL_STATUS_SUCCESS)
+    {
+        ChipLogError(DataManagement, "Endpoint %x, Cluster " ChipLogFormatMEI ", Attribute " ChipLogFormatMEI
+                     ": failed to store published value: 0x%02x",
+                     aPath.mEndpointId, ChipLogValueMEI(aPath.mClusterId), ChipLogValueMEI(aPath.mAttributeId), status);
+    }
+}
@@ -0,0 +1,84 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Implementation of the router assigning operational nodes to the shards of a fleet controller.
+ */
+
+#include <controller/ShardRouter.h>
+
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace Controller {
+
+namespace {
+
+// splitmix64 finalizer: spreads close identifiers (e.g. consecutive node ids) over the whole range
+uint64_t Mix(uint64_t value)
+{
+    value += 0x9E3779B97F4A7C15ULL;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+} // namespace
+
+CHIP_ERROR ShardRouter::Init(uint8_t shardCount, Partitioning partitioning, uint16_t baseListenPort)
+{
+    VerifyOrReturnError(shardCount > 0 && shardCount <= kMaxShardCount, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(baseListenPort == 0 || baseListenPort <= UINT16_MAX - (shardCount - 1), CHIP_ERROR_INVALID_ARGUMENT);
+
+    mShardCount     = shardCount;
+    mPartitioning   = partitioning;
+    mBaseListenPort = baseListenPort;
+    return CHIP_NO_ERROR;
+}
+
+uint8_t ShardRouter::GetShard(const PeerId & peer) const
+{
+    uint64_t key = Mix(peer.GetCompressedFabricId());
+    if (mPartitioning == Partitioning::kByNode)
+    {
+        key = Mix(key ^ peer.GetNodeId());
+    }
+
+    uint8_t shard      = 0;
+    uint64_t maxWeight = 0;
+    for (uint8_t candidate = 0; candidate < mShardCount; candidate++)
+    {
+        uint64_t weight = Mix(key + candidate);
+        if (candidate == 0 || weight > maxWeight)
+        {
+            shard     = candidate;
+            maxWeight = weight;
+        }
+    }
+    return shard;
+}
+
+uint16_t ShardRouter::GetListenPort(uint8_t shard) const
+{
+    VerifyOrReturnValue(mBaseListenPort != 0, 0);
+    return static_cast<uint16_t>(mBaseListenPort + shard);
+}
+
+} // namespace Controller
+} // namespace chip
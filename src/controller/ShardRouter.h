@@ -0,0 +1,88 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Declaration of the router assigning operational nodes to the shards of a fleet controller.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/PeerId.h>
+
+#include <stdint.h>
+
+namespace chip {
+namespace Controller {
+
+/**
+ * Assigns operational nodes to the shards of a fleet controller.
+ *
+ * A controller process runs a single CHIP stack: the platform manager, the system layer, the interaction
+ * model engine and the DNS-SD resolver are process-wide singletons. A controller managing more nodes than
+ * one core can serve is therefore split into shards, each one a controller process with its own event
+ * loop, storage, session tables and transports, listening on its own UDP port (FactoryInitParams::listenPort
+ * set to GetListenPort() of the shard). All shards use the same router configuration so that they agree on
+ * which shard manages each node.
+ *
+ * Nodes are assigned with rendezvous (highest random weight) hashing: every node goes to the shard with
+ * the highest hash of the (node, shard) pair. This spreads nodes evenly without any shared state, and
+ * growing from N to N+1 shards only moves the nodes won by the new shard, about 1/(N+1) of them.
+ */
+class ShardRouter
+{
+public:
+    enum class Partitioning : uint8_t
+    {
+        kByNode,   ///< Nodes are spread over all shards.
+        kByFabric, ///< All the nodes of a fabric are managed by the same shard.
+    };
+
+    static constexpr uint8_t kMaxShardCount = 64;
+
+    /**
+     * @param[in] shardCount      The number of shards, from 1 to kMaxShardCount.
+     * @param[in] partitioning    Whether nodes of a fabric may be managed by different shards.
+     * @param[in] baseListenPort  The UDP port of shard 0, shard i listening on baseListenPort + i. When 0,
+     *                            all shards let the system pick their port.
+     */
+    CHIP_ERROR Init(uint8_t shardCount, Partitioning partitioning = Partitioning::kByNode, uint16_t baseListenPort = 0);
+
+    uint8_t GetShardCount() const { return mShardCount; }
+
+    /**
+     * The shard managing the given node.
+     */
+    uint8_t GetShard(const PeerId & peer) const;
+
+    bool IsManagedBy(const PeerId & peer, uint8_t shard) const { return GetShard(peer) == shard; }
+
+    /**
+     * The UDP port the controller of the given shard listens on.
+     */
+    uint16_t GetListenPort(uint8_t shard) const;
+
+private:
+    uint8_t mShardCount        = 1;
+    Partitioning mPartitioning = Partitioning::kByNode;
+    uint16_t mBaseListenPort   = 0;
+};
+
+} // namespace Controller
+} // namespace chip
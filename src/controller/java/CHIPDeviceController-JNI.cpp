@@ -24,6 +24,7 @@
 #include "AndroidCallbacks.h"
 #include "AndroidCommissioningWindowOpener.h"
 #include "AndroidDeviceControllerWrapper.h"
+#include "CHIPAttributeTLVValueDecoder.h"
 #include <lib/support/CHIPJNIError.h>
 #include <lib/support/JniReferences.h>
 #include <lib/support/JniTypeWrappers.h>
@@ -150,6 +151,12 @@ void JNI_OnUnload(JavaVM * jvm, void * reserved)
         pthread_join(sIOThread, NULL);
     }
 
+    JNIEnv * env = JniReferences::GetInstance().GetEnvForCurrentThread();
+    if (env != nullptr)
+    {
+        JniReferences::GetInstance().ClearCachedClassRefs(env);
+    }
+
     sJVM = NULL;
 
     chip::Platform::MemoryShutdown();
@@ -1402,6 +1409,34 @@ JNI_METHOD(void, read)
     callback->mReadClient = readClient;
 }
 
+JNI_METHOD(jobject, decodeAttributeValue)(JNIEnv * env, jobject self, jobject attributePath, jbyteArray tlv)
+{
+    EndpointId endpointId;
+    ClusterId clusterId;
+    AttributeId attributeId;
+    TLV::TLVReader reader;
+    JniByteArray tlvBytes(env, tlv);
+    jobject value = nullptr;
+
+    CHIP_ERROR err = ParseAttributePath(attributePath, endpointId, clusterId, attributeId);
+    SuccessOrExit(err);
+
+    reader.Init(tlvBytes.byteSpan());
+    err = reader.Next();
+    SuccessOrExit(err);
+
+    value = DecodeAttributeValue(app::ConcreteAttributePath(endpointId, clusterId, attributeId), reader, &err);
+
+exit:
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Controller, "Failed to decode attribute value. Err = %" CHIP_ERROR_FORMAT, err.Format());
+        JniReferences::GetInstance().ThrowError(env, sChipDeviceControllerExceptionCls, err);
+    }
+
+    return value;
+}
+
 /**
  * Takes objects in attributePathList, converts them to app:AttributePathParams, and appends them to outAttributePathParamsList.
  */
@@ -657,6 +657,15 @@ public class ChipDeviceController {
    */
   public native byte[] convertX509CertToMatterCert(byte[] x509Cert);
 
+  /**
+   * Decodes the TLV encoded value of an attribute, as reported in {@link
+   * chip.devicecontroller.model.AttributeState#getTlv()}, to the object the read callbacks report
+   * for it.
+   *
+   * @throws ChipDeviceControllerException if the attribute is unknown or the TLV is invalid
+   */
+  public native Object decodeAttributeValue(ChipAttributePath attributePath, byte[] tlv);
+
   /**
    * Generates a new PASE verifier for the given setup PIN code.
    *
@@ -1383,16 +1383,12 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                                                                                entry_0.revision, newElement_0_revision);
 
                 jclass deviceTypeStructStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$DescriptorClusterDeviceTypeStruct", deviceTypeStructStructClass_1);
+                jmethodID deviceTypeStructStructCtor_1;
+                static chip::JniCachedConstructor deviceTypeStructStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$DescriptorClusterDeviceTypeStruct",
+                    "(Ljava/lang/Integer;Ljava/lang/Integer;)V");
+                err = deviceTypeStructStructCtorCache_1.Get(env, deviceTypeStructStructClass_1, deviceTypeStructStructCtor_1);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$DescriptorClusterDeviceTypeStruct");
-                    return nullptr;
-                }
-                jmethodID deviceTypeStructStructCtor_1 =
-                    env->GetMethodID(deviceTypeStructStructClass_1, "<init>", "(Ljava/lang/Integer;Ljava/lang/Integer;)V");
-                if (deviceTypeStructStructCtor_1 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$DescriptorClusterDeviceTypeStruct constructor");
                     return nullptr;
@@ -1674,17 +1670,12 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                                                                               entry_0.fabricIndex, newElement_0_fabricIndex);
 
                 jclass targetStructStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$BindingClusterTargetStruct", targetStructStructClass_1);
-                if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$BindingClusterTargetStruct");
-                    return nullptr;
-                }
-                jmethodID targetStructStructCtor_1 = env->GetMethodID(
-                    targetStructStructClass_1, "<init>",
+                jmethodID targetStructStructCtor_1;
+                static chip::JniCachedConstructor targetStructStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$BindingClusterTargetStruct",
                     "(Ljava/util/Optional;Ljava/util/Optional;Ljava/util/Optional;Ljava/util/Optional;Ljava/lang/Integer;)V");
-                if (targetStructStructCtor_1 == nullptr)
+                err = targetStructStructCtorCache_1.Get(env, targetStructStructClass_1, targetStructStructCtor_1);
+                if (err != CHIP_NO_ERROR)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$BindingClusterTargetStruct constructor");
                     return nullptr;
@@ -1913,16 +1904,12 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                         }
 
                         jclass targetStructClass_4;
-                        err = chip::JniReferences::GetInstance().GetClassRef(
-                            env, "chip/devicecontroller/ChipStructs$AccessControlClusterTarget", targetStructClass_4);
+                        jmethodID targetStructCtor_4;
+                        static chip::JniCachedConstructor targetStructCtorCache_4(
+                            "chip/devicecontroller/ChipStructs$AccessControlClusterTarget",
+                            "(Ljava/lang/Long;Ljava/lang/Integer;Ljava/lang/Long;)V");
+                        err = targetStructCtorCache_4.Get(env, targetStructClass_4, targetStructCtor_4);
                         if (err != CHIP_NO_ERROR)
-                        {
-                            ChipLogError(Zcl, "Could not find class ChipStructs$AccessControlClusterTarget");
-                            return nullptr;
-                        }
-                        jmethodID targetStructCtor_4 = env->GetMethodID(targetStructClass_4, "<init>",
-                                                                        "(Ljava/lang/Long;Ljava/lang/Integer;Ljava/lang/Long;)V");
-                        if (targetStructCtor_4 == nullptr)
                         {
                             ChipLogError(Zcl, "Could not find ChipStructs$AccessControlClusterTarget constructor");
                             return nullptr;
@@ -1941,18 +1928,12 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                                                                               entry_0.fabricIndex, newElement_0_fabricIndex);
 
                 jclass accessControlEntryStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$AccessControlClusterAccessControlEntry",
-                    accessControlEntryStructClass_1);
-                if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$AccessControlClusterAccessControlEntry");
-                    return nullptr;
-                }
-                jmethodID accessControlEntryStructCtor_1 = env->GetMethodID(
-                    accessControlEntryStructClass_1, "<init>",
+                jmethodID accessControlEntryStructCtor_1;
+                static chip::JniCachedConstructor accessControlEntryStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$AccessControlClusterAccessControlEntry",
                     "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/util/ArrayList;Ljava/util/ArrayList;Ljava/lang/Integer;)V");
-                if (accessControlEntryStructCtor_1 == nullptr)
+                err = accessControlEntryStructCtorCache_1.Get(env, accessControlEntryStructClass_1, accessControlEntryStructCtor_1);
+                if (err != CHIP_NO_ERROR)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$AccessControlClusterAccessControlEntry constructor");
                     return nullptr;
@@ -1994,16 +1975,11 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                                                                               entry_0.fabricIndex, newElement_0_fabricIndex);
 
                 jclass extensionEntryStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$AccessControlClusterExtensionEntry", extensionEntryStructClass_1);
+                jmethodID extensionEntryStructCtor_1;
+                static chip::JniCachedConstructor extensionEntryStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$AccessControlClusterExtensionEntry", "([BLjava/lang/Integer;)V");
+                err = extensionEntryStructCtorCache_1.Get(env, extensionEntryStructClass_1, extensionEntryStructCtor_1);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$AccessControlClusterExtensionEntry");
-                    return nullptr;
-                }
-                jmethodID extensionEntryStructCtor_1 =
-                    env->GetMethodID(extensionEntryStructClass_1, "<init>", "([BLjava/lang/Integer;)V");
-                if (extensionEntryStructCtor_1 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$AccessControlClusterExtensionEntry constructor");
                     return nullptr;
@@ -2222,18 +2198,13 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                     static_cast<uint8_t>(entry_0.state), newElement_0_state);
 
                 jclass actionStructStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$ActionsClusterActionStruct", actionStructStructClass_1);
+                jmethodID actionStructStructCtor_1;
+                static chip::JniCachedConstructor actionStructStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$ActionsClusterActionStruct",
+                    "(Ljava/lang/Integer;Ljava/lang/String;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/"
+                    "Integer;)V");
+                err = actionStructStructCtorCache_1.Get(env, actionStructStructClass_1, actionStructStructCtor_1);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$ActionsClusterActionStruct");
-                    return nullptr;
-                }
-                jmethodID actionStructStructCtor_1 =
-                    env->GetMethodID(actionStructStructClass_1, "<init>",
-                                     "(Ljava/lang/Integer;Ljava/lang/String;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/"
-                                     "Integer;Ljava/lang/Integer;)V");
-                if (actionStructStructCtor_1 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$ActionsClusterActionStruct constructor");
                     return nullptr;
@@ -2292,17 +2263,12 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                 }
 
                 jclass endpointListStructStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$ActionsClusterEndpointListStruct", endpointListStructStructClass_1);
+                jmethodID endpointListStructStructCtor_1;
+                static chip::JniCachedConstructor endpointListStructStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$ActionsClusterEndpointListStruct",
+                    "(Ljava/lang/Integer;Ljava/lang/String;Ljava/lang/Integer;Ljava/util/ArrayList;)V");
+                err = endpointListStructStructCtorCache_1.Get(env, endpointListStructStructClass_1, endpointListStructStructCtor_1);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$ActionsClusterEndpointListStruct");
-                    return nullptr;
-                }
-                jmethodID endpointListStructStructCtor_1 =
-                    env->GetMethodID(endpointListStructStructClass_1, "<init>",
-                                     "(Ljava/lang/Integer;Ljava/lang/String;Ljava/lang/Integer;Ljava/util/ArrayList;)V");
-                if (endpointListStructStructCtor_1 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$ActionsClusterEndpointListStruct constructor");
                     return nullptr;
@@ -2711,16 +2677,13 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                 cppValue.subscriptionsPerFabric, value_subscriptionsPerFabric);
 
             jclass capabilityMinimaStructStructClass_0;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipStructs$BasicClusterCapabilityMinimaStruct", capabilityMinimaStructStructClass_0);
+            jmethodID capabilityMinimaStructStructCtor_0;
+            static chip::JniCachedConstructor capabilityMinimaStructStructCtorCache_0(
+                "chip/devicecontroller/ChipStructs$BasicClusterCapabilityMinimaStruct",
+                "(Ljava/lang/Integer;Ljava/lang/Integer;)V");
+            err = capabilityMinimaStructStructCtorCache_0.Get(
+                env, capabilityMinimaStructStructClass_0, capabilityMinimaStructStructCtor_0);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipStructs$BasicClusterCapabilityMinimaStruct");
-                return nullptr;
-            }
-            jmethodID capabilityMinimaStructStructCtor_0 =
-                env->GetMethodID(capabilityMinimaStructStructClass_0, "<init>", "(Ljava/lang/Integer;Ljava/lang/Integer;)V");
-            if (capabilityMinimaStructStructCtor_0 == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipStructs$BasicClusterCapabilityMinimaStruct constructor");
                 return nullptr;
@@ -2942,17 +2905,12 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                                                                               entry_0.fabricIndex, newElement_0_fabricIndex);
 
                 jclass providerLocationStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$OtaSoftwareUpdateRequestorClusterProviderLocation",
-                    providerLocationStructClass_1);
+                jmethodID providerLocationStructCtor_1;
+                static chip::JniCachedConstructor providerLocationStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$OtaSoftwareUpdateRequestorClusterProviderLocation",
+                    "(Ljava/lang/Long;Ljava/lang/Integer;Ljava/lang/Integer;)V");
+                err = providerLocationStructCtorCache_1.Get(env, providerLocationStructClass_1, providerLocationStructCtor_1);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$OtaSoftwareUpdateRequestorClusterProviderLocation");
-                    return nullptr;
-                }
-                jmethodID providerLocationStructCtor_1 = env->GetMethodID(
-                    providerLocationStructClass_1, "<init>", "(Ljava/lang/Long;Ljava/lang/Integer;Ljava/lang/Integer;)V");
-                if (providerLocationStructCtor_1 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$OtaSoftwareUpdateRequestorClusterProviderLocation constructor");
                     return nullptr;
@@ -4244,17 +4202,13 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                 cppValue.maxCumulativeFailsafeSeconds, value_maxCumulativeFailsafeSeconds);
 
             jclass basicCommissioningInfoStructClass_0;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipStructs$GeneralCommissioningClusterBasicCommissioningInfo",
-                basicCommissioningInfoStructClass_0);
+            jmethodID basicCommissioningInfoStructCtor_0;
+            static chip::JniCachedConstructor basicCommissioningInfoStructCtorCache_0(
+                "chip/devicecontroller/ChipStructs$GeneralCommissioningClusterBasicCommissioningInfo",
+                "(Ljava/lang/Integer;Ljava/lang/Integer;)V");
+            err = basicCommissioningInfoStructCtorCache_0.Get(
+                env, basicCommissioningInfoStructClass_0, basicCommissioningInfoStructCtor_0);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipStructs$GeneralCommissioningClusterBasicCommissioningInfo");
-                return nullptr;
-            }
-            jmethodID basicCommissioningInfoStructCtor_0 =
-                env->GetMethodID(basicCommissioningInfoStructClass_0, "<init>", "(Ljava/lang/Integer;Ljava/lang/Integer;)V");
-            if (basicCommissioningInfoStructCtor_0 == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipStructs$GeneralCommissioningClusterBasicCommissioningInfo constructor");
                 return nullptr;
@@ -4465,16 +4419,11 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                                                                            entry_0.connected, newElement_0_connected);
 
                 jclass networkInfoStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$NetworkCommissioningClusterNetworkInfo", networkInfoStructClass_1);
+                jmethodID networkInfoStructCtor_1;
+                static chip::JniCachedConstructor networkInfoStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$NetworkCommissioningClusterNetworkInfo", "([BLjava/lang/Boolean;)V");
+                err = networkInfoStructCtorCache_1.Get(env, networkInfoStructClass_1, networkInfoStructCtor_1);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$NetworkCommissioningClusterNetworkInfo");
-                    return nullptr;
-                }
-                jmethodID networkInfoStructCtor_1 =
-                    env->GetMethodID(networkInfoStructClass_1, "<init>", "([BLjava/lang/Boolean;)V");
-                if (networkInfoStructCtor_1 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$NetworkCommissioningClusterNetworkInfo constructor");
                     return nullptr;
@@ -4892,19 +4841,14 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                     newElement_0_type);
 
                 jclass networkInterfaceTypeStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$GeneralDiagnosticsClusterNetworkInterfaceType",
-                    networkInterfaceTypeStructClass_1);
+                jmethodID networkInterfaceTypeStructCtor_1;
+                static chip::JniCachedConstructor networkInterfaceTypeStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$GeneralDiagnosticsClusterNetworkInterfaceType",
+                    "(Ljava/lang/String;Ljava/lang/Boolean;Ljava/lang/Boolean;Ljava/lang/Boolean;[BLjava/util/ArrayList;Ljava/util/"
+                    "ArrayList;Ljava/lang/Integer;)V");
+                err = networkInterfaceTypeStructCtorCache_1.Get(
+                    env, networkInterfaceTypeStructClass_1, networkInterfaceTypeStructCtor_1);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$GeneralDiagnosticsClusterNetworkInterfaceType");
-                    return nullptr;
-                }
-                jmethodID networkInterfaceTypeStructCtor_1 =
-                    env->GetMethodID(networkInterfaceTypeStructClass_1, "<init>",
-                                     "(Ljava/lang/String;Ljava/lang/Boolean;Ljava/lang/Boolean;Ljava/lang/Boolean;[BLjava/util/"
-                                     "ArrayList;Ljava/util/ArrayList;Ljava/lang/Integer;)V");
-                if (networkInterfaceTypeStructCtor_1 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$GeneralDiagnosticsClusterNetworkInterfaceType constructor");
                     return nullptr;
@@ -5263,17 +5207,12 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                 }
 
                 jclass threadMetricsStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$SoftwareDiagnosticsClusterThreadMetrics", threadMetricsStructClass_1);
-                if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$SoftwareDiagnosticsClusterThreadMetrics");
-                    return nullptr;
-                }
-                jmethodID threadMetricsStructCtor_1 = env->GetMethodID(
-                    threadMetricsStructClass_1, "<init>",
+                jmethodID threadMetricsStructCtor_1;
+                static chip::JniCachedConstructor threadMetricsStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$SoftwareDiagnosticsClusterThreadMetrics",
                     "(Ljava/lang/Long;Ljava/util/Optional;Ljava/util/Optional;Ljava/util/Optional;Ljava/util/Optional;)V");
-                if (threadMetricsStructCtor_1 == nullptr)
+                err = threadMetricsStructCtorCache_1.Get(env, threadMetricsStructClass_1, threadMetricsStructCtor_1);
+                if (err != CHIP_NO_ERROR)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$SoftwareDiagnosticsClusterThreadMetrics constructor");
                     return nullptr;
@@ -5701,20 +5640,14 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                                                                            entry_0.isChild, newElement_0_isChild);
 
                 jclass neighborTableStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$ThreadNetworkDiagnosticsClusterNeighborTable",
-                    neighborTableStructClass_1);
+                jmethodID neighborTableStructCtor_1;
+                static chip::JniCachedConstructor neighborTableStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$ThreadNetworkDiagnosticsClusterNeighborTable",
+                    "(Ljava/lang/Long;Ljava/lang/Long;Ljava/lang/Integer;Ljava/lang/Long;Ljava/lang/Long;Ljava/lang/Integer;Ljava/"
+                    "lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Boolean;"
+                    "Ljava/lang/Boolean;Ljava/lang/Boolean;)V");
+                err = neighborTableStructCtorCache_1.Get(env, neighborTableStructClass_1, neighborTableStructCtor_1);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$ThreadNetworkDiagnosticsClusterNeighborTable");
-                    return nullptr;
-                }
-                jmethodID neighborTableStructCtor_1 =
-                    env->GetMethodID(neighborTableStructClass_1, "<init>",
-                                     "(Ljava/lang/Long;Ljava/lang/Long;Ljava/lang/Integer;Ljava/lang/Long;Ljava/lang/Long;Ljava/"
-                                     "lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/"
-                                     "Integer;Ljava/lang/Boolean;Ljava/lang/Boolean;Ljava/lang/Boolean;Ljava/lang/Boolean;)V");
-                if (neighborTableStructCtor_1 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$ThreadNetworkDiagnosticsClusterNeighborTable constructor");
                     return nullptr;
@@ -5806,18 +5739,13 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                                                                            entry_0.linkEstablished, newElement_0_linkEstablished);
 
                 jclass routeTableStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$ThreadNetworkDiagnosticsClusterRouteTable", routeTableStructClass_1);
-                if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$ThreadNetworkDiagnosticsClusterRouteTable");
-                    return nullptr;
-                }
-                jmethodID routeTableStructCtor_1 = env->GetMethodID(
-                    routeTableStructClass_1, "<init>",
+                jmethodID routeTableStructCtor_1;
+                static chip::JniCachedConstructor routeTableStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$ThreadNetworkDiagnosticsClusterRouteTable",
                     "(Ljava/lang/Long;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/"
                     "Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Boolean;)V");
-                if (routeTableStructCtor_1 == nullptr)
+                err = routeTableStructCtorCache_1.Get(env, routeTableStructClass_1, routeTableStructCtor_1);
+                if (err != CHIP_NO_ERROR)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$ThreadNetworkDiagnosticsClusterRouteTable constructor");
                     return nullptr;
@@ -6665,17 +6593,12 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                     value_flagsClassName.c_str(), value_flagsCtorSignature.c_str(), cppValue.Value().flags, value_flags);
 
                 jclass securityPolicyStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$ThreadNetworkDiagnosticsClusterSecurityPolicy",
-                    securityPolicyStructClass_1);
+                jmethodID securityPolicyStructCtor_1;
+                static chip::JniCachedConstructor securityPolicyStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$ThreadNetworkDiagnosticsClusterSecurityPolicy",
+                    "(Ljava/lang/Integer;Ljava/lang/Integer;)V");
+                err = securityPolicyStructCtorCache_1.Get(env, securityPolicyStructClass_1, securityPolicyStructCtor_1);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$ThreadNetworkDiagnosticsClusterSecurityPolicy");
-                    return nullptr;
-                }
-                jmethodID securityPolicyStructCtor_1 =
-                    env->GetMethodID(securityPolicyStructClass_1, "<init>", "(Ljava/lang/Integer;Ljava/lang/Integer;)V");
-                if (securityPolicyStructCtor_1 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$ThreadNetworkDiagnosticsClusterSecurityPolicy constructor");
                     return nullptr;
@@ -6796,21 +6719,15 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                     cppValue.Value().channelMaskPresent, value_channelMaskPresent);
 
                 jclass operationalDatasetComponentsStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$ThreadNetworkDiagnosticsClusterOperationalDatasetComponents",
-                    operationalDatasetComponentsStructClass_1);
+                jmethodID operationalDatasetComponentsStructCtor_1;
+                static chip::JniCachedConstructor operationalDatasetComponentsStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$ThreadNetworkDiagnosticsClusterOperationalDatasetComponents",
+                    "(Ljava/lang/Boolean;Ljava/lang/Boolean;Ljava/lang/Boolean;Ljava/lang/Boolean;Ljava/lang/Boolean;Ljava/lang/"
+                    "Boolean;Ljava/lang/Boolean;Ljava/lang/Boolean;Ljava/lang/Boolean;Ljava/lang/Boolean;Ljava/lang/Boolean;Ljava/"
+                    "lang/Boolean;)V");
+                err = operationalDatasetComponentsStructCtorCache_1.Get(
+                    env, operationalDatasetComponentsStructClass_1, operationalDatasetComponentsStructCtor_1);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl,
-                                 "Could not find class ChipStructs$ThreadNetworkDiagnosticsClusterOperationalDatasetComponents");
-                    return nullptr;
-                }
-                jmethodID operationalDatasetComponentsStructCtor_1 =
-                    env->GetMethodID(operationalDatasetComponentsStructClass_1, "<init>",
-                                     "(Ljava/lang/Boolean;Ljava/lang/Boolean;Ljava/lang/Boolean;Ljava/lang/Boolean;Ljava/lang/"
-                                     "Boolean;Ljava/lang/Boolean;Ljava/lang/Boolean;Ljava/lang/Boolean;Ljava/lang/Boolean;Ljava/"
-                                     "lang/Boolean;Ljava/lang/Boolean;Ljava/lang/Boolean;)V");
-                if (operationalDatasetComponentsStructCtor_1 == nullptr)
                 {
                     ChipLogError(
                         Zcl, "Could not find ChipStructs$ThreadNetworkDiagnosticsClusterOperationalDatasetComponents constructor");
@@ -8300,15 +8217,11 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                                                                               entry_0.fabricIndex, newElement_0_fabricIndex);
 
                 jclass NOCStructStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$OperationalCredentialsClusterNOCStruct", NOCStructStructClass_1);
+                jmethodID NOCStructStructCtor_1;
+                static chip::JniCachedConstructor NOCStructStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$OperationalCredentialsClusterNOCStruct", "([B[BLjava/lang/Integer;)V");
+                err = NOCStructStructCtorCache_1.Get(env, NOCStructStructClass_1, NOCStructStructCtor_1);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$OperationalCredentialsClusterNOCStruct");
-                    return nullptr;
-                }
-                jmethodID NOCStructStructCtor_1 = env->GetMethodID(NOCStructStructClass_1, "<init>", "([B[BLjava/lang/Integer;)V");
-                if (NOCStructStructCtor_1 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$OperationalCredentialsClusterNOCStruct constructor");
                     return nullptr;
@@ -8370,18 +8283,12 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                                                                               entry_0.fabricIndex, newElement_0_fabricIndex);
 
                 jclass fabricDescriptorStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$OperationalCredentialsClusterFabricDescriptor",
-                    fabricDescriptorStructClass_1);
-                if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$OperationalCredentialsClusterFabricDescriptor");
-                    return nullptr;
-                }
-                jmethodID fabricDescriptorStructCtor_1 = env->GetMethodID(
-                    fabricDescriptorStructClass_1, "<init>",
+                jmethodID fabricDescriptorStructCtor_1;
+                static chip::JniCachedConstructor fabricDescriptorStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$OperationalCredentialsClusterFabricDescriptor",
                     "([BLjava/lang/Integer;Ljava/lang/Long;Ljava/lang/Long;Ljava/lang/String;Ljava/lang/Integer;)V");
-                if (fabricDescriptorStructCtor_1 == nullptr)
+                err = fabricDescriptorStructCtorCache_1.Get(env, fabricDescriptorStructClass_1, fabricDescriptorStructCtor_1);
+                if (err != CHIP_NO_ERROR)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$OperationalCredentialsClusterFabricDescriptor constructor");
                     return nullptr;
@@ -8611,17 +8518,12 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                                                                               entry_0.fabricIndex, newElement_0_fabricIndex);
 
                 jclass groupKeyMapStructStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$GroupKeyManagementClusterGroupKeyMapStruct",
-                    groupKeyMapStructStructClass_1);
+                jmethodID groupKeyMapStructStructCtor_1;
+                static chip::JniCachedConstructor groupKeyMapStructStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$GroupKeyManagementClusterGroupKeyMapStruct",
+                    "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;)V");
+                err = groupKeyMapStructStructCtorCache_1.Get(env, groupKeyMapStructStructClass_1, groupKeyMapStructStructCtor_1);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$GroupKeyManagementClusterGroupKeyMapStruct");
-                    return nullptr;
-                }
-                jmethodID groupKeyMapStructStructCtor_1 = env->GetMethodID(
-                    groupKeyMapStructStructClass_1, "<init>", "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;)V");
-                if (groupKeyMapStructStructCtor_1 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$GroupKeyManagementClusterGroupKeyMapStruct constructor");
                     return nullptr;
@@ -8689,18 +8591,12 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                                                                               entry_0.fabricIndex, newElement_0_fabricIndex);
 
                 jclass groupInfoMapStructStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$GroupKeyManagementClusterGroupInfoMapStruct",
-                    groupInfoMapStructStructClass_1);
+                jmethodID groupInfoMapStructStructCtor_1;
+                static chip::JniCachedConstructor groupInfoMapStructStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$GroupKeyManagementClusterGroupInfoMapStruct",
+                    "(Ljava/lang/Integer;Ljava/util/ArrayList;Ljava/util/Optional;Ljava/lang/Integer;)V");
+                err = groupInfoMapStructStructCtorCache_1.Get(env, groupInfoMapStructStructClass_1, groupInfoMapStructStructCtor_1);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$GroupKeyManagementClusterGroupInfoMapStruct");
-                    return nullptr;
-                }
-                jmethodID groupInfoMapStructStructCtor_1 =
-                    env->GetMethodID(groupInfoMapStructStructClass_1, "<init>",
-                                     "(Ljava/lang/Integer;Ljava/util/ArrayList;Ljava/util/Optional;Ljava/lang/Integer;)V");
-                if (groupInfoMapStructStructCtor_1 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$GroupKeyManagementClusterGroupInfoMapStruct constructor");
                     return nullptr;
@@ -8876,16 +8772,11 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                 newElement_0_value = env->NewStringUTF(std::string(entry_0.value.data(), entry_0.value.size()).c_str());
 
                 jclass labelStructStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$FixedLabelClusterLabelStruct", labelStructStructClass_1);
+                jmethodID labelStructStructCtor_1;
+                static chip::JniCachedConstructor labelStructStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$FixedLabelClusterLabelStruct", "(Ljava/lang/String;Ljava/lang/String;)V");
+                err = labelStructStructCtorCache_1.Get(env, labelStructStructClass_1, labelStructStructCtor_1);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$FixedLabelClusterLabelStruct");
-                    return nullptr;
-                }
-                jmethodID labelStructStructCtor_1 =
-                    env->GetMethodID(labelStructStructClass_1, "<init>", "(Ljava/lang/String;Ljava/lang/String;)V");
-                if (labelStructStructCtor_1 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$FixedLabelClusterLabelStruct constructor");
                     return nullptr;
@@ -9031,16 +8922,11 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                 newElement_0_value = env->NewStringUTF(std::string(entry_0.value.data(), entry_0.value.size()).c_str());
 
                 jclass labelStructStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$UserLabelClusterLabelStruct", labelStructStructClass_1);
+                jmethodID labelStructStructCtor_1;
+                static chip::JniCachedConstructor labelStructStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$UserLabelClusterLabelStruct", "(Ljava/lang/String;Ljava/lang/String;)V");
+                err = labelStructStructCtorCache_1.Get(env, labelStructStructClass_1, labelStructStructCtor_1);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$UserLabelClusterLabelStruct");
-                    return nullptr;
-                }
-                jmethodID labelStructStructCtor_1 =
-                    env->GetMethodID(labelStructStructClass_1, "<init>", "(Ljava/lang/String;Ljava/lang/String;)V");
-                if (labelStructStructCtor_1 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$UserLabelClusterLabelStruct constructor");
                     return nullptr;
@@ -9346,16 +9232,12 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                                                                                    entry_2.value, newElement_2_value);
 
                     jclass semanticTagStructClass_3;
-                    err = chip::JniReferences::GetInstance().GetClassRef(
-                        env, "chip/devicecontroller/ChipStructs$ModeSelectClusterSemanticTag", semanticTagStructClass_3);
+                    jmethodID semanticTagStructCtor_3;
+                    static chip::JniCachedConstructor semanticTagStructCtorCache_3(
+                        "chip/devicecontroller/ChipStructs$ModeSelectClusterSemanticTag",
+                        "(Ljava/lang/Integer;Ljava/lang/Integer;)V");
+                    err = semanticTagStructCtorCache_3.Get(env, semanticTagStructClass_3, semanticTagStructCtor_3);
                     if (err != CHIP_NO_ERROR)
-                    {
-                        ChipLogError(Zcl, "Could not find class ChipStructs$ModeSelectClusterSemanticTag");
-                        return nullptr;
-                    }
-                    jmethodID semanticTagStructCtor_3 =
-                        env->GetMethodID(semanticTagStructClass_3, "<init>", "(Ljava/lang/Integer;Ljava/lang/Integer;)V");
-                    if (semanticTagStructCtor_3 == nullptr)
                     {
                         ChipLogError(Zcl, "Could not find ChipStructs$ModeSelectClusterSemanticTag constructor");
                         return nullptr;
@@ -9367,16 +9249,12 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                 }
 
                 jclass modeOptionStructStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$ModeSelectClusterModeOptionStruct", modeOptionStructStructClass_1);
+                jmethodID modeOptionStructStructCtor_1;
+                static chip::JniCachedConstructor modeOptionStructStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$ModeSelectClusterModeOptionStruct",
+                    "(Ljava/lang/String;Ljava/lang/Integer;Ljava/util/ArrayList;)V");
+                err = modeOptionStructStructCtorCache_1.Get(env, modeOptionStructStructClass_1, modeOptionStructStructCtor_1);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$ModeSelectClusterModeOptionStruct");
-                    return nullptr;
-                }
-                jmethodID modeOptionStructStructCtor_1 = env->GetMethodID(
-                    modeOptionStructStructClass_1, "<init>", "(Ljava/lang/String;Ljava/lang/Integer;Ljava/util/ArrayList;)V");
-                if (modeOptionStructStructCtor_1 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$ModeSelectClusterModeOptionStruct constructor");
                     return nullptr;
@@ -14736,17 +14614,12 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                 }
 
                 jclass channelInfoStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$ChannelClusterChannelInfo", channelInfoStructClass_1);
-                if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$ChannelClusterChannelInfo");
-                    return nullptr;
-                }
-                jmethodID channelInfoStructCtor_1 = env->GetMethodID(
-                    channelInfoStructClass_1, "<init>",
+                jmethodID channelInfoStructCtor_1;
+                static chip::JniCachedConstructor channelInfoStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$ChannelClusterChannelInfo",
                     "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/util/Optional;Ljava/util/Optional;Ljava/util/Optional;)V");
-                if (channelInfoStructCtor_1 == nullptr)
+                err = channelInfoStructCtorCache_1.Get(env, channelInfoStructClass_1, channelInfoStructCtor_1);
+                if (err != CHIP_NO_ERROR)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$ChannelClusterChannelInfo constructor");
                     return nullptr;
@@ -14811,17 +14684,12 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                     static_cast<uint8_t>(cppValue.Value().lineupInfoType), value_lineupInfoType);
 
                 jclass lineupInfoStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$ChannelClusterLineupInfo", lineupInfoStructClass_1);
+                jmethodID lineupInfoStructCtor_1;
+                static chip::JniCachedConstructor lineupInfoStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$ChannelClusterLineupInfo",
+                    "(Ljava/lang/String;Ljava/util/Optional;Ljava/util/Optional;Ljava/lang/Integer;)V");
+                err = lineupInfoStructCtorCache_1.Get(env, lineupInfoStructClass_1, lineupInfoStructCtor_1);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$ChannelClusterLineupInfo");
-                    return nullptr;
-                }
-                jmethodID lineupInfoStructCtor_1 =
-                    env->GetMethodID(lineupInfoStructClass_1, "<init>",
-                                     "(Ljava/lang/String;Ljava/util/Optional;Ljava/util/Optional;Ljava/lang/Integer;)V");
-                if (lineupInfoStructCtor_1 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$ChannelClusterLineupInfo constructor");
                     return nullptr;
@@ -14900,17 +14768,12 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                 }
 
                 jclass channelInfoStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$ChannelClusterChannelInfo", channelInfoStructClass_1);
-                if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$ChannelClusterChannelInfo");
-                    return nullptr;
-                }
-                jmethodID channelInfoStructCtor_1 = env->GetMethodID(
-                    channelInfoStructClass_1, "<init>",
+                jmethodID channelInfoStructCtor_1;
+                static chip::JniCachedConstructor channelInfoStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$ChannelClusterChannelInfo",
                     "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/util/Optional;Ljava/util/Optional;Ljava/util/Optional;)V");
-                if (channelInfoStructCtor_1 == nullptr)
+                err = channelInfoStructCtorCache_1.Get(env, channelInfoStructClass_1, channelInfoStructCtor_1);
+                if (err != CHIP_NO_ERROR)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$ChannelClusterChannelInfo constructor");
                     return nullptr;
@@ -15059,16 +14922,12 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                 newElement_0_name = env->NewStringUTF(std::string(entry_0.name.data(), entry_0.name.size()).c_str());
 
                 jclass targetInfoStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$TargetNavigatorClusterTargetInfo", targetInfoStructClass_1);
+                jmethodID targetInfoStructCtor_1;
+                static chip::JniCachedConstructor targetInfoStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$TargetNavigatorClusterTargetInfo",
+                    "(Ljava/lang/Integer;Ljava/lang/String;)V");
+                err = targetInfoStructCtorCache_1.Get(env, targetInfoStructClass_1, targetInfoStructCtor_1);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$TargetNavigatorClusterTargetInfo");
-                    return nullptr;
-                }
-                jmethodID targetInfoStructCtor_1 =
-                    env->GetMethodID(targetInfoStructClass_1, "<init>", "(Ljava/lang/Integer;Ljava/lang/String;)V");
-                if (targetInfoStructCtor_1 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$TargetNavigatorClusterTargetInfo constructor");
                     return nullptr;
@@ -15302,16 +15161,12 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                 }
 
                 jclass playbackPositionStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$MediaPlaybackClusterPlaybackPosition", playbackPositionStructClass_1);
+                jmethodID playbackPositionStructCtor_1;
+                static chip::JniCachedConstructor playbackPositionStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$MediaPlaybackClusterPlaybackPosition",
+                    "(Ljava/lang/Long;Ljava/lang/Long;)V");
+                err = playbackPositionStructCtorCache_1.Get(env, playbackPositionStructClass_1, playbackPositionStructCtor_1);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$MediaPlaybackClusterPlaybackPosition");
-                    return nullptr;
-                }
-                jmethodID playbackPositionStructCtor_1 =
-                    env->GetMethodID(playbackPositionStructClass_1, "<init>", "(Ljava/lang/Long;Ljava/lang/Long;)V");
-                if (playbackPositionStructCtor_1 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$MediaPlaybackClusterPlaybackPosition constructor");
                     return nullptr;
@@ -15528,17 +15383,12 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                     env->NewStringUTF(std::string(entry_0.description.data(), entry_0.description.size()).c_str());
 
                 jclass inputInfoStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$MediaInputClusterInputInfo", inputInfoStructClass_1);
+                jmethodID inputInfoStructCtor_1;
+                static chip::JniCachedConstructor inputInfoStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$MediaInputClusterInputInfo",
+                    "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/String;Ljava/lang/String;)V");
+                err = inputInfoStructCtorCache_1.Get(env, inputInfoStructClass_1, inputInfoStructCtor_1);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$MediaInputClusterInputInfo");
-                    return nullptr;
-                }
-                jmethodID inputInfoStructCtor_1 =
-                    env->GetMethodID(inputInfoStructClass_1, "<init>",
-                                     "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/String;Ljava/lang/String;)V");
-                if (inputInfoStructCtor_1 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$MediaInputClusterInputInfo constructor");
                     return nullptr;
@@ -16081,16 +15931,12 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                 newElement_0_name = env->NewStringUTF(std::string(entry_0.name.data(), entry_0.name.size()).c_str());
 
                 jclass outputInfoStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$AudioOutputClusterOutputInfo", outputInfoStructClass_1);
+                jmethodID outputInfoStructCtor_1;
+                static chip::JniCachedConstructor outputInfoStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$AudioOutputClusterOutputInfo",
+                    "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/String;)V");
+                err = outputInfoStructCtorCache_1.Get(env, outputInfoStructClass_1, outputInfoStructCtor_1);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$AudioOutputClusterOutputInfo");
-                    return nullptr;
-                }
-                jmethodID outputInfoStructCtor_1 = env->GetMethodID(outputInfoStructClass_1, "<init>",
-                                                                    "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/String;)V");
-                if (outputInfoStructCtor_1 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$AudioOutputClusterOutputInfo constructor");
                     return nullptr;
@@ -16281,16 +16127,12 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                                                                         .c_str());
 
                 jclass applicationStructClass_2;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$ApplicationLauncherClusterApplication", applicationStructClass_2);
+                jmethodID applicationStructCtor_2;
+                static chip::JniCachedConstructor applicationStructCtorCache_2(
+                    "chip/devicecontroller/ChipStructs$ApplicationLauncherClusterApplication",
+                    "(Ljava/lang/Integer;Ljava/lang/String;)V");
+                err = applicationStructCtorCache_2.Get(env, applicationStructClass_2, applicationStructCtor_2);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$ApplicationLauncherClusterApplication");
-                    return nullptr;
-                }
-                jmethodID applicationStructCtor_2 =
-                    env->GetMethodID(applicationStructClass_2, "<init>", "(Ljava/lang/Integer;Ljava/lang/String;)V");
-                if (applicationStructCtor_2 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$ApplicationLauncherClusterApplication constructor");
                     return nullptr;
@@ -16315,17 +16157,12 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                 }
 
                 jclass applicationEPStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$ApplicationLauncherClusterApplicationEP", applicationEPStructClass_1);
-                if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$ApplicationLauncherClusterApplicationEP");
-                    return nullptr;
-                }
-                jmethodID applicationEPStructCtor_1 = env->GetMethodID(
-                    applicationEPStructClass_1, "<init>",
+                jmethodID applicationEPStructCtor_1;
+                static chip::JniCachedConstructor applicationEPStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$ApplicationLauncherClusterApplicationEP",
                     "(Lchip/devicecontroller/ChipStructs$ApplicationLauncherClusterApplication;Ljava/util/Optional;)V");
-                if (applicationEPStructCtor_1 == nullptr)
+                err = applicationEPStructCtorCache_1.Get(env, applicationEPStructClass_1, applicationEPStructCtor_1);
+                if (err != CHIP_NO_ERROR)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$ApplicationLauncherClusterApplicationEP constructor");
                     return nullptr;
@@ -16521,17 +16358,13 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                 env->NewStringUTF(std::string(cppValue.applicationId.data(), cppValue.applicationId.size()).c_str());
 
             jclass applicationBasicApplicationStructClass_0;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipStructs$ApplicationBasicClusterApplicationBasicApplication",
-                applicationBasicApplicationStructClass_0);
+            jmethodID applicationBasicApplicationStructCtor_0;
+            static chip::JniCachedConstructor applicationBasicApplicationStructCtorCache_0(
+                "chip/devicecontroller/ChipStructs$ApplicationBasicClusterApplicationBasicApplication",
+                "(Ljava/lang/Integer;Ljava/lang/String;)V");
+            err = applicationBasicApplicationStructCtorCache_0.Get(
+                env, applicationBasicApplicationStructClass_0, applicationBasicApplicationStructCtor_0);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipStructs$ApplicationBasicClusterApplicationBasicApplication");
-                return nullptr;
-            }
-            jmethodID applicationBasicApplicationStructCtor_0 =
-                env->GetMethodID(applicationBasicApplicationStructClass_0, "<init>", "(Ljava/lang/Integer;Ljava/lang/String;)V");
-            if (applicationBasicApplicationStructCtor_0 == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipStructs$ApplicationBasicClusterApplicationBasicApplication constructor");
                 return nullptr;
@@ -17560,17 +17393,12 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                 newElement_0_member2 = newElement_0_member2ByteArray;
 
                 jclass testListStructOctetStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$TestClusterClusterTestListStructOctet",
-                    testListStructOctetStructClass_1);
+                jmethodID testListStructOctetStructCtor_1;
+                static chip::JniCachedConstructor testListStructOctetStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$TestClusterClusterTestListStructOctet", "(Ljava/lang/Long;[B)V");
+                err = testListStructOctetStructCtorCache_1.Get(
+                    env, testListStructOctetStructClass_1, testListStructOctetStructCtor_1);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$TestClusterClusterTestListStructOctet");
-                    return nullptr;
-                }
-                jmethodID testListStructOctetStructCtor_1 =
-                    env->GetMethodID(testListStructOctetStructClass_1, "<init>", "(Ljava/lang/Long;[B)V");
-                if (testListStructOctetStructCtor_1 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$TestClusterClusterTestListStructOctet constructor");
                     return nullptr;
@@ -17836,18 +17664,13 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                         entry_0.nullableStruct.Value().h, newElement_0_nullableStruct_h);
 
                     jclass simpleStructStructClass_3;
-                    err = chip::JniReferences::GetInstance().GetClassRef(
-                        env, "chip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct", simpleStructStructClass_3);
+                    jmethodID simpleStructStructCtor_3;
+                    static chip::JniCachedConstructor simpleStructStructCtorCache_3(
+                        "chip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct",
+                        "(Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Integer;[BLjava/lang/String;Ljava/lang/Integer;Ljava/"
+                        "lang/Float;Ljava/lang/Double;)V");
+                    err = simpleStructStructCtorCache_3.Get(env, simpleStructStructClass_3, simpleStructStructCtor_3);
                     if (err != CHIP_NO_ERROR)
-                    {
-                        ChipLogError(Zcl, "Could not find class ChipStructs$TestClusterClusterSimpleStruct");
-                        return nullptr;
-                    }
-                    jmethodID simpleStructStructCtor_3 =
-                        env->GetMethodID(simpleStructStructClass_3, "<init>",
-                                         "(Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Integer;[BLjava/lang/String;Ljava/lang/"
-                                         "Integer;Ljava/lang/Float;Ljava/lang/Double;)V");
-                    if (simpleStructStructCtor_3 == nullptr)
                     {
                         ChipLogError(Zcl, "Could not find ChipStructs$TestClusterClusterSimpleStruct constructor");
                         return nullptr;
@@ -17921,18 +17744,13 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                         newElement_0_optionalStructInsideOptional_h);
 
                     jclass simpleStructStructClass_3;
-                    err = chip::JniReferences::GetInstance().GetClassRef(
-                        env, "chip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct", simpleStructStructClass_3);
+                    jmethodID simpleStructStructCtor_3;
+                    static chip::JniCachedConstructor simpleStructStructCtorCache_3(
+                        "chip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct",
+                        "(Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Integer;[BLjava/lang/String;Ljava/lang/Integer;Ljava/"
+                        "lang/Float;Ljava/lang/Double;)V");
+                    err = simpleStructStructCtorCache_3.Get(env, simpleStructStructClass_3, simpleStructStructCtor_3);
                     if (err != CHIP_NO_ERROR)
-                    {
-                        ChipLogError(Zcl, "Could not find class ChipStructs$TestClusterClusterSimpleStruct");
-                        return nullptr;
-                    }
-                    jmethodID simpleStructStructCtor_3 =
-                        env->GetMethodID(simpleStructStructClass_3, "<init>",
-                                         "(Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Integer;[BLjava/lang/String;Ljava/lang/"
-                                         "Integer;Ljava/lang/Float;Ljava/lang/Double;)V");
-                    if (simpleStructStructCtor_3 == nullptr)
                     {
                         ChipLogError(Zcl, "Could not find ChipStructs$TestClusterClusterSimpleStruct constructor");
                         return nullptr;
@@ -18021,18 +17839,13 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                             entry_0.nullableOptionalStruct.Value().Value().h, newElement_0_nullableOptionalStructInsideOptional_h);
 
                         jclass simpleStructStructClass_4;
-                        err = chip::JniReferences::GetInstance().GetClassRef(
-                            env, "chip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct", simpleStructStructClass_4);
+                        jmethodID simpleStructStructCtor_4;
+                        static chip::JniCachedConstructor simpleStructStructCtorCache_4(
+                            "chip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct",
+                            "(Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Integer;[BLjava/lang/String;Ljava/lang/Integer;"
+                            "Ljava/lang/Float;Ljava/lang/Double;)V");
+                        err = simpleStructStructCtorCache_4.Get(env, simpleStructStructClass_4, simpleStructStructCtor_4);
                         if (err != CHIP_NO_ERROR)
-                        {
-                            ChipLogError(Zcl, "Could not find class ChipStructs$TestClusterClusterSimpleStruct");
-                            return nullptr;
-                        }
-                        jmethodID simpleStructStructCtor_4 =
-                            env->GetMethodID(simpleStructStructClass_4, "<init>",
-                                             "(Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Integer;[BLjava/lang/String;Ljava/"
-                                             "lang/Integer;Ljava/lang/Float;Ljava/lang/Double;)V");
-                        if (simpleStructStructCtor_4 == nullptr)
                         {
                             ChipLogError(Zcl, "Could not find ChipStructs$TestClusterClusterSimpleStruct constructor");
                             return nullptr;
@@ -18135,20 +17948,15 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                 }
 
                 jclass nullablesAndOptionalsStructStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$TestClusterClusterNullablesAndOptionalsStruct",
-                    nullablesAndOptionalsStructStructClass_1);
-                if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$TestClusterClusterNullablesAndOptionalsStruct");
-                    return nullptr;
-                }
-                jmethodID nullablesAndOptionalsStructStructCtor_1 = env->GetMethodID(
-                    nullablesAndOptionalsStructStructClass_1, "<init>",
+                jmethodID nullablesAndOptionalsStructStructCtor_1;
+                static chip::JniCachedConstructor nullablesAndOptionalsStructStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$TestClusterClusterNullablesAndOptionalsStruct",
                     "(Ljava/lang/Integer;Ljava/util/Optional;Ljava/util/Optional;Ljava/lang/String;Ljava/util/Optional;Ljava/util/"
                     "Optional;Lchip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct;Ljava/util/Optional;Ljava/util/"
                     "Optional;Ljava/util/ArrayList;Ljava/util/Optional;Ljava/util/Optional;)V");
-                if (nullablesAndOptionalsStructStructCtor_1 == nullptr)
+                err = nullablesAndOptionalsStructStructCtorCache_1.Get(
+                    env, nullablesAndOptionalsStructStructClass_1, nullablesAndOptionalsStructStructCtor_1);
+                if (err != CHIP_NO_ERROR)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$TestClusterClusterNullablesAndOptionalsStruct constructor");
                     return nullptr;
@@ -18227,18 +18035,13 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                                                                          cppValue.h, value_h);
 
             jclass simpleStructStructClass_0;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct", simpleStructStructClass_0);
+            jmethodID simpleStructStructCtor_0;
+            static chip::JniCachedConstructor simpleStructStructCtorCache_0(
+                "chip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct",
+                "(Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Integer;[BLjava/lang/String;Ljava/lang/Integer;Ljava/lang/Float;"
+                "Ljava/lang/Double;)V");
+            err = simpleStructStructCtorCache_0.Get(env, simpleStructStructClass_0, simpleStructStructCtor_0);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipStructs$TestClusterClusterSimpleStruct");
-                return nullptr;
-            }
-            jmethodID simpleStructStructCtor_0 =
-                env->GetMethodID(simpleStructStructClass_0, "<init>",
-                                 "(Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Integer;[BLjava/lang/String;Ljava/lang/"
-                                 "Integer;Ljava/lang/Float;Ljava/lang/Double;)V");
-            if (simpleStructStructCtor_0 == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipStructs$TestClusterClusterSimpleStruct constructor");
                 return nullptr;
@@ -18469,18 +18272,13 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                     newElement_0_fabricSensitiveStruct_h);
 
                 jclass simpleStructStructClass_2;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct", simpleStructStructClass_2);
+                jmethodID simpleStructStructCtor_2;
+                static chip::JniCachedConstructor simpleStructStructCtorCache_2(
+                    "chip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct",
+                    "(Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Integer;[BLjava/lang/String;Ljava/lang/Integer;Ljava/lang/"
+                    "Float;Ljava/lang/Double;)V");
+                err = simpleStructStructCtorCache_2.Get(env, simpleStructStructClass_2, simpleStructStructCtor_2);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$TestClusterClusterSimpleStruct");
-                    return nullptr;
-                }
-                jmethodID simpleStructStructCtor_2 =
-                    env->GetMethodID(simpleStructStructClass_2, "<init>",
-                                     "(Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Integer;[BLjava/lang/String;Ljava/lang/"
-                                     "Integer;Ljava/lang/Float;Ljava/lang/Double;)V");
-                if (simpleStructStructCtor_2 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$TestClusterClusterSimpleStruct constructor");
                     return nullptr;
@@ -18514,18 +18312,13 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                                                                               entry_0.fabricIndex, newElement_0_fabricIndex);
 
                 jclass testFabricScopedStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$TestClusterClusterTestFabricScoped", testFabricScopedStructClass_1);
-                if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$TestClusterClusterTestFabricScoped");
-                    return nullptr;
-                }
-                jmethodID testFabricScopedStructCtor_1 = env->GetMethodID(
-                    testFabricScopedStructClass_1, "<init>",
+                jmethodID testFabricScopedStructCtor_1;
+                static chip::JniCachedConstructor testFabricScopedStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$TestClusterClusterTestFabricScoped",
                     "(Ljava/lang/Integer;Ljava/util/Optional;Ljava/lang/Integer;Ljava/util/Optional;Ljava/lang/String;Lchip/"
                     "devicecontroller/ChipStructs$TestClusterClusterSimpleStruct;Ljava/util/ArrayList;Ljava/lang/Integer;)V");
-                if (testFabricScopedStructCtor_1 == nullptr)
+                err = testFabricScopedStructCtorCache_1.Get(env, testFabricScopedStructClass_1, testFabricScopedStructCtor_1);
+                if (err != CHIP_NO_ERROR)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$TestClusterClusterTestFabricScoped constructor");
                     return nullptr;
@@ -19267,18 +19060,13 @@ jobject DecodeAttributeValue(const app::ConcreteAttributePath & aPath, TLV::TLVR
                                                                              cppValue.Value().h, value_h);
 
                 jclass simpleStructStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct", simpleStructStructClass_1);
+                jmethodID simpleStructStructCtor_1;
+                static chip::JniCachedConstructor simpleStructStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct",
+                    "(Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Integer;[BLjava/lang/String;Ljava/lang/Integer;Ljava/lang/"
+                    "Float;Ljava/lang/Double;)V");
+                err = simpleStructStructCtorCache_1.Get(env, simpleStructStructClass_1, simpleStructStructCtor_1);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$TestClusterClusterSimpleStruct");
-                    return nullptr;
-                }
-                jmethodID simpleStructStructCtor_1 =
-                    env->GetMethodID(simpleStructStructClass_1, "<init>",
-                                     "(Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Integer;[BLjava/lang/String;Ljava/lang/"
-                                     "Integer;Ljava/lang/Float;Ljava/lang/Double;)V");
-                if (simpleStructStructCtor_1 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$TestClusterClusterSimpleStruct constructor");
                     return nullptr;
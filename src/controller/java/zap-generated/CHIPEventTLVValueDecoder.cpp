@@ -268,16 +268,12 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                         }
 
                         jclass targetStructClass_4;
-                        err = chip::JniReferences::GetInstance().GetClassRef(
-                            env, "chip/devicecontroller/ChipStructs$AccessControlClusterTarget", targetStructClass_4);
+                        jmethodID targetStructCtor_4;
+                        static chip::JniCachedConstructor targetStructCtorCache_4(
+                            "chip/devicecontroller/ChipStructs$AccessControlClusterTarget",
+                            "(Ljava/lang/Long;Ljava/lang/Integer;Ljava/lang/Long;)V");
+                        err = targetStructCtorCache_4.Get(env, targetStructClass_4, targetStructCtor_4);
                         if (err != CHIP_NO_ERROR)
-                        {
-                            ChipLogError(Zcl, "Could not find class ChipStructs$AccessControlClusterTarget");
-                            return nullptr;
-                        }
-                        jmethodID targetStructCtor_4 = env->GetMethodID(targetStructClass_4, "<init>",
-                                                                        "(Ljava/lang/Long;Ljava/lang/Integer;Ljava/lang/Long;)V");
-                        if (targetStructCtor_4 == nullptr)
                         {
                             ChipLogError(Zcl, "Could not find ChipStructs$AccessControlClusterTarget constructor");
                             return nullptr;
@@ -296,18 +292,12 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                     cppValue.latestValue.Value().fabricIndex, value_latestValue_fabricIndex);
 
                 jclass accessControlEntryStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$AccessControlClusterAccessControlEntry",
-                    accessControlEntryStructClass_1);
-                if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$AccessControlClusterAccessControlEntry");
-                    return nullptr;
-                }
-                jmethodID accessControlEntryStructCtor_1 = env->GetMethodID(
-                    accessControlEntryStructClass_1, "<init>",
+                jmethodID accessControlEntryStructCtor_1;
+                static chip::JniCachedConstructor accessControlEntryStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$AccessControlClusterAccessControlEntry",
                     "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/util/ArrayList;Ljava/util/ArrayList;Ljava/lang/Integer;)V");
-                if (accessControlEntryStructCtor_1 == nullptr)
+                err = accessControlEntryStructCtorCache_1.Get(env, accessControlEntryStructClass_1, accessControlEntryStructCtor_1);
+                if (err != CHIP_NO_ERROR)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$AccessControlClusterAccessControlEntry constructor");
                     return nullptr;
@@ -327,19 +317,14 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                                                                           cppValue.fabricIndex, value_fabricIndex);
 
             jclass accessControlEntryChangedStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$AccessControlClusterAccessControlEntryChangedEvent",
-                accessControlEntryChangedStructClass);
+            jmethodID accessControlEntryChangedStructCtor;
+            static chip::JniCachedConstructor accessControlEntryChangedStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$AccessControlClusterAccessControlEntryChangedEvent",
+                "(Ljava/lang/Long;Ljava/lang/Integer;Ljava/lang/Integer;Lchip/devicecontroller/"
+                "ChipStructs$AccessControlClusterAccessControlEntry;Ljava/lang/Integer;)V");
+            err = accessControlEntryChangedStructCtorCache.Get(
+                env, accessControlEntryChangedStructClass, accessControlEntryChangedStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$AccessControlClusterAccessControlEntryChangedEvent");
-                return nullptr;
-            }
-            jmethodID accessControlEntryChangedStructCtor =
-                env->GetMethodID(accessControlEntryChangedStructClass, "<init>",
-                                 "(Ljava/lang/Long;Ljava/lang/Integer;Ljava/lang/Integer;Lchip/devicecontroller/"
-                                 "ChipStructs$AccessControlClusterAccessControlEntry;Ljava/lang/Integer;)V");
-            if (accessControlEntryChangedStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$AccessControlClusterAccessControlEntryChangedEvent constructor");
                 return nullptr;
@@ -415,16 +400,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                     cppValue.latestValue.Value().fabricIndex, value_latestValue_fabricIndex);
 
                 jclass extensionEntryStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$AccessControlClusterExtensionEntry", extensionEntryStructClass_1);
+                jmethodID extensionEntryStructCtor_1;
+                static chip::JniCachedConstructor extensionEntryStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$AccessControlClusterExtensionEntry", "([BLjava/lang/Integer;)V");
+                err = extensionEntryStructCtorCache_1.Get(env, extensionEntryStructClass_1, extensionEntryStructCtor_1);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$AccessControlClusterExtensionEntry");
-                    return nullptr;
-                }
-                jmethodID extensionEntryStructCtor_1 =
-                    env->GetMethodID(extensionEntryStructClass_1, "<init>", "([BLjava/lang/Integer;)V");
-                if (extensionEntryStructCtor_1 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$AccessControlClusterExtensionEntry constructor");
                     return nullptr;
@@ -442,19 +422,14 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                                                                           cppValue.fabricIndex, value_fabricIndex);
 
             jclass accessControlExtensionChangedStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$AccessControlClusterAccessControlExtensionChangedEvent",
-                accessControlExtensionChangedStructClass);
+            jmethodID accessControlExtensionChangedStructCtor;
+            static chip::JniCachedConstructor accessControlExtensionChangedStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$AccessControlClusterAccessControlExtensionChangedEvent",
+                "(Ljava/lang/Long;Ljava/lang/Integer;Ljava/lang/Integer;Lchip/devicecontroller/"
+                "ChipStructs$AccessControlClusterExtensionEntry;Ljava/lang/Integer;)V");
+            err = accessControlExtensionChangedStructCtorCache.Get(
+                env, accessControlExtensionChangedStructClass, accessControlExtensionChangedStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$AccessControlClusterAccessControlExtensionChangedEvent");
-                return nullptr;
-            }
-            jmethodID accessControlExtensionChangedStructCtor =
-                env->GetMethodID(accessControlExtensionChangedStructClass, "<init>",
-                                 "(Ljava/lang/Long;Ljava/lang/Integer;Ljava/lang/Integer;Lchip/devicecontroller/"
-                                 "ChipStructs$AccessControlClusterExtensionEntry;Ljava/lang/Integer;)V");
-            if (accessControlExtensionChangedStructCtor == nullptr)
             {
                 ChipLogError(Zcl,
                              "Could not find ChipEventStructs$AccessControlClusterAccessControlExtensionChangedEvent constructor");
@@ -504,16 +479,12 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                                                                           static_cast<uint8_t>(cppValue.newState), value_newState);
 
             jclass stateChangedStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$ActionsClusterStateChangedEvent", stateChangedStructClass);
+            jmethodID stateChangedStructCtor;
+            static chip::JniCachedConstructor stateChangedStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$ActionsClusterStateChangedEvent",
+                "(Ljava/lang/Integer;Ljava/lang/Long;Ljava/lang/Integer;)V");
+            err = stateChangedStructCtorCache.Get(env, stateChangedStructClass, stateChangedStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$ActionsClusterStateChangedEvent");
-                return nullptr;
-            }
-            jmethodID stateChangedStructCtor =
-                env->GetMethodID(stateChangedStructClass, "<init>", "(Ljava/lang/Integer;Ljava/lang/Long;Ljava/lang/Integer;)V");
-            if (stateChangedStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$ActionsClusterStateChangedEvent constructor");
                 return nullptr;
@@ -557,16 +528,12 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 value_errorClassName.c_str(), value_errorCtorSignature.c_str(), static_cast<uint8_t>(cppValue.error), value_error);
 
             jclass actionFailedStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$ActionsClusterActionFailedEvent", actionFailedStructClass);
+            jmethodID actionFailedStructCtor;
+            static chip::JniCachedConstructor actionFailedStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$ActionsClusterActionFailedEvent",
+                "(Ljava/lang/Integer;Ljava/lang/Long;Ljava/lang/Integer;Ljava/lang/Integer;)V");
+            err = actionFailedStructCtorCache.Get(env, actionFailedStructClass, actionFailedStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$ActionsClusterActionFailedEvent");
-                return nullptr;
-            }
-            jmethodID actionFailedStructCtor = env->GetMethodID(
-                actionFailedStructClass, "<init>", "(Ljava/lang/Integer;Ljava/lang/Long;Ljava/lang/Integer;Ljava/lang/Integer;)V");
-            if (actionFailedStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$ActionsClusterActionFailedEvent constructor");
                 return nullptr;
@@ -602,15 +569,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                                                                            cppValue.softwareVersion, value_softwareVersion);
 
             jclass startUpStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$BasicClusterStartUpEvent", startUpStructClass);
+            jmethodID startUpStructCtor;
+            static chip::JniCachedConstructor startUpStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$BasicClusterStartUpEvent", "(Ljava/lang/Long;)V");
+            err = startUpStructCtorCache.Get(env, startUpStructClass, startUpStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$BasicClusterStartUpEvent");
-                return nullptr;
-            }
-            jmethodID startUpStructCtor = env->GetMethodID(startUpStructClass, "<init>", "(Ljava/lang/Long;)V");
-            if (startUpStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$BasicClusterStartUpEvent constructor");
                 return nullptr;
@@ -628,15 +591,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 return nullptr;
             }
             jclass shutDownStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$BasicClusterShutDownEvent", shutDownStructClass);
+            jmethodID shutDownStructCtor;
+            static chip::JniCachedConstructor shutDownStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$BasicClusterShutDownEvent", "()V");
+            err = shutDownStructCtorCache.Get(env, shutDownStructClass, shutDownStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$BasicClusterShutDownEvent");
-                return nullptr;
-            }
-            jmethodID shutDownStructCtor = env->GetMethodID(shutDownStructClass, "<init>", "()V");
-            if (shutDownStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$BasicClusterShutDownEvent constructor");
                 return nullptr;
@@ -661,15 +620,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                                                                           cppValue.fabricIndex, value_fabricIndex);
 
             jclass leaveStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$BasicClusterLeaveEvent", leaveStructClass);
+            jmethodID leaveStructCtor;
+            static chip::JniCachedConstructor leaveStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$BasicClusterLeaveEvent", "(Ljava/lang/Integer;)V");
+            err = leaveStructCtorCache.Get(env, leaveStructClass, leaveStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$BasicClusterLeaveEvent");
-                return nullptr;
-            }
-            jmethodID leaveStructCtor = env->GetMethodID(leaveStructClass, "<init>", "(Ljava/lang/Integer;)V");
-            if (leaveStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$BasicClusterLeaveEvent constructor");
                 return nullptr;
@@ -694,16 +649,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                                                                        cppValue.reachableNewValue, value_reachableNewValue);
 
             jclass reachableChangedStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$BasicClusterReachableChangedEvent", reachableChangedStructClass);
+            jmethodID reachableChangedStructCtor;
+            static chip::JniCachedConstructor reachableChangedStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$BasicClusterReachableChangedEvent", "(Ljava/lang/Boolean;)V");
+            err = reachableChangedStructCtorCache.Get(env, reachableChangedStructClass, reachableChangedStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$BasicClusterReachableChangedEvent");
-                return nullptr;
-            }
-            jmethodID reachableChangedStructCtor =
-                env->GetMethodID(reachableChangedStructClass, "<init>", "(Ljava/lang/Boolean;)V");
-            if (reachableChangedStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$BasicClusterReachableChangedEvent constructor");
                 return nullptr;
@@ -776,18 +726,12 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
             }
 
             jclass stateTransitionStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$OtaSoftwareUpdateRequestorClusterStateTransitionEvent",
-                stateTransitionStructClass);
+            jmethodID stateTransitionStructCtor;
+            static chip::JniCachedConstructor stateTransitionStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$OtaSoftwareUpdateRequestorClusterStateTransitionEvent",
+                "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Long;)V");
+            err = stateTransitionStructCtorCache.Get(env, stateTransitionStructClass, stateTransitionStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$OtaSoftwareUpdateRequestorClusterStateTransitionEvent");
-                return nullptr;
-            }
-            jmethodID stateTransitionStructCtor =
-                env->GetMethodID(stateTransitionStructClass, "<init>",
-                                 "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Long;)V");
-            if (stateTransitionStructCtor == nullptr)
             {
                 ChipLogError(Zcl,
                              "Could not find ChipEventStructs$OtaSoftwareUpdateRequestorClusterStateTransitionEvent constructor");
@@ -820,17 +764,12 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 value_productIDClassName.c_str(), value_productIDCtorSignature.c_str(), cppValue.productID, value_productID);
 
             jclass versionAppliedStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$OtaSoftwareUpdateRequestorClusterVersionAppliedEvent",
-                versionAppliedStructClass);
+            jmethodID versionAppliedStructCtor;
+            static chip::JniCachedConstructor versionAppliedStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$OtaSoftwareUpdateRequestorClusterVersionAppliedEvent",
+                "(Ljava/lang/Long;Ljava/lang/Integer;)V");
+            err = versionAppliedStructCtorCache.Get(env, versionAppliedStructClass, versionAppliedStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$OtaSoftwareUpdateRequestorClusterVersionAppliedEvent");
-                return nullptr;
-            }
-            jmethodID versionAppliedStructCtor =
-                env->GetMethodID(versionAppliedStructClass, "<init>", "(Ljava/lang/Long;Ljava/lang/Integer;)V");
-            if (versionAppliedStructCtor == nullptr)
             {
                 ChipLogError(Zcl,
                              "Could not find ChipEventStructs$OtaSoftwareUpdateRequestorClusterVersionAppliedEvent constructor");
@@ -892,17 +831,12 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
             }
 
             jclass downloadErrorStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$OtaSoftwareUpdateRequestorClusterDownloadErrorEvent",
-                downloadErrorStructClass);
+            jmethodID downloadErrorStructCtor;
+            static chip::JniCachedConstructor downloadErrorStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$OtaSoftwareUpdateRequestorClusterDownloadErrorEvent",
+                "(Ljava/lang/Long;Ljava/lang/Long;Ljava/lang/Integer;Ljava/lang/Long;)V");
+            err = downloadErrorStructCtorCache.Get(env, downloadErrorStructClass, downloadErrorStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$OtaSoftwareUpdateRequestorClusterDownloadErrorEvent");
-                return nullptr;
-            }
-            jmethodID downloadErrorStructCtor = env->GetMethodID(
-                downloadErrorStructClass, "<init>", "(Ljava/lang/Long;Ljava/lang/Long;Ljava/lang/Integer;Ljava/lang/Long;)V");
-            if (downloadErrorStructCtor == nullptr)
             {
                 ChipLogError(Zcl,
                              "Could not find ChipEventStructs$OtaSoftwareUpdateRequestorClusterDownloadErrorEvent constructor");
@@ -1042,17 +976,12 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
             }
 
             jclass hardwareFaultChangeStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$GeneralDiagnosticsClusterHardwareFaultChangeEvent",
-                hardwareFaultChangeStructClass);
+            jmethodID hardwareFaultChangeStructCtor;
+            static chip::JniCachedConstructor hardwareFaultChangeStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$GeneralDiagnosticsClusterHardwareFaultChangeEvent",
+                "(Ljava/util/ArrayList;Ljava/util/ArrayList;)V");
+            err = hardwareFaultChangeStructCtorCache.Get(env, hardwareFaultChangeStructClass, hardwareFaultChangeStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$GeneralDiagnosticsClusterHardwareFaultChangeEvent");
-                return nullptr;
-            }
-            jmethodID hardwareFaultChangeStructCtor =
-                env->GetMethodID(hardwareFaultChangeStructClass, "<init>", "(Ljava/util/ArrayList;Ljava/util/ArrayList;)V");
-            if (hardwareFaultChangeStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$GeneralDiagnosticsClusterHardwareFaultChangeEvent constructor");
                 return nullptr;
@@ -1101,17 +1030,12 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
             }
 
             jclass radioFaultChangeStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$GeneralDiagnosticsClusterRadioFaultChangeEvent",
-                radioFaultChangeStructClass);
+            jmethodID radioFaultChangeStructCtor;
+            static chip::JniCachedConstructor radioFaultChangeStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$GeneralDiagnosticsClusterRadioFaultChangeEvent",
+                "(Ljava/util/ArrayList;Ljava/util/ArrayList;)V");
+            err = radioFaultChangeStructCtorCache.Get(env, radioFaultChangeStructClass, radioFaultChangeStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$GeneralDiagnosticsClusterRadioFaultChangeEvent");
-                return nullptr;
-            }
-            jmethodID radioFaultChangeStructCtor =
-                env->GetMethodID(radioFaultChangeStructClass, "<init>", "(Ljava/util/ArrayList;Ljava/util/ArrayList;)V");
-            if (radioFaultChangeStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$GeneralDiagnosticsClusterRadioFaultChangeEvent constructor");
                 return nullptr;
@@ -1159,17 +1083,12 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
             }
 
             jclass networkFaultChangeStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$GeneralDiagnosticsClusterNetworkFaultChangeEvent",
-                networkFaultChangeStructClass);
+            jmethodID networkFaultChangeStructCtor;
+            static chip::JniCachedConstructor networkFaultChangeStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$GeneralDiagnosticsClusterNetworkFaultChangeEvent",
+                "(Ljava/util/ArrayList;Ljava/util/ArrayList;)V");
+            err = networkFaultChangeStructCtorCache.Get(env, networkFaultChangeStructClass, networkFaultChangeStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$GeneralDiagnosticsClusterNetworkFaultChangeEvent");
-                return nullptr;
-            }
-            jmethodID networkFaultChangeStructCtor =
-                env->GetMethodID(networkFaultChangeStructClass, "<init>", "(Ljava/util/ArrayList;Ljava/util/ArrayList;)V");
-            if (networkFaultChangeStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$GeneralDiagnosticsClusterNetworkFaultChangeEvent constructor");
                 return nullptr;
@@ -1195,15 +1114,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 value_bootReason);
 
             jclass bootReasonStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$GeneralDiagnosticsClusterBootReasonEvent", bootReasonStructClass);
+            jmethodID bootReasonStructCtor;
+            static chip::JniCachedConstructor bootReasonStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$GeneralDiagnosticsClusterBootReasonEvent", "(Ljava/lang/Integer;)V");
+            err = bootReasonStructCtorCache.Get(env, bootReasonStructClass, bootReasonStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$GeneralDiagnosticsClusterBootReasonEvent");
-                return nullptr;
-            }
-            jmethodID bootReasonStructCtor = env->GetMethodID(bootReasonStructClass, "<init>", "(Ljava/lang/Integer;)V");
-            if (bootReasonStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$GeneralDiagnosticsClusterBootReasonEvent constructor");
                 return nullptr;
@@ -1267,17 +1182,12 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
             }
 
             jclass softwareFaultStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$SoftwareDiagnosticsClusterSoftwareFaultEvent",
-                softwareFaultStructClass);
+            jmethodID softwareFaultStructCtor;
+            static chip::JniCachedConstructor softwareFaultStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$SoftwareDiagnosticsClusterSoftwareFaultEvent",
+                "(Ljava/lang/Long;Ljava/util/Optional;Ljava/util/Optional;)V");
+            err = softwareFaultStructCtorCache.Get(env, softwareFaultStructClass, softwareFaultStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$SoftwareDiagnosticsClusterSoftwareFaultEvent");
-                return nullptr;
-            }
-            jmethodID softwareFaultStructCtor =
-                env->GetMethodID(softwareFaultStructClass, "<init>", "(Ljava/lang/Long;Ljava/util/Optional;Ljava/util/Optional;)V");
-            if (softwareFaultStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$SoftwareDiagnosticsClusterSoftwareFaultEvent constructor");
                 return nullptr;
@@ -1313,17 +1223,12 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 static_cast<uint8_t>(cppValue.connectionStatus), value_connectionStatus);
 
             jclass connectionStatusStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$ThreadNetworkDiagnosticsClusterConnectionStatusEvent",
-                connectionStatusStructClass);
+            jmethodID connectionStatusStructCtor;
+            static chip::JniCachedConstructor connectionStatusStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$ThreadNetworkDiagnosticsClusterConnectionStatusEvent",
+                "(Ljava/lang/Integer;)V");
+            err = connectionStatusStructCtorCache.Get(env, connectionStatusStructClass, connectionStatusStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$ThreadNetworkDiagnosticsClusterConnectionStatusEvent");
-                return nullptr;
-            }
-            jmethodID connectionStatusStructCtor =
-                env->GetMethodID(connectionStatusStructClass, "<init>", "(Ljava/lang/Integer;)V");
-            if (connectionStatusStructCtor == nullptr)
             {
                 ChipLogError(Zcl,
                              "Could not find ChipEventStructs$ThreadNetworkDiagnosticsClusterConnectionStatusEvent constructor");
@@ -1372,17 +1277,12 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
             }
 
             jclass networkFaultChangeStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$ThreadNetworkDiagnosticsClusterNetworkFaultChangeEvent",
-                networkFaultChangeStructClass);
+            jmethodID networkFaultChangeStructCtor;
+            static chip::JniCachedConstructor networkFaultChangeStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$ThreadNetworkDiagnosticsClusterNetworkFaultChangeEvent",
+                "(Ljava/util/ArrayList;Ljava/util/ArrayList;)V");
+            err = networkFaultChangeStructCtorCache.Get(env, networkFaultChangeStructClass, networkFaultChangeStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$ThreadNetworkDiagnosticsClusterNetworkFaultChangeEvent");
-                return nullptr;
-            }
-            jmethodID networkFaultChangeStructCtor =
-                env->GetMethodID(networkFaultChangeStructClass, "<init>", "(Ljava/util/ArrayList;Ljava/util/ArrayList;)V");
-            if (networkFaultChangeStructCtor == nullptr)
             {
                 ChipLogError(Zcl,
                              "Could not find ChipEventStructs$ThreadNetworkDiagnosticsClusterNetworkFaultChangeEvent constructor");
@@ -1418,16 +1318,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 value_reasonCodeClassName.c_str(), value_reasonCodeCtorSignature.c_str(), cppValue.reasonCode, value_reasonCode);
 
             jclass disconnectionStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$WiFiNetworkDiagnosticsClusterDisconnectionEvent",
-                disconnectionStructClass);
+            jmethodID disconnectionStructCtor;
+            static chip::JniCachedConstructor disconnectionStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$WiFiNetworkDiagnosticsClusterDisconnectionEvent", "(Ljava/lang/Integer;)V");
+            err = disconnectionStructCtorCache.Get(env, disconnectionStructClass, disconnectionStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$WiFiNetworkDiagnosticsClusterDisconnectionEvent");
-                return nullptr;
-            }
-            jmethodID disconnectionStructCtor = env->GetMethodID(disconnectionStructClass, "<init>", "(Ljava/lang/Integer;)V");
-            if (disconnectionStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$WiFiNetworkDiagnosticsClusterDisconnectionEvent constructor");
                 return nullptr;
@@ -1458,17 +1353,12 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 value_statusClassName.c_str(), value_statusCtorSignature.c_str(), cppValue.status, value_status);
 
             jclass associationFailureStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$WiFiNetworkDiagnosticsClusterAssociationFailureEvent",
-                associationFailureStructClass);
+            jmethodID associationFailureStructCtor;
+            static chip::JniCachedConstructor associationFailureStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$WiFiNetworkDiagnosticsClusterAssociationFailureEvent",
+                "(Ljava/lang/Integer;Ljava/lang/Integer;)V");
+            err = associationFailureStructCtorCache.Get(env, associationFailureStructClass, associationFailureStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$WiFiNetworkDiagnosticsClusterAssociationFailureEvent");
-                return nullptr;
-            }
-            jmethodID associationFailureStructCtor =
-                env->GetMethodID(associationFailureStructClass, "<init>", "(Ljava/lang/Integer;Ljava/lang/Integer;)V");
-            if (associationFailureStructCtor == nullptr)
             {
                 ChipLogError(Zcl,
                              "Could not find ChipEventStructs$WiFiNetworkDiagnosticsClusterAssociationFailureEvent constructor");
@@ -1495,17 +1385,12 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 static_cast<uint8_t>(cppValue.connectionStatus), value_connectionStatus);
 
             jclass connectionStatusStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$WiFiNetworkDiagnosticsClusterConnectionStatusEvent",
-                connectionStatusStructClass);
+            jmethodID connectionStatusStructCtor;
+            static chip::JniCachedConstructor connectionStatusStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$WiFiNetworkDiagnosticsClusterConnectionStatusEvent",
+                "(Ljava/lang/Integer;)V");
+            err = connectionStatusStructCtorCache.Get(env, connectionStatusStructClass, connectionStatusStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$WiFiNetworkDiagnosticsClusterConnectionStatusEvent");
-                return nullptr;
-            }
-            jmethodID connectionStatusStructCtor =
-                env->GetMethodID(connectionStatusStructClass, "<init>", "(Ljava/lang/Integer;)V");
-            if (connectionStatusStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$WiFiNetworkDiagnosticsClusterConnectionStatusEvent constructor");
                 return nullptr;
@@ -1550,15 +1435,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                                                                            cppValue.softwareVersion, value_softwareVersion);
 
             jclass startUpStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$BridgedDeviceBasicClusterStartUpEvent", startUpStructClass);
+            jmethodID startUpStructCtor;
+            static chip::JniCachedConstructor startUpStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$BridgedDeviceBasicClusterStartUpEvent", "(Ljava/lang/Long;)V");
+            err = startUpStructCtorCache.Get(env, startUpStructClass, startUpStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$BridgedDeviceBasicClusterStartUpEvent");
-                return nullptr;
-            }
-            jmethodID startUpStructCtor = env->GetMethodID(startUpStructClass, "<init>", "(Ljava/lang/Long;)V");
-            if (startUpStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$BridgedDeviceBasicClusterStartUpEvent constructor");
                 return nullptr;
@@ -1576,15 +1457,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 return nullptr;
             }
             jclass shutDownStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$BridgedDeviceBasicClusterShutDownEvent", shutDownStructClass);
+            jmethodID shutDownStructCtor;
+            static chip::JniCachedConstructor shutDownStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$BridgedDeviceBasicClusterShutDownEvent", "()V");
+            err = shutDownStructCtorCache.Get(env, shutDownStructClass, shutDownStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$BridgedDeviceBasicClusterShutDownEvent");
-                return nullptr;
-            }
-            jmethodID shutDownStructCtor = env->GetMethodID(shutDownStructClass, "<init>", "()V");
-            if (shutDownStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$BridgedDeviceBasicClusterShutDownEvent constructor");
                 return nullptr;
@@ -1602,15 +1479,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 return nullptr;
             }
             jclass leaveStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$BridgedDeviceBasicClusterLeaveEvent", leaveStructClass);
+            jmethodID leaveStructCtor;
+            static chip::JniCachedConstructor leaveStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$BridgedDeviceBasicClusterLeaveEvent", "()V");
+            err = leaveStructCtorCache.Get(env, leaveStructClass, leaveStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$BridgedDeviceBasicClusterLeaveEvent");
-                return nullptr;
-            }
-            jmethodID leaveStructCtor = env->GetMethodID(leaveStructClass, "<init>", "()V");
-            if (leaveStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$BridgedDeviceBasicClusterLeaveEvent constructor");
                 return nullptr;
@@ -1635,17 +1508,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                                                                        cppValue.reachableNewValue, value_reachableNewValue);
 
             jclass reachableChangedStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$BridgedDeviceBasicClusterReachableChangedEvent",
-                reachableChangedStructClass);
+            jmethodID reachableChangedStructCtor;
+            static chip::JniCachedConstructor reachableChangedStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$BridgedDeviceBasicClusterReachableChangedEvent", "(Ljava/lang/Boolean;)V");
+            err = reachableChangedStructCtorCache.Get(env, reachableChangedStructClass, reachableChangedStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$BridgedDeviceBasicClusterReachableChangedEvent");
-                return nullptr;
-            }
-            jmethodID reachableChangedStructCtor =
-                env->GetMethodID(reachableChangedStructClass, "<init>", "(Ljava/lang/Boolean;)V");
-            if (reachableChangedStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$BridgedDeviceBasicClusterReachableChangedEvent constructor");
                 return nullptr;
@@ -1680,15 +1547,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                                                                           cppValue.newPosition, value_newPosition);
 
             jclass switchLatchedStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$SwitchClusterSwitchLatchedEvent", switchLatchedStructClass);
+            jmethodID switchLatchedStructCtor;
+            static chip::JniCachedConstructor switchLatchedStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$SwitchClusterSwitchLatchedEvent", "(Ljava/lang/Integer;)V");
+            err = switchLatchedStructCtorCache.Get(env, switchLatchedStructClass, switchLatchedStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$SwitchClusterSwitchLatchedEvent");
-                return nullptr;
-            }
-            jmethodID switchLatchedStructCtor = env->GetMethodID(switchLatchedStructClass, "<init>", "(Ljava/lang/Integer;)V");
-            if (switchLatchedStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$SwitchClusterSwitchLatchedEvent constructor");
                 return nullptr;
@@ -1713,15 +1576,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                                                                           cppValue.newPosition, value_newPosition);
 
             jclass initialPressStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$SwitchClusterInitialPressEvent", initialPressStructClass);
+            jmethodID initialPressStructCtor;
+            static chip::JniCachedConstructor initialPressStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$SwitchClusterInitialPressEvent", "(Ljava/lang/Integer;)V");
+            err = initialPressStructCtorCache.Get(env, initialPressStructClass, initialPressStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$SwitchClusterInitialPressEvent");
-                return nullptr;
-            }
-            jmethodID initialPressStructCtor = env->GetMethodID(initialPressStructClass, "<init>", "(Ljava/lang/Integer;)V");
-            if (initialPressStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$SwitchClusterInitialPressEvent constructor");
                 return nullptr;
@@ -1746,15 +1605,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                                                                           cppValue.newPosition, value_newPosition);
 
             jclass longPressStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$SwitchClusterLongPressEvent", longPressStructClass);
+            jmethodID longPressStructCtor;
+            static chip::JniCachedConstructor longPressStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$SwitchClusterLongPressEvent", "(Ljava/lang/Integer;)V");
+            err = longPressStructCtorCache.Get(env, longPressStructClass, longPressStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$SwitchClusterLongPressEvent");
-                return nullptr;
-            }
-            jmethodID longPressStructCtor = env->GetMethodID(longPressStructClass, "<init>", "(Ljava/lang/Integer;)V");
-            if (longPressStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$SwitchClusterLongPressEvent constructor");
                 return nullptr;
@@ -1779,15 +1634,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                                                                           cppValue.previousPosition, value_previousPosition);
 
             jclass shortReleaseStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$SwitchClusterShortReleaseEvent", shortReleaseStructClass);
+            jmethodID shortReleaseStructCtor;
+            static chip::JniCachedConstructor shortReleaseStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$SwitchClusterShortReleaseEvent", "(Ljava/lang/Integer;)V");
+            err = shortReleaseStructCtorCache.Get(env, shortReleaseStructClass, shortReleaseStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$SwitchClusterShortReleaseEvent");
-                return nullptr;
-            }
-            jmethodID shortReleaseStructCtor = env->GetMethodID(shortReleaseStructClass, "<init>", "(Ljava/lang/Integer;)V");
-            if (shortReleaseStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$SwitchClusterShortReleaseEvent constructor");
                 return nullptr;
@@ -1812,15 +1663,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                                                                           cppValue.previousPosition, value_previousPosition);
 
             jclass longReleaseStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$SwitchClusterLongReleaseEvent", longReleaseStructClass);
+            jmethodID longReleaseStructCtor;
+            static chip::JniCachedConstructor longReleaseStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$SwitchClusterLongReleaseEvent", "(Ljava/lang/Integer;)V");
+            err = longReleaseStructCtorCache.Get(env, longReleaseStructClass, longReleaseStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$SwitchClusterLongReleaseEvent");
-                return nullptr;
-            }
-            jmethodID longReleaseStructCtor = env->GetMethodID(longReleaseStructClass, "<init>", "(Ljava/lang/Integer;)V");
-            if (longReleaseStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$SwitchClusterLongReleaseEvent constructor");
                 return nullptr;
@@ -1852,16 +1699,12 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 cppValue.currentNumberOfPressesCounted, value_currentNumberOfPressesCounted);
 
             jclass multiPressOngoingStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$SwitchClusterMultiPressOngoingEvent", multiPressOngoingStructClass);
+            jmethodID multiPressOngoingStructCtor;
+            static chip::JniCachedConstructor multiPressOngoingStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$SwitchClusterMultiPressOngoingEvent",
+                "(Ljava/lang/Integer;Ljava/lang/Integer;)V");
+            err = multiPressOngoingStructCtorCache.Get(env, multiPressOngoingStructClass, multiPressOngoingStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$SwitchClusterMultiPressOngoingEvent");
-                return nullptr;
-            }
-            jmethodID multiPressOngoingStructCtor =
-                env->GetMethodID(multiPressOngoingStructClass, "<init>", "(Ljava/lang/Integer;Ljava/lang/Integer;)V");
-            if (multiPressOngoingStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$SwitchClusterMultiPressOngoingEvent constructor");
                 return nullptr;
@@ -1894,16 +1737,12 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 cppValue.totalNumberOfPressesCounted, value_totalNumberOfPressesCounted);
 
             jclass multiPressCompleteStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$SwitchClusterMultiPressCompleteEvent", multiPressCompleteStructClass);
+            jmethodID multiPressCompleteStructCtor;
+            static chip::JniCachedConstructor multiPressCompleteStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$SwitchClusterMultiPressCompleteEvent",
+                "(Ljava/lang/Integer;Ljava/lang/Integer;)V");
+            err = multiPressCompleteStructCtorCache.Get(env, multiPressCompleteStructClass, multiPressCompleteStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$SwitchClusterMultiPressCompleteEvent");
-                return nullptr;
-            }
-            jmethodID multiPressCompleteStructCtor =
-                env->GetMethodID(multiPressCompleteStructClass, "<init>", "(Ljava/lang/Integer;Ljava/lang/Integer;)V");
-            if (multiPressCompleteStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$SwitchClusterMultiPressCompleteEvent constructor");
                 return nullptr;
@@ -1988,15 +1827,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 value_stateValueClassName.c_str(), value_stateValueCtorSignature.c_str(), cppValue.stateValue, value_stateValue);
 
             jclass stateChangeStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$BooleanStateClusterStateChangeEvent", stateChangeStructClass);
+            jmethodID stateChangeStructCtor;
+            static chip::JniCachedConstructor stateChangeStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$BooleanStateClusterStateChangeEvent", "(Ljava/lang/Boolean;)V");
+            err = stateChangeStructCtorCache.Get(env, stateChangeStructClass, stateChangeStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$BooleanStateClusterStateChangeEvent");
-                return nullptr;
-            }
-            jmethodID stateChangeStructCtor = env->GetMethodID(stateChangeStructClass, "<init>", "(Ljava/lang/Boolean;)V");
-            if (stateChangeStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$BooleanStateClusterStateChangeEvent constructor");
                 return nullptr;
@@ -2041,15 +1876,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 value_alarmCode);
 
             jclass doorLockAlarmStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$DoorLockClusterDoorLockAlarmEvent", doorLockAlarmStructClass);
+            jmethodID doorLockAlarmStructCtor;
+            static chip::JniCachedConstructor doorLockAlarmStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$DoorLockClusterDoorLockAlarmEvent", "(Ljava/lang/Integer;)V");
+            err = doorLockAlarmStructCtorCache.Get(env, doorLockAlarmStructClass, doorLockAlarmStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$DoorLockClusterDoorLockAlarmEvent");
-                return nullptr;
-            }
-            jmethodID doorLockAlarmStructCtor = env->GetMethodID(doorLockAlarmStructClass, "<init>", "(Ljava/lang/Integer;)V");
-            if (doorLockAlarmStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$DoorLockClusterDoorLockAlarmEvent constructor");
                 return nullptr;
@@ -2074,15 +1905,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 value_doorState);
 
             jclass doorStateChangeStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$DoorLockClusterDoorStateChangeEvent", doorStateChangeStructClass);
+            jmethodID doorStateChangeStructCtor;
+            static chip::JniCachedConstructor doorStateChangeStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$DoorLockClusterDoorStateChangeEvent", "(Ljava/lang/Integer;)V");
+            err = doorStateChangeStructCtorCache.Get(env, doorStateChangeStructClass, doorStateChangeStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$DoorLockClusterDoorStateChangeEvent");
-                return nullptr;
-            }
-            jmethodID doorStateChangeStructCtor = env->GetMethodID(doorStateChangeStructClass, "<init>", "(Ljava/lang/Integer;)V");
-            if (doorStateChangeStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$DoorLockClusterDoorStateChangeEvent constructor");
                 return nullptr;
@@ -2190,16 +2017,12 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                             entry_2.credentialIndex, newElement_2_credentialIndex);
 
                         jclass dlCredentialStructClass_3;
-                        err = chip::JniReferences::GetInstance().GetClassRef(
-                            env, "chip/devicecontroller/ChipStructs$DoorLockClusterDlCredential", dlCredentialStructClass_3);
+                        jmethodID dlCredentialStructCtor_3;
+                        static chip::JniCachedConstructor dlCredentialStructCtorCache_3(
+                            "chip/devicecontroller/ChipStructs$DoorLockClusterDlCredential",
+                            "(Ljava/lang/Integer;Ljava/lang/Integer;)V");
+                        err = dlCredentialStructCtorCache_3.Get(env, dlCredentialStructClass_3, dlCredentialStructCtor_3);
                         if (err != CHIP_NO_ERROR)
-                        {
-                            ChipLogError(Zcl, "Could not find class ChipStructs$DoorLockClusterDlCredential");
-                            return nullptr;
-                        }
-                        jmethodID dlCredentialStructCtor_3 =
-                            env->GetMethodID(dlCredentialStructClass_3, "<init>", "(Ljava/lang/Integer;Ljava/lang/Integer;)V");
-                        if (dlCredentialStructCtor_3 == nullptr)
                         {
                             ChipLogError(Zcl, "Could not find ChipStructs$DoorLockClusterDlCredential constructor");
                             return nullptr;
@@ -2214,17 +2037,13 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
             }
 
             jclass lockOperationStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$DoorLockClusterLockOperationEvent", lockOperationStructClass);
+            jmethodID lockOperationStructCtor;
+            static chip::JniCachedConstructor lockOperationStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$DoorLockClusterLockOperationEvent",
+                "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Long;Ljava/util/Optional;"
+                ")V");
+            err = lockOperationStructCtorCache.Get(env, lockOperationStructClass, lockOperationStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$DoorLockClusterLockOperationEvent");
-                return nullptr;
-            }
-            jmethodID lockOperationStructCtor = env->GetMethodID(lockOperationStructClass, "<init>",
-                                                                 "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/"
-                                                                 "lang/Integer;Ljava/lang/Long;Ljava/util/Optional;)V");
-            if (lockOperationStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$DoorLockClusterLockOperationEvent constructor");
                 return nullptr;
@@ -2341,16 +2160,12 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                             entry_2.credentialIndex, newElement_2_credentialIndex);
 
                         jclass dlCredentialStructClass_3;
-                        err = chip::JniReferences::GetInstance().GetClassRef(
-                            env, "chip/devicecontroller/ChipStructs$DoorLockClusterDlCredential", dlCredentialStructClass_3);
+                        jmethodID dlCredentialStructCtor_3;
+                        static chip::JniCachedConstructor dlCredentialStructCtorCache_3(
+                            "chip/devicecontroller/ChipStructs$DoorLockClusterDlCredential",
+                            "(Ljava/lang/Integer;Ljava/lang/Integer;)V");
+                        err = dlCredentialStructCtorCache_3.Get(env, dlCredentialStructClass_3, dlCredentialStructCtor_3);
                         if (err != CHIP_NO_ERROR)
-                        {
-                            ChipLogError(Zcl, "Could not find class ChipStructs$DoorLockClusterDlCredential");
-                            return nullptr;
-                        }
-                        jmethodID dlCredentialStructCtor_3 =
-                            env->GetMethodID(dlCredentialStructClass_3, "<init>", "(Ljava/lang/Integer;Ljava/lang/Integer;)V");
-                        if (dlCredentialStructCtor_3 == nullptr)
                         {
                             ChipLogError(Zcl, "Could not find ChipStructs$DoorLockClusterDlCredential constructor");
                             return nullptr;
@@ -2365,19 +2180,13 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
             }
 
             jclass lockOperationErrorStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$DoorLockClusterLockOperationErrorEvent",
-                lockOperationErrorStructClass);
+            jmethodID lockOperationErrorStructCtor;
+            static chip::JniCachedConstructor lockOperationErrorStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$DoorLockClusterLockOperationErrorEvent",
+                "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Long;"
+                "Ljava/util/Optional;)V");
+            err = lockOperationErrorStructCtorCache.Get(env, lockOperationErrorStructClass, lockOperationErrorStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$DoorLockClusterLockOperationErrorEvent");
-                return nullptr;
-            }
-            jmethodID lockOperationErrorStructCtor =
-                env->GetMethodID(lockOperationErrorStructClass, "<init>",
-                                 "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/"
-                                 "Integer;Ljava/lang/Long;Ljava/util/Optional;)V");
-            if (lockOperationErrorStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$DoorLockClusterLockOperationErrorEvent constructor");
                 return nullptr;
@@ -2474,18 +2283,13 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
             }
 
             jclass lockUserChangeStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$DoorLockClusterLockUserChangeEvent", lockUserChangeStructClass);
+            jmethodID lockUserChangeStructCtor;
+            static chip::JniCachedConstructor lockUserChangeStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$DoorLockClusterLockUserChangeEvent",
+                "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Long;"
+                "Ljava/lang/Integer;)V");
+            err = lockUserChangeStructCtorCache.Get(env, lockUserChangeStructClass, lockUserChangeStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$DoorLockClusterLockUserChangeEvent");
-                return nullptr;
-            }
-            jmethodID lockUserChangeStructCtor =
-                env->GetMethodID(lockUserChangeStructClass, "<init>",
-                                 "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/"
-                                 "Integer;Ljava/lang/Long;Ljava/lang/Integer;)V");
-            if (lockUserChangeStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$DoorLockClusterLockUserChangeEvent constructor");
                 return nullptr;
@@ -2535,16 +2339,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 return nullptr;
             }
             jclass supplyVoltageLowStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterSupplyVoltageLowEvent",
-                supplyVoltageLowStructClass);
+            jmethodID supplyVoltageLowStructCtor;
+            static chip::JniCachedConstructor supplyVoltageLowStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterSupplyVoltageLowEvent", "()V");
+            err = supplyVoltageLowStructCtorCache.Get(env, supplyVoltageLowStructClass, supplyVoltageLowStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$PumpConfigurationAndControlClusterSupplyVoltageLowEvent");
-                return nullptr;
-            }
-            jmethodID supplyVoltageLowStructCtor = env->GetMethodID(supplyVoltageLowStructClass, "<init>", "()V");
-            if (supplyVoltageLowStructCtor == nullptr)
             {
                 ChipLogError(Zcl,
                              "Could not find ChipEventStructs$PumpConfigurationAndControlClusterSupplyVoltageLowEvent constructor");
@@ -2563,16 +2362,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 return nullptr;
             }
             jclass supplyVoltageHighStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterSupplyVoltageHighEvent",
-                supplyVoltageHighStructClass);
+            jmethodID supplyVoltageHighStructCtor;
+            static chip::JniCachedConstructor supplyVoltageHighStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterSupplyVoltageHighEvent", "()V");
+            err = supplyVoltageHighStructCtorCache.Get(env, supplyVoltageHighStructClass, supplyVoltageHighStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$PumpConfigurationAndControlClusterSupplyVoltageHighEvent");
-                return nullptr;
-            }
-            jmethodID supplyVoltageHighStructCtor = env->GetMethodID(supplyVoltageHighStructClass, "<init>", "()V");
-            if (supplyVoltageHighStructCtor == nullptr)
             {
                 ChipLogError(
                     Zcl, "Could not find ChipEventStructs$PumpConfigurationAndControlClusterSupplyVoltageHighEvent constructor");
@@ -2591,16 +2385,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 return nullptr;
             }
             jclass powerMissingPhaseStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterPowerMissingPhaseEvent",
-                powerMissingPhaseStructClass);
+            jmethodID powerMissingPhaseStructCtor;
+            static chip::JniCachedConstructor powerMissingPhaseStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterPowerMissingPhaseEvent", "()V");
+            err = powerMissingPhaseStructCtorCache.Get(env, powerMissingPhaseStructClass, powerMissingPhaseStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$PumpConfigurationAndControlClusterPowerMissingPhaseEvent");
-                return nullptr;
-            }
-            jmethodID powerMissingPhaseStructCtor = env->GetMethodID(powerMissingPhaseStructClass, "<init>", "()V");
-            if (powerMissingPhaseStructCtor == nullptr)
             {
                 ChipLogError(
                     Zcl, "Could not find ChipEventStructs$PumpConfigurationAndControlClusterPowerMissingPhaseEvent constructor");
@@ -2619,16 +2408,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 return nullptr;
             }
             jclass systemPressureLowStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterSystemPressureLowEvent",
-                systemPressureLowStructClass);
+            jmethodID systemPressureLowStructCtor;
+            static chip::JniCachedConstructor systemPressureLowStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterSystemPressureLowEvent", "()V");
+            err = systemPressureLowStructCtorCache.Get(env, systemPressureLowStructClass, systemPressureLowStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$PumpConfigurationAndControlClusterSystemPressureLowEvent");
-                return nullptr;
-            }
-            jmethodID systemPressureLowStructCtor = env->GetMethodID(systemPressureLowStructClass, "<init>", "()V");
-            if (systemPressureLowStructCtor == nullptr)
             {
                 ChipLogError(
                     Zcl, "Could not find ChipEventStructs$PumpConfigurationAndControlClusterSystemPressureLowEvent constructor");
@@ -2647,17 +2431,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 return nullptr;
             }
             jclass systemPressureHighStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterSystemPressureHighEvent",
-                systemPressureHighStructClass);
+            jmethodID systemPressureHighStructCtor;
+            static chip::JniCachedConstructor systemPressureHighStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterSystemPressureHighEvent", "()V");
+            err = systemPressureHighStructCtorCache.Get(env, systemPressureHighStructClass, systemPressureHighStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl,
-                             "Could not find class ChipEventStructs$PumpConfigurationAndControlClusterSystemPressureHighEvent");
-                return nullptr;
-            }
-            jmethodID systemPressureHighStructCtor = env->GetMethodID(systemPressureHighStructClass, "<init>", "()V");
-            if (systemPressureHighStructCtor == nullptr)
             {
                 ChipLogError(
                     Zcl, "Could not find ChipEventStructs$PumpConfigurationAndControlClusterSystemPressureHighEvent constructor");
@@ -2676,16 +2454,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 return nullptr;
             }
             jclass dryRunningStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterDryRunningEvent",
-                dryRunningStructClass);
+            jmethodID dryRunningStructCtor;
+            static chip::JniCachedConstructor dryRunningStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterDryRunningEvent", "()V");
+            err = dryRunningStructCtorCache.Get(env, dryRunningStructClass, dryRunningStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$PumpConfigurationAndControlClusterDryRunningEvent");
-                return nullptr;
-            }
-            jmethodID dryRunningStructCtor = env->GetMethodID(dryRunningStructClass, "<init>", "()V");
-            if (dryRunningStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$PumpConfigurationAndControlClusterDryRunningEvent constructor");
                 return nullptr;
@@ -2703,17 +2476,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 return nullptr;
             }
             jclass motorTemperatureHighStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterMotorTemperatureHighEvent",
-                motorTemperatureHighStructClass);
+            jmethodID motorTemperatureHighStructCtor;
+            static chip::JniCachedConstructor motorTemperatureHighStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterMotorTemperatureHighEvent", "()V");
+            err = motorTemperatureHighStructCtorCache.Get(env, motorTemperatureHighStructClass, motorTemperatureHighStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl,
-                             "Could not find class ChipEventStructs$PumpConfigurationAndControlClusterMotorTemperatureHighEvent");
-                return nullptr;
-            }
-            jmethodID motorTemperatureHighStructCtor = env->GetMethodID(motorTemperatureHighStructClass, "<init>", "()V");
-            if (motorTemperatureHighStructCtor == nullptr)
             {
                 ChipLogError(
                     Zcl, "Could not find ChipEventStructs$PumpConfigurationAndControlClusterMotorTemperatureHighEvent constructor");
@@ -2732,17 +2499,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 return nullptr;
             }
             jclass pumpMotorFatalFailureStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterPumpMotorFatalFailureEvent",
-                pumpMotorFatalFailureStructClass);
+            jmethodID pumpMotorFatalFailureStructCtor;
+            static chip::JniCachedConstructor pumpMotorFatalFailureStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterPumpMotorFatalFailureEvent", "()V");
+            err = pumpMotorFatalFailureStructCtorCache.Get(env, pumpMotorFatalFailureStructClass, pumpMotorFatalFailureStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl,
-                             "Could not find class ChipEventStructs$PumpConfigurationAndControlClusterPumpMotorFatalFailureEvent");
-                return nullptr;
-            }
-            jmethodID pumpMotorFatalFailureStructCtor = env->GetMethodID(pumpMotorFatalFailureStructClass, "<init>", "()V");
-            if (pumpMotorFatalFailureStructCtor == nullptr)
             {
                 ChipLogError(
                     Zcl,
@@ -2762,17 +2523,12 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 return nullptr;
             }
             jclass electronicTemperatureHighStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterElectronicTemperatureHighEvent",
-                electronicTemperatureHighStructClass);
+            jmethodID electronicTemperatureHighStructCtor;
+            static chip::JniCachedConstructor electronicTemperatureHighStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterElectronicTemperatureHighEvent", "()V");
+            err = electronicTemperatureHighStructCtorCache.Get(
+                env, electronicTemperatureHighStructClass, electronicTemperatureHighStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(
-                    Zcl, "Could not find class ChipEventStructs$PumpConfigurationAndControlClusterElectronicTemperatureHighEvent");
-                return nullptr;
-            }
-            jmethodID electronicTemperatureHighStructCtor = env->GetMethodID(electronicTemperatureHighStructClass, "<init>", "()V");
-            if (electronicTemperatureHighStructCtor == nullptr)
             {
                 ChipLogError(
                     Zcl,
@@ -2792,16 +2548,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 return nullptr;
             }
             jclass pumpBlockedStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterPumpBlockedEvent",
-                pumpBlockedStructClass);
+            jmethodID pumpBlockedStructCtor;
+            static chip::JniCachedConstructor pumpBlockedStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterPumpBlockedEvent", "()V");
+            err = pumpBlockedStructCtorCache.Get(env, pumpBlockedStructClass, pumpBlockedStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$PumpConfigurationAndControlClusterPumpBlockedEvent");
-                return nullptr;
-            }
-            jmethodID pumpBlockedStructCtor = env->GetMethodID(pumpBlockedStructClass, "<init>", "()V");
-            if (pumpBlockedStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$PumpConfigurationAndControlClusterPumpBlockedEvent constructor");
                 return nullptr;
@@ -2819,16 +2570,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 return nullptr;
             }
             jclass sensorFailureStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterSensorFailureEvent",
-                sensorFailureStructClass);
+            jmethodID sensorFailureStructCtor;
+            static chip::JniCachedConstructor sensorFailureStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterSensorFailureEvent", "()V");
+            err = sensorFailureStructCtorCache.Get(env, sensorFailureStructClass, sensorFailureStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$PumpConfigurationAndControlClusterSensorFailureEvent");
-                return nullptr;
-            }
-            jmethodID sensorFailureStructCtor = env->GetMethodID(sensorFailureStructClass, "<init>", "()V");
-            if (sensorFailureStructCtor == nullptr)
             {
                 ChipLogError(Zcl,
                              "Could not find ChipEventStructs$PumpConfigurationAndControlClusterSensorFailureEvent constructor");
@@ -2847,17 +2593,12 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 return nullptr;
             }
             jclass electronicNonFatalFailureStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterElectronicNonFatalFailureEvent",
-                electronicNonFatalFailureStructClass);
+            jmethodID electronicNonFatalFailureStructCtor;
+            static chip::JniCachedConstructor electronicNonFatalFailureStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterElectronicNonFatalFailureEvent", "()V");
+            err = electronicNonFatalFailureStructCtorCache.Get(
+                env, electronicNonFatalFailureStructClass, electronicNonFatalFailureStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(
-                    Zcl, "Could not find class ChipEventStructs$PumpConfigurationAndControlClusterElectronicNonFatalFailureEvent");
-                return nullptr;
-            }
-            jmethodID electronicNonFatalFailureStructCtor = env->GetMethodID(electronicNonFatalFailureStructClass, "<init>", "()V");
-            if (electronicNonFatalFailureStructCtor == nullptr)
             {
                 ChipLogError(
                     Zcl,
@@ -2877,17 +2618,12 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 return nullptr;
             }
             jclass electronicFatalFailureStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterElectronicFatalFailureEvent",
-                electronicFatalFailureStructClass);
+            jmethodID electronicFatalFailureStructCtor;
+            static chip::JniCachedConstructor electronicFatalFailureStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterElectronicFatalFailureEvent", "()V");
+            err = electronicFatalFailureStructCtorCache.Get(
+                env, electronicFatalFailureStructClass, electronicFatalFailureStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl,
-                             "Could not find class ChipEventStructs$PumpConfigurationAndControlClusterElectronicFatalFailureEvent");
-                return nullptr;
-            }
-            jmethodID electronicFatalFailureStructCtor = env->GetMethodID(electronicFatalFailureStructClass, "<init>", "()V");
-            if (electronicFatalFailureStructCtor == nullptr)
             {
                 ChipLogError(
                     Zcl,
@@ -2907,16 +2643,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 return nullptr;
             }
             jclass generalFaultStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterGeneralFaultEvent",
-                generalFaultStructClass);
+            jmethodID generalFaultStructCtor;
+            static chip::JniCachedConstructor generalFaultStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterGeneralFaultEvent", "()V");
+            err = generalFaultStructCtorCache.Get(env, generalFaultStructClass, generalFaultStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$PumpConfigurationAndControlClusterGeneralFaultEvent");
-                return nullptr;
-            }
-            jmethodID generalFaultStructCtor = env->GetMethodID(generalFaultStructClass, "<init>", "()V");
-            if (generalFaultStructCtor == nullptr)
             {
                 ChipLogError(Zcl,
                              "Could not find ChipEventStructs$PumpConfigurationAndControlClusterGeneralFaultEvent constructor");
@@ -2935,15 +2666,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 return nullptr;
             }
             jclass leakageStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterLeakageEvent", leakageStructClass);
+            jmethodID leakageStructCtor;
+            static chip::JniCachedConstructor leakageStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterLeakageEvent", "()V");
+            err = leakageStructCtorCache.Get(env, leakageStructClass, leakageStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$PumpConfigurationAndControlClusterLeakageEvent");
-                return nullptr;
-            }
-            jmethodID leakageStructCtor = env->GetMethodID(leakageStructClass, "<init>", "()V");
-            if (leakageStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$PumpConfigurationAndControlClusterLeakageEvent constructor");
                 return nullptr;
@@ -2961,16 +2688,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 return nullptr;
             }
             jclass airDetectionStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterAirDetectionEvent",
-                airDetectionStructClass);
+            jmethodID airDetectionStructCtor;
+            static chip::JniCachedConstructor airDetectionStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterAirDetectionEvent", "()V");
+            err = airDetectionStructCtorCache.Get(env, airDetectionStructClass, airDetectionStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$PumpConfigurationAndControlClusterAirDetectionEvent");
-                return nullptr;
-            }
-            jmethodID airDetectionStructCtor = env->GetMethodID(airDetectionStructClass, "<init>", "()V");
-            if (airDetectionStructCtor == nullptr)
             {
                 ChipLogError(Zcl,
                              "Could not find ChipEventStructs$PumpConfigurationAndControlClusterAirDetectionEvent constructor");
@@ -2989,16 +2711,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 return nullptr;
             }
             jclass turbineOperationStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterTurbineOperationEvent",
-                turbineOperationStructClass);
+            jmethodID turbineOperationStructCtor;
+            static chip::JniCachedConstructor turbineOperationStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$PumpConfigurationAndControlClusterTurbineOperationEvent", "()V");
+            err = turbineOperationStructCtorCache.Get(env, turbineOperationStructClass, turbineOperationStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$PumpConfigurationAndControlClusterTurbineOperationEvent");
-                return nullptr;
-            }
-            jmethodID turbineOperationStructCtor = env->GetMethodID(turbineOperationStructClass, "<init>", "()V");
-            if (turbineOperationStructCtor == nullptr)
             {
                 ChipLogError(Zcl,
                              "Could not find ChipEventStructs$PumpConfigurationAndControlClusterTurbineOperationEvent constructor");
@@ -3325,18 +3042,13 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                 value_arg4_hClassName.c_str(), value_arg4_hCtorSignature.c_str(), cppValue.arg4.h, value_arg4_h);
 
             jclass simpleStructStructClass_0;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct", simpleStructStructClass_0);
+            jmethodID simpleStructStructCtor_0;
+            static chip::JniCachedConstructor simpleStructStructCtorCache_0(
+                "chip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct",
+                "(Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Integer;[BLjava/lang/String;Ljava/lang/Integer;Ljava/lang/Float;"
+                "Ljava/lang/Double;)V");
+            err = simpleStructStructCtorCache_0.Get(env, simpleStructStructClass_0, simpleStructStructCtor_0);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipStructs$TestClusterClusterSimpleStruct");
-                return nullptr;
-            }
-            jmethodID simpleStructStructCtor_0 =
-                env->GetMethodID(simpleStructStructClass_0, "<init>",
-                                 "(Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Integer;[BLjava/lang/String;Ljava/lang/"
-                                 "Integer;Ljava/lang/Float;Ljava/lang/Double;)V");
-            if (simpleStructStructCtor_0 == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipStructs$TestClusterClusterSimpleStruct constructor");
                 return nullptr;
@@ -3393,18 +3105,13 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                     newElement_0_hClassName.c_str(), newElement_0_hCtorSignature.c_str(), entry_0.h, newElement_0_h);
 
                 jclass simpleStructStructClass_1;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct", simpleStructStructClass_1);
+                jmethodID simpleStructStructCtor_1;
+                static chip::JniCachedConstructor simpleStructStructCtorCache_1(
+                    "chip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct",
+                    "(Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Integer;[BLjava/lang/String;Ljava/lang/Integer;Ljava/lang/"
+                    "Float;Ljava/lang/Double;)V");
+                err = simpleStructStructCtorCache_1.Get(env, simpleStructStructClass_1, simpleStructStructCtor_1);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$TestClusterClusterSimpleStruct");
-                    return nullptr;
-                }
-                jmethodID simpleStructStructCtor_1 =
-                    env->GetMethodID(simpleStructStructClass_1, "<init>",
-                                     "(Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Integer;[BLjava/lang/String;Ljava/lang/"
-                                     "Integer;Ljava/lang/Float;Ljava/lang/Double;)V");
-                if (simpleStructStructCtor_1 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$TestClusterClusterSimpleStruct constructor");
                     return nullptr;
@@ -3432,18 +3139,13 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
             }
 
             jclass testEventStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$TestClusterClusterTestEventEvent", testEventStructClass);
+            jmethodID testEventStructCtor;
+            static chip::JniCachedConstructor testEventStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$TestClusterClusterTestEventEvent",
+                "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Boolean;Lchip/devicecontroller/"
+                "ChipStructs$TestClusterClusterSimpleStruct;Ljava/util/ArrayList;Ljava/util/ArrayList;)V");
+            err = testEventStructCtorCache.Get(env, testEventStructClass, testEventStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$TestClusterClusterTestEventEvent");
-                return nullptr;
-            }
-            jmethodID testEventStructCtor =
-                env->GetMethodID(testEventStructClass, "<init>",
-                                 "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Boolean;Lchip/devicecontroller/"
-                                 "ChipStructs$TestClusterClusterSimpleStruct;Ljava/util/ArrayList;Ljava/util/ArrayList;)V");
-            if (testEventStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$TestClusterClusterTestEventEvent constructor");
                 return nullptr;
@@ -3469,17 +3171,11 @@ jobject DecodeEventValue(const app::ConcreteEventPath & aPath, TLV::TLVReader &
                                                                           cppValue.fabricIndex, value_fabricIndex);
 
             jclass testFabricScopedEventStructClass;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipEventStructs$TestClusterClusterTestFabricScopedEventEvent",
-                testFabricScopedEventStructClass);
+            jmethodID testFabricScopedEventStructCtor;
+            static chip::JniCachedConstructor testFabricScopedEventStructCtorCache(
+                "chip/devicecontroller/ChipEventStructs$TestClusterClusterTestFabricScopedEventEvent", "(Ljava/lang/Integer;)V");
+            err = testFabricScopedEventStructCtorCache.Get(env, testFabricScopedEventStructClass, testFabricScopedEventStructCtor);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipEventStructs$TestClusterClusterTestFabricScopedEventEvent");
-                return nullptr;
-            }
-            jmethodID testFabricScopedEventStructCtor =
-                env->GetMethodID(testFabricScopedEventStructClass, "<init>", "(Ljava/lang/Integer;)V");
-            if (testFabricScopedEventStructCtor == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipEventStructs$TestClusterClusterTestFabricScopedEventEvent constructor");
                 return nullptr;
@@ -536,16 +536,12 @@ void CHIPScenesClusterViewSceneResponseCallback::CallbackFn(
                 }
 
                 jclass attributeValuePairStructClass_4;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$ScenesClusterAttributeValuePair", attributeValuePairStructClass_4);
+                jmethodID attributeValuePairStructCtor_4;
+                static chip::JniCachedConstructor attributeValuePairStructCtorCache_4(
+                    "chip/devicecontroller/ChipStructs$ScenesClusterAttributeValuePair",
+                    "(Ljava/util/Optional;Ljava/util/ArrayList;)V");
+                err = attributeValuePairStructCtorCache_4.Get(env, attributeValuePairStructClass_4, attributeValuePairStructCtor_4);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$ScenesClusterAttributeValuePair");
-                    return;
-                }
-                jmethodID attributeValuePairStructCtor_4 =
-                    env->GetMethodID(attributeValuePairStructClass_4, "<init>", "(Ljava/util/Optional;Ljava/util/ArrayList;)V");
-                if (attributeValuePairStructCtor_4 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$ScenesClusterAttributeValuePair constructor");
                     return;
@@ -557,16 +553,11 @@ void CHIPScenesClusterViewSceneResponseCallback::CallbackFn(
             }
 
             jclass extensionFieldSetStructClass_2;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipStructs$ScenesClusterExtensionFieldSet", extensionFieldSetStructClass_2);
+            jmethodID extensionFieldSetStructCtor_2;
+            static chip::JniCachedConstructor extensionFieldSetStructCtorCache_2(
+                "chip/devicecontroller/ChipStructs$ScenesClusterExtensionFieldSet", "(Ljava/lang/Long;Ljava/util/ArrayList;)V");
+            err = extensionFieldSetStructCtorCache_2.Get(env, extensionFieldSetStructClass_2, extensionFieldSetStructCtor_2);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipStructs$ScenesClusterExtensionFieldSet");
-                return;
-            }
-            jmethodID extensionFieldSetStructCtor_2 =
-                env->GetMethodID(extensionFieldSetStructClass_2, "<init>", "(Ljava/lang/Long;Ljava/util/ArrayList;)V");
-            if (extensionFieldSetStructCtor_2 == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipStructs$ScenesClusterExtensionFieldSet constructor");
                 return;
@@ -1444,18 +1435,13 @@ void CHIPNetworkCommissioningClusterScanNetworksResponseCallback::CallbackFn(
                 newElement_1_rssiClassName.c_str(), newElement_1_rssiCtorSignature.c_str(), entry_1.rssi, newElement_1_rssi);
 
             jclass wiFiInterfaceScanResultStructClass_2;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipStructs$NetworkCommissioningClusterWiFiInterfaceScanResult",
-                wiFiInterfaceScanResultStructClass_2);
+            jmethodID wiFiInterfaceScanResultStructCtor_2;
+            static chip::JniCachedConstructor wiFiInterfaceScanResultStructCtorCache_2(
+                "chip/devicecontroller/ChipStructs$NetworkCommissioningClusterWiFiInterfaceScanResult",
+                "(Ljava/lang/Integer;[B[BLjava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;)V");
+            err = wiFiInterfaceScanResultStructCtorCache_2.Get(
+                env, wiFiInterfaceScanResultStructClass_2, wiFiInterfaceScanResultStructCtor_2);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipStructs$NetworkCommissioningClusterWiFiInterfaceScanResult");
-                return;
-            }
-            jmethodID wiFiInterfaceScanResultStructCtor_2 =
-                env->GetMethodID(wiFiInterfaceScanResultStructClass_2, "<init>",
-                                 "(Ljava/lang/Integer;[B[BLjava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;)V");
-            if (wiFiInterfaceScanResultStructCtor_2 == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipStructs$NetworkCommissioningClusterWiFiInterfaceScanResult constructor");
                 return;
@@ -1527,19 +1513,14 @@ void CHIPNetworkCommissioningClusterScanNetworksResponseCallback::CallbackFn(
                 newElement_1_lqiClassName.c_str(), newElement_1_lqiCtorSignature.c_str(), entry_1.lqi, newElement_1_lqi);
 
             jclass threadInterfaceScanResultStructClass_2;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipStructs$NetworkCommissioningClusterThreadInterfaceScanResult",
-                threadInterfaceScanResultStructClass_2);
+            jmethodID threadInterfaceScanResultStructCtor_2;
+            static chip::JniCachedConstructor threadInterfaceScanResultStructCtorCache_2(
+                "chip/devicecontroller/ChipStructs$NetworkCommissioningClusterThreadInterfaceScanResult",
+                "(Ljava/lang/Integer;Ljava/lang/Long;Ljava/lang/String;Ljava/lang/Integer;Ljava/lang/Integer;[BLjava/lang/Integer;"
+                "Ljava/lang/Integer;)V");
+            err = threadInterfaceScanResultStructCtorCache_2.Get(
+                env, threadInterfaceScanResultStructClass_2, threadInterfaceScanResultStructCtor_2);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipStructs$NetworkCommissioningClusterThreadInterfaceScanResult");
-                return;
-            }
-            jmethodID threadInterfaceScanResultStructCtor_2 =
-                env->GetMethodID(threadInterfaceScanResultStructClass_2, "<init>",
-                                 "(Ljava/lang/Integer;Ljava/lang/Long;Ljava/lang/String;Ljava/lang/Integer;Ljava/lang/"
-                                 "Integer;[BLjava/lang/Integer;Ljava/lang/Integer;)V");
-            if (threadInterfaceScanResultStructCtor_2 == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipStructs$NetworkCommissioningClusterThreadInterfaceScanResult constructor");
                 return;
@@ -2242,17 +2223,12 @@ void CHIPGroupKeyManagementClusterKeySetReadResponseCallback::CallbackFn(
     }
 
     jclass groupKeySetStructStructClass_0;
-    err = chip::JniReferences::GetInstance().GetClassRef(
-        env, "chip/devicecontroller/ChipStructs$GroupKeyManagementClusterGroupKeySetStruct", groupKeySetStructStructClass_0);
+    jmethodID groupKeySetStructStructCtor_0;
+    static chip::JniCachedConstructor groupKeySetStructStructCtorCache_0(
+        "chip/devicecontroller/ChipStructs$GroupKeyManagementClusterGroupKeySetStruct",
+        "(Ljava/lang/Integer;Ljava/lang/Integer;[BLjava/lang/Long;[BLjava/lang/Long;[BLjava/lang/Long;)V");
+    err = groupKeySetStructStructCtorCache_0.Get(env, groupKeySetStructStructClass_0, groupKeySetStructStructCtor_0);
     if (err != CHIP_NO_ERROR)
-    {
-        ChipLogError(Zcl, "Could not find class ChipStructs$GroupKeyManagementClusterGroupKeySetStruct");
-        return;
-    }
-    jmethodID groupKeySetStructStructCtor_0 =
-        env->GetMethodID(groupKeySetStructStructClass_0, "<init>",
-                         "(Ljava/lang/Integer;Ljava/lang/Integer;[BLjava/lang/Long;[BLjava/lang/Long;[BLjava/lang/Long;)V");
-    if (groupKeySetStructStructCtor_0 == nullptr)
     {
         ChipLogError(Zcl, "Could not find ChipStructs$GroupKeyManagementClusterGroupKeySetStruct constructor");
         return;
@@ -2850,16 +2826,11 @@ void CHIPDoorLockClusterGetUserResponseCallback::CallbackFn(
                                                                            entry_1.credentialIndex, newElement_1_credentialIndex);
 
             jclass dlCredentialStructClass_2;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipStructs$DoorLockClusterDlCredential", dlCredentialStructClass_2);
+            jmethodID dlCredentialStructCtor_2;
+            static chip::JniCachedConstructor dlCredentialStructCtorCache_2(
+                "chip/devicecontroller/ChipStructs$DoorLockClusterDlCredential", "(Ljava/lang/Integer;Ljava/lang/Integer;)V");
+            err = dlCredentialStructCtorCache_2.Get(env, dlCredentialStructClass_2, dlCredentialStructCtor_2);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipStructs$DoorLockClusterDlCredential");
-                return;
-            }
-            jmethodID dlCredentialStructCtor_2 =
-                env->GetMethodID(dlCredentialStructClass_2, "<init>", "(Ljava/lang/Integer;Ljava/lang/Integer;)V");
-            if (dlCredentialStructCtor_2 == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipStructs$DoorLockClusterDlCredential constructor");
                 return;
@@ -3227,17 +3198,13 @@ void CHIPThermostatClusterGetWeeklyScheduleResponseCallback::CallbackFn(
         }
 
         jclass thermostatScheduleTransitionStructClass_1;
-        err = chip::JniReferences::GetInstance().GetClassRef(
-            env, "chip/devicecontroller/ChipStructs$ThermostatClusterThermostatScheduleTransition",
-            thermostatScheduleTransitionStructClass_1);
+        jmethodID thermostatScheduleTransitionStructCtor_1;
+        static chip::JniCachedConstructor thermostatScheduleTransitionStructCtorCache_1(
+            "chip/devicecontroller/ChipStructs$ThermostatClusterThermostatScheduleTransition",
+            "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;)V");
+        err = thermostatScheduleTransitionStructCtorCache_1.Get(
+            env, thermostatScheduleTransitionStructClass_1, thermostatScheduleTransitionStructCtor_1);
         if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(Zcl, "Could not find class ChipStructs$ThermostatClusterThermostatScheduleTransition");
-            return;
-        }
-        jmethodID thermostatScheduleTransitionStructCtor_1 = env->GetMethodID(
-            thermostatScheduleTransitionStructClass_1, "<init>", "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;)V");
-        if (thermostatScheduleTransitionStructCtor_1 == nullptr)
         {
             ChipLogError(Zcl, "Could not find ChipStructs$ThermostatClusterThermostatScheduleTransition constructor");
             return;
@@ -4246,17 +4213,13 @@ void CHIPTestClusterClusterSimpleStructResponseCallback::CallbackFn(
                                                                  dataResponse.arg1.h, arg1_h);
 
     jclass simpleStructStructClass_0;
-    err = chip::JniReferences::GetInstance().GetClassRef(env, "chip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct",
-                                                         simpleStructStructClass_0);
+    jmethodID simpleStructStructCtor_0;
+    static chip::JniCachedConstructor simpleStructStructCtorCache_0(
+        "chip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct",
+        "(Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Integer;[BLjava/lang/String;Ljava/lang/Integer;Ljava/lang/Float;Ljava/"
+        "lang/Double;)V");
+    err = simpleStructStructCtorCache_0.Get(env, simpleStructStructClass_0, simpleStructStructCtor_0);
     if (err != CHIP_NO_ERROR)
-    {
-        ChipLogError(Zcl, "Could not find class ChipStructs$TestClusterClusterSimpleStruct");
-        return;
-    }
-    jmethodID simpleStructStructCtor_0 = env->GetMethodID(simpleStructStructClass_0, "<init>",
-                                                          "(Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Integer;[BLjava/lang/"
-                                                          "String;Ljava/lang/Integer;Ljava/lang/Float;Ljava/lang/Double;)V");
-    if (simpleStructStructCtor_0 == nullptr)
     {
         ChipLogError(Zcl, "Could not find ChipStructs$TestClusterClusterSimpleStruct constructor");
         return;
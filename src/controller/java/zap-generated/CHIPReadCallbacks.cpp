@@ -2746,16 +2746,11 @@ void CHIPDescriptorDeviceTypeListAttributeCallback::CallbackFn(
                                                                        newElement_0_revision);
 
         jclass deviceTypeStructStructClass_1;
-        err = chip::JniReferences::GetInstance().GetClassRef(
-            env, "chip/devicecontroller/ChipStructs$DescriptorClusterDeviceTypeStruct", deviceTypeStructStructClass_1);
+        jmethodID deviceTypeStructStructCtor_1;
+        static chip::JniCachedConstructor deviceTypeStructStructCtorCache_1(
+            "chip/devicecontroller/ChipStructs$DescriptorClusterDeviceTypeStruct", "(Ljava/lang/Integer;Ljava/lang/Integer;)V");
+        err = deviceTypeStructStructCtorCache_1.Get(env, deviceTypeStructStructClass_1, deviceTypeStructStructCtor_1);
         if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(Zcl, "Could not find class ChipStructs$DescriptorClusterDeviceTypeStruct");
-            return;
-        }
-        jmethodID deviceTypeStructStructCtor_1 =
-            env->GetMethodID(deviceTypeStructStructClass_1, "<init>", "(Ljava/lang/Integer;Ljava/lang/Integer;)V");
-        if (deviceTypeStructStructCtor_1 == nullptr)
         {
             ChipLogError(Zcl, "Could not find ChipStructs$DescriptorClusterDeviceTypeStruct constructor");
             return;
@@ -3315,17 +3310,12 @@ void CHIPBindingBindingAttributeCallback::CallbackFn(
                                                                       entry_0.fabricIndex, newElement_0_fabricIndex);
 
         jclass targetStructStructClass_1;
-        err = chip::JniReferences::GetInstance().GetClassRef(env, "chip/devicecontroller/ChipStructs$BindingClusterTargetStruct",
-                                                             targetStructStructClass_1);
-        if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(Zcl, "Could not find class ChipStructs$BindingClusterTargetStruct");
-            return;
-        }
-        jmethodID targetStructStructCtor_1 = env->GetMethodID(
-            targetStructStructClass_1, "<init>",
+        jmethodID targetStructStructCtor_1;
+        static chip::JniCachedConstructor targetStructStructCtorCache_1(
+            "chip/devicecontroller/ChipStructs$BindingClusterTargetStruct",
             "(Ljava/util/Optional;Ljava/util/Optional;Ljava/util/Optional;Ljava/util/Optional;Ljava/lang/Integer;)V");
-        if (targetStructStructCtor_1 == nullptr)
+        err = targetStructStructCtorCache_1.Get(env, targetStructStructClass_1, targetStructStructCtor_1);
+        if (err != CHIP_NO_ERROR)
         {
             ChipLogError(Zcl, "Could not find ChipStructs$BindingClusterTargetStruct constructor");
             return;
@@ -3699,16 +3689,12 @@ void CHIPAccessControlAclAttributeCallback::CallbackFn(
                 }
 
                 jclass targetStructClass_4;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$AccessControlClusterTarget", targetStructClass_4);
+                jmethodID targetStructCtor_4;
+                static chip::JniCachedConstructor targetStructCtorCache_4(
+                    "chip/devicecontroller/ChipStructs$AccessControlClusterTarget",
+                    "(Ljava/lang/Long;Ljava/lang/Integer;Ljava/lang/Long;)V");
+                err = targetStructCtorCache_4.Get(env, targetStructClass_4, targetStructCtor_4);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$AccessControlClusterTarget");
-                    return;
-                }
-                jmethodID targetStructCtor_4 =
-                    env->GetMethodID(targetStructClass_4, "<init>", "(Ljava/lang/Long;Ljava/lang/Integer;Ljava/lang/Long;)V");
-                if (targetStructCtor_4 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$AccessControlClusterTarget constructor");
                     return;
@@ -3727,17 +3713,12 @@ void CHIPAccessControlAclAttributeCallback::CallbackFn(
                                                                       entry_0.fabricIndex, newElement_0_fabricIndex);
 
         jclass accessControlEntryStructClass_1;
-        err = chip::JniReferences::GetInstance().GetClassRef(
-            env, "chip/devicecontroller/ChipStructs$AccessControlClusterAccessControlEntry", accessControlEntryStructClass_1);
-        if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(Zcl, "Could not find class ChipStructs$AccessControlClusterAccessControlEntry");
-            return;
-        }
-        jmethodID accessControlEntryStructCtor_1 = env->GetMethodID(
-            accessControlEntryStructClass_1, "<init>",
+        jmethodID accessControlEntryStructCtor_1;
+        static chip::JniCachedConstructor accessControlEntryStructCtorCache_1(
+            "chip/devicecontroller/ChipStructs$AccessControlClusterAccessControlEntry",
             "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/util/ArrayList;Ljava/util/ArrayList;Ljava/lang/Integer;)V");
-        if (accessControlEntryStructCtor_1 == nullptr)
+        err = accessControlEntryStructCtorCache_1.Get(env, accessControlEntryStructClass_1, accessControlEntryStructCtor_1);
+        if (err != CHIP_NO_ERROR)
         {
             ChipLogError(Zcl, "Could not find ChipStructs$AccessControlClusterAccessControlEntry constructor");
             return;
@@ -3824,15 +3805,11 @@ void CHIPAccessControlExtensionAttributeCallback::CallbackFn(
                                                                       entry_0.fabricIndex, newElement_0_fabricIndex);
 
         jclass extensionEntryStructClass_1;
-        err = chip::JniReferences::GetInstance().GetClassRef(
-            env, "chip/devicecontroller/ChipStructs$AccessControlClusterExtensionEntry", extensionEntryStructClass_1);
+        jmethodID extensionEntryStructCtor_1;
+        static chip::JniCachedConstructor extensionEntryStructCtorCache_1(
+            "chip/devicecontroller/ChipStructs$AccessControlClusterExtensionEntry", "([BLjava/lang/Integer;)V");
+        err = extensionEntryStructCtorCache_1.Get(env, extensionEntryStructClass_1, extensionEntryStructCtor_1);
         if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(Zcl, "Could not find class ChipStructs$AccessControlClusterExtensionEntry");
-            return;
-        }
-        jmethodID extensionEntryStructCtor_1 = env->GetMethodID(extensionEntryStructClass_1, "<init>", "([BLjava/lang/Integer;)V");
-        if (extensionEntryStructCtor_1 == nullptr)
         {
             ChipLogError(Zcl, "Could not find ChipStructs$AccessControlClusterExtensionEntry constructor");
             return;
@@ -4153,17 +4130,12 @@ void CHIPActionsActionListAttributeCallback::CallbackFn(
                                                                       static_cast<uint8_t>(entry_0.state), newElement_0_state);
 
         jclass actionStructStructClass_1;
-        err = chip::JniReferences::GetInstance().GetClassRef(env, "chip/devicecontroller/ChipStructs$ActionsClusterActionStruct",
-                                                             actionStructStructClass_1);
-        if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(Zcl, "Could not find class ChipStructs$ActionsClusterActionStruct");
-            return;
-        }
-        jmethodID actionStructStructCtor_1 = env->GetMethodID(
-            actionStructStructClass_1, "<init>",
+        jmethodID actionStructStructCtor_1;
+        static chip::JniCachedConstructor actionStructStructCtorCache_1(
+            "chip/devicecontroller/ChipStructs$ActionsClusterActionStruct",
             "(Ljava/lang/Integer;Ljava/lang/String;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;)V");
-        if (actionStructStructCtor_1 == nullptr)
+        err = actionStructStructCtorCache_1.Get(env, actionStructStructClass_1, actionStructStructCtor_1);
+        if (err != CHIP_NO_ERROR)
         {
             ChipLogError(Zcl, "Could not find ChipStructs$ActionsClusterActionStruct constructor");
             return;
@@ -4268,17 +4240,12 @@ void CHIPActionsEndpointListsAttributeCallback::CallbackFn(
         }
 
         jclass endpointListStructStructClass_1;
-        err = chip::JniReferences::GetInstance().GetClassRef(
-            env, "chip/devicecontroller/ChipStructs$ActionsClusterEndpointListStruct", endpointListStructStructClass_1);
+        jmethodID endpointListStructStructCtor_1;
+        static chip::JniCachedConstructor endpointListStructStructCtorCache_1(
+            "chip/devicecontroller/ChipStructs$ActionsClusterEndpointListStruct",
+            "(Ljava/lang/Integer;Ljava/lang/String;Ljava/lang/Integer;Ljava/util/ArrayList;)V");
+        err = endpointListStructStructCtorCache_1.Get(env, endpointListStructStructClass_1, endpointListStructStructCtor_1);
         if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(Zcl, "Could not find class ChipStructs$ActionsClusterEndpointListStruct");
-            return;
-        }
-        jmethodID endpointListStructStructCtor_1 =
-            env->GetMethodID(endpointListStructStructClass_1, "<init>",
-                             "(Ljava/lang/Integer;Ljava/lang/String;Ljava/lang/Integer;Ljava/util/ArrayList;)V");
-        if (endpointListStructStructCtor_1 == nullptr)
         {
             ChipLogError(Zcl, "Could not find ChipStructs$ActionsClusterEndpointListStruct constructor");
             return;
@@ -4924,17 +4891,12 @@ void CHIPOtaSoftwareUpdateRequestorDefaultOtaProvidersAttributeCallback::Callbac
                                                                       entry_0.fabricIndex, newElement_0_fabricIndex);
 
         jclass providerLocationStructClass_1;
-        err = chip::JniReferences::GetInstance().GetClassRef(
-            env, "chip/devicecontroller/ChipStructs$OtaSoftwareUpdateRequestorClusterProviderLocation",
-            providerLocationStructClass_1);
+        jmethodID providerLocationStructCtor_1;
+        static chip::JniCachedConstructor providerLocationStructCtorCache_1(
+            "chip/devicecontroller/ChipStructs$OtaSoftwareUpdateRequestorClusterProviderLocation",
+            "(Ljava/lang/Long;Ljava/lang/Integer;Ljava/lang/Integer;)V");
+        err = providerLocationStructCtorCache_1.Get(env, providerLocationStructClass_1, providerLocationStructCtor_1);
         if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(Zcl, "Could not find class ChipStructs$OtaSoftwareUpdateRequestorClusterProviderLocation");
-            return;
-        }
-        jmethodID providerLocationStructCtor_1 =
-            env->GetMethodID(providerLocationStructClass_1, "<init>", "(Ljava/lang/Long;Ljava/lang/Integer;Ljava/lang/Integer;)V");
-        if (providerLocationStructCtor_1 == nullptr)
         {
             ChipLogError(Zcl, "Could not find ChipStructs$OtaSoftwareUpdateRequestorClusterProviderLocation constructor");
             return;
@@ -7116,15 +7078,11 @@ void CHIPNetworkCommissioningNetworksAttributeCallback::CallbackFn(
                                                                    newElement_0_connected);
 
         jclass networkInfoStructClass_1;
-        err = chip::JniReferences::GetInstance().GetClassRef(
-            env, "chip/devicecontroller/ChipStructs$NetworkCommissioningClusterNetworkInfo", networkInfoStructClass_1);
+        jmethodID networkInfoStructCtor_1;
+        static chip::JniCachedConstructor networkInfoStructCtorCache_1(
+            "chip/devicecontroller/ChipStructs$NetworkCommissioningClusterNetworkInfo", "([BLjava/lang/Boolean;)V");
+        err = networkInfoStructCtorCache_1.Get(env, networkInfoStructClass_1, networkInfoStructCtor_1);
         if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(Zcl, "Could not find class ChipStructs$NetworkCommissioningClusterNetworkInfo");
-            return;
-        }
-        jmethodID networkInfoStructCtor_1 = env->GetMethodID(networkInfoStructClass_1, "<init>", "([BLjava/lang/Boolean;)V");
-        if (networkInfoStructCtor_1 == nullptr)
         {
             ChipLogError(Zcl, "Could not find ChipStructs$NetworkCommissioningClusterNetworkInfo constructor");
             return;
@@ -7835,19 +7793,13 @@ void CHIPGeneralDiagnosticsNetworkInterfacesAttributeCallback::CallbackFn(
                                                                       static_cast<uint8_t>(entry_0.type), newElement_0_type);
 
         jclass networkInterfaceTypeStructClass_1;
-        err = chip::JniReferences::GetInstance().GetClassRef(
-            env, "chip/devicecontroller/ChipStructs$GeneralDiagnosticsClusterNetworkInterfaceType",
-            networkInterfaceTypeStructClass_1);
+        jmethodID networkInterfaceTypeStructCtor_1;
+        static chip::JniCachedConstructor networkInterfaceTypeStructCtorCache_1(
+            "chip/devicecontroller/ChipStructs$GeneralDiagnosticsClusterNetworkInterfaceType",
+            "(Ljava/lang/String;Ljava/lang/Boolean;Ljava/lang/Boolean;Ljava/lang/Boolean;[BLjava/util/ArrayList;Ljava/util/"
+            "ArrayList;Ljava/lang/Integer;)V");
+        err = networkInterfaceTypeStructCtorCache_1.Get(env, networkInterfaceTypeStructClass_1, networkInterfaceTypeStructCtor_1);
         if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(Zcl, "Could not find class ChipStructs$GeneralDiagnosticsClusterNetworkInterfaceType");
-            return;
-        }
-        jmethodID networkInterfaceTypeStructCtor_1 =
-            env->GetMethodID(networkInterfaceTypeStructClass_1, "<init>",
-                             "(Ljava/lang/String;Ljava/lang/Boolean;Ljava/lang/Boolean;Ljava/lang/Boolean;[BLjava/util/"
-                             "ArrayList;Ljava/util/ArrayList;Ljava/lang/Integer;)V");
-        if (networkInterfaceTypeStructCtor_1 == nullptr)
         {
             ChipLogError(Zcl, "Could not find ChipStructs$GeneralDiagnosticsClusterNetworkInterfaceType constructor");
             return;
@@ -8420,17 +8372,12 @@ void CHIPSoftwareDiagnosticsThreadMetricsAttributeCallback::CallbackFn(
         }
 
         jclass threadMetricsStructClass_1;
-        err = chip::JniReferences::GetInstance().GetClassRef(
-            env, "chip/devicecontroller/ChipStructs$SoftwareDiagnosticsClusterThreadMetrics", threadMetricsStructClass_1);
+        jmethodID threadMetricsStructCtor_1;
+        static chip::JniCachedConstructor threadMetricsStructCtorCache_1(
+            "chip/devicecontroller/ChipStructs$SoftwareDiagnosticsClusterThreadMetrics",
+            "(Ljava/lang/Long;Ljava/util/Optional;Ljava/util/Optional;Ljava/util/Optional;Ljava/util/Optional;)V");
+        err = threadMetricsStructCtorCache_1.Get(env, threadMetricsStructClass_1, threadMetricsStructCtor_1);
         if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(Zcl, "Could not find class ChipStructs$SoftwareDiagnosticsClusterThreadMetrics");
-            return;
-        }
-        jmethodID threadMetricsStructCtor_1 =
-            env->GetMethodID(threadMetricsStructClass_1, "<init>",
-                             "(Ljava/lang/Long;Ljava/util/Optional;Ljava/util/Optional;Ljava/util/Optional;Ljava/util/Optional;)V");
-        if (threadMetricsStructCtor_1 == nullptr)
         {
             ChipLogError(Zcl, "Could not find ChipStructs$SoftwareDiagnosticsClusterThreadMetrics constructor");
             return;
@@ -9216,19 +9163,14 @@ void CHIPThreadNetworkDiagnosticsNeighborTableListAttributeCallback::CallbackFn(
                                                                    newElement_0_isChild);
 
         jclass neighborTableStructClass_1;
-        err = chip::JniReferences::GetInstance().GetClassRef(
-            env, "chip/devicecontroller/ChipStructs$ThreadNetworkDiagnosticsClusterNeighborTable", neighborTableStructClass_1);
+        jmethodID neighborTableStructCtor_1;
+        static chip::JniCachedConstructor neighborTableStructCtorCache_1(
+            "chip/devicecontroller/ChipStructs$ThreadNetworkDiagnosticsClusterNeighborTable",
+            "(Ljava/lang/Long;Ljava/lang/Long;Ljava/lang/Integer;Ljava/lang/Long;Ljava/lang/Long;Ljava/lang/Integer;Ljava/lang/"
+            "Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Boolean;Ljava/lang/"
+            "Boolean;Ljava/lang/Boolean;)V");
+        err = neighborTableStructCtorCache_1.Get(env, neighborTableStructClass_1, neighborTableStructCtor_1);
         if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(Zcl, "Could not find class ChipStructs$ThreadNetworkDiagnosticsClusterNeighborTable");
-            return;
-        }
-        jmethodID neighborTableStructCtor_1 =
-            env->GetMethodID(neighborTableStructClass_1, "<init>",
-                             "(Ljava/lang/Long;Ljava/lang/Long;Ljava/lang/Integer;Ljava/lang/Long;Ljava/lang/Long;Ljava/lang/"
-                             "Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/"
-                             "Boolean;Ljava/lang/Boolean;Ljava/lang/Boolean;Ljava/lang/Boolean;)V");
-        if (neighborTableStructCtor_1 == nullptr)
         {
             ChipLogError(Zcl, "Could not find ChipStructs$ThreadNetworkDiagnosticsClusterNeighborTable constructor");
             return;
@@ -9366,18 +9308,13 @@ void CHIPThreadNetworkDiagnosticsRouteTableListAttributeCallback::CallbackFn(
                                                                    entry_0.linkEstablished, newElement_0_linkEstablished);
 
         jclass routeTableStructClass_1;
-        err = chip::JniReferences::GetInstance().GetClassRef(
-            env, "chip/devicecontroller/ChipStructs$ThreadNetworkDiagnosticsClusterRouteTable", routeTableStructClass_1);
+        jmethodID routeTableStructCtor_1;
+        static chip::JniCachedConstructor routeTableStructCtorCache_1(
+            "chip/devicecontroller/ChipStructs$ThreadNetworkDiagnosticsClusterRouteTable",
+            "(Ljava/lang/Long;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/"
+            "lang/Integer;Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Boolean;)V");
+        err = routeTableStructCtorCache_1.Get(env, routeTableStructClass_1, routeTableStructCtor_1);
         if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(Zcl, "Could not find class ChipStructs$ThreadNetworkDiagnosticsClusterRouteTable");
-            return;
-        }
-        jmethodID routeTableStructCtor_1 =
-            env->GetMethodID(routeTableStructClass_1, "<init>",
-                             "(Ljava/lang/Long;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/"
-                             "lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Boolean;)V");
-        if (routeTableStructCtor_1 == nullptr)
         {
             ChipLogError(Zcl, "Could not find ChipStructs$ThreadNetworkDiagnosticsClusterRouteTable constructor");
             return;
@@ -12704,15 +12641,11 @@ void CHIPOperationalCredentialsNOCsAttributeCallback::CallbackFn(
                                                                       entry_0.fabricIndex, newElement_0_fabricIndex);
 
         jclass NOCStructStructClass_1;
-        err = chip::JniReferences::GetInstance().GetClassRef(
-            env, "chip/devicecontroller/ChipStructs$OperationalCredentialsClusterNOCStruct", NOCStructStructClass_1);
+        jmethodID NOCStructStructCtor_1;
+        static chip::JniCachedConstructor NOCStructStructCtorCache_1(
+            "chip/devicecontroller/ChipStructs$OperationalCredentialsClusterNOCStruct", "([B[BLjava/lang/Integer;)V");
+        err = NOCStructStructCtorCache_1.Get(env, NOCStructStructClass_1, NOCStructStructCtor_1);
         if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(Zcl, "Could not find class ChipStructs$OperationalCredentialsClusterNOCStruct");
-            return;
-        }
-        jmethodID NOCStructStructCtor_1 = env->GetMethodID(NOCStructStructClass_1, "<init>", "([B[BLjava/lang/Integer;)V");
-        if (NOCStructStructCtor_1 == nullptr)
         {
             ChipLogError(Zcl, "Could not find ChipStructs$OperationalCredentialsClusterNOCStruct constructor");
             return;
@@ -12821,17 +12754,12 @@ void CHIPOperationalCredentialsFabricsAttributeCallback::CallbackFn(
                                                                       entry_0.fabricIndex, newElement_0_fabricIndex);
 
         jclass fabricDescriptorStructClass_1;
-        err = chip::JniReferences::GetInstance().GetClassRef(
-            env, "chip/devicecontroller/ChipStructs$OperationalCredentialsClusterFabricDescriptor", fabricDescriptorStructClass_1);
+        jmethodID fabricDescriptorStructCtor_1;
+        static chip::JniCachedConstructor fabricDescriptorStructCtorCache_1(
+            "chip/devicecontroller/ChipStructs$OperationalCredentialsClusterFabricDescriptor",
+            "([BLjava/lang/Integer;Ljava/lang/Long;Ljava/lang/Long;Ljava/lang/String;Ljava/lang/Integer;)V");
+        err = fabricDescriptorStructCtorCache_1.Get(env, fabricDescriptorStructClass_1, fabricDescriptorStructCtor_1);
         if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(Zcl, "Could not find class ChipStructs$OperationalCredentialsClusterFabricDescriptor");
-            return;
-        }
-        jmethodID fabricDescriptorStructCtor_1 =
-            env->GetMethodID(fabricDescriptorStructClass_1, "<init>",
-                             "([BLjava/lang/Integer;Ljava/lang/Long;Ljava/lang/Long;Ljava/lang/String;Ljava/lang/Integer;)V");
-        if (fabricDescriptorStructCtor_1 == nullptr)
         {
             ChipLogError(Zcl, "Could not find ChipStructs$OperationalCredentialsClusterFabricDescriptor constructor");
             return;
@@ -13214,16 +13142,12 @@ void CHIPGroupKeyManagementGroupKeyMapAttributeCallback::CallbackFn(
                                                                       entry_0.fabricIndex, newElement_0_fabricIndex);
 
         jclass groupKeyMapStructStructClass_1;
-        err = chip::JniReferences::GetInstance().GetClassRef(
-            env, "chip/devicecontroller/ChipStructs$GroupKeyManagementClusterGroupKeyMapStruct", groupKeyMapStructStructClass_1);
+        jmethodID groupKeyMapStructStructCtor_1;
+        static chip::JniCachedConstructor groupKeyMapStructStructCtorCache_1(
+            "chip/devicecontroller/ChipStructs$GroupKeyManagementClusterGroupKeyMapStruct",
+            "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;)V");
+        err = groupKeyMapStructStructCtorCache_1.Get(env, groupKeyMapStructStructClass_1, groupKeyMapStructStructCtor_1);
         if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(Zcl, "Could not find class ChipStructs$GroupKeyManagementClusterGroupKeyMapStruct");
-            return;
-        }
-        jmethodID groupKeyMapStructStructCtor_1 = env->GetMethodID(groupKeyMapStructStructClass_1, "<init>",
-                                                                   "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/Integer;)V");
-        if (groupKeyMapStructStructCtor_1 == nullptr)
         {
             ChipLogError(Zcl, "Could not find ChipStructs$GroupKeyManagementClusterGroupKeyMapStruct constructor");
             return;
@@ -13340,17 +13264,12 @@ void CHIPGroupKeyManagementGroupTableAttributeCallback::CallbackFn(
                                                                       entry_0.fabricIndex, newElement_0_fabricIndex);
 
         jclass groupInfoMapStructStructClass_1;
-        err = chip::JniReferences::GetInstance().GetClassRef(
-            env, "chip/devicecontroller/ChipStructs$GroupKeyManagementClusterGroupInfoMapStruct", groupInfoMapStructStructClass_1);
+        jmethodID groupInfoMapStructStructCtor_1;
+        static chip::JniCachedConstructor groupInfoMapStructStructCtorCache_1(
+            "chip/devicecontroller/ChipStructs$GroupKeyManagementClusterGroupInfoMapStruct",
+            "(Ljava/lang/Integer;Ljava/util/ArrayList;Ljava/util/Optional;Ljava/lang/Integer;)V");
+        err = groupInfoMapStructStructCtorCache_1.Get(env, groupInfoMapStructStructClass_1, groupInfoMapStructStructCtor_1);
         if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(Zcl, "Could not find class ChipStructs$GroupKeyManagementClusterGroupInfoMapStruct");
-            return;
-        }
-        jmethodID groupInfoMapStructStructCtor_1 =
-            env->GetMethodID(groupInfoMapStructStructClass_1, "<init>",
-                             "(Ljava/lang/Integer;Ljava/util/ArrayList;Ljava/util/Optional;Ljava/lang/Integer;)V");
-        if (groupInfoMapStructStructCtor_1 == nullptr)
         {
             ChipLogError(Zcl, "Could not find ChipStructs$GroupKeyManagementClusterGroupInfoMapStruct constructor");
             return;
@@ -13643,16 +13562,11 @@ void CHIPFixedLabelLabelListAttributeCallback::CallbackFn(
         newElement_0_value = env->NewStringUTF(std::string(entry_0.value.data(), entry_0.value.size()).c_str());
 
         jclass labelStructStructClass_1;
-        err = chip::JniReferences::GetInstance().GetClassRef(env, "chip/devicecontroller/ChipStructs$FixedLabelClusterLabelStruct",
-                                                             labelStructStructClass_1);
+        jmethodID labelStructStructCtor_1;
+        static chip::JniCachedConstructor labelStructStructCtorCache_1(
+            "chip/devicecontroller/ChipStructs$FixedLabelClusterLabelStruct", "(Ljava/lang/String;Ljava/lang/String;)V");
+        err = labelStructStructCtorCache_1.Get(env, labelStructStructClass_1, labelStructStructCtor_1);
         if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(Zcl, "Could not find class ChipStructs$FixedLabelClusterLabelStruct");
-            return;
-        }
-        jmethodID labelStructStructCtor_1 =
-            env->GetMethodID(labelStructStructClass_1, "<init>", "(Ljava/lang/String;Ljava/lang/String;)V");
-        if (labelStructStructCtor_1 == nullptr)
         {
             ChipLogError(Zcl, "Could not find ChipStructs$FixedLabelClusterLabelStruct constructor");
             return;
@@ -13942,16 +13856,11 @@ void CHIPUserLabelLabelListAttributeCallback::CallbackFn(
         newElement_0_value = env->NewStringUTF(std::string(entry_0.value.data(), entry_0.value.size()).c_str());
 
         jclass labelStructStructClass_1;
-        err = chip::JniReferences::GetInstance().GetClassRef(env, "chip/devicecontroller/ChipStructs$UserLabelClusterLabelStruct",
-                                                             labelStructStructClass_1);
+        jmethodID labelStructStructCtor_1;
+        static chip::JniCachedConstructor labelStructStructCtorCache_1(
+            "chip/devicecontroller/ChipStructs$UserLabelClusterLabelStruct", "(Ljava/lang/String;Ljava/lang/String;)V");
+        err = labelStructStructCtorCache_1.Get(env, labelStructStructClass_1, labelStructStructCtor_1);
         if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(Zcl, "Could not find class ChipStructs$UserLabelClusterLabelStruct");
-            return;
-        }
-        jmethodID labelStructStructCtor_1 =
-            env->GetMethodID(labelStructStructClass_1, "<init>", "(Ljava/lang/String;Ljava/lang/String;)V");
-        if (labelStructStructCtor_1 == nullptr)
         {
             ChipLogError(Zcl, "Could not find ChipStructs$UserLabelClusterLabelStruct constructor");
             return;
@@ -14474,16 +14383,11 @@ void CHIPModeSelectSupportedModesAttributeCallback::CallbackFn(
                 newElement_2_valueClassName.c_str(), newElement_2_valueCtorSignature.c_str(), entry_2.value, newElement_2_value);
 
             jclass semanticTagStructClass_3;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipStructs$ModeSelectClusterSemanticTag", semanticTagStructClass_3);
+            jmethodID semanticTagStructCtor_3;
+            static chip::JniCachedConstructor semanticTagStructCtorCache_3(
+                "chip/devicecontroller/ChipStructs$ModeSelectClusterSemanticTag", "(Ljava/lang/Integer;Ljava/lang/Integer;)V");
+            err = semanticTagStructCtorCache_3.Get(env, semanticTagStructClass_3, semanticTagStructCtor_3);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipStructs$ModeSelectClusterSemanticTag");
-                return;
-            }
-            jmethodID semanticTagStructCtor_3 =
-                env->GetMethodID(semanticTagStructClass_3, "<init>", "(Ljava/lang/Integer;Ljava/lang/Integer;)V");
-            if (semanticTagStructCtor_3 == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipStructs$ModeSelectClusterSemanticTag constructor");
                 return;
@@ -14495,16 +14399,12 @@ void CHIPModeSelectSupportedModesAttributeCallback::CallbackFn(
         }
 
         jclass modeOptionStructStructClass_1;
-        err = chip::JniReferences::GetInstance().GetClassRef(
-            env, "chip/devicecontroller/ChipStructs$ModeSelectClusterModeOptionStruct", modeOptionStructStructClass_1);
+        jmethodID modeOptionStructStructCtor_1;
+        static chip::JniCachedConstructor modeOptionStructStructCtorCache_1(
+            "chip/devicecontroller/ChipStructs$ModeSelectClusterModeOptionStruct",
+            "(Ljava/lang/String;Ljava/lang/Integer;Ljava/util/ArrayList;)V");
+        err = modeOptionStructStructCtorCache_1.Get(env, modeOptionStructStructClass_1, modeOptionStructStructCtor_1);
         if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(Zcl, "Could not find class ChipStructs$ModeSelectClusterModeOptionStruct");
-            return;
-        }
-        jmethodID modeOptionStructStructCtor_1 = env->GetMethodID(modeOptionStructStructClass_1, "<init>",
-                                                                  "(Ljava/lang/String;Ljava/lang/Integer;Ljava/util/ArrayList;)V");
-        if (modeOptionStructStructCtor_1 == nullptr)
         {
             ChipLogError(Zcl, "Could not find ChipStructs$ModeSelectClusterModeOptionStruct constructor");
             return;
@@ -22379,17 +22279,12 @@ void CHIPChannelChannelListAttributeCallback::CallbackFn(
         }
 
         jclass channelInfoStructClass_1;
-        err = chip::JniReferences::GetInstance().GetClassRef(env, "chip/devicecontroller/ChipStructs$ChannelClusterChannelInfo",
-                                                             channelInfoStructClass_1);
-        if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(Zcl, "Could not find class ChipStructs$ChannelClusterChannelInfo");
-            return;
-        }
-        jmethodID channelInfoStructCtor_1 = env->GetMethodID(
-            channelInfoStructClass_1, "<init>",
+        jmethodID channelInfoStructCtor_1;
+        static chip::JniCachedConstructor channelInfoStructCtorCache_1(
+            "chip/devicecontroller/ChipStructs$ChannelClusterChannelInfo",
             "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/util/Optional;Ljava/util/Optional;Ljava/util/Optional;)V");
-        if (channelInfoStructCtor_1 == nullptr)
+        err = channelInfoStructCtorCache_1.Get(env, channelInfoStructClass_1, channelInfoStructCtor_1);
+        if (err != CHIP_NO_ERROR)
         {
             ChipLogError(Zcl, "Could not find ChipStructs$ChannelClusterChannelInfo constructor");
             return;
@@ -22687,16 +22582,11 @@ void CHIPTargetNavigatorTargetListAttributeCallback::CallbackFn(
         newElement_0_name = env->NewStringUTF(std::string(entry_0.name.data(), entry_0.name.size()).c_str());
 
         jclass targetInfoStructClass_1;
-        err = chip::JniReferences::GetInstance().GetClassRef(
-            env, "chip/devicecontroller/ChipStructs$TargetNavigatorClusterTargetInfo", targetInfoStructClass_1);
+        jmethodID targetInfoStructCtor_1;
+        static chip::JniCachedConstructor targetInfoStructCtorCache_1(
+            "chip/devicecontroller/ChipStructs$TargetNavigatorClusterTargetInfo", "(Ljava/lang/Integer;Ljava/lang/String;)V");
+        err = targetInfoStructCtorCache_1.Get(env, targetInfoStructClass_1, targetInfoStructCtor_1);
         if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(Zcl, "Could not find class ChipStructs$TargetNavigatorClusterTargetInfo");
-            return;
-        }
-        jmethodID targetInfoStructCtor_1 =
-            env->GetMethodID(targetInfoStructClass_1, "<init>", "(Ljava/lang/Integer;Ljava/lang/String;)V");
-        if (targetInfoStructCtor_1 == nullptr)
         {
             ChipLogError(Zcl, "Could not find ChipStructs$TargetNavigatorClusterTargetInfo constructor");
             return;
@@ -23474,16 +23364,12 @@ void CHIPMediaInputInputListAttributeCallback::CallbackFn(
         newElement_0_description = env->NewStringUTF(std::string(entry_0.description.data(), entry_0.description.size()).c_str());
 
         jclass inputInfoStructClass_1;
-        err = chip::JniReferences::GetInstance().GetClassRef(env, "chip/devicecontroller/ChipStructs$MediaInputClusterInputInfo",
-                                                             inputInfoStructClass_1);
+        jmethodID inputInfoStructCtor_1;
+        static chip::JniCachedConstructor inputInfoStructCtorCache_1(
+            "chip/devicecontroller/ChipStructs$MediaInputClusterInputInfo",
+            "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/String;Ljava/lang/String;)V");
+        err = inputInfoStructCtorCache_1.Get(env, inputInfoStructClass_1, inputInfoStructCtor_1);
         if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(Zcl, "Could not find class ChipStructs$MediaInputClusterInputInfo");
-            return;
-        }
-        jmethodID inputInfoStructCtor_1 = env->GetMethodID(
-            inputInfoStructClass_1, "<init>", "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/String;Ljava/lang/String;)V");
-        if (inputInfoStructCtor_1 == nullptr)
         {
             ChipLogError(Zcl, "Could not find ChipStructs$MediaInputClusterInputInfo constructor");
             return;
@@ -24486,16 +24372,12 @@ void CHIPAudioOutputOutputListAttributeCallback::CallbackFn(
         newElement_0_name = env->NewStringUTF(std::string(entry_0.name.data(), entry_0.name.size()).c_str());
 
         jclass outputInfoStructClass_1;
-        err = chip::JniReferences::GetInstance().GetClassRef(env, "chip/devicecontroller/ChipStructs$AudioOutputClusterOutputInfo",
-                                                             outputInfoStructClass_1);
+        jmethodID outputInfoStructCtor_1;
+        static chip::JniCachedConstructor outputInfoStructCtorCache_1(
+            "chip/devicecontroller/ChipStructs$AudioOutputClusterOutputInfo",
+            "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/String;)V");
+        err = outputInfoStructCtorCache_1.Get(env, outputInfoStructClass_1, outputInfoStructCtor_1);
         if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(Zcl, "Could not find class ChipStructs$AudioOutputClusterOutputInfo");
-            return;
-        }
-        jmethodID outputInfoStructCtor_1 =
-            env->GetMethodID(outputInfoStructClass_1, "<init>", "(Ljava/lang/Integer;Ljava/lang/Integer;Ljava/lang/String;)V");
-        if (outputInfoStructCtor_1 == nullptr)
         {
             ChipLogError(Zcl, "Could not find ChipStructs$AudioOutputClusterOutputInfo constructor");
             return;
@@ -25986,16 +25868,11 @@ void CHIPTestClusterListStructOctetStringAttributeCallback::CallbackFn(
         newElement_0_member2 = newElement_0_member2ByteArray;
 
         jclass testListStructOctetStructClass_1;
-        err = chip::JniReferences::GetInstance().GetClassRef(
-            env, "chip/devicecontroller/ChipStructs$TestClusterClusterTestListStructOctet", testListStructOctetStructClass_1);
+        jmethodID testListStructOctetStructCtor_1;
+        static chip::JniCachedConstructor testListStructOctetStructCtorCache_1(
+            "chip/devicecontroller/ChipStructs$TestClusterClusterTestListStructOctet", "(Ljava/lang/Long;[B)V");
+        err = testListStructOctetStructCtorCache_1.Get(env, testListStructOctetStructClass_1, testListStructOctetStructCtor_1);
         if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(Zcl, "Could not find class ChipStructs$TestClusterClusterTestListStructOctet");
-            return;
-        }
-        jmethodID testListStructOctetStructCtor_1 =
-            env->GetMethodID(testListStructOctetStructClass_1, "<init>", "(Ljava/lang/Long;[B)V");
-        if (testListStructOctetStructCtor_1 == nullptr)
         {
             ChipLogError(Zcl, "Could not find ChipStructs$TestClusterClusterTestListStructOctet constructor");
             return;
@@ -26282,18 +26159,13 @@ void CHIPTestClusterListNullablesAndOptionalsStructAttributeCallback::CallbackFn
                 entry_0.nullableStruct.Value().h, newElement_0_nullableStruct_h);
 
             jclass simpleStructStructClass_3;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct", simpleStructStructClass_3);
+            jmethodID simpleStructStructCtor_3;
+            static chip::JniCachedConstructor simpleStructStructCtorCache_3(
+                "chip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct",
+                "(Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Integer;[BLjava/lang/String;Ljava/lang/Integer;Ljava/lang/Float;"
+                "Ljava/lang/Double;)V");
+            err = simpleStructStructCtorCache_3.Get(env, simpleStructStructClass_3, simpleStructStructCtor_3);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipStructs$TestClusterClusterSimpleStruct");
-                return;
-            }
-            jmethodID simpleStructStructCtor_3 =
-                env->GetMethodID(simpleStructStructClass_3, "<init>",
-                                 "(Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Integer;[BLjava/lang/String;Ljava/lang/"
-                                 "Integer;Ljava/lang/Float;Ljava/lang/Double;)V");
-            if (simpleStructStructCtor_3 == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipStructs$TestClusterClusterSimpleStruct constructor");
                 return;
@@ -26366,18 +26238,13 @@ void CHIPTestClusterListNullablesAndOptionalsStructAttributeCallback::CallbackFn
                 newElement_0_optionalStructInsideOptional_h);
 
             jclass simpleStructStructClass_3;
-            err = chip::JniReferences::GetInstance().GetClassRef(
-                env, "chip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct", simpleStructStructClass_3);
+            jmethodID simpleStructStructCtor_3;
+            static chip::JniCachedConstructor simpleStructStructCtorCache_3(
+                "chip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct",
+                "(Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Integer;[BLjava/lang/String;Ljava/lang/Integer;Ljava/lang/Float;"
+                "Ljava/lang/Double;)V");
+            err = simpleStructStructCtorCache_3.Get(env, simpleStructStructClass_3, simpleStructStructCtor_3);
             if (err != CHIP_NO_ERROR)
-            {
-                ChipLogError(Zcl, "Could not find class ChipStructs$TestClusterClusterSimpleStruct");
-                return;
-            }
-            jmethodID simpleStructStructCtor_3 =
-                env->GetMethodID(simpleStructStructClass_3, "<init>",
-                                 "(Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Integer;[BLjava/lang/String;Ljava/lang/"
-                                 "Integer;Ljava/lang/Float;Ljava/lang/Double;)V");
-            if (simpleStructStructCtor_3 == nullptr)
             {
                 ChipLogError(Zcl, "Could not find ChipStructs$TestClusterClusterSimpleStruct constructor");
                 return;
@@ -26463,18 +26330,13 @@ void CHIPTestClusterListNullablesAndOptionalsStructAttributeCallback::CallbackFn
                     entry_0.nullableOptionalStruct.Value().Value().h, newElement_0_nullableOptionalStructInsideOptional_h);
 
                 jclass simpleStructStructClass_4;
-                err = chip::JniReferences::GetInstance().GetClassRef(
-                    env, "chip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct", simpleStructStructClass_4);
+                jmethodID simpleStructStructCtor_4;
+                static chip::JniCachedConstructor simpleStructStructCtorCache_4(
+                    "chip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct",
+                    "(Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Integer;[BLjava/lang/String;Ljava/lang/Integer;Ljava/lang/"
+                    "Float;Ljava/lang/Double;)V");
+                err = simpleStructStructCtorCache_4.Get(env, simpleStructStructClass_4, simpleStructStructCtor_4);
                 if (err != CHIP_NO_ERROR)
-                {
-                    ChipLogError(Zcl, "Could not find class ChipStructs$TestClusterClusterSimpleStruct");
-                    return;
-                }
-                jmethodID simpleStructStructCtor_4 =
-                    env->GetMethodID(simpleStructStructClass_4, "<init>",
-                                     "(Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Integer;[BLjava/lang/String;Ljava/lang/"
-                                     "Integer;Ljava/lang/Float;Ljava/lang/Double;)V");
-                if (simpleStructStructCtor_4 == nullptr)
                 {
                     ChipLogError(Zcl, "Could not find ChipStructs$TestClusterClusterSimpleStruct constructor");
                     return;
@@ -26568,20 +26430,15 @@ void CHIPTestClusterListNullablesAndOptionalsStructAttributeCallback::CallbackFn
         }
 
         jclass nullablesAndOptionalsStructStructClass_1;
-        err = chip::JniReferences::GetInstance().GetClassRef(
-            env, "chip/devicecontroller/ChipStructs$TestClusterClusterNullablesAndOptionalsStruct",
-            nullablesAndOptionalsStructStructClass_1);
+        jmethodID nullablesAndOptionalsStructStructCtor_1;
+        static chip::JniCachedConstructor nullablesAndOptionalsStructStructCtorCache_1(
+            "chip/devicecontroller/ChipStructs$TestClusterClusterNullablesAndOptionalsStruct",
+            "(Ljava/lang/Integer;Ljava/util/Optional;Ljava/util/Optional;Ljava/lang/String;Ljava/util/Optional;Ljava/util/Optional;"
+            "Lchip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct;Ljava/util/Optional;Ljava/util/Optional;Ljava/util/"
+            "ArrayList;Ljava/util/Optional;Ljava/util/Optional;)V");
+        err = nullablesAndOptionalsStructStructCtorCache_1.Get(
+            env, nullablesAndOptionalsStructStructClass_1, nullablesAndOptionalsStructStructCtor_1);
         if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(Zcl, "Could not find class ChipStructs$TestClusterClusterNullablesAndOptionalsStruct");
-            return;
-        }
-        jmethodID nullablesAndOptionalsStructStructCtor_1 =
-            env->GetMethodID(nullablesAndOptionalsStructStructClass_1, "<init>",
-                             "(Ljava/lang/Integer;Ljava/util/Optional;Ljava/util/Optional;Ljava/lang/String;Ljava/util/"
-                             "Optional;Ljava/util/Optional;Lchip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct;Ljava/"
-                             "util/Optional;Ljava/util/Optional;Ljava/util/ArrayList;Ljava/util/Optional;Ljava/util/Optional;)V");
-        if (nullablesAndOptionalsStructStructCtor_1 == nullptr)
         {
             ChipLogError(Zcl, "Could not find ChipStructs$TestClusterClusterNullablesAndOptionalsStruct constructor");
             return;
@@ -26845,18 +26702,13 @@ void CHIPTestClusterListFabricScopedAttributeCallback::CallbackFn(
             entry_0.fabricSensitiveStruct.h, newElement_0_fabricSensitiveStruct_h);
 
         jclass simpleStructStructClass_2;
-        err = chip::JniReferences::GetInstance().GetClassRef(
-            env, "chip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct", simpleStructStructClass_2);
+        jmethodID simpleStructStructCtor_2;
+        static chip::JniCachedConstructor simpleStructStructCtorCache_2(
+            "chip/devicecontroller/ChipStructs$TestClusterClusterSimpleStruct",
+            "(Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Integer;[BLjava/lang/String;Ljava/lang/Integer;Ljava/lang/Float;"
+            "Ljava/lang/Double;)V");
+        err = simpleStructStructCtorCache_2.Get(env, simpleStructStructClass_2, simpleStructStructCtor_2);
         if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(Zcl, "Could not find class ChipStructs$TestClusterClusterSimpleStruct");
-            return;
-        }
-        jmethodID simpleStructStructCtor_2 =
-            env->GetMethodID(simpleStructStructClass_2, "<init>",
-                             "(Ljava/lang/Integer;Ljava/lang/Boolean;Ljava/lang/Integer;[BLjava/lang/String;Ljava/lang/"
-                             "Integer;Ljava/lang/Float;Ljava/lang/Double;)V");
-        if (simpleStructStructCtor_2 == nullptr)
         {
             ChipLogError(Zcl, "Could not find ChipStructs$TestClusterClusterSimpleStruct constructor");
             return;
@@ -26889,18 +26741,13 @@ void CHIPTestClusterListFabricScopedAttributeCallback::CallbackFn(
                                                                       entry_0.fabricIndex, newElement_0_fabricIndex);
 
         jclass testFabricScopedStructClass_1;
-        err = chip::JniReferences::GetInstance().GetClassRef(
-            env, "chip/devicecontroller/ChipStructs$TestClusterClusterTestFabricScoped", testFabricScopedStructClass_1);
-        if (err != CHIP_NO_ERROR)
-        {
-            ChipLogError(Zcl, "Could not find class ChipStructs$TestClusterClusterTestFabricScoped");
-            return;
-        }
-        jmethodID testFabricScopedStructCtor_1 = env->GetMethodID(
-            testFabricScopedStructClass_1, "<init>",
+        jmethodID testFabricScopedStructCtor_1;
+        static chip::JniCachedConstructor testFabricScopedStructCtorCache_1(
+            "chip/devicecontroller/ChipStructs$TestClusterClusterTestFabricScoped",
             "(Ljava/lang/Integer;Ljava/util/Optional;Ljava/lang/Integer;Ljava/util/Optional;Ljava/lang/String;Lchip/"
             "devicecontroller/ChipStructs$TestClusterClusterSimpleStruct;Ljava/util/ArrayList;Ljava/lang/Integer;)V");
-        if (testFabricScopedStructCtor_1 == nullptr)
+        err = testFabricScopedStructCtorCache_1.Get(env, testFabricScopedStructClass_1, testFabricScopedStructCtor_1);
+        if (err != CHIP_NO_ERROR)
         {
             ChipLogError(Zcl, "Could not find ChipStructs$TestClusterClusterTestFabricScoped constructor");
             return;
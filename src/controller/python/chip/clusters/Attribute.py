@@ -650,24 +650,46 @@ class AsyncReadTransaction:
 
     def handleAttributeData(self, path: AttributePathWithListIndex, dataVersion: int, status: int, data: bytes):
         try:
-            imStatus = status
+            self._handleAttributeValue(path, dataVersion, status, lambda: chip.tlv.TLVReader(data).get().get("Any", {}))
+        except Exception as ex:
+            logging.exception(ex)
+
+    def handleAttributeBatch(self, data: bytes):
+        ''' Handles all the attributes of a report, pickled by the native side as a list of
+            (endpoint, cluster, attribute, dataVersion, status, value, tlv) tuples. The value is
+            already decoded, unless it could not be, in which case the TLV is passed instead.
+        '''
+        try:
+            records = chip.tlv.loadPickledValues(data)
+        except Exception as ex:
+            logging.exception(ex)
+            return
+
+        for endpoint, cluster, attribute, dataVersion, status, value, tlv in records:
+            path = AttributePath(EndpointId=endpoint, ClusterId=cluster, AttributeId=attribute)
+            if tlv is not None:
+                self.handleAttributeData(path, dataVersion, status, tlv)
+                continue
             try:
-                imStatus = chip.interaction_model.Status(status)
-            except:
-                pass
+                self._handleAttributeValue(path, dataVersion, status, lambda: value)
+            except Exception as ex:
+                logging.exception(ex)
 
-            if (imStatus != chip.interaction_model.Status.Success):
-                attributeValue = ValueDecodeFailure(
-                    None, chip.interaction_model.InteractionModelError(imStatus))
-            else:
-                tlvData = chip.tlv.TLVReader(data).get().get("Any", {})
-                attributeValue = tlvData
+    def _handleAttributeValue(self, path: AttributePath, dataVersion: int, status: int, decode: Callable[[], Any]):
+        imStatus = status
+        try:
+            imStatus = chip.interaction_model.Status(status)
+        except:
+            pass
 
-            self._cache.UpdateTLV(path, dataVersion, attributeValue)
-            self._changedPathSet.add(path)
+        if (imStatus != chip.interaction_model.Status.Success):
+            attributeValue = ValueDecodeFailure(
+                None, chip.interaction_model.InteractionModelError(imStatus))
+        else:
+            attributeValue = decode()
 
-        except Exception as ex:
-            logging.exception(ex)
+        self._cache.UpdateTLV(path, dataVersion, attributeValue)
+        self._changedPathSet.add(path)
 
     def handleEventData(self, header: EventHeader, path: EventPath, data: bytes, status: int):
         try:
@@ -827,6 +849,8 @@ class AsyncWriteTransaction:
 
 _OnReadAttributeDataCallbackFunct = CFUNCTYPE(
     None, py_object, c_uint32, c_uint16, c_uint32, c_uint32, c_uint8, c_void_p, c_size_t)
+_OnReadAttributeBatchCallbackFunct = CFUNCTYPE(
+    None, py_object, c_void_p, c_size_t)
 _OnSubscriptionEstablishedCallbackFunct = CFUNCTYPE(None, py_object, c_uint32)
 _OnResubscriptionAttemptedCallbackFunct = CFUNCTYPE(None, py_object, c_uint32, c_uint32)
 _OnReadEventDataCallbackFunct = CFUNCTYPE(
@@ -848,6 +872,11 @@ def _OnReadAttributeDataCallback(closure, dataVersion: int, endpoint: int, clust
         EndpointId=endpoint, ClusterId=cluster, AttributeId=attribute), dataVersion, status, dataBytes[:])
 
 
+@_OnReadAttributeBatchCallbackFunct
+def _OnReadAttributeBatchCallback(closure, data, len):
+    closure.handleAttributeBatch(ctypes.string_at(data, len))
+
+
 @_OnReadEventDataCallbackFunct
 def _OnReadEventDataCallback(closure, endpoint: int, cluster: int, event: c_uint64, number: int, priority: int, timestamp: int, timestampType: int, data, len, status):
     dataBytes = ctypes.string_at(data, len)
@@ -948,10 +977,11 @@ _ReadParams = construct.Struct(
     "IsSubscription" / construct.Flag,
     "IsFabricFiltered" / construct.Flag,
     "KeepSubscriptions" / construct.Flag,
+    "BatchReports" / construct.Flag,
 )
 
 
-def Read(future: Future, eventLoop, device, devCtrl, attributes: List[AttributePath] = None, dataVersionFilters: List[DataVersionFilter] = None, events: List[EventPath] = None, returnClusterObject: bool = True, subscriptionParameters: SubscriptionParameters = None, fabricFiltered: bool = True, keepSubscriptions: bool = False) -> int:
+def Read(future: Future, eventLoop, device, devCtrl, attributes: List[AttributePath] = None, dataVersionFilters: List[DataVersionFilter] = None, events: List[EventPath] = None, returnClusterObject: bool = True, subscriptionParameters: SubscriptionParameters = None, fabricFiltered: bool = True, keepSubscriptions: bool = False, batchReports: bool = False) -> int:
     if (not attributes) and dataVersionFilters:
         raise ValueError(
             "Must provide valid attribute list when data version filters is not null")
@@ -1033,6 +1063,7 @@ def Read(future: Future, eventLoop, device, devCtrl, attributes: List[AttributeP
         params.IsSubscription = True
         params.KeepSubscriptions = keepSubscriptions
     params.IsFabricFiltered = fabricFiltered
+    params.BatchReports = batchReports
     params = _ReadParams.build(params)
 
     res = builtins.chipStack.Call(
@@ -1076,13 +1107,13 @@ def Init():
                    _OnWriteResponseCallbackFunct, _OnWriteErrorCallbackFunct, _OnWriteDoneCallbackFunct])
         handle.pychip_ReadClient_Read.restype = c_uint32
         setter.Set('pychip_ReadClient_InitCallbacks', None, [
-                   _OnReadAttributeDataCallbackFunct, _OnReadEventDataCallbackFunct, _OnSubscriptionEstablishedCallbackFunct, _OnResubscriptionAttemptedCallbackFunct, _OnReadErrorCallbackFunct, _OnReadDoneCallbackFunct,
+                   _OnReadAttributeDataCallbackFunct, _OnReadAttributeBatchCallbackFunct, _OnReadEventDataCallbackFunct, _OnSubscriptionEstablishedCallbackFunct, _OnResubscriptionAttemptedCallbackFunct, _OnReadErrorCallbackFunct, _OnReadDoneCallbackFunct,
                    _OnReportBeginCallbackFunct, _OnReportEndCallbackFunct])
 
     handle.pychip_WriteClient_InitCallbacks(
         _OnWriteResponseCallback, _OnWriteErrorCallback, _OnWriteDoneCallback)
     handle.pychip_ReadClient_InitCallbacks(
-        _OnReadAttributeDataCallback, _OnReadEventDataCallback, _OnSubscriptionEstablishedCallback, _OnResubscriptionAttemptedCallback, _OnReadErrorCallback, _OnReadDoneCallback,
+        _OnReadAttributeDataCallback, _OnReadAttributeBatchCallback, _OnReadEventDataCallback, _OnSubscriptionEstablishedCallback, _OnResubscriptionAttemptedCallback, _OnReadErrorCallback, _OnReadDoneCallback,
         _OnReportBeginCallback, _OnReportEndCallback)
 
     _BuildAttributeIndex()
@@ -0,0 +1,405 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "PickleWriter.h"
+
+#include <lib/support/CodeUtils.h>
+
+#include <cstring>
+#include <limits>
+
+namespace chip {
+namespace python {
+
+namespace {
+
+// Opcodes of the pickle protocol, see Lib/pickletools.py in CPython.
+constexpr uint8_t kProto          = 0x80;
+constexpr uint8_t kProtocol       = 3;
+constexpr uint8_t kStop           = '.';
+constexpr uint8_t kMark           = '(';
+constexpr uint8_t kNone           = 'N';
+constexpr uint8_t kNewTrue        = 0x88;
+constexpr uint8_t kNewFalse       = 0x89;
+constexpr uint8_t kBinInt1        = 'K';
+constexpr uint8_t kBinInt2        = 'M';
+constexpr uint8_t kBinInt         = 'J';
+constexpr uint8_t kLong1          = 0x8a;
+constexpr uint8_t kBinFloat       = 'G';
+constexpr uint8_t kShortBinBytes  = 'C';
+constexpr uint8_t kBinBytes       = 'B';
+constexpr uint8_t kBinUnicode     = 'X';
+constexpr uint8_t kEmptyList      = ']';
+constexpr uint8_t kAppends        = 'e';
+constexpr uint8_t kEmptyDict      = '}';
+constexpr uint8_t kSetItems       = 'u';
+constexpr uint8_t kTuple          = 't';
+constexpr uint8_t kTuple1         = 0x85;
+constexpr uint8_t kTuple2         = 0x86;
+constexpr uint8_t kGlobal         = 'c';
+constexpr uint8_t kReduce         = 'R';
+constexpr uint8_t kBinPut         = 'q';
+constexpr uint8_t kBinGet         = 'h';
+constexpr const char kTlvModule[] = "chip.tlv";
+
+// Whether Python decodes the string as UTF-8, which rejects overlong
+// encodings, surrogates and code points above U+10FFFF.
+bool IsValidUtf8(const uint8_t * data, size_t length)
+{
+    size_t i = 0;
+    while (i < length)
+    {
+        uint8_t byte = data[i];
+        if (byte < 0x80)
+        {
+            i++;
+            continue;
+        }
+
+        size_t count;
+        uint32_t codePoint;
+        uint32_t minimum;
+        if ((byte & 0xE0) == 0xC0)
+        {
+            count     = 1;
+            codePoint = byte & 0x1F;
+            minimum   = 0x80;
+        }
+        else if ((byte & 0xF0) == 0xE0)
+        {
+            count     = 2;
+            codePoint = byte & 0x0F;
+            minimum   = 0x800;
+        }
+        else if ((byte & 0xF8) == 0xF0)
+        {
+            count     = 3;
+            codePoint = byte & 0x07;
+            minimum   = 0x10000;
+        }
+        else
+        {
+            return false;
+        }
+
+        VerifyOrReturnError(length - i > count, false);
+        for (size_t j = 1; j <= count; j++)
+        {
+            VerifyOrReturnError((data[i + j] & 0xC0) == 0x80, false);
+            codePoint = (codePoint << 6) | (data[i + j] & 0x3F);
+        }
+        VerifyOrReturnError(codePoint >= minimum && codePoint <= 0x10FFFF, false);
+        VerifyOrReturnError(codePoint < 0xD800 || codePoint > 0xDFFF, false);
+        i += count + 1;
+    }
+    return true;
+}
+
+} // namespace
+
+void PickleWriter::Reset()
+{
+    mBuffer.clear();
+    for (size_t & offset : mMemoOffsets)
+    {
+        offset = 0;
+    }
+    PutOpcode(kProto);
+    PutOpcode(kProtocol);
+}
+
+void PickleWriter::Truncate(size_t size)
+{
+    mBuffer.resize(size);
+    for (size_t & offset : mMemoOffsets)
+    {
+        if (offset >= size)
+        {
+            offset = 0;
+        }
+    }
+}
+
+void PickleWriter::Finish()
+{
+    PutOpcode(kStop);
+}
+
+void PickleWriter::PutLittleEndian(uint64_t value, size_t length)
+{
+    for (size_t i = 0; i < length; i++)
+    {
+        mBuffer.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+void PickleWriter::PutNone()
+{
+    PutOpcode(kNone);
+}
+
+void PickleWriter::PutBool(bool value)
+{
+    PutOpcode(value ? kNewTrue : kNewFalse);
+}
+
+void PickleWriter::PutInt(int64_t value)
+{
+    if (value >= 0 && value <= std::numeric_limits<uint8_t>::max())
+    {
+        PutOpcode(kBinInt1);
+        PutLittleEndian(static_cast<uint64_t>(value), 1);
+    }
+    else if (value >= 0 && value <= std::numeric_limits<uint16_t>::max())
+    {
+        PutOpcode(kBinInt2);
+        PutLittleEndian(static_cast<uint64_t>(value), 2);
+    }
+    else if (value >= std::numeric_limits<int32_t>::min() && value <= std::numeric_limits<int32_t>::max())
+    {
+        PutOpcode(kBinInt);
+        PutLittleEndian(static_cast<uint64_t>(value), 4);
+    }
+    else
+    {
+        // Two's complement, little endian
+        PutOpcode(kLong1);
+        PutOpcode(8);
+        PutLittleEndian(static_cast<uint64_t>(value), 8);
+    }
+}
+
+void PickleWriter::PutUInt(uint64_t value)
+{
+    if (value <= static_cast<uint64_t>(std::numeric_limits<int64_t>::max()))
+    {
+        PutInt(static_cast<int64_t>(value));
+        return;
+    }
+
+    // An extra zero byte keeps the two's complement value positive.
+    PutOpcode(kLong1);
+    PutOpcode(9);
+    PutLittleEndian(value, 8);
+    PutOpcode(0);
+}
+
+void PickleWriter::PutBytes(const uint8_t * data, size_t length)
+{
+    if (length <= std::numeric_limits<uint8_t>::max())
+    {
+        PutOpcode(kShortBinBytes);
+        PutLittleEndian(length, 1);
+    }
+    else
+    {
+        PutOpcode(kBinBytes);
+        PutLittleEndian(length, 4);
+    }
+    mBuffer.insert(mBuffer.end(), data, data + length);
+}
+
+void PickleWriter::PutString(const char * data, size_t length)
+{
+    PutOpcode(kBinUnicode);
+    PutLittleEndian(length, 4);
+    mBuffer.insert(mBuffer.end(), data, data + length);
+}
+
+void PickleWriter::StartList()
+{
+    PutOpcode(kEmptyList);
+    PutOpcode(kMark);
+}
+
+void PickleWriter::EndList()
+{
+    PutOpcode(kAppends);
+}
+
+void PickleWriter::StartTuple()
+{
+    PutOpcode(kMark);
+}
+
+void PickleWriter::EndTuple()
+{
+    PutOpcode(kTuple);
+}
+
+void PickleWriter::StartDict()
+{
+    PutOpcode(kEmptyDict);
+    PutOpcode(kMark);
+}
+
+void PickleWriter::EndDict()
+{
+    PutOpcode(kSetItems);
+}
+
+void PickleWriter::PutGlobal(const char * module, const char * name)
+{
+    PutOpcode(kGlobal);
+    mBuffer.insert(mBuffer.end(), module, module + strlen(module));
+    PutOpcode('\n');
+    mBuffer.insert(mBuffer.end(), name, name + strlen(name));
+    PutOpcode('\n');
+}
+
+void PickleWriter::PutTlvType(const char * name, uint8_t memoIndex)
+{
+    // The type is looked up once per stream, then fetched from the memo.
+    if (mMemoOffsets[memoIndex] != 0)
+    {
+        PutOpcode(kBinGet);
+        PutOpcode(memoIndex);
+        return;
+    }
+    PutGlobal(kTlvModule, name);
+    mMemoOffsets[memoIndex] = mBuffer.size();
+    PutOpcode(kBinPut);
+    PutOpcode(memoIndex);
+}
+
+void PickleWriter::PutTag(TLV::Tag tag)
+{
+    if (TLV::IsContextTag(tag))
+    {
+        PutInt(TLV::TagNumFromTag(tag));
+        return;
+    }
+
+    // Profile tags are keyed by a (profile, tag) tuple, as in chip.tlv.
+    PutUInt(TLV::ProfileIdFromTag(tag));
+    PutUInt(TLV::TagNumFromTag(tag));
+    PutOpcode(kTuple2);
+}
+
+CHIP_ERROR PickleWriter::PutTLVContainer(TLV::TLVReader & reader, bool isDict)
+{
+    TLV::TLVType containerType;
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+
+    isDict ? StartDict() : StartList();
+    CHIP_ERROR err;
+    while ((err = reader.Next()) == CHIP_NO_ERROR)
+    {
+        if (isDict)
+        {
+            TLV::Tag tag = reader.GetTag();
+            if (tag == TLV::AnonymousTag())
+            {
+                PutString("Any", 3);
+            }
+            else
+            {
+                PutTag(tag);
+            }
+        }
+        ReturnErrorOnFailure(PutTLV(reader));
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+    isDict ? EndDict() : EndList();
+
+    return reader.ExitContainer(containerType);
+}
+
+CHIP_ERROR PickleWriter::PutTLV(TLV::TLVReader & reader)
+{
+    switch (reader.GetType())
+    {
+    case TLV::kTLVType_SignedInteger: {
+        int64_t value;
+        ReturnErrorOnFailure(reader.Get(value));
+        PutInt(value);
+        break;
+    }
+    case TLV::kTLVType_UnsignedInteger: {
+        uint64_t value;
+        ReturnErrorOnFailure(reader.Get(value));
+        PutTlvType("uint", kUIntMemo);
+        PutUInt(value);
+        PutOpcode(kTuple1);
+        PutOpcode(kReduce);
+        break;
+    }
+    case TLV::kTLVType_Boolean: {
+        bool value;
+        ReturnErrorOnFailure(reader.Get(value));
+        PutBool(value);
+        break;
+    }
+    case TLV::kTLVType_FloatingPointNumber: {
+        double value;
+        ReturnErrorOnFailure(reader.Get(value));
+        bool isFloat32 = (reader.GetControlByte() & TLV::kTLVTypeMask) ==
+            static_cast<uint8_t>(TLV::TLVElementType::FloatingPointNumber32);
+        if (isFloat32)
+        {
+            PutTlvType("float32", kFloat32Memo);
+        }
+        uint64_t bits;
+        static_assert(sizeof(bits) == sizeof(value), "Unexpected double size");
+        memcpy(&bits, &value, sizeof(bits));
+        PutOpcode(kBinFloat);
+        for (size_t i = sizeof(bits); i > 0; i--)
+        {
+            // Big endian
+            PutOpcode(static_cast<uint8_t>(bits >> (8 * (i - 1))));
+        }
+        if (isFloat32)
+        {
+            PutOpcode(kTuple1);
+            PutOpcode(kReduce);
+        }
+        break;
+    }
+    case TLV::kTLVType_UTF8String:
+    case TLV::kTLVType_ByteString: {
+        const uint8_t * data = nullptr;
+        uint32_t length      = reader.GetLength();
+        if (length > 0)
+        {
+            ReturnErrorOnFailure(reader.GetDataPtr(data));
+        }
+        if (reader.GetType() == TLV::kTLVType_UTF8String && IsValidUtf8(data, length))
+        {
+            PutString(reinterpret_cast<const char *>(data), length);
+        }
+        else
+        {
+            PutBytes(data, length);
+        }
+        break;
+    }
+    case TLV::kTLVType_Null:
+        PutNone();
+        break;
+    case TLV::kTLVType_Structure:
+        return PutTLVContainer(reader, true);
+    case TLV::kTLVType_Array:
+    case TLV::kTLVType_List:
+        return PutTLVContainer(reader, false);
+    default:
+        return CHIP_ERROR_WRONG_TLV_TYPE;
+    }
+    return CHIP_NO_ERROR;
+}
+
+} // namespace python
+} // namespace chip
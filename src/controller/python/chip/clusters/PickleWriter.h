@@ -0,0 +1,98 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/CHIPTLV.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace chip {
+namespace python {
+
+/**
+ * Writes Python objects as a pickle stream (protocol 3), so that the Python
+ * side builds them all with a single call to chip.tlv.loadPickledValues(),
+ * whose unpickler is implemented in C, instead of decoding TLV in Python.
+ * That unpickler only resolves the chip.tlv types below, so the stream must
+ * not reference any other global.
+ *
+ * TLV elements are written as chip.tlv.TLVReader decodes them: structures as
+ * dicts keyed by tag, arrays and lists as lists, unsigned integers as
+ * chip.tlv.uint, single precision floats as chip.tlv.float32, and UTF-8
+ * strings that are not valid UTF-8 as bytes.
+ */
+class PickleWriter
+{
+public:
+    // Starts a new stream.
+    void Reset();
+    // Ends the stream, which can then be read until the next Reset().
+    void Finish();
+
+    const uint8_t * Data() const { return mBuffer.data(); }
+    size_t Size() const { return mBuffer.size(); }
+
+    // Truncates the stream to a size previously returned by Size(), to drop
+    // what was written since then.
+    void Truncate(size_t size);
+
+    void PutNone();
+    void PutBool(bool value);
+    void PutInt(int64_t value);
+    void PutUInt(uint64_t value);
+    void PutBytes(const uint8_t * data, size_t length);
+    void PutString(const char * data, size_t length);
+
+    // Containers: the elements of a list, tuple or dict (as key, value
+    // pairs) are written between the Start and End calls.
+    void StartList();
+    void EndList();
+    void StartTuple();
+    void EndTuple();
+    void StartDict();
+    void EndDict();
+
+    /**
+     * Writes the TLV element the reader is positioned on.  On error, the
+     * stream is left with a partially written element, which the caller can
+     * drop with Truncate().
+     */
+    CHIP_ERROR PutTLV(TLV::TLVReader & reader);
+
+private:
+    void PutOpcode(uint8_t opcode) { mBuffer.push_back(opcode); }
+    void PutLittleEndian(uint64_t value, size_t length);
+    void PutGlobal(const char * module, const char * name);
+    void PutTlvType(const char * name, uint8_t memoIndex);
+    void PutTag(TLV::Tag tag);
+    CHIP_ERROR PutTLVContainer(TLV::TLVReader & reader, bool isDict);
+
+    static constexpr uint8_t kUIntMemo    = 0;
+    static constexpr uint8_t kFloat32Memo = 1;
+    static constexpr size_t kMemoCount    = 2;
+
+    std::vector<uint8_t> mBuffer;
+    // Offsets in the stream at which the chip.tlv types were memoized, or 0.
+    size_t mMemoOffsets[kMemoCount] = {};
+};
+
+} // namespace python
+} // namespace chip
@@ -26,6 +26,7 @@
 #include <app/InteractionModelEngine.h>
 #include <app/ReadClient.h>
 #include <app/WriteClient.h>
+#include <controller/python/chip/clusters/PickleWriter.h>
 #include <lib/support/CodeUtils.h>
 
 #include <cstdio>
@@ -69,6 +70,7 @@ using OnReadAttributeDataCallback       = void (*)(PyObject * appContext, chip::
                                              chip::ClusterId clusterId, chip::AttributeId attributeId,
                                              std::underlying_type_t<Protocols::InteractionModel::Status> imstatus, uint8_t * data,
                                              uint32_t dataLen);
+using OnReadAttributeBatchCallback      = void (*)(PyObject * appContext, const uint8_t * data, size_t dataLen);
 using OnReadEventDataCallback           = void (*)(PyObject * appContext, chip::EndpointId endpointId, chip::ClusterId clusterId,
                                          chip::EventId eventId, chip::EventNumber eventNumber, uint8_t priority, uint64_t timestamp,
                                          uint8_t timestampType, uint8_t * data, uint32_t dataLen,
@@ -82,6 +84,7 @@ using OnReportBeginCallback             = void (*)(PyObject * appContext);
 using OnReportEndCallback               = void (*)(PyObject * appContext);
 
 OnReadAttributeDataCallback gOnReadAttributeDataCallback             = nullptr;
+OnReadAttributeBatchCallback gOnReadAttributeBatchCallback           = nullptr;
 OnReadEventDataCallback gOnReadEventDataCallback                     = nullptr;
 OnSubscriptionEstablishedCallback gOnSubscriptionEstablishedCallback = nullptr;
 OnResubscriptionAttemptedCallback gOnResubscriptionAttemptedCallback = nullptr;
@@ -98,7 +101,9 @@ void PythonResubscribePolicy(uint32_t aNumCumulativeRetries, uint32_t & aNextSub
 class ReadClientCallback : public ReadClient::Callback
 {
 public:
-    ReadClientCallback(PyObject * appContext) : mBufferedReadCallback(*this), mAppContext(appContext) {}
+    ReadClientCallback(PyObject * appContext, bool batchReports) :
+        mBufferedReadCallback(*this), mAppContext(appContext), mBatchReports(batchReports)
+    {}
 
     app::BufferedReadCallback * GetBufferedReadCallback() { return &mBufferedReadCallback; }
 
@@ -109,25 +114,25 @@ public:
         // callback. If we do, that's a bug.
         //
         VerifyOrDie(!aPath.IsListItemOperation());
-        size_t bufferLen                  = (apData == nullptr ? 0 : apData->GetRemainingLength() + apData->GetLengthRead());
-        std::unique_ptr<uint8_t[]> buffer = std::unique_ptr<uint8_t[]>(apData == nullptr ? nullptr : new uint8_t[bufferLen]);
-        uint32_t size                     = 0;
+
+        if (mBatchReports)
+        {
+            AddToReport(aPath, apData, aStatus);
+            return;
+        }
+
+        std::unique_ptr<uint8_t[]> buffer;
+        uint32_t size = 0;
         // When the apData is nullptr, means we did not receive a valid attribute data from server, status will be some error
         // status.
         if (apData != nullptr)
         {
-            // The TLVReader's read head is not pointing to the first element in the container instead of the container itself, use
-            // a TLVWriter to get a TLV with a normalized TLV buffer (Wrapped with a anonymous tag, no extra "end of container" tag
-            // at the end.)
-            TLV::TLVWriter writer;
-            writer.Init(buffer.get(), bufferLen);
-            CHIP_ERROR err = writer.CopyElement(TLV::AnonymousTag(), *apData);
+            CHIP_ERROR err = CopyAttributeData(*apData, buffer, size);
             if (err != CHIP_NO_ERROR)
             {
                 this->OnError(err);
                 return;
             }
-            size = writer.GetLengthWritten();
         }
 
         DataVersion version = 0;
@@ -194,7 +199,16 @@ public:
 
     void OnError(CHIP_ERROR aError) override { gOnReadErrorCallback(mAppContext, aError.AsInteger()); }
 
-    void OnReportBegin() override { gOnReportBeginCallback(mAppContext); }
+    void OnReportBegin() override
+    {
+        if (mBatchReports)
+        {
+            mReport.Reset();
+            mReport.StartList();
+            mReportAttributeCount = 0;
+        }
+        gOnReportBeginCallback(mAppContext);
+    }
     void OnDeallocatePaths(chip::app::ReadPrepareParams && aReadPrepareParams) override
     {
         if (aReadPrepareParams.mpAttributePathParamsList != nullptr)
@@ -213,7 +227,16 @@ public:
         }
     }
 
-    void OnReportEnd() override { gOnReportEndCallback(mAppContext); }
+    void OnReportEnd() override
+    {
+        if (mBatchReports && mReportAttributeCount > 0)
+        {
+            mReport.EndList();
+            mReport.Finish();
+            gOnReadAttributeBatchCallback(mAppContext, mReport.Data(), mReport.Size());
+        }
+        gOnReportEndCallback(mAppContext);
+    }
 
     void OnDone(ReadClient *) override
     {
@@ -225,10 +248,84 @@ public:
     void AdoptReadClient(std::unique_ptr<ReadClient> apReadClient) { mReadClient = std::move(apReadClient); }
 
 private:
+    static CHIP_ERROR CopyAttributeData(const TLV::TLVReader & aData, std::unique_ptr<uint8_t[]> & aBuffer, uint32_t & aSize)
+    {
+        size_t bufferLen = aData.GetRemainingLength() + aData.GetLengthRead();
+        aBuffer          = std::unique_ptr<uint8_t[]>(new uint8_t[bufferLen]);
+
+        // The TLVReader's read head is not pointing to the first element in the container instead of the container itself, use
+        // a TLVWriter to get a TLV with a normalized TLV buffer (Wrapped with a anonymous tag, no extra "end of container" tag
+        // at the end.)
+        TLV::TLVReader reader;
+        reader.Init(aData);
+        TLV::TLVWriter writer;
+        writer.Init(aBuffer.get(), bufferLen);
+        ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), reader));
+        aSize = writer.GetLengthWritten();
+        return CHIP_NO_ERROR;
+    }
+
+    /**
+     * Adds the attribute to the report passed to Python at its end, as an
+     * (endpoint, cluster, attribute, version, status, value, tlv) tuple.  The
+     * value is decoded here, the TLV is only passed, as bytes, for the values
+     * that cannot be.
+     */
+    void AddToReport(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData, const StatusIB & aStatus)
+    {
+        size_t recordStart = mReport.Size();
+        mReport.StartTuple();
+        mReport.PutUInt(aPath.mEndpointId);
+        mReport.PutUInt(aPath.mClusterId);
+        mReport.PutUInt(aPath.mAttributeId);
+        mReport.PutUInt(aPath.mDataVersion.ValueOr(0));
+        mReport.PutUInt(to_underlying(aStatus.mStatus));
+        if (apData == nullptr)
+        {
+            mReport.StartDict();
+            mReport.EndDict();
+            mReport.PutNone();
+        }
+        else
+        {
+            TLV::TLVReader reader;
+            reader.Init(*apData);
+            size_t valueStart = mReport.Size();
+            if (mReport.PutTLV(reader) == CHIP_NO_ERROR)
+            {
+                mReport.PutNone();
+            }
+            else
+            {
+                mReport.Truncate(valueStart);
+                mReport.PutNone();
+
+                std::unique_ptr<uint8_t[]> buffer;
+                uint32_t size  = 0;
+                CHIP_ERROR err = CopyAttributeData(*apData, buffer, size);
+                if (err != CHIP_NO_ERROR)
+                {
+                    mReport.Truncate(recordStart);
+                    this->OnError(err);
+                    return;
+                }
+                mReport.PutBytes(buffer.get(), size);
+            }
+        }
+        mReport.EndTuple();
+        mReportAttributeCount++;
+    }
+
     BufferedReadCallback mBufferedReadCallback;
 
     PyObject * mAppContext;
 
+    // Whether the attributes of each report are passed to Python at once, at
+    // the end of the report.
+    bool mBatchReports;
+    PickleWriter mReport;
+    size_t mReportAttributeCount = 0;
+
     std::unique_ptr<ReadClient> mReadClient;
 };
 
@@ -241,6 +338,7 @@ struct __attribute__((packed)) PyReadAttributeParams
     bool isSubscription;
     bool isFabricFiltered;
     bool keepSubscriptions;
+    bool batchReports;
 };
 
 // Encodes n attribute write requests, follows 3 * n arguments, in the (AttributeWritePath*=void *, uint8_t*, size_t) order.
@@ -307,6 +405,7 @@ void pychip_WriteClient_InitCallbacks(OnWriteResponseCallback onWriteResponseCal
 }
 
 void pychip_ReadClient_InitCallbacks(OnReadAttributeDataCallback onReadAttributeDataCallback,
+                                     OnReadAttributeBatchCallback onReadAttributeBatchCallback,
                                      OnReadEventDataCallback onReadEventDataCallback,
                                      OnSubscriptionEstablishedCallback onSubscriptionEstablishedCallback,
                                      OnResubscriptionAttemptedCallback onResubscriptionAttemptedCallback,
@@ -314,6 +413,7 @@ void pychip_ReadClient_InitCallbacks(OnReadAttributeDataCallback onReadAttribute
                                      OnReportBeginCallback onReportBeginCallback, OnReportEndCallback onReportEndCallback)
 {
     gOnReadAttributeDataCallback       = onReadAttributeDataCallback;
+    gOnReadAttributeBatchCallback      = onReadAttributeBatchCallback;
     gOnReadEventDataCallback           = onReadEventDataCallback;
     gOnSubscriptionEstablishedCallback = onSubscriptionEstablishedCallback;
     gOnResubscriptionAttemptedCallback = onResubscriptionAttemptedCallback;
@@ -400,7 +500,7 @@ chip::ChipError::StorageType pychip_ReadClient_Read(void * appContext, ReadClien
     // The readParamsBuf might be not aligned, using a memcpy to avoid some unexpected behaviors.
     memcpy(&pyParams, readParamsBuf, sizeof(pyParams));
 
-    std::unique_ptr<ReadClientCallback> callback = std::make_unique<ReadClientCallback>(appContext);
+    std::unique_ptr<ReadClientCallback> callback = std::make_unique<ReadClientCallback>(appContext, pyParams.batchReports);
 
     va_list args;
     va_start(args, numEventPaths);
@@ -28,6 +28,8 @@
 from __future__ import absolute_import
 from __future__ import print_function
 
+import io
+import pickle
 import struct
 from collections import OrderedDict
 from collections.abc import Mapping, Sequence
@@ -691,6 +693,36 @@ class TLVReader(object):
                     raise ValueError("Attempt to decode unsupported TLV tag")
 
 
+class _ValuesUnpickler(pickle.Unpickler):
+    ''' Unpickler for the values transcoded from TLV by the native PickleWriter.
+
+        The values come from the device, so the only classes the stream may reference are
+        the chip.tlv types PickleWriter emits. Anything else is rejected instead of being
+        imported and called.
+    '''
+    _allowedClasses = {
+        "uint": uint,
+        "float32": float32,
+    }
+
+    def find_class(self, module, name):
+        if module == "chip.tlv" and name in self._allowedClasses:
+            return self._allowedClasses[name]
+        raise pickle.UnpicklingError(
+            "global '%s.%s' is not allowed in TLV values" % (module, name))
+
+    def persistent_load(self, pid):
+        raise pickle.UnpicklingError("persistent ids are not allowed in TLV values")
+
+
+def loadPickledValues(data):
+    ''' Loads a pickle stream written by the native PickleWriter.
+
+        Raises pickle.UnpicklingError if the stream references anything but the chip.tlv types.
+    '''
+    return _ValuesUnpickler(io.BytesIO(data)).load()
+
+
 def tlvTagToSortKey(tag):
     if tag is None:
         return -1
@@ -564,6 +564,37 @@ class ClusterObjectTests:
                 res = await cls._RetryForContent(request=lambda: devCtrl.Read(nodeid=NODE_ID, attributes=attributes[1], events=events[1]), until=lambda res: res != 0)
                 VerifyDecodeSuccess(res.attributes)
 
+    @classmethod
+    @base.test_case
+    async def TestBatchedReports(cls, devCtrl):
+        req = ['*']
+
+        logger.info("1: Reading E* C* A* one attribute at a time")
+        start = time.time()
+        res = await devCtrl.ReadAttribute(nodeid=NODE_ID, attributes=req)
+        logger.info(f"Read {sum(len(c) for c in res.values())} clusters in {time.time() - start:.3f}s")
+
+        logger.info("2: Reading E* C* A* in batches")
+        start = time.time()
+        batchedRes = await devCtrl.ReadAttribute(nodeid=NODE_ID, attributes=req, batchReports=True)
+        logger.info(f"Read {sum(len(c) for c in batchedRes.values())} clusters in {time.time() - start:.3f}s")
+        VerifyDecodeSuccess(batchedRes)
+
+        # Values such as counters may change between reads, so only compare the
+        # paths, and the values of clusters that do not change.
+        for endpoint in res:
+            for cluster in res[endpoint]:
+                if res[endpoint][cluster].keys() != batchedRes[endpoint][cluster].keys():
+                    raise AssertionError(f"Unexpected attributes for endpoint {endpoint}, cluster {cluster}")
+            if res[endpoint][Clusters.Descriptor] != batchedRes[endpoint][Clusters.Descriptor]:
+                raise AssertionError(f"Unexpected Descriptor cluster for endpoint {endpoint}")
+        if res.keys() != batchedRes.keys():
+            raise AssertionError("Unexpected endpoints")
+
+        logger.info("3: Reading E* C* A* in batches as cluster objects")
+        res = await devCtrl.ReadAttribute(nodeid=NODE_ID, attributes=req, returnClusterObject=True, batchReports=True)
+        logger.info(f"Basic Cluster - Label: {res[0][Clusters.Basic].productLabel}")
+
     @classmethod
     async def RunTest(cls, devCtrl):
         try:
@@ -578,6 +609,7 @@ class ClusterObjectTests:
             await cls.TestSubscribeZeroMinInterval(devCtrl)
             await cls.TestSubscribeAttribute(devCtrl)
             await cls.TestMixedReadAttributeAndEvents(devCtrl)
+            await cls.TestBatchedReports(devCtrl)
             # Note: Write will change some attribute values, always put it after read tests
             await cls.TestWriteRequest(devCtrl)
             await cls.TestTimedRequest(devCtrl)
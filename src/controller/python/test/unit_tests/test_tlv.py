@@ -18,7 +18,10 @@
 
 from chip.tlv import TLVWriter, TLVReader
 from chip.tlv import uint as tlvUint
+from chip.tlv import float32 as tlvFloat32
+from chip.tlv import loadPickledValues
 
+import pickle
 import unittest
 
 
@@ -149,5 +152,45 @@ class TestTLVReader(unittest.TestCase):
         self._read_case([0b00000100, 0xab], tlvUint(0xab))
 
 
+class TestPickledValues(unittest.TestCase):
+    # Protocol 3 header, as written by the native PickleWriter.
+    _header = b'\x80\x03'
+
+    def test_tlv_types(self):
+        # [uint(5), float32(1.5)], built with GLOBAL and REDUCE as PickleWriter does.
+        data = (self._header + b']('
+                + b'cchip.tlv\nuint\nq\x00K\x05\x85R'
+                + b'cchip.tlv\nfloat32\nq\x01G\x3f\xf8\x00\x00\x00\x00\x00\x00\x85R'
+                + b'h\x00K\x07\x85R'
+                + b'e.')
+        values = loadPickledValues(data)
+        self.assertEqual(values, [5, 1.5, 7])
+        self.assertIsInstance(values[0], tlvUint)
+        self.assertIsInstance(values[1], tlvFloat32)
+        self.assertIsInstance(values[2], tlvUint)
+
+    def test_reject_other_globals(self):
+        # os.system('true'): a stream that would run a command if the global was resolved.
+        data = self._header + b'cos\nsystem\nX\x04\x00\x00\x00true\x85R.'
+        with self.assertRaises(pickle.UnpicklingError):
+            loadPickledValues(data)
+
+        # Only the exact chip.tlv types are allowed, not the rest of the module.
+        data = self._header + b'cchip.tlv\nTLVReader\nN\x85R.'
+        with self.assertRaises(pickle.UnpicklingError):
+            loadPickledValues(data)
+
+        data = self._header + b'cbuiltins\neval\nX\x01\x00\x00\x001\x85R.'
+        with self.assertRaises(pickle.UnpicklingError):
+            loadPickledValues(data)
+
+    def test_reject_stack_global(self):
+        # Protocol 4 STACK_GLOBAL goes through find_class too.
+        data = (b'\x80\x04' + b'\x8c\x02os\x8c\x06system\x93'
+                + b'\x8c\x04true\x85R.')
+        with self.assertRaises(pickle.UnpicklingError):
+            loadPickledValues(data)
+
+
 if __name__ == '__main__':
     unittest.main()
@@ -42,6 +42,7 @@
 #include <messaging/tests/MessagingContext.h>
 #include <nlunit-test.h>
 #include <utility>
+#include <vector>
 
 using TestContext = chip::Test::AppContext;
 using namespace chip;
@@ -0,0 +1,298 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app-common/zap-generated/ids/Clusters.h>
+#include <app/AttributeAccessInterface.h>
+#include <app/InteractionModelEngine.h>
+#include <app/tests/AppTestContext.h>
+#include <app/util/DataModelHandler.h>
+#include <app/util/attribute-storage.h>
+#include <controller/ReadInteraction.h>
+#include <controller/ShardRouter.h>
+#include <lib/support/UnitTestContext.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+using TestContext = chip::Test::AppContext;
+
+using namespace chip;
+using namespace chip::app::Clusters;
+using namespace chip::Controller;
+
+namespace {
+
+constexpr uint32_t kNodeCount               = 10000;
+constexpr CompressedFabricId kFabricId      = 0x1122334455667788ULL;
+constexpr CompressedFabricId kOtherFabricId = 0x8877665544332211ULL;
+
+PeerId NodeAt(uint32_t index, CompressedFabricId fabricId = kFabricId)
+{
+    return PeerId().SetCompressedFabricId(fabricId).SetNodeId(0x1000 + index);
+}
+
+//
+// The generated endpoint_config for the controller app has Endpoint 1
+// already used in the fixed endpoint set of size 1. Consequently, let's use the next
+// number higher than that for our dynamic test endpoint.
+//
+constexpr EndpointId kTestEndpointId  = 2;
+constexpr AttributeId kTestAttributeId = 1;
+
+// clang-format off
+DECLARE_DYNAMIC_ATTRIBUTE_LIST_BEGIN(testClusterAttrs)
+DECLARE_DYNAMIC_ATTRIBUTE(kTestAttributeId, INT32U, 4, 0), DECLARE_DYNAMIC_ATTRIBUTE_LIST_END();
+
+DECLARE_DYNAMIC_CLUSTER_LIST_BEGIN(testEndpointClusters)
+DECLARE_DYNAMIC_CLUSTER(TestCluster::Id, testClusterAttrs, nullptr, nullptr), DECLARE_DYNAMIC_CLUSTER_LIST_END;
+
+DECLARE_DYNAMIC_ENDPOINT(testEndpoint, testEndpointClusters);
+// clang-format on
+
+// Counts the reads the server answers, and answers each one with its rank.
+class CountingAttrAccess : public app::AttributeAccessInterface
+{
+public:
+    CountingAttrAccess() : AttributeAccessInterface(MakeOptional(kTestEndpointId), TestCluster::Id)
+    {
+        registerAttributeAccessOverride(this);
+    }
+
+    CHIP_ERROR Read(const app::ConcreteReadAttributePath & aPath, app::AttributeValueEncoder & aEncoder) override
+    {
+        return aEncoder.Encode(++mReadCount);
+    }
+
+    uint32_t mReadCount = 0;
+};
+
+CountingAttrAccess gAttrAccess;
+
+void TestInit(nlTestSuite * inSuite, void * inContext)
+{
+    ShardRouter router;
+
+    NL_TEST_ASSERT(inSuite, router.GetShardCount() == 1);
+    NL_TEST_ASSERT(inSuite, router.GetShard(NodeAt(0)) == 0);
+
+    NL_TEST_ASSERT(inSuite, router.Init(0) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, router.Init(ShardRouter::kMaxShardCount + 1) == CHIP_ERROR_INVALID_ARGUMENT);
+    NL_TEST_ASSERT(inSuite, router.Init(4, ShardRouter::Partitioning::kByNode, UINT16_MAX - 2) == CHIP_ERROR_INVALID_ARGUMENT);
+
+    NL_TEST_ASSERT(inSuite, router.Init(4) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, router.GetShardCount() == 4);
+    NL_TEST_ASSERT(inSuite, router.GetListenPort(3) == 0);
+
+    NL_TEST_ASSERT(inSuite, router.Init(4, ShardRouter::Partitioning::kByNode, 5540) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, router.GetListenPort(0) == 5540);
+    NL_TEST_ASSERT(inSuite, router.GetListenPort(3) == 5543);
+}
+
+void TestBalance(nlTestSuite * inSuite, void * inContext)
+{
+    ShardRouter router;
+
+    for (uint8_t shardCount = 1; shardCount <= 16; shardCount++)
+    {
+        uint32_t nodesPerShard[16] = {};
+
+        NL_TEST_ASSERT(inSuite, router.Init(shardCount) == CHIP_NO_ERROR);
+        for (uint32_t i = 0; i < kNodeCount; i++)
+        {
+            uint8_t shard = router.GetShard(NodeAt(i));
+            NL_TEST_ASSERT(inSuite, shard < shardCount);
+            NL_TEST_ASSERT(inSuite, router.IsManagedBy(NodeAt(i), shard));
+            nodesPerShard[shard]++;
+        }
+
+        // Every shard gets its fair share of nodes within 15%
+        uint32_t fairShare = kNodeCount / shardCount;
+        for (uint8_t shard = 0; shard < shardCount; shard++)
+        {
+            NL_TEST_ASSERT(inSuite, nodesPerShard[shard] * 100 >= fairShare * 85);
+            NL_TEST_ASSERT(inSuite, nodesPerShard[shard] * 100 <= fairShare * 115);
+        }
+    }
+}
+
+void TestGrowthMovesFewNodes(nlTestSuite * inSuite, void * inContext)
+{
+    ShardRouter before;
+    ShardRouter after;
+
+    for (uint8_t shardCount = 1; shardCount < 16; shardCount++)
+    {
+        uint32_t moved = 0;
+
+        NL_TEST_ASSERT(inSuite, before.Init(shardCount) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, after.Init(static_cast<uint8_t>(shardCount + 1)) == CHIP_NO_ERROR);
+        for (uint32_t i = 0; i < kNodeCount; i++)
+        {
+            uint8_t oldShard = before.GetShard(NodeAt(i));
+            uint8_t newShard = after.GetShard(NodeAt(i));
+            if (oldShard != newShard)
+            {
+                // Nodes only ever move to the new shard
+                NL_TEST_ASSERT(inSuite, newShard == shardCount);
+                moved++;
+            }
+        }
+
+        // About 1/(N+1) of the nodes move
+        uint32_t expected = kNodeCount / (shardCount + 1u);
+        NL_TEST_ASSERT(inSuite, moved * 100 >= expected * 85);
+        NL_TEST_ASSERT(inSuite, moved * 100 <= expected * 115);
+    }
+}
+
+void TestFabricPartitioning(nlTestSuite * inSuite, void * inContext)
+{
+    ShardRouter router;
+    uint32_t fabricsPerShard[8] = {};
+
+    NL_TEST_ASSERT(inSuite, router.Init(8, ShardRouter::Partitioning::kByFabric) == CHIP_NO_ERROR);
+
+    uint8_t fabricShard = router.GetShard(NodeAt(0));
+    for (uint32_t i = 1; i < kNodeCount; i++)
+    {
+        NL_TEST_ASSERT(inSuite, router.GetShard(NodeAt(i)) == fabricShard);
+    }
+
+    // Fabrics themselves are spread over the shards
+    for (uint32_t fabric = 0; fabric < 800; fabric++)
+    {
+        fabricsPerShard[router.GetShard(NodeAt(0, kOtherFabricId + fabric))]++;
+    }
+    for (uint32_t count : fabricsPerShard)
+    {
+        NL_TEST_ASSERT(inSuite, count >= 60 && count <= 140);
+    }
+
+    // The same node id on another fabric is an unrelated node
+    NL_TEST_ASSERT(inSuite, router.Init(8) == CHIP_NO_ERROR);
+    uint32_t sameShard = 0;
+    for (uint32_t i = 0; i < kNodeCount; i++)
+    {
+        sameShard += router.GetShard(NodeAt(i)) == router.GetShard(NodeAt(i, kOtherFabricId)) ? 1 : 0;
+    }
+    NL_TEST_ASSERT(inSuite, sameShard < kNodeCount / 4);
+}
+
+// Every shard controller of a fleet runs with the same router configuration and only talks to the nodes of its own
+// shard. The loopback peer stands in for all the nodes: each shard reads the attribute of every node it manages
+// over a real session, and each node must be read by exactly one shard.
+void TestShardedReads(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *static_cast<TestContext *>(inContext);
+
+    constexpr uint8_t kShardCount     = 4;
+    constexpr uint32_t kFleetNodeCount = 64;
+
+    InitDataModelHandler(&ctx.GetExchangeManager());
+
+    DataVersion dataVersionStorage[ArraySize(testEndpointClusters)];
+    emberAfSetDynamicEndpoint(0, kTestEndpointId, &testEndpoint, Span<DataVersion>(dataVersionStorage));
+
+    ShardRouter routers[kShardCount];
+    uint32_t readsByShard[kShardCount]    = {};
+    uint32_t readsByNode[kFleetNodeCount] = {};
+    uint32_t numFailures                  = 0;
+    uint32_t readCountBefore              = gAttrAccess.mReadCount;
+
+    for (uint8_t shard = 0; shard < kShardCount; shard++)
+    {
+        NL_TEST_ASSERT(inSuite, routers[shard].Init(kShardCount) == CHIP_NO_ERROR);
+
+        for (uint32_t node = 0; node < kFleetNodeCount; node++)
+        {
+            if (!routers[shard].IsManagedBy(NodeAt(node), shard))
+            {
+                continue;
+            }
+
+            auto onSuccessCb = [&readsByShard, &readsByNode, shard, node](const app::ConcreteDataAttributePath & attributePath,
+                                                                           const uint32_t & dataResponse) {
+                readsByShard[shard]++;
+                readsByNode[node]++;
+            };
+            auto onFailureCb = [&numFailures](const app::ConcreteDataAttributePath * attributePath, CHIP_ERROR aError) {
+                numFailures++;
+            };
+
+            NL_TEST_ASSERT(inSuite,
+                           ReadAttribute<uint32_t>(&ctx.GetExchangeManager(), ctx.GetSessionBobToAlice(), kTestEndpointId,
+                                                   TestCluster::Id, kTestAttributeId, onSuccessCb, onFailureCb) == CHIP_NO_ERROR);
+            ctx.DrainAndServiceIO();
+        }
+    }
+
+    NL_TEST_ASSERT(inSuite, numFailures == 0);
+    NL_TEST_ASSERT(inSuite, gAttrAccess.mReadCount - readCountBefore == kFleetNodeCount);
+    for (uint32_t node = 0; node < kFleetNodeCount; node++)
+    {
+        NL_TEST_ASSERT(inSuite, readsByNode[node] == 1);
+    }
+
+    // Each shard did the reads of its share of the fleet, and no shard was left out.
+    for (uint8_t shard = 0; shard < kShardCount; shard++)
+    {
+        uint32_t managed = 0;
+        for (uint32_t node = 0; node < kFleetNodeCount; node++)
+        {
+            managed += routers[0].GetShard(NodeAt(node)) == shard ? 1 : 0;
+        }
+        NL_TEST_ASSERT(inSuite, readsByShard[shard] == managed);
+        NL_TEST_ASSERT(inSuite, managed > 0);
+    }
+
+    NL_TEST_ASSERT(inSuite, app::InteractionModelEngine::GetInstance()->GetNumActiveReadClients() == 0);
+    NL_TEST_ASSERT(inSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+
+    emberAfClearDynamicEndpoint(0);
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("TestInit", TestInit),
+    NL_TEST_DEF("TestBalance", TestBalance),
+    NL_TEST_DEF("TestGrowthMovesFewNodes", TestGrowthMovesFewNodes),
+    NL_TEST_DEF("TestFabricPartitioning", TestFabricPartitioning),
+    NL_TEST_DEF("TestShardedReads", TestShardedReads),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+// clang-format off
+nlTestSuite sSuite =
+{
+    "TestShardRouter",
+    &sTests[0],
+    TestContext::Initialize,
+    TestContext::Finalize
+};
+// clang-format on
+
+} // namespace
+
+int TestShardRouter()
+{
+    return chip::ExecuteTestsWithContext<TestContext>(&sSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestShardRouter)
@@ -20,6 +20,7 @@
 #include <lib/support/CodeUtils.h>
 #include <lib/support/DefaultStorageKeyAllocator.h>
 #include <lib/support/Pool.h>
+#include <lib/support/SafeInt.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -35,6 +36,24 @@ using GroupSession  = GroupDataProvider::GroupSession;
 
 static constexpr size_t kPersistentBufferMax = 128;
 
+template <typename Credentials>
+Credentials * GetCurrentCredentials(Credentials * operational_keys, uint8_t keys_count)
+{
+    // An epoch key update SHALL order the keys from oldest to newest,
+    // the current epoch key having the second newest time if time
+    // synchronization is not achieved or guaranteed.
+    switch (keys_count)
+    {
+    case 1:
+    case 2:
+        return &operational_keys[0];
+    case 3:
+        return &operational_keys[1];
+    default:
+        return nullptr;
+    }
+}
+
 template <size_t kMaxSerializedSize>
 struct PersistentData
 {
@@ -742,19 +761,7 @@ struct KeySetData : PersistentData<kPersistentBufferMax>
 
     Crypto::GroupOperationalCredentials * GetCurrentGroupCredentials()
     {
-        // An epoch key update SHALL order the keys from oldest to newest,
-        // the current epoch key having the second newest time if time
-        // synchronization is not achieved or guaranteed.
-        switch (this->keys_count)
-        {
-        case 1:
-        case 2:
-            return &operational_keys[0];
-        case 3:
-            return &operational_keys[1];
-        default:
-            return nullptr;
-        }
+        return GetCurrentCredentials(operational_keys, keys_count);
     }
 
     CHIP_ERROR Serialize(TLV::TLVWriter & writer) const override
@@ -895,20 +902,181 @@ void GroupDataProviderImpl::Finish()
     mKeySetIterators.ReleaseAll();
     mGroupSessionsIterator.ReleaseAll();
     mGroupKeyContexPool.ReleaseAll();
+#if CHIP_CONFIG_GROUP_DATA_INDEX
+    mFabricTables.ReleaseAll();
+#endif // CHIP_CONFIG_GROUP_DATA_INDEX
 }
 
 void GroupDataProviderImpl::SetStorageDelegate(PersistentStorageDelegate * storage)
 {
     VerifyOrDie(storage != nullptr);
     mStorage = storage;
+#if CHIP_CONFIG_GROUP_DATA_INDEX
+    mFabricTables.ReleaseAll();
+#endif // CHIP_CONFIG_GROUP_DATA_INDEX
+}
+
+void GroupDataProviderImpl::InvalidateFabricTables(FabricIndex fabric_index)
+{
+#if CHIP_CONFIG_GROUP_DATA_INDEX
+    mFabricTables.ForEachActiveObject([&](FabricTables * tables) {
+        if (tables->fabric_index == fabric_index)
+        {
+            mFabricTables.ReleaseObject(tables);
+            return Loop::Break;
+        }
+        return Loop::Continue;
+    });
+#endif // CHIP_CONFIG_GROUP_DATA_INDEX
+}
+
+#if CHIP_CONFIG_GROUP_DATA_INDEX
+
+GroupDataProviderImpl::FabricTables * GroupDataProviderImpl::GetFabricTables(FabricIndex fabric_index)
+{
+    FabricTables * found = nullptr;
+    mFabricTables.ForEachActiveObject([&](FabricTables * tables) {
+        if (tables->fabric_index == fabric_index)
+        {
+            found = tables;
+            return Loop::Break;
+        }
+        return Loop::Continue;
+    });
+    VerifyOrReturnError(nullptr == found, found);
+    VerifyOrReturnError(IsInitialized() && kUndefinedFabricIndex != fabric_index, nullptr);
+
+    found = mFabricTables.CreateObject(fabric_index);
+    VerifyOrReturnError(nullptr != found, nullptr);
+    CHIP_ERROR err = found->Load(mStorage);
+    if (CHIP_NO_ERROR != err)
+    {
+        ChipLogError(Zcl, "Failed to load the group tables of fabric %u: %" CHIP_ERROR_FORMAT, fabric_index, err.Format());
+        mFabricTables.ReleaseObject(found);
+        return nullptr;
+    }
+    return found;
+}
+
+GroupDataProviderImpl::FabricTables::~FabricTables()
+{
+    if (keyset_count > 0)
+    {
+        Crypto::ClearSecretData(reinterpret_cast<uint8_t *>(keysets.Get()), keyset_count * sizeof(KeySetEntry));
+    }
 }
 
+CHIP_ERROR GroupDataProviderImpl::FabricTables::Load(PersistentStorageDelegate * storage)
+{
+    FabricData fabric(fabric_index);
+    CHIP_ERROR err = fabric.Load(storage);
+    // A fabric without data has empty tables
+    VerifyOrReturnError(CHIP_ERROR_NOT_FOUND != err, CHIP_NO_ERROR);
+    ReturnErrorOnFailure(err);
+
+    // Groups
+    VerifyOrReturnError(0 == fabric.group_count || groups.Calloc(fabric.group_count).Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    GroupData group(fabric_index, fabric.first_group);
+    size_t total_endpoints = 0;
+    for (uint16_t i = 0; i < fabric.group_count; i++, group.group_id = group.next)
+    {
+        ReturnErrorOnFailure(group.Load(storage));
+        GroupEntry & entry = groups[i];
+        entry.group_id     = group.group_id;
+        memcpy(entry.name, group.name, sizeof(entry.name));
+        entry.first_endpoint_id = group.first_endpoint;
+        entry.first_endpoint    = static_cast<uint16_t>(total_endpoints);
+        entry.endpoint_count    = group.endpoint_count;
+        total_endpoints += group.endpoint_count;
+        VerifyOrReturnError(CanCastTo<uint16_t>(total_endpoints), CHIP_ERROR_NO_MEMORY);
+    }
+    group_count = fabric.group_count;
+
+    // Endpoints, grouped by group
+    VerifyOrReturnError(0 == total_endpoints || endpoints.Calloc(total_endpoints).Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    for (uint16_t i = 0; i < group_count; i++)
+    {
+        EndpointData endpoint(fabric_index, groups[i].group_id, groups[i].first_endpoint_id);
+        for (uint16_t j = 0; j < groups[i].endpoint_count; j++, endpoint.endpoint_id = endpoint.next)
+        {
+            ReturnErrorOnFailure(endpoint.Load(storage));
+            endpoints[groups[i].first_endpoint + j] = endpoint.endpoint_id;
+        }
+    }
+    endpoint_count = static_cast<uint16_t>(total_endpoints);
+
+    // Group-Key map
+    VerifyOrReturnError(0 == fabric.map_count || maps.Calloc(fabric.map_count).Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    KeyMapData map(fabric_index, fabric.first_map);
+    for (uint16_t i = 0; i < fabric.map_count; i++, map.id = map.next)
+    {
+        ReturnErrorOnFailure(map.Load(storage));
+        maps[i].group_id  = map.group_id;
+        maps[i].keyset_id = map.keyset_id;
+    }
+    map_count = fabric.map_count;
+
+    // Key sets
+    VerifyOrReturnError(0 == fabric.keyset_count || keysets.Calloc(fabric.keyset_count).Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+    KeySetData keyset(fabric_index, fabric.first_keyset);
+    for (uint16_t i = 0; i < fabric.keyset_count; i++, keyset.keyset_id = keyset.next)
+    {
+        // Count the entry first, so that its keys are cleared even if loading fails.
+        keyset_count = static_cast<uint16_t>(i + 1);
+        ReturnErrorOnFailure(keyset.Load(storage));
+        KeySetEntry & entry = keysets[i];
+        entry.keyset_id     = keyset.keyset_id;
+        entry.policy        = keyset.policy;
+        entry.keys_count    = keyset.keys_count;
+        memcpy(entry.operational_keys, keyset.operational_keys, sizeof(entry.operational_keys));
+    }
+    return CHIP_NO_ERROR;
+}
+
+const GroupDataProviderImpl::FabricTables::GroupEntry * GroupDataProviderImpl::FabricTables::FindGroup(GroupId group_id,
+                                                                                                      size_t hint) const
+{
+    if (hint < group_count && groups[hint].group_id == group_id)
+    {
+        return &groups[hint];
+    }
+    for (uint16_t i = 0; i < group_count; i++)
+    {
+        if (groups[i].group_id == group_id)
+        {
+            return &groups[i];
+        }
+    }
+    return nullptr;
+}
+
+GroupId GroupDataProviderImpl::FabricTables::NextGroupId(const GroupEntry * group) const
+{
+    size_t next = GroupPosition(group) + 1;
+    return (next < group_count) ? groups[next].group_id : kUndefinedGroupId;
+}
+
+const GroupDataProviderImpl::FabricTables::KeySetEntry * GroupDataProviderImpl::FabricTables::FindKeySet(KeysetId keyset_id) const
+{
+    for (uint16_t i = 0; i < keyset_count; i++)
+    {
+        if (keysets[i].keyset_id == keyset_id)
+        {
+            return &keysets[i];
+        }
+    }
+    return nullptr;
+}
+
+#endif // CHIP_CONFIG_GROUP_DATA_INDEX
+
 //
 // Group Info
 //
 
 CHIP_ERROR GroupDataProviderImpl::SetGroupInfo(chip::FabricIndex fabric_index, const GroupInfo & info)
 {
+    FabricTablesInvalidator invalidator(*this, fabric_index);
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
     FabricData fabric(fabric_index);
@@ -933,6 +1101,18 @@ CHIP_ERROR GroupDataProviderImpl::SetGroupInfo(chip::FabricIndex fabric_index, c
 
 CHIP_ERROR GroupDataProviderImpl::GetGroupInfo(chip::FabricIndex fabric_index, chip::GroupId group_id, GroupInfo & info)
 {
+#if CHIP_CONFIG_GROUP_DATA_INDEX
+    const FabricTables * tables = GetFabricTables(fabric_index);
+    if (nullptr != tables)
+    {
+        const FabricTables::GroupEntry * entry = tables->FindGroup(group_id);
+        VerifyOrReturnError(nullptr != entry, CHIP_ERROR_NOT_FOUND);
+        info.group_id = group_id;
+        info.SetName(entry->name);
+        return CHIP_NO_ERROR;
+    }
+#endif // CHIP_CONFIG_GROUP_DATA_INDEX
+
     FabricData fabric(fabric_index);
     GroupData group;
 
@@ -946,6 +1126,7 @@ CHIP_ERROR GroupDataProviderImpl::GetGroupInfo(chip::FabricIndex fabric_index, c
 
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupInfo(chip::FabricIndex fabric_index, chip::GroupId group_id)
 {
+    FabricTablesInvalidator invalidator(*this, fabric_index);
     FabricData fabric(fabric_index);
     GroupData group;
 
@@ -957,6 +1138,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupInfo(chip::FabricIndex fabric_index
 
 CHIP_ERROR GroupDataProviderImpl::SetGroupInfoAt(chip::FabricIndex fabric_index, size_t index, const GroupInfo & info)
 {
+    FabricTablesInvalidator invalidator(*this, fabric_index);
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
     FabricData fabric(fabric_index);
@@ -1025,6 +1207,17 @@ CHIP_ERROR GroupDataProviderImpl::GetGroupInfoAt(chip::FabricIndex fabric_index,
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
+#if CHIP_CONFIG_GROUP_DATA_INDEX
+    const FabricTables * tables = GetFabricTables(fabric_index);
+    if (nullptr != tables)
+    {
+        VerifyOrReturnError(index < tables->group_count, CHIP_ERROR_NOT_FOUND);
+        info.group_id = tables->groups[index].group_id;
+        info.SetName(tables->groups[index].name);
+        return CHIP_NO_ERROR;
+    }
+#endif // CHIP_CONFIG_GROUP_DATA_INDEX
+
     FabricData fabric(fabric_index);
     GroupData group;
 
@@ -1039,6 +1232,7 @@ CHIP_ERROR GroupDataProviderImpl::GetGroupInfoAt(chip::FabricIndex fabric_index,
 
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupInfoAt(chip::FabricIndex fabric_index, size_t index)
 {
+    FabricTablesInvalidator invalidator(*this, fabric_index);
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
     FabricData fabric(fabric_index);
@@ -1088,6 +1282,23 @@ bool GroupDataProviderImpl::HasEndpoint(chip::FabricIndex fabric_index, chip::Gr
 {
     VerifyOrReturnError(IsInitialized(), false);
 
+#if CHIP_CONFIG_GROUP_DATA_INDEX
+    const FabricTables * tables = GetFabricTables(fabric_index);
+    if (nullptr != tables)
+    {
+        const FabricTables::GroupEntry * group = tables->FindGroup(group_id);
+        VerifyOrReturnError(nullptr != group, false);
+        for (uint16_t i = 0; i < group->endpoint_count; i++)
+        {
+            if (tables->endpoints[group->first_endpoint + i] == endpoint_id)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+#endif // CHIP_CONFIG_GROUP_DATA_INDEX
+
     FabricData fabric(fabric_index);
     GroupData group;
     EndpointData endpoint;
@@ -1099,6 +1310,7 @@ bool GroupDataProviderImpl::HasEndpoint(chip::FabricIndex fabric_index, chip::Gr
 
 CHIP_ERROR GroupDataProviderImpl::AddEndpoint(chip::FabricIndex fabric_index, chip::GroupId group_id, chip::EndpointId endpoint_id)
 {
+    FabricTablesInvalidator invalidator(*this, fabric_index);
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
     FabricData fabric(fabric_index);
@@ -1157,6 +1369,7 @@ CHIP_ERROR GroupDataProviderImpl::AddEndpoint(chip::FabricIndex fabric_index, ch
 CHIP_ERROR GroupDataProviderImpl::RemoveEndpoint(chip::FabricIndex fabric_index, chip::GroupId group_id,
                                                  chip::EndpointId endpoint_id)
 {
+    FabricTablesInvalidator invalidator(*this, fabric_index);
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
     FabricData fabric(fabric_index);
@@ -1196,6 +1409,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoint(chip::FabricIndex fabric_index,
 
 CHIP_ERROR GroupDataProviderImpl::RemoveEndpoint(chip::FabricIndex fabric_index, chip::EndpointId endpoint_id)
 {
+    FabricTablesInvalidator invalidator(*this, fabric_index);
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
     FabricData fabric(fabric_index);
@@ -1237,6 +1451,17 @@ GroupDataProviderImpl::GroupInfoIteratorImpl::GroupInfoIteratorImpl(GroupDataPro
     mProvider(provider),
     mFabric(fabric_index)
 {
+#if CHIP_CONFIG_GROUP_DATA_INDEX
+    const FabricTables * tables = provider.GetFabricTables(fabric_index);
+    if (nullptr != tables)
+    {
+        mNextId = (tables->group_count > 0) ? tables->groups[0].group_id : kUndefinedGroupId;
+        mTotal  = tables->group_count;
+        mCount  = 0;
+        return;
+    }
+#endif // CHIP_CONFIG_GROUP_DATA_INDEX
+
     FabricData fabric(fabric_index);
     if (CHIP_NO_ERROR == fabric.Load(provider.mStorage))
     {
@@ -1255,6 +1480,23 @@ bool GroupDataProviderImpl::GroupInfoIteratorImpl::Next(GroupInfo & output)
 {
     VerifyOrReturnError(mCount < mTotal, false);
 
+#if CHIP_CONFIG_GROUP_DATA_INDEX
+    // The tables are looked up on each call, as they are dropped by any change
+    // made during the iteration, which then resumes from the next group id.
+    const FabricTables * tables = mProvider.GetFabricTables(mFabric);
+    if (nullptr != tables)
+    {
+        const FabricTables::GroupEntry * entry = tables->FindGroup(mNextId, mCount);
+        VerifyOrReturnError(nullptr != entry, false);
+
+        mCount++;
+        mNextId         = tables->NextGroupId(entry);
+        output.group_id = entry->group_id;
+        output.SetName(entry->name);
+        return true;
+    }
+#endif // CHIP_CONFIG_GROUP_DATA_INDEX
+
     GroupData group(mFabric, mNextId);
     VerifyOrReturnError(CHIP_NO_ERROR == group.Load(mProvider.mStorage), false);
 
@@ -1281,6 +1523,20 @@ GroupDataProviderImpl::EndpointIteratorImpl::EndpointIteratorImpl(GroupDataProvi
     mProvider(provider),
     mFabric(fabric_index)
 {
+#if CHIP_CONFIG_GROUP_DATA_INDEX
+    const FabricTables * tables = provider.GetFabricTables(fabric_index);
+    if (nullptr != tables)
+    {
+        VerifyOrReturn(tables->group_count > 0);
+        mGroup         = tables->groups[0].group_id;
+        mFirstGroup    = tables->groups[0].group_id;
+        mGroupCount    = tables->group_count;
+        mEndpoint      = tables->groups[0].first_endpoint_id;
+        mEndpointCount = tables->groups[0].endpoint_count;
+        return;
+    }
+#endif // CHIP_CONFIG_GROUP_DATA_INDEX
+
     FabricData fabric(fabric_index);
     VerifyOrReturn(CHIP_NO_ERROR == fabric.Load(provider.mStorage));
 
@@ -1296,6 +1552,14 @@ GroupDataProviderImpl::EndpointIteratorImpl::EndpointIteratorImpl(GroupDataProvi
 
 size_t GroupDataProviderImpl::EndpointIteratorImpl::Count()
 {
+#if CHIP_CONFIG_GROUP_DATA_INDEX
+    const FabricTables * tables = mProvider.GetFabricTables(mFabric);
+    if (nullptr != tables)
+    {
+        return tables->endpoint_count;
+    }
+#endif // CHIP_CONFIG_GROUP_DATA_INDEX
+
     GroupData group(mFabric, mFirstGroup);
     size_t group_index    = 0;
     size_t endpoint_index = 0;
@@ -1327,6 +1591,57 @@ bool GroupDataProviderImpl::EndpointIteratorImpl::Next(GroupEndpoint & output)
 {
     while (mGroupIndex < mGroupCount)
     {
+#if CHIP_CONFIG_GROUP_DATA_INDEX
+        // As with storage, the iteration resumes from the ids of the next group
+        // and endpoint, so that the tables may change between calls.
+        const FabricTables * tables = mProvider.GetFabricTables(mFabric);
+        if (nullptr != tables)
+        {
+            const FabricTables::GroupEntry * entry = tables->FindGroup(mGroup, mGroupPosition);
+            if (nullptr == entry)
+            {
+                mGroupIndex = mGroupCount;
+                return false;
+            }
+            mGroupPosition = tables->GroupPosition(entry);
+            if (mFirstEndpoint)
+            {
+                mEndpoint         = entry->first_endpoint_id;
+                mEndpointIndex    = 0;
+                mEndpointCount    = entry->endpoint_count;
+                mEndpointPosition = 0;
+                mFirstEndpoint    = false;
+            }
+            if (mEndpointIndex < mEndpointCount)
+            {
+                const EndpointId * endpoints = &tables->endpoints[entry->first_endpoint];
+                size_t position              = mEndpointPosition;
+                if (position >= entry->endpoint_count || endpoints[position] != mEndpoint)
+                {
+                    position = 0;
+                    while (position < entry->endpoint_count && endpoints[position] != mEndpoint)
+                    {
+                        position++;
+                    }
+                }
+                if (position < entry->endpoint_count)
+                {
+                    output.group_id    = entry->group_id;
+                    output.endpoint_id = mEndpoint;
+                    mEndpointPosition  = position + 1;
+                    mEndpoint = (mEndpointPosition < entry->endpoint_count) ? endpoints[mEndpointPosition] : kInvalidEndpointId;
+                    mEndpointIndex++;
+                    return true;
+                }
+            }
+            mGroup = tables->NextGroupId(entry);
+            mGroupPosition++;
+            mGroupIndex++;
+            mFirstEndpoint = true;
+            continue;
+        }
+#endif // CHIP_CONFIG_GROUP_DATA_INDEX
+
         GroupData group(mFabric, mGroup);
         if (CHIP_NO_ERROR != group.Load(mProvider.mStorage))
         {
@@ -1366,6 +1681,7 @@ void GroupDataProviderImpl::EndpointIteratorImpl::Release()
 
 CHIP_ERROR GroupDataProviderImpl::RemoveEndpoints(chip::FabricIndex fabric_index, chip::GroupId group_id)
 {
+    FabricTablesInvalidator invalidator(*this, fabric_index);
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
     FabricData fabric(fabric_index);
@@ -1396,6 +1712,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveEndpoints(chip::FabricIndex fabric_index
 
 CHIP_ERROR GroupDataProviderImpl::SetGroupKeyAt(chip::FabricIndex fabric_index, size_t index, const GroupKey & in_map)
 {
+    FabricTablesInvalidator invalidator(*this, fabric_index);
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
     FabricData fabric(fabric_index);
@@ -1448,6 +1765,17 @@ CHIP_ERROR GroupDataProviderImpl::GetGroupKeyAt(chip::FabricIndex fabric_index,
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
+#if CHIP_CONFIG_GROUP_DATA_INDEX
+    const FabricTables * tables = GetFabricTables(fabric_index);
+    if (nullptr != tables)
+    {
+        VerifyOrReturnError(index < tables->map_count, CHIP_ERROR_NOT_FOUND);
+        out_map.group_id  = tables->maps[index].group_id;
+        out_map.keyset_id = tables->maps[index].keyset_id;
+        return CHIP_NO_ERROR;
+    }
+#endif // CHIP_CONFIG_GROUP_DATA_INDEX
+
     FabricData fabric(fabric_index);
     KeyMapData map;
 
@@ -1462,6 +1790,7 @@ CHIP_ERROR GroupDataProviderImpl::GetGroupKeyAt(chip::FabricIndex fabric_index,
 
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_index, size_t index)
 {
+    FabricTablesInvalidator invalidator(*this, fabric_index);
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
     FabricData fabric(fabric_index);
@@ -1494,6 +1823,7 @@ CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeyAt(chip::FabricIndex fabric_inde
 
 CHIP_ERROR GroupDataProviderImpl::RemoveGroupKeys(chip::FabricIndex fabric_index)
 {
+    FabricTablesInvalidator invalidator(*this, fabric_index);
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
     FabricData fabric(fabric_index);
@@ -1570,6 +1900,7 @@ constexpr size_t GroupDataProvider::EpochKey::kLengthBytes;
 CHIP_ERROR GroupDataProviderImpl::SetKeySet(chip::FabricIndex fabric_index, const ByteSpan & compressed_fabric_id,
                                             const KeySet & in_keyset)
 {
+    FabricTablesInvalidator invalidator(*this, fabric_index);
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
     FabricData fabric(fabric_index);
@@ -1620,6 +1951,25 @@ CHIP_ERROR GroupDataProviderImpl::GetKeySet(chip::FabricIndex fabric_index, uint
 {
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
+#if CHIP_CONFIG_GROUP_DATA_INDEX
+    const FabricTables * tables = GetFabricTables(fabric_index);
+    if (nullptr != tables)
+    {
+        const FabricTables::KeySetEntry * entry = tables->FindKeySet(target_id);
+        VerifyOrReturnError(nullptr != entry, CHIP_ERROR_NOT_FOUND);
+
+        out_keyset.ClearKeys();
+        out_keyset.keyset_id     = entry->keyset_id;
+        out_keyset.policy        = entry->policy;
+        out_keyset.num_keys_used = entry->keys_count;
+        // Epoch keys are not read back, only start times
+        out_keyset.epoch_keys[0].start_time = entry->operational_keys[0].start_time;
+        out_keyset.epoch_keys[1].start_time = entry->operational_keys[1].start_time;
+        out_keyset.epoch_keys[2].start_time = entry->operational_keys[2].start_time;
+        return CHIP_NO_ERROR;
+    }
+#endif // CHIP_CONFIG_GROUP_DATA_INDEX
+
     FabricData fabric(fabric_index);
     KeySetData keyset;
 
@@ -1641,6 +1991,7 @@ CHIP_ERROR GroupDataProviderImpl::GetKeySet(chip::FabricIndex fabric_index, uint
 
 CHIP_ERROR GroupDataProviderImpl::RemoveKeySet(chip::FabricIndex fabric_index, uint16_t target_id)
 {
+    FabricTablesInvalidator invalidator(*this, fabric_index);
     VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INTERNAL);
 
     FabricData fabric(fabric_index);
@@ -1725,6 +2076,7 @@ void GroupDataProviderImpl::KeySetIteratorImpl::Release()
 
 CHIP_ERROR GroupDataProviderImpl::RemoveFabric(chip::FabricIndex fabric_index)
 {
+    FabricTablesInvalidator invalidator(*this, fabric_index);
     FabricData fabric(fabric_index);
 
     // Fabric data defaults to zero, so if not entry is found, no mappings, or keys are removed
@@ -1773,6 +2125,32 @@ CHIP_ERROR GroupDataProviderImpl::RemoveFabric(chip::FabricIndex fabric_index)
 
 Crypto::SymmetricKeyContext * GroupDataProviderImpl::GetKeyContext(FabricIndex fabric_index, GroupId group_id)
 {
+#if CHIP_CONFIG_GROUP_DATA_INDEX
+    const FabricTables * tables = GetFabricTables(fabric_index);
+    if (nullptr != tables)
+    {
+        for (uint16_t i = 0; i < tables->map_count; ++i)
+        {
+            const FabricTables::MapEntry & mapping = tables->maps[i];
+            // GroupKeySetID of 0 is reserved for the Identity Protection Key (IPK)
+            if (mapping.keyset_id > 0 && mapping.group_id == group_id)
+            {
+                const FabricTables::KeySetEntry * keyset = tables->FindKeySet(mapping.keyset_id);
+                VerifyOrReturnError(nullptr != keyset, nullptr);
+                const Crypto::GroupOperationalCredentials * creds =
+                    GetCurrentCredentials(keyset->operational_keys, keyset->keys_count);
+                if (nullptr != creds)
+                {
+                    return mGroupKeyContexPool.CreateObject(
+                        *this, ByteSpan(creds->encryption_key, Crypto::CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES), creds->hash,
+                        ByteSpan(creds->privacy_key, Crypto::CHIP_CRYPTO_SYMMETRIC_KEY_LENGTH_BYTES));
+                }
+            }
+        }
+        return nullptr;
+    }
+#endif // CHIP_CONFIG_GROUP_DATA_INDEX
+
     FabricData fabric(fabric_index);
     VerifyOrReturnError(CHIP_NO_ERROR == fabric.Load(mStorage), nullptr);
 
@@ -1803,6 +2181,31 @@ Crypto::SymmetricKeyContext * GroupDataProviderImpl::GetKeyContext(FabricIndex f
 
 CHIP_ERROR GroupDataProviderImpl::GetIpkKeySet(FabricIndex fabric_index, KeySet & out_keyset)
 {
+#if CHIP_CONFIG_GROUP_DATA_INDEX
+    const FabricTables * tables = GetFabricTables(fabric_index);
+    if (nullptr != tables)
+    {
+        const FabricTables::KeySetEntry * keyset = tables->FindKeySet(kIdentityProtectionKeySetId);
+        VerifyOrReturnError(nullptr != keyset, CHIP_ERROR_NOT_FOUND);
+
+        out_keyset.keyset_id     = keyset->keyset_id;
+        out_keyset.num_keys_used = keyset->keys_count;
+        out_keyset.policy        = keyset->policy;
+
+        for (size_t key_idx = 0; key_idx < ArraySize(out_keyset.epoch_keys); ++key_idx)
+        {
+            out_keyset.epoch_keys[key_idx].Clear();
+            if (key_idx < keyset->keys_count)
+            {
+                out_keyset.epoch_keys[key_idx].start_time = keyset->operational_keys[key_idx].start_time;
+                memcpy(&out_keyset.epoch_keys[key_idx].key[0], keyset->operational_keys[key_idx].encryption_key,
+                       EpochKey::kLengthBytes);
+            }
+        }
+        return CHIP_NO_ERROR;
+    }
+#endif // CHIP_CONFIG_GROUP_DATA_INDEX
+
     FabricData fabric(fabric_index);
     VerifyOrReturnError(CHIP_NO_ERROR == fabric.Load(mStorage), CHIP_ERROR_NOT_FOUND);
 
@@ -1902,6 +2305,29 @@ size_t GroupDataProviderImpl::GroupSessionIteratorImpl::Count()
             break;
         }
 
+#if CHIP_CONFIG_GROUP_DATA_INDEX
+        const FabricTables * tables = mProvider.GetFabricTables(fabric.fabric_index);
+        if (nullptr != tables)
+        {
+            for (uint16_t j = 0; j < tables->map_count; ++j)
+            {
+                const FabricTables::KeySetEntry * keyset = tables->FindKeySet(tables->maps[j].keyset_id);
+                if (nullptr == keyset)
+                {
+                    break;
+                }
+                for (uint16_t k = 0; k < keyset->keys_count; ++k)
+                {
+                    if (keyset->operational_keys[k].hash == mSessionId)
+                    {
+                        count++;
+                    }
+                }
+            }
+            continue;
+        }
+#endif // CHIP_CONFIG_GROUP_DATA_INDEX
+
         // Iterate key sets
         KeyMapData mapping(fabric.fabric_index, fabric.first_map);
 
@@ -1948,6 +2374,38 @@ bool GroupDataProviderImpl::GroupSessionIteratorImpl::Next(GroupSession & output
             continue;
         }
 
+#if CHIP_CONFIG_GROUP_DATA_INDEX
+        const FabricTables * tables = mProvider.GetFabricTables(mFabric);
+        if (nullptr != tables)
+        {
+            VerifyOrReturnError(mMapCount < tables->map_count, false);
+            const FabricTables::MapEntry & mapping   = tables->maps[mMapCount];
+            const FabricTables::KeySetEntry * keyset = tables->FindKeySet(mapping.keyset_id);
+            VerifyOrReturnError(nullptr != keyset, false);
+
+            if (mKeyIndex >= keyset->keys_count)
+            {
+                // No more keys in current keyset, try next
+                mMapCount++;
+                mKeyIndex = 0;
+                continue;
+            }
+
+            const Crypto::GroupOperationalCredentials & creds = keyset->operational_keys[mKeyIndex++];
+            if (creds.hash == mSessionId)
+            {
+                mGroupKeyContext.SetKey(ByteSpan(creds.encryption_key, sizeof(creds.encryption_key)), mSessionId);
+                mGroupKeyContext.SetPrivacyKey(ByteSpan(creds.privacy_key, sizeof(creds.privacy_key)));
+                output.fabric_index    = fabric.fabric_index;
+                output.group_id        = mapping.group_id;
+                output.security_policy = keyset->policy;
+                output.key             = &mGroupKeyContext;
+                return true;
+            }
+            continue;
+        }
+#endif // CHIP_CONFIG_GROUP_DATA_INDEX
+
         if (mFirstMap)
         {
             mMapping  = fabric.first_map;
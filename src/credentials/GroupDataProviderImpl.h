@@ -17,8 +17,10 @@
 #pragma once
 
 #include <credentials/GroupDataProvider.h>
+#include <lib/core/CHIPConfig.h>
 #include <lib/core/CHIPPersistentStorageDelegate.h>
 #include <lib/support/Pool.h>
+#include <lib/support/ScopedBuffer.h>
 
 namespace chip {
 namespace Credentials {
@@ -145,6 +147,9 @@ protected:
         size_t mEndpointIndex = 0;
         size_t mEndpointCount = 0;
         bool mFirstEndpoint   = true;
+        // Positions of mGroup and mEndpoint in the in-memory tables, if used
+        size_t mGroupPosition    = 0;
+        size_t mEndpointPosition = 0;
     };
 
     class GroupKeyContext : public Crypto::SymmetricKeyContext
@@ -227,6 +232,82 @@ protected:
         bool mFirstMap           = true;
         GroupKeyContext mGroupKeyContext;
     };
+
+#if CHIP_CONFIG_GROUP_DATA_INDEX
+    /**
+     * In-memory copy of the group tables of a fabric, in the order of the
+     * stored lists, so that lookups and iterations need no storage read.  The
+     * copy of a fabric is dropped once a change to its tables completes, and
+     * loaded again on the next lookup.  Lookups read the storage whenever a
+     * copy cannot be loaded.
+     */
+    struct FabricTables
+    {
+        struct GroupEntry
+        {
+            GroupId group_id;
+            char name[GroupInfo::kGroupNameMax + 1];
+            EndpointId first_endpoint_id;
+            uint16_t first_endpoint; // Index of the first endpoint of the group in `endpoints`
+            uint16_t endpoint_count;
+        };
+
+        struct MapEntry
+        {
+            GroupId group_id;
+            KeysetId keyset_id;
+        };
+
+        struct KeySetEntry
+        {
+            KeysetId keyset_id;
+            SecurityPolicy policy;
+            uint8_t keys_count;
+            Crypto::GroupOperationalCredentials operational_keys[KeySet::kEpochKeysMax];
+        };
+
+        FabricTables(FabricIndex fabric) : fabric_index(fabric) {}
+        ~FabricTables();
+
+        CHIP_ERROR Load(PersistentStorageDelegate * storage);
+        // Looks the group up at position `hint` first, then through all groups.
+        const GroupEntry * FindGroup(GroupId group_id, size_t hint = 0) const;
+        size_t GroupPosition(const GroupEntry * group) const { return static_cast<size_t>(group - groups.Get()); }
+        GroupId NextGroupId(const GroupEntry * group) const;
+        const KeySetEntry * FindKeySet(KeysetId keyset_id) const;
+
+        const FabricIndex fabric_index;
+        uint16_t group_count    = 0;
+        uint16_t endpoint_count = 0;
+        uint16_t map_count      = 0;
+        uint16_t keyset_count   = 0;
+        Platform::ScopedMemoryBuffer<GroupEntry> groups;
+        Platform::ScopedMemoryBuffer<EndpointId> endpoints;
+        Platform::ScopedMemoryBuffer<MapEntry> maps;
+        Platform::ScopedMemoryBuffer<KeySetEntry> keysets;
+    };
+
+    // Returns the copy of the tables of the given fabric, loading it if needed,
+    // or nullptr if it cannot be loaded.
+    FabricTables * GetFabricTables(FabricIndex fabric_index);
+#endif // CHIP_CONFIG_GROUP_DATA_INDEX
+
+    // Drops the in-memory copy of the tables of the given fabric, if any.
+    void InvalidateFabricTables(FabricIndex fabric_index);
+
+    class FabricTablesInvalidator
+    {
+    public:
+        FabricTablesInvalidator(GroupDataProviderImpl & provider, FabricIndex fabric_index) :
+            mProvider(provider), mFabric(fabric_index)
+        {}
+        ~FabricTablesInvalidator() { mProvider.InvalidateFabricTables(mFabric); }
+
+    private:
+        GroupDataProviderImpl & mProvider;
+        FabricIndex mFabric;
+    };
+
     bool IsInitialized() { return (mStorage != nullptr); }
     CHIP_ERROR RemoveEndpoints(FabricIndex fabric_index, GroupId group_id);
 
@@ -237,6 +318,9 @@ protected:
     ObjectPool<KeySetIteratorImpl, kIteratorsMax> mKeySetIterators;
     ObjectPool<GroupSessionIteratorImpl, kIteratorsMax> mGroupSessionsIterator;
     ObjectPool<GroupKeyContext, kIteratorsMax> mGroupKeyContexPool;
+#if CHIP_CONFIG_GROUP_DATA_INDEX
+    ObjectPool<FabricTables, CHIP_CONFIG_MAX_FABRICS> mFabricTables;
+#endif // CHIP_CONFIG_GROUP_DATA_INDEX
 };
 
 } // namespace Credentials
@@ -19,10 +19,12 @@
 #include <credentials/GroupDataProviderImpl.h>
 #include <lib/core/CHIPTLV.h>
 #include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
 #include <lib/support/TestPersistentStorageDelegate.h>
 #include <lib/support/UnitTestRegistration.h>
 #include <nlunit-test.h>
 #include <platform/KeyValueStoreManager.h>
+#include <system/SystemClock.h>
 #include <set>
 #include <string.h>
 #include <tuple>
@@ -1181,6 +1183,82 @@ void TestGroupDecryption(nlTestSuite * apSuite, void * apContext)
     }
 }
 
+/// Counts the reads reaching the storage.
+class CountingStorageDelegate : public TestPersistentStorageDelegate
+{
+public:
+    CHIP_ERROR SyncGetKeyValue(const char * key, void * buffer, uint16_t & size) override
+    {
+        mReadCount++;
+        return TestPersistentStorageDelegate::SyncGetKeyValue(key, buffer, size);
+    }
+
+    size_t mReadCount = 0;
+};
+
+void TestLookupReads(nlTestSuite * apSuite, void * apContext)
+{
+    constexpr uint16_t kGroupCount        = 50;
+    constexpr uint16_t kEndpointsPerGroup = 20;
+
+    CountingStorageDelegate storage;
+    GroupDataProviderImpl provider(kGroupCount, kMaxGroupKeysPerFabric);
+    provider.SetStorageDelegate(&storage);
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider.Init());
+
+    for (GroupId group = 1; group <= kGroupCount; group++)
+    {
+        NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider.SetGroupInfo(kFabric1, GroupInfo(group, "Group")));
+        for (EndpointId endpoint = 1; endpoint <= kEndpointsPerGroup; endpoint++)
+        {
+            NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider.AddEndpoint(kFabric1, group, endpoint));
+        }
+    }
+
+    // Dispatch of a group message to each endpoint of each group
+    storage.mReadCount                  = 0;
+    System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+    for (GroupId group = 1; group <= kGroupCount; group++)
+    {
+        for (EndpointId endpoint = 1; endpoint <= kEndpointsPerGroup; endpoint++)
+        {
+            NL_TEST_ASSERT(apSuite, provider.HasEndpoint(kFabric1, group, endpoint));
+        }
+        NL_TEST_ASSERT(apSuite, !provider.HasEndpoint(kFabric1, group, kEndpointsPerGroup + 1));
+    }
+    size_t count = 0;
+    auto it      = provider.IterateEndpoints(kFabric1);
+    NL_TEST_ASSERT(apSuite, it);
+    if (it)
+    {
+        GroupEndpoint output;
+        NL_TEST_ASSERT(apSuite, kGroupCount * kEndpointsPerGroup == it->Count());
+        while (it->Next(output))
+        {
+            count++;
+        }
+        it->Release();
+    }
+    NL_TEST_ASSERT(apSuite, kGroupCount * kEndpointsPerGroup == count);
+    System::Clock::Microseconds64 elapsed = System::SystemClock().GetMonotonicMicroseconds64() - start;
+
+    ChipLogProgress(Test, "%u groups of %u endpoints: %u storage reads in %u us", kGroupCount, kEndpointsPerGroup,
+                    static_cast<unsigned>(storage.mReadCount), static_cast<unsigned>(elapsed.count()));
+#if CHIP_CONFIG_GROUP_DATA_INDEX
+    // The tables are read once: the fabric, its groups and their endpoints.
+    NL_TEST_ASSERT(apSuite, storage.mReadCount == 1 + kGroupCount + kGroupCount * kEndpointsPerGroup);
+
+    // Changes are seen by the next lookups
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider.RemoveEndpoint(kFabric1, 1, 1));
+    NL_TEST_ASSERT(apSuite, !provider.HasEndpoint(kFabric1, 1, 1));
+    NL_TEST_ASSERT(apSuite, CHIP_NO_ERROR == provider.AddEndpoint(kFabric1, 1, 1));
+    NL_TEST_ASSERT(apSuite, provider.HasEndpoint(kFabric1, 1, 1));
+#endif // CHIP_CONFIG_GROUP_DATA_INDEX
+
+    provider.RemoveFabric(kFabric1);
+    provider.Finish();
+}
+
 } // namespace TestGroups
 } // namespace app
 } // namespace chip
@@ -1258,6 +1336,7 @@ const nlTest sTests[] = { NL_TEST_DEF("TestStorageDelegate", chip::app::TestGrou
                           NL_TEST_DEF("TestIpk", chip::app::TestGroups::TestIpk),
                           NL_TEST_DEF("TestPerFabricData", chip::app::TestGroups::TestPerFabricData),
                           NL_TEST_DEF("TestGroupDecryption", chip::app::TestGroups::TestGroupDecryption),
+                          NL_TEST_DEF("TestLookupReads", chip::app::TestGroups::TestLookupReads),
                           NL_TEST_SENTINEL() };
 } // namespace
 
@@ -91,6 +91,17 @@
 #define CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE 100
 #endif
 
+/**
+ * CHIP_DEVICE_CONFIG_POSIX_EVENT_QUEUE_SIZE
+ *
+ * The maximum number of events that can be held in the chip Platform event queue on POSIX platforms,
+ * where the queue is a lock-free ring shared by all posting threads, embedded in the PlatformManager.
+ * Must be a power of two. Defaults to CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE rounded up to a power of two.
+ */
+#ifndef CHIP_DEVICE_CONFIG_POSIX_EVENT_QUEUE_SIZE
+#define CHIP_DEVICE_CONFIG_POSIX_EVENT_QUEUE_SIZE 128
+#endif
+
 /**
  * CHIP_DEVICE_CONFIG_LOG_PROVISIONING_HASH
  *
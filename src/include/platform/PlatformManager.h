@@ -136,6 +136,9 @@ public:
      * stack.  When called from a thread that is not doing the stack work item
      * processing, the callback function may be called (on the work item
      * processing thread) before ScheduleWork returns.
+     *
+     * If the event queue is full, the work is not scheduled and an error is
+     * logged; see PostEvent.
      */
     void ScheduleWork(AsyncWorkFunct workFunct, intptr_t arg = 0);
 
@@ -197,6 +200,10 @@ public:
      * When called from a thread that is not doing the stack work item
      * processing, the event might get dispatched (on the work item processing
      * thread) before PostEvent returns.
+     *
+     * The event queue is bounded: if it is full, PostEvent drops the event
+     * and returns an error, CHIP_ERROR_NO_MEMORY on POSIX platforms.
+     * PostEventOrDie aborts instead.
      */
     [[nodiscard]] CHIP_ERROR PostEvent(const ChipDeviceEvent * event);
     void PostEventOrDie(const ChipDeviceEvent * event);
@@ -131,18 +131,28 @@ CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_StartChipTimer(System::
 template <class ImplClass>
 CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_PostEvent(const ChipDeviceEvent * event)
 {
-    mChipEventQueue.Push(*event);
+    bool wakeEventLoop = false;
+    CHIP_ERROR err     = mChipEventQueue.Push(*event, wakeEventLoop);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Failed to post event %d: %" CHIP_ERROR_FORMAT, event->Type, err.Format());
+        return err;
+    }
 
-    SystemLayerSocketsLoop().Signal(); // Trigger wake select on CHIP thread
+    // Only the first event queued since the CHIP thread emptied the queue needs to wake select
+    if (wakeEventLoop)
+    {
+        SystemLayerSocketsLoop().Signal(); // Trigger wake select on CHIP thread
+    }
     return CHIP_NO_ERROR;
 }
 
 template <class ImplClass>
 void GenericPlatformManagerImpl_POSIX<ImplClass>::ProcessDeviceEvents()
 {
-    while (!mChipEventQueue.Empty())
+    ChipDeviceEvent event;
+    while (mChipEventQueue.PopFront(event))
     {
-        const ChipDeviceEvent event = mChipEventQueue.PopFront();
         Impl()->DispatchEvent(&event);
     }
 }
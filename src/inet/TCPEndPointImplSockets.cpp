@@ -31,6 +31,7 @@
 #include <system/SystemFaultInjection.h>
 
 #include <stdio.h>
+#include <algorithm>
 #include <string.h>
 #include <utility>
 
@@ -41,6 +42,7 @@
 #include <sys/ioctl.h>
 #include <sys/select.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 // SOCK_CLOEXEC not defined on all platforms, e.g. iOS/macOS:
@@ -484,9 +486,25 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
 
     while (!mSendQueue.IsNull())
     {
-        uint16_t bufLen = mSendQueue->DataLength();
+        // Gather the queued buffers into a single sendmsg(), so that a message split over a chain of buffers (or several
+        // queued messages) does not take one system call and one TCP segment per buffer.
+        struct iovec sendIOV[kMaxSendIOVecs];
+        size_t iovCount  = 0;
+        size_t queuedLen = 0;
+        for (System::PacketBufferHandle buf = mSendQueue.Retain(); !buf.IsNull() && iovCount < kMaxSendIOVecs; buf.Advance())
+        {
+            sendIOV[iovCount].iov_base = buf->Start();
+            sendIOV[iovCount].iov_len  = buf->DataLength();
+            queuedLen += buf->DataLength();
+            iovCount++;
+        }
 
-        ssize_t lenSentRaw = send(mSocket, mSendQueue->Start(), bufLen, sendFlags);
+        struct msghdr msgHeader;
+        memset(&msgHeader, 0, sizeof(msgHeader));
+        msgHeader.msg_iov    = sendIOV;
+        msgHeader.msg_iovlen = static_cast<decltype(msgHeader.msg_iovlen)>(iovCount);
+
+        ssize_t lenSentRaw = sendmsg(mSocket, &msgHeader, sendFlags);
 
         if (lenSentRaw == -1)
         {
@@ -497,43 +515,52 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
             break;
         }
 
-        if (lenSentRaw < 0 || lenSentRaw > bufLen)
+        if (lenSentRaw < 0 || static_cast<size_t>(lenSentRaw) > queuedLen)
         {
             err = CHIP_ERROR_INCORRECT_STATE;
             break;
         }
 
-        // Cast is safe because bufLen is uint16_t.
-        uint16_t lenSent = static_cast<uint16_t>(lenSentRaw);
+        size_t lenSent = static_cast<size_t>(lenSentRaw);
 
         // Mark the connection as being active.
         MarkActive();
 
-        if (lenSent < bufLen)
+        // Free the buffers that were sent entirely, then consume what was sent of the next one.
+        size_t lenLeft = lenSent;
+        while (!mSendQueue.IsNull() && lenLeft >= mSendQueue->DataLength())
         {
-            mSendQueue->ConsumeHead(lenSent);
+            lenLeft -= mSendQueue->DataLength();
+            mSendQueue.FreeHead();
         }
-        else
+        if (lenLeft > 0)
         {
-            mSendQueue.FreeHead();
-            if (mSendQueue.IsNull())
+            // Cast is safe because lenLeft is less than the uint16_t length of the head buffer.
+            mSendQueue->ConsumeHead(static_cast<uint16_t>(lenLeft));
+        }
+
+        if (mSendQueue.IsNull())
+        {
+            // Do not wait for ability to write on this endpoint.
+            err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
+            if (err != CHIP_NO_ERROR)
             {
-                // Do not wait for ability to write on this endpoint.
-                err = static_cast<System::LayerSockets &>(GetSystemLayer()).ClearCallbackOnPendingWrite(mWatch);
-                if (err != CHIP_NO_ERROR)
-                {
-                    break;
-                }
+                break;
             }
         }
 
         if (OnDataSent != nullptr)
         {
-            OnDataSent(this, lenSent);
+            for (size_t lenToReport = lenSent; lenToReport > 0;)
+            {
+                uint16_t len = static_cast<uint16_t>(std::min<size_t>(lenToReport, UINT16_MAX));
+                OnDataSent(this, len);
+                lenToReport -= len;
+            }
         }
 
 #if INET_CONFIG_OVERRIDE_SYSTEM_TCP_USER_TIMEOUT
-        mBytesWrittenSinceLastProbe += lenSent;
+        mBytesWrittenSinceLastProbe += static_cast<uint32_t>(lenSent);
 
         bool isProgressing = false;
 
@@ -559,7 +586,7 @@ CHIP_ERROR TCPEndPointImplSockets::DriveSendingImpl()
         }
 #endif // INET_CONFIG_OVERRIDE_SYSTEM_TCP_USER_TIMEOUT
 
-        if (lenSent < bufLen)
+        if (lenSent < queuedLen)
         {
             break;
         }
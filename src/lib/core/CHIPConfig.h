@@ -267,6 +267,56 @@
 #define CHIP_UDC_PORT CHIP_PORT + 10
 #endif // CHIP_UDC_PORT
 
+/**
+ *  @def CHIP_CONFIG_ENABLE_TCP_TRANSPORT
+ *
+ *  @brief
+ *    Listen for TCP connections on CHIP_PORT next to UDP, and establish operational sessions over TCP with the nodes that
+ *    advertise TCP support. Messages on TCP sessions are not retransmitted by MRP and may be larger than a network
+ *    packet, so that reports are not chunked to the UDP MTU.
+ *
+ *    Requires INET_CONFIG_ENABLE_TCP_ENDPOINT.
+ */
+#ifndef CHIP_CONFIG_ENABLE_TCP_TRANSPORT
+#define CHIP_CONFIG_ENABLE_TCP_TRANSPORT 0
+#endif // CHIP_CONFIG_ENABLE_TCP_TRANSPORT
+
+/**
+ *  @def CHIP_CONFIG_MAX_ACTIVE_TCP_CONNECTIONS
+ *
+ *  @brief
+ *    Maximum number of simultaneously open TCP connections of the TCP transport. When objects are pool allocated from the
+ *    heap the connection table grows as needed and this is ignored.
+ *
+ */
+#ifndef CHIP_CONFIG_MAX_ACTIVE_TCP_CONNECTIONS
+#define CHIP_CONFIG_MAX_ACTIVE_TCP_CONNECTIONS 4
+#endif // CHIP_CONFIG_MAX_ACTIVE_TCP_CONNECTIONS
+
+/**
+ *  @def CHIP_CONFIG_MAX_TCP_PENDING_PACKETS
+ *
+ *  @brief
+ *    Maximum number of peers for which the TCP transport holds messages while connecting.
+ *
+ */
+#ifndef CHIP_CONFIG_MAX_TCP_PENDING_PACKETS
+#define CHIP_CONFIG_MAX_TCP_PENDING_PACKETS 4
+#endif // CHIP_CONFIG_MAX_TCP_PENDING_PACKETS
+
+/**
+ *  @def CHIP_CONFIG_TCP_CONNECTION_IDLE_TIMEOUT_MS
+ *
+ *  @brief
+ *    Time after which the TCP transport closes a connection it initiated on which nothing was sent or received. Until
+ *    then the connection is reused for all the messages to the peer, including those of later sessions. Accepted
+ *    connections are left for the peer to close, since they cannot be reopened from this side. 0 keeps connections open.
+ *
+ */
+#ifndef CHIP_CONFIG_TCP_CONNECTION_IDLE_TIMEOUT_MS
+#define CHIP_CONFIG_TCP_CONNECTION_IDLE_TIMEOUT_MS 300000
+#endif // CHIP_CONFIG_TCP_CONNECTION_IDLE_TIMEOUT_MS
+
 /**
  *  @def CHIP_CONFIG_SECURITY_TEST_MODE
  *
@@ -771,8 +821,10 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
  *      * #CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS
  *      * #CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS
  *      * #CHIP_IM_MAX_REPORTS_IN_FLIGHT
+ *      * #CHIP_IM_REPORT_BANDWIDTH_BYTES_PER_SECOND
  *      * #CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS
  *      * #CHIP_IM_SERVER_MAX_NUM_DIRTY_SET
+ *      * #CHIP_IM_SERVER_MAX_NUM_PUBLISHED_ATTRIBUTE_CHANGES
  *      * #CHIP_IM_MAX_NUM_WRITE_HANDLER
  *      * #CHIP_IM_MAX_NUM_WRITE_CLIENT
  *      * #CHIP_IM_MAX_NUM_TIMED_HANDLER
@@ -823,6 +875,18 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_MAX_REPORTS_IN_FLIGHT 4
 #endif
 
+/**
+ * @def CHIP_IM_REPORT_BANDWIDTH_BYTES_PER_SECOND
+ *
+ * @brief Defines the number of bytes per second the default report scheduler lets the reporting engine send, across all read and
+ * subscription transactions. Urgent events and the empty reports keeping subscriptions alive are not held back by this budget.
+ *
+ * The default value 0 means that reports are not limited.
+ */
+#ifndef CHIP_IM_REPORT_BANDWIDTH_BYTES_PER_SECOND
+#define CHIP_IM_REPORT_BANDWIDTH_BYTES_PER_SECOND 0
+#endif
+
 /**
  * @def CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS
  *
@@ -850,6 +914,102 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_SERVER_MAX_NUM_DIRTY_SET 8
 #endif
 
+/**
+ * @def CHIP_IM_SERVER_MAX_NUM_PUBLISHED_ATTRIBUTE_CHANGES
+ *
+ * @brief Defines the maximum number of distinct attributes whose changes, published from any thread with
+ *        MatterPublishAttributeChange, can wait for the reporting engine at the same time. Repeated changes of an
+ *        attribute only use one entry.
+ */
+#ifndef CHIP_IM_SERVER_MAX_NUM_PUBLISHED_ATTRIBUTE_CHANGES
+#define CHIP_IM_SERVER_MAX_NUM_PUBLISHED_ATTRIBUTE_CHANGES 32
+#endif
+
+/**
+ * @def CHIP_IM_SERVER_MAX_PUBLISHED_ATTRIBUTE_VALUE_SIZE
+ *
+ * @brief Defines the maximum size, in bytes, of an attribute value published along with an attribute change.
+ */
+#ifndef CHIP_IM_SERVER_MAX_PUBLISHED_ATTRIBUTE_VALUE_SIZE
+#define CHIP_IM_SERVER_MAX_PUBLISHED_ATTRIBUTE_VALUE_SIZE 8
+#endif
+
+/**
+ * @def CHIP_CONFIG_DEFERRED_ATTRIBUTE_PERSISTENCE
+ *
+ * @brief If true, the server defers the writes of non-volatile attributes to storage with a
+ *        DeferredAttributePersistenceProvider, so that attributes changing many times per second (e.g. CurrentLevel
+ *        during a transition) are written once per flush interval instead of once per change. Values changed less
+ *        than a flush interval before a power loss are lost.
+ */
+#ifndef CHIP_CONFIG_DEFERRED_ATTRIBUTE_PERSISTENCE
+#define CHIP_CONFIG_DEFERRED_ATTRIBUTE_PERSISTENCE 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_DEFERRED_ATTRIBUTE_PERSISTENCE_FLUSH_INTERVAL_MS
+ *
+ * @brief Defines the default maximum time, in milliseconds, a deferred attribute write waits before being written
+ *        to storage.
+ */
+#ifndef CHIP_CONFIG_DEFERRED_ATTRIBUTE_PERSISTENCE_FLUSH_INTERVAL_MS
+#define CHIP_CONFIG_DEFERRED_ATTRIBUTE_PERSISTENCE_FLUSH_INTERVAL_MS 2000
+#endif
+
+/**
+ * @def CHIP_CONFIG_DEFERRED_ATTRIBUTE_PERSISTENCE_MAX_PENDING_WRITES
+ *
+ * @brief Defines the maximum number of distinct attributes whose writes to storage can be deferred at the same
+ *        time. All the deferred writes are flushed when it is reached.
+ */
+#ifndef CHIP_CONFIG_DEFERRED_ATTRIBUTE_PERSISTENCE_MAX_PENDING_WRITES
+#define CHIP_CONFIG_DEFERRED_ATTRIBUTE_PERSISTENCE_MAX_PENDING_WRITES 8
+#endif
+
+/**
+ * @def CHIP_CONFIG_DEFERRED_ATTRIBUTE_PERSISTENCE_MAX_VALUE_SIZE
+ *
+ * @brief Defines the size, in bytes, of the largest attribute value whose write to storage can be deferred. Larger
+ *        values, such as strings, are written immediately.
+ */
+#ifndef CHIP_CONFIG_DEFERRED_ATTRIBUTE_PERSISTENCE_MAX_VALUE_SIZE
+#define CHIP_CONFIG_DEFERRED_ATTRIBUTE_PERSISTENCE_MAX_VALUE_SIZE 8
+#endif
+
+/**
+ * @def CHIP_CONFIG_ATTRIBUTE_SNAPSHOTS
+ *
+ * @brief If true, the server stores the non-volatile attributes of each endpoint with a
+ *        SnapshotAttributePersistenceProvider, which also keeps all of them in a single snapshot value so that they
+ *        are restored with one storage read per endpoint at boot.
+ */
+#ifndef CHIP_CONFIG_ATTRIBUTE_SNAPSHOTS
+#define CHIP_CONFIG_ATTRIBUTE_SNAPSHOTS 0
+#endif
+
+/**
+ * @def CHIP_CONFIG_ATTRIBUTE_SNAPSHOT_MAX_SIZE
+ *
+ * @brief Defines the size, in bytes, of the largest attribute snapshot. The attributes of an endpoint whose snapshot
+ *        would be larger are restored one storage read at a time. Must not exceed the largest value the platform
+ *        storage accepts.
+ */
+#ifndef CHIP_CONFIG_ATTRIBUTE_SNAPSHOT_MAX_SIZE
+#define CHIP_CONFIG_ATTRIBUTE_SNAPSHOT_MAX_SIZE 1024
+#endif
+
+/**
+ * @def CHIP_CONFIG_ATTRIBUTE_SNAPSHOT_FIXED_ENDPOINT_COUNT
+ *
+ * @brief Defines the number of fixed endpoints the SnapshotAttributePersistenceProvider remembers as having no
+ *        snapshot, so that attribute writes on them do not delete it again. Dynamic endpoints, up to
+ *        CHIP_DEVICE_CONFIG_DYNAMIC_ENDPOINT_COUNT, are remembered on top of these. Should be at least the number of
+ *        fixed endpoints of the device.
+ */
+#ifndef CHIP_CONFIG_ATTRIBUTE_SNAPSHOT_FIXED_ENDPOINT_COUNT
+#define CHIP_CONFIG_ATTRIBUTE_SNAPSHOT_FIXED_ENDPOINT_COUNT 8
+#endif
+
 /**
  * @def CHIP_IM_MAX_NUM_WRITE_HANDLER
  *
@@ -985,6 +1145,21 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #error "Please ensure CHIP_CONFIG_MAX_GROUP_KEYS_PER_FABRIC > 0 to support at least the IPK."
 #endif
 
+/**
+ * @def CHIP_CONFIG_GROUP_DATA_INDEX
+ *
+ * @brief If true, GroupDataProviderImpl keeps in memory a copy of the group tables of the fabrics it is queried for,
+ *        so that group lookups (e.g. on each group command or write) need no storage read. The copy is allocated
+ *        on the heap, sized to the stored tables.
+ *
+ *        The copy includes the group operational keys, which then stay in heap memory for as long as the fabric
+ *        is looked up, rather than only during each lookup. They are cleared when the copy is released. Disabled
+ *        by default.
+ */
+#ifndef CHIP_CONFIG_GROUP_DATA_INDEX
+#define CHIP_CONFIG_GROUP_DATA_INDEX 0
+#endif
+
 /**
  * @def CHIP_CONFIG_MAX_GROUP_ENDPOINTS_PER_FABRIC
  *
@@ -1246,6 +1421,42 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MINMDNS_MAX_PARALLEL_RESOLVES 2
 #endif // CHIP_CONFIG_MINMDNS_MAX_PARALLEL_RESOLVES
 
+/*
+ * @def CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+ *
+ * @brief Number of encoded replies the minmdns advertiser keeps, to answer
+ *        repeated identical queries without rebuilding the reply.
+ *        Reply packets are heap-allocated when a reply is cached.
+ *        Set to 0 to disable the cache.
+ */
+#ifndef CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+#define CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE 4
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+
+/*
+ * @def CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE
+ *
+ * @brief Number of DNSSD records (SRV, TXT, A/AAAA) the minmdns resolver
+ *        keeps until their TTL expires, to resolve nodes without querying
+ *        the network again. A resolved node typically needs 3 records.
+ *        Record data is heap-allocated. Set to 0 to disable the cache.
+ */
+#ifndef CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE
+#define CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE 16
+#endif // CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE
+
+/*
+ * @def CHIP_CONFIG_MINMDNS_RETRY_QUEUE_SIZE
+ *
+ * @brief Number of browse/resolve queries the minmdns resolver keeps
+ *        track of (and retries) at the same time. Queries due at the same
+ *        time are sent in a single packet, so controllers resolving many
+ *        nodes benefit from a larger value.
+ */
+#ifndef CHIP_CONFIG_MINMDNS_RETRY_QUEUE_SIZE
+#define CHIP_CONFIG_MINMDNS_RETRY_QUEUE_SIZE 4
+#endif // CHIP_CONFIG_MINMDNS_RETRY_QUEUE_SIZE
+
 /*
  * @def CHIP_CONFIG_NETWORK_COMMISSIONING_DEBUG_TEXT_BUFFER_SIZE
  *
@@ -228,6 +228,19 @@ Optional<ActiveResolveAttempts::ScheduledAttempt> ActiveResolveAttempts::NextSch
     return Optional<ScheduledAttempt>::Missing();
 }
 
+bool ActiveResolveAttempts::HasFreeSlot() const
+{
+    for (auto & entry : mRetryQueue)
+    {
+        if (entry.attempt.IsEmpty())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 bool ActiveResolveAttempts::IsWaitingForIpResolutionFor(SerializedQNameIterator hostName) const
 {
     for (auto & entry : mRetryQueue)
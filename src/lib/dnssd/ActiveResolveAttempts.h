@@ -20,6 +20,7 @@
 #include <cstddef>
 #include <cstdint>
 
+#include <lib/core/CHIPConfig.h>
 #include <lib/core/Optional.h>
 #include <lib/core/PeerId.h>
 #include <lib/dnssd/Resolver.h>
@@ -41,7 +42,7 @@ namespace Minimal {
 class ActiveResolveAttempts
 {
 public:
-    static constexpr size_t kRetryQueueSize                      = 4;
+    static constexpr size_t kRetryQueueSize                      = CHIP_CONFIG_MINMDNS_RETRY_QUEUE_SIZE;
     static constexpr chip::System::Clock::Timeout kMaxRetryDelay = chip::System::Clock::Seconds16(16);
 
     struct ScheduledAttempt
@@ -227,6 +228,10 @@ public:
     //    any peer that needs a new request sent
     chip::Optional<ScheduledAttempt> NextScheduled();
 
+    /// Check if a new resolution can be marked pending without replacing
+    /// one that is still pending.
+    bool HasFreeSlot() const;
+
     /// Check if any of the pending queries are for the given host name for
     /// IP resolution.
     bool IsWaitingForIpResolutionFor(SerializedQNameIterator hostName) const;
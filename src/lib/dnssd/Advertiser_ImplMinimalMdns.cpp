@@ -26,6 +26,7 @@
 #include <crypto/RandUtils.h>
 #include <lib/dnssd/Advertiser_ImplMinimalMdnsAllocator.h>
 #include <lib/dnssd/minimal_mdns/AddressPolicy.h>
+#include <lib/dnssd/minimal_mdns/ResponseCache.h>
 #include <lib/dnssd/minimal_mdns/ResponseSender.h>
 #include <lib/dnssd/minimal_mdns/Server.h>
 #include <lib/dnssd/minimal_mdns/core/FlatAllocatedQName.h>
@@ -163,6 +164,7 @@ public:
     AdvertiserMinMdns() : mResponseSender(&GlobalMinimalMdnsServer::Server())
     {
         GlobalMinimalMdnsServer::Instance().SetQueryDelegate(this);
+        mResponseSender.SetResponseCache(&mResponseCache);
 
         CHIP_ERROR err = mResponseSender.AddQueryResponder(mQueryResponderAllocatorCommissionable.GetQueryResponder());
 
@@ -282,6 +284,9 @@ private:
     OperationalQueryAllocator::Allocator * FindEmptyOperationalAllocator();
 
     ResponseSender mResponseSender;
+    // Replies to repeated queries. Cached replies refer to the records above and MUST be
+    // invalidated whenever any of them changes.
+    ResponseCache mResponseCache;
     uint8_t mCommissionableInstanceName[sizeof(uint64_t)];
 
     bool mIsInitialized = false;
@@ -337,6 +342,9 @@ CHIP_ERROR AdvertiserMinMdns::Init(chip::Inet::EndPointManager<chip::Inet::UDPEn
     // GlobalMinimalMdnsServer to handle that.
     GlobalMinimalMdnsServer::Server().Shutdown();
 
+    // Interfaces may have changed
+    mResponseCache.Invalidate();
+
     if (!mIsInitialized)
     {
         UpdateCommissionableInstanceName();
@@ -362,11 +370,14 @@ void AdvertiserMinMdns::Shutdown()
     AdvertiseRecords(BroadcastAdvertiseType::kRemovingAll);
 
     GlobalMinimalMdnsServer::Server().Shutdown();
+    mResponseCache.Invalidate();
     mIsInitialized = false;
 }
 
 CHIP_ERROR AdvertiserMinMdns::RemoveServices()
 {
+    mResponseCache.Invalidate();
+
     while (mOperationalResponders.begin() != mOperationalResponders.end())
     {
         auto it = mOperationalResponders.begin();
@@ -441,6 +452,7 @@ CHIP_ERROR AdvertiserMinMdns::Advertise(const OperationalAdvertisingParameters &
     // which will clear caches (including things we are about to remove). Once this is done
     // we will re-advertise available records with a longer TTL again.
     AdvertiseRecords(BroadcastAdvertiseType::kRemovingAll);
+    mResponseCache.Invalidate();
 
     QNamePart nameCheckParts[]  = { nameBuffer, kOperationalServiceName, kOperationalProtocol, kLocalDomain };
     FullQName nameCheck         = FullQName(nameCheckParts);
@@ -561,6 +573,7 @@ CHIP_ERROR AdvertiserMinMdns::Advertise(const CommissionAdvertisingParameters &
     // which will clear caches (including things we are about to remove). Once this is done
     // we will re-advertise available records with a longer TTL again.
     AdvertiseRecords(BroadcastAdvertiseType::kRemovingAll);
+    mResponseCache.Invalidate();
 
     if (params.GetCommissionAdvertiseMode() == CommssionAdvertiseMode::kCommissionableNode)
     {
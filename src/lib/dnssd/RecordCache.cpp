@@ -0,0 +1,364 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "RecordCache.h"
+
+#include <ctype.h>
+#include <string.h>
+
+#include <lib/dnssd/minimal_mdns/RecordData.h>
+#include <lib/dnssd/minimal_mdns/core/RecordWriter.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+namespace mdns {
+namespace Minimal {
+namespace {
+
+constexpr uint32_t kFnvOffsetBasis = 2166136261u;
+constexpr uint32_t kFnvPrime       = 16777619u;
+
+uint32_t HashLabel(uint32_t hash, const char * label)
+{
+    // QName comparisons are case insensitive, so is the hash
+    for (; *label != '\0'; label++)
+    {
+        hash = (hash ^ static_cast<uint32_t>(tolower(static_cast<unsigned char>(*label)))) * kFnvPrime;
+    }
+    return (hash ^ '.') * kFnvPrime;
+}
+
+uint32_t HashName(SerializedQNameIterator name)
+{
+    uint32_t hash = kFnvOffsetBasis;
+    while (name.Next())
+    {
+        hash = HashLabel(hash, name.Value());
+    }
+    return hash;
+}
+
+uint32_t HashName(const FullQName & name)
+{
+    uint32_t hash = kFnvOffsetBasis;
+    for (size_t i = 0; i < name.nameCount; i++)
+    {
+        hash = HashLabel(hash, name.names[i]);
+    }
+    return hash;
+}
+
+bool IsAddress(QType type)
+{
+    return (type == QType::A) || (type == QType::AAAA);
+}
+
+/// Write [data] as a complete resource record in [buffer], such that the record
+/// can be parsed using [buffer] alone as packet data.
+CHIP_ERROR SerializeRecord(const ResourceData & data, const BytesRange & packet, uint8_t * buffer, size_t bufferSize,
+                           uint16_t & recordLength)
+{
+    chip::Encoding::BigEndian::BufferWriter output(buffer, bufferSize);
+    RecordWriter writer(&output);
+
+    writer.WriteQName(data.GetName());
+    writer.Put16(static_cast<uint16_t>(data.GetType()))
+        .Put16(static_cast<uint16_t>(data.GetClass()))
+        .Put32(static_cast<uint32_t>(chip::min<uint64_t>(data.GetTtlSeconds(), UINT32_MAX)));
+
+    const size_t dataLengthOffset = output.Needed();
+    writer.Put16(0); // updated once data is written
+
+    if (data.GetType() == QType::SRV)
+    {
+        // SRV target may point anywhere in the packet, so it has to be written again
+        SrvRecord srv;
+        VerifyOrReturnError(srv.Parse(data.GetData(), packet), CHIP_ERROR_INVALID_ARGUMENT);
+        writer.Put16(srv.GetPriority()).Put16(srv.GetWeight()).Put16(srv.GetPort()).WriteQName(srv.GetName());
+    }
+    else
+    {
+        writer.Put(data.GetData());
+    }
+
+    VerifyOrReturnError(writer.Fit(), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    const size_t dataLength = output.Needed() - dataLengthOffset - sizeof(uint16_t);
+    buffer[dataLengthOffset]     = static_cast<uint8_t>(dataLength >> 8);
+    buffer[dataLengthOffset + 1] = static_cast<uint8_t>(dataLength & 0xFF);
+
+    recordLength = static_cast<uint16_t>(output.Needed());
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+CHIP_ERROR RecordCacheBase::AddRecord(chip::Inet::InterfaceId interface, const ResourceData & data, const BytesRange & packet)
+{
+    switch (data.GetType())
+    {
+    case QType::SRV:
+    case QType::TXT:
+    case QType::A:
+    case QType::AAAA:
+        break;
+    default:
+        return CHIP_NO_ERROR; // not needed for resolution
+    }
+
+    uint8_t buffer[kMaxRecordSize];
+    uint16_t recordLength = 0;
+    ReturnErrorOnFailure(SerializeRecord(data, packet, buffer, sizeof(buffer), recordLength));
+
+    // Drop the records this one replaces
+    const uint32_t nameHash = HashName(data.GetName());
+    size_t index            = 0;
+    for (Entry * entry = FindNext(index, data.GetType(), data.GetName(), nameHash); entry != nullptr;
+         entry         = FindNext(++index, data.GetType(), data.GetName(), nameHash))
+    {
+        if (IsAddress(data.GetType()))
+        {
+            // Hosts have several addresses, only replace the same address
+            ResourceData cached;
+            if (ParseEntry(*entry, cached) &&
+                ((entry->interface != interface) || (cached.GetData().Size() != data.GetData().Size()) ||
+                 (memcmp(cached.GetData().Start(), data.GetData().Start(), data.GetData().Size()) != 0)))
+            {
+                continue;
+            }
+        }
+        Free(*entry);
+    }
+
+    // TTL of 0 means the record is being removed
+    ReturnErrorCodeIf(data.GetTtlSeconds() == 0, CHIP_NO_ERROR);
+
+    const chip::System::Clock::Timestamp now = mClock->GetMonotonicTimestamp();
+    const uint64_t ttl                       = data.GetTtlSeconds();
+
+    Entry * entry = AllocateEntry(now);
+    ReturnErrorCodeIf(entry == nullptr, CHIP_ERROR_NO_MEMORY);
+
+    entry->record = static_cast<uint8_t *>(chip::Platform::MemoryAlloc(recordLength));
+    ReturnErrorCodeIf(entry->record == nullptr, CHIP_ERROR_NO_MEMORY);
+
+    memcpy(entry->record, buffer, recordLength);
+    entry->recordLength = recordLength;
+    entry->nameHash     = nameHash;
+    entry->type         = data.GetType();
+    entry->interface    = interface;
+    entry->expiry       = now + chip::System::Clock::Seconds32(static_cast<uint32_t>(chip::min<uint64_t>(ttl, UINT32_MAX)));
+
+    mStatistics.inserts++;
+    return CHIP_NO_ERROR;
+}
+
+bool RecordCacheBase::Fill(const FullQName & name, chip::Dnssd::IncrementalResolver & resolver)
+{
+    size_t index = 0;
+    Entry * srv  = FindNext(index, QType::SRV, name, HashName(name));
+
+    return (srv != nullptr) && FillFromSrv(*srv, resolver);
+}
+
+bool RecordCacheBase::Lookup(const FullQName & name, chip::Dnssd::IncrementalResolver & resolver)
+{
+    if (Fill(name, resolver))
+    {
+        mStatistics.hits++;
+        return true;
+    }
+
+    mStatistics.misses++;
+    return false;
+}
+
+bool RecordCacheBase::FillNext(size_t & index, chip::Dnssd::IncrementalResolver & resolver)
+{
+    const chip::System::Clock::Timestamp now = mClock->GetMonotonicTimestamp();
+
+    for (; index < mEntryCount; index++)
+    {
+        Entry & entry = mEntries[index];
+        if ((entry.record == nullptr) || (entry.type != QType::SRV) || IsExpired(entry, now))
+        {
+            continue;
+        }
+
+        if (FillFromSrv(entry, resolver))
+        {
+            index++;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void RecordCacheBase::Clear()
+{
+    for (size_t i = 0; i < mEntryCount; i++)
+    {
+        Free(mEntries[i]);
+    }
+}
+
+size_t RecordCacheBase::GetRecordCount()
+{
+    const chip::System::Clock::Timestamp now = mClock->GetMonotonicTimestamp();
+
+    size_t count = 0;
+    for (size_t i = 0; i < mEntryCount; i++)
+    {
+        if (mEntries[i].record == nullptr)
+        {
+            continue;
+        }
+        if (IsExpired(mEntries[i], now))
+        {
+            Free(mEntries[i]);
+            continue;
+        }
+        count++;
+    }
+    return count;
+}
+
+void RecordCacheBase::Free(Entry & entry)
+{
+    if (entry.record != nullptr)
+    {
+        chip::Platform::MemoryFree(entry.record);
+        entry.record       = nullptr;
+        entry.recordLength = 0;
+    }
+}
+
+bool RecordCacheBase::IsExpired(const Entry & entry, chip::System::Clock::Timestamp now) const
+{
+    return entry.expiry <= now;
+}
+
+bool RecordCacheBase::ParseEntry(const Entry & entry, ResourceData & data)
+{
+    const uint8_t * start = entry.record;
+    return data.Parse(BytesRange(entry.record, entry.record + entry.recordLength), &start);
+}
+
+template <class NameType>
+RecordCacheBase::Entry * RecordCacheBase::FindNext(size_t & index, QType type, const NameType & name, uint32_t nameHash)
+{
+    const chip::System::Clock::Timestamp now = mClock->GetMonotonicTimestamp();
+
+    for (; index < mEntryCount; index++)
+    {
+        Entry & entry = mEntries[index];
+        if (entry.record == nullptr)
+        {
+            continue;
+        }
+        if (IsExpired(entry, now))
+        {
+            Free(entry);
+            continue;
+        }
+        if ((entry.type != type) || (entry.nameHash != nameHash))
+        {
+            continue;
+        }
+
+        ResourceData data;
+        if (ParseEntry(entry, data) && (data.GetName() == name))
+        {
+            return &entry;
+        }
+    }
+
+    return nullptr;
+}
+
+void RecordCacheBase::Feed(QType type, SerializedQNameIterator name, chip::Dnssd::IncrementalResolver & resolver)
+{
+    const uint32_t nameHash = HashName(name);
+
+    size_t index = 0;
+    for (Entry * entry = FindNext(index, type, name, nameHash); entry != nullptr; entry = FindNext(++index, type, name, nameHash))
+    {
+        ResourceData data;
+        if (ParseEntry(*entry, data))
+        {
+            // Errors are not fatal: a resolve may not need all records (e.g. when out of space for IP addresses)
+            resolver.OnRecord(entry->interface, data, BytesRange(entry->record, entry->record + entry->recordLength));
+        }
+    }
+}
+
+bool RecordCacheBase::FillFromSrv(const Entry & srv, chip::Dnssd::IncrementalResolver & resolver)
+{
+    resolver.ResetToInactive();
+
+    ResourceData data;
+    SrvRecord srvRecord;
+    VerifyOrReturnValue(ParseEntry(srv, data), false);
+    VerifyOrReturnValue(srvRecord.Parse(data.GetData(), BytesRange(srv.record, srv.record + srv.recordLength)), false);
+    VerifyOrReturnValue(resolver.InitializeParsing(data.GetName(), srvRecord) == CHIP_NO_ERROR, false);
+
+    Feed(QType::TXT, resolver.GetRecordName(), resolver);
+    Feed(QType::AAAA, resolver.GetTargetHostName(), resolver);
+    Feed(QType::A, resolver.GetTargetHostName(), resolver);
+
+    if (resolver.GetMissingRequiredInformation().HasAny())
+    {
+        resolver.ResetToInactive();
+        return false;
+    }
+
+    return true;
+}
+
+RecordCacheBase::Entry * RecordCacheBase::AllocateEntry(chip::System::Clock::Timestamp now)
+{
+    Entry * oldest = nullptr;
+
+    for (size_t i = 0; i < mEntryCount; i++)
+    {
+        Entry & entry = mEntries[i];
+        if ((entry.record != nullptr) && IsExpired(entry, now))
+        {
+            Free(entry);
+        }
+        if (entry.record == nullptr)
+        {
+            return &entry;
+        }
+        if ((oldest == nullptr) || (entry.expiry < oldest->expiry))
+        {
+            oldest = &entry;
+        }
+    }
+
+    if (oldest != nullptr)
+    {
+        Free(*oldest);
+        mStatistics.evictions++;
+    }
+
+    return oldest;
+}
+
+} // namespace Minimal
+} // namespace mdns
@@ -0,0 +1,149 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <inet/InetInterface.h>
+#include <lib/dnssd/IncrementalResolve.h>
+#include <lib/dnssd/minimal_mdns/Parser.h>
+#include <lib/dnssd/minimal_mdns/core/QName.h>
+#include <system/SystemClock.h>
+
+namespace mdns {
+namespace Minimal {
+
+/// Keeps the DNSSD records received by the resolver until their TTL expires.
+///
+/// Every response seen on the network (including unsolicited announcements and
+/// replies to queries sent by other nodes) carries SRV, TXT and A/AAAA records that
+/// a later resolve may need. Keeping them allows resolves to be answered locally
+/// instead of querying the network again.
+///
+/// Records are stored self-contained (name compression only refers to data within
+/// the record) in heap-allocated buffers. When full, the record closest to expiry
+/// is evicted.
+class RecordCacheBase
+{
+public:
+    struct Statistics
+    {
+        uint32_t hits      = 0; // lookups answered from the cache
+        uint32_t misses    = 0; // lookups that required a network query
+        uint32_t inserts   = 0; // records added to the cache
+        uint32_t evictions = 0; // records dropped before they expired, to make space
+    };
+
+    // Records larger than this are not cached (TXT records are the largest expected ones)
+    static constexpr size_t kMaxRecordSize = 512;
+
+    RecordCacheBase(const RecordCacheBase &) = delete;
+    RecordCacheBase & operator=(const RecordCacheBase &) = delete;
+
+    /// Store a record received in a response.
+    ///
+    /// Only records useful for node resolution are kept (SRV, TXT, A and AAAA). A record
+    /// replaces previously received records of the same name and type (for A/AAAA records:
+    /// of the same address). A record with a TTL of 0 removes them instead.
+    ///
+    /// [packet] represents the range of valid bytes within the packet for the purpose of
+    /// QName parsing.
+    CHIP_ERROR AddRecord(chip::Inet::InterfaceId interface, const ResourceData & data, const BytesRange & packet);
+
+    /// Initialize [resolver] from the cached SRV record named [name] and feed it all
+    /// the cached TXT and IP address records for that service.
+    ///
+    /// Returns true if the resolver ended up active with no information missing. Does not
+    /// update statistics, see Lookup().
+    bool Fill(const FullQName & name, chip::Dnssd::IncrementalResolver & resolver);
+
+    /// Same as Fill(), updating the hit/miss statistics.
+    bool Lookup(const FullQName & name, chip::Dnssd::IncrementalResolver & resolver);
+
+    /// Iterate over all cached services: fills [resolver] with the next cached SRV record
+    /// from position [index] that can be completely resolved from the cache.
+    ///
+    /// Start with [index] set to 0. Returns false once all records were visited.
+    bool FillNext(size_t & index, chip::Dnssd::IncrementalResolver & resolver);
+
+    /// Drop all cached records.
+    void Clear();
+
+    /// Number of unexpired records.
+    size_t GetRecordCount();
+
+    const Statistics & GetStatistics() const { return mStatistics; }
+
+protected:
+    struct Entry
+    {
+        uint8_t * record = nullptr; // heap allocated, self-contained record
+        uint16_t recordLength = 0;
+        uint32_t nameHash     = 0;
+        QType type            = QType::ANY;
+        chip::Inet::InterfaceId interface;
+        chip::System::Clock::Timestamp expiry;
+    };
+
+    RecordCacheBase(chip::System::Clock::ClockBase * clock, Entry * entries, size_t entryCount) :
+        mClock(clock), mEntries(entries), mEntryCount(entryCount)
+    {}
+    ~RecordCacheBase() = default;
+
+private:
+    void Free(Entry & entry);
+    bool IsExpired(const Entry & entry, chip::System::Clock::Timestamp now) const;
+
+    /// Parse the record kept by the given entry.
+    static bool ParseEntry(const Entry & entry, ResourceData & data);
+
+    /// Find the next unexpired entry starting at [index] of the given type matching [name].
+    template <class NameType>
+    Entry * FindNext(size_t & index, QType type, const NameType & name, uint32_t nameHash);
+
+    /// Feed [resolver] all the cached records of the given type and name.
+    void Feed(QType type, SerializedQNameIterator name, chip::Dnssd::IncrementalResolver & resolver);
+
+    /// Initialize [resolver] from a cached SRV record and feed it the records of the service.
+    bool FillFromSrv(const Entry & srv, chip::Dnssd::IncrementalResolver & resolver);
+
+    /// Select where to store a new record, evicting the record closest to expiry if needed.
+    Entry * AllocateEntry(chip::System::Clock::Timestamp now);
+
+    chip::System::Clock::ClockBase * mClock;
+    Entry * mEntries;
+    size_t mEntryCount;
+    Statistics mStatistics;
+};
+
+/// A record cache holding up to N records.
+template <size_t N>
+class RecordCache : public RecordCacheBase
+{
+public:
+    RecordCache(chip::System::Clock::ClockBase * clock) : RecordCacheBase(clock, mEntryStorage, N) {}
+    ~RecordCache() { Clear(); }
+
+private:
+    // keep a valid array type even if caching is disabled
+    Entry mEntryStorage[N > 0 ? N : 1];
+};
+
+} // namespace Minimal
+} // namespace mdns
@@ -23,6 +23,7 @@
 #include <lib/dnssd/ActiveResolveAttempts.h>
 #include <lib/dnssd/IncrementalResolve.h>
 #include <lib/dnssd/MinimalMdnsServer.h>
+#include <lib/dnssd/RecordCache.h>
 #include <lib/dnssd/ResolverProxy.h>
 #include <lib/dnssd/ServiceNaming.h>
 #include <lib/dnssd/minimal_mdns/Logging.h>
@@ -42,11 +43,80 @@ namespace chip {
 namespace Dnssd {
 namespace {
 
+// Query packets are kept below the IPv6 minimum MTU (1280 bytes, minus IP and UDP headers)
 constexpr size_t kMdnsMaxPacketSize = 1024;
 constexpr uint16_t kMdnsPort        = 5353;
 
+// Retries are delayed by up to this much so that retries due around the same time share a packet
+constexpr System::Clock::Milliseconds32 kRetryCoalescingWindow(100);
+
 using namespace mdns::Minimal;
 
+/// Checks if the given SRV record name is a service of the given discovery type
+bool IsServiceOfType(SerializedQNameIterator name, DiscoveryType type)
+{
+    const QNamePart commissionableSuffix[] = { kCommissionableServiceName, kCommissionProtocol, kLocalDomain };
+    const QNamePart commissionerSuffix[]   = { kCommissionerServiceName, kCommissionProtocol, kLocalDomain };
+
+    // skip over the instance name
+    VerifyOrReturnValue(name.Next() && name.IsValid(), false);
+
+    switch (type)
+    {
+    case DiscoveryType::kCommissionableNode:
+        return name == FullQName(commissionableSuffix);
+    case DiscoveryType::kCommissionerNode:
+        return name == FullQName(commissionerSuffix);
+    default:
+        return false;
+    }
+}
+
+/// Checks if the given filter can be applied to data already received, rather
+/// than through the subtype of a browse query.
+bool CanFilterLocally(const DiscoveryFilter & filter)
+{
+    switch (filter.type)
+    {
+    case DiscoveryFilterType::kNone:
+    case DiscoveryFilterType::kShortDiscriminator:
+    case DiscoveryFilterType::kLongDiscriminator:
+    case DiscoveryFilterType::kVendorId:
+    case DiscoveryFilterType::kDeviceType:
+    case DiscoveryFilterType::kCommissioningMode:
+    case DiscoveryFilterType::kInstanceName:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/// Checks if a discovered node would be reported by a browse using the given filter.
+bool MatchesFilter(const DiscoveredNodeData & nodeData, const DiscoveryFilter & filter)
+{
+    const CommissionNodeData & data = nodeData.commissionData;
+
+    switch (filter.type)
+    {
+    case DiscoveryFilterType::kNone:
+        return true;
+    case DiscoveryFilterType::kShortDiscriminator:
+        return ((data.longDiscriminator >> 8) & 0x0F) == filter.code;
+    case DiscoveryFilterType::kLongDiscriminator:
+        return data.longDiscriminator == filter.code;
+    case DiscoveryFilterType::kVendorId:
+        return data.vendorId == filter.code;
+    case DiscoveryFilterType::kDeviceType:
+        return data.deviceType == filter.code;
+    case DiscoveryFilterType::kCommissioningMode:
+        return data.commissioningMode != 0;
+    case DiscoveryFilterType::kInstanceName:
+        return (filter.instanceName != nullptr) && data.IsInstanceName(filter.instanceName);
+    default:
+        return false;
+    }
+}
+
 /// Handles processing of minmdns packet data.
 ///
 /// Can process multiple incremental resolves based on SRV data and allows
@@ -55,7 +125,9 @@ using namespace mdns::Minimal;
 class PacketParser : private ParserDelegate
 {
 public:
-    PacketParser(ActiveResolveAttempts & activeResolves) : mActiveResolves(activeResolves) {}
+    PacketParser(ActiveResolveAttempts & activeResolves, RecordCacheBase & recordCache) :
+        mActiveResolves(activeResolves), mRecordCache(recordCache)
+    {}
 
     /// Goes through the given SRV records within a response packet
     /// and sets up data resolution
@@ -104,6 +176,7 @@ private:
 
     // resolvers kept between parse steps
     ActiveResolveAttempts & mActiveResolves;
+    RecordCacheBase & mRecordCache;
     IncrementalResolver mResolvers[kMinMdnsNumParallelResolvers];
 };
 
@@ -161,6 +234,17 @@ void PacketParser::OnResource(ResourceType type, const ResourceData & data)
 
 void PacketParser::ParseResource(const ResourceData & data)
 {
+    // Keep every record, including the ones nobody is waiting for yet (e.g. announcements)
+    CHIP_ERROR cacheErr = mRecordCache.AddRecord(mInterfaceId, data, mPacketRange);
+#if CHIP_MINMDNS_HIGH_VERBOSITY
+    if (cacheErr != CHIP_NO_ERROR)
+    {
+        ChipLogError(Discovery, "Failed to cache DNSSD record: %" CHIP_ERROR_FORMAT, cacheErr.Format());
+    }
+#else
+    (void) cacheErr;
+#endif
+
     for (auto & resolver : mResolvers)
     {
         if (resolver.IsActive())
@@ -265,7 +349,9 @@ void PacketParser::ParseNonSrvRecords(Inet::InterfaceId interface, const BytesRa
 class MinMdnsResolver : public Resolver, public MdnsPacketDelegate
 {
 public:
-    MinMdnsResolver() : mActiveResolves(&chip::System::SystemClock()), mPacketParser(mActiveResolves)
+    MinMdnsResolver() :
+        mActiveResolves(&chip::System::SystemClock()), mRecordCache(&chip::System::SystemClock()),
+        mPacketParser(mActiveResolves, mRecordCache)
     {
         GlobalMinimalMdnsServer::Instance().SetResponseDelegate(this);
     }
@@ -287,13 +373,41 @@ private:
     CommissioningResolveDelegate * mCommissioningDelegate = nullptr;
     System::Layer * mSystemLayer                          = nullptr;
     ActiveResolveAttempts mActiveResolves;
+    RecordCache<CHIP_CONFIG_MINMDNS_RECORD_CACHE_SIZE> mRecordCache;
     PacketParser mPacketParser;
 
+    // Results found in the record cache, reported from the event loop like results from the network
+    static constexpr size_t kMaxCachedResolves = 4;
+    PeerId mCachedResolves[kMaxCachedResolves];
+    size_t mCachedResolveCount = 0;
+
+    struct CachedBrowse
+    {
+        bool pending = false;
+        DiscoveryType type;
+        DiscoveryFilter filter;
+        char instanceName[Commission::kInstanceNameMaxLength + 1];
+    };
+    CachedBrowse mCachedBrowse;
+
+    /// Fill [resolver] with the cached records of the given peer. New lookups are accounted in cache statistics.
+    bool ResolveFromCache(const PeerId & peerId, IncrementalResolver & resolver, bool newLookup);
+    bool ScheduleCachedResolve(const PeerId & peerId);
+    void ScheduleCachedBrowse(DiscoveryType type, const DiscoveryFilter & filter);
+    void ReportCachedResults();
+    static void CachedResultsCallback(System::Layer *, void * self);
+
     void ScheduleIpAddressResolve(SerializedQNameIterator hostName);
 
     CHIP_ERROR SendAllPendingQueries();
     CHIP_ERROR ScheduleRetries();
 
+    /// Add the query of the given attempt to [builder], sending the packet built so far first if the query does not fit.
+    CHIP_ERROR AddToQueryPacket(QueryBuilder & builder, const ActiveResolveAttempts::ScheduledAttempt & attempt);
+
+    /// Send the packet built by [builder], if any.
+    CHIP_ERROR SendQueryPacket(QueryBuilder & builder, bool firstSend);
+
     /// Prepare a query for the given schedule attempt
     CHIP_ERROR BuildQuery(QueryBuilder & builder, const ActiveResolveAttempts::ScheduledAttempt & attempt);
 
@@ -440,6 +554,11 @@ CHIP_ERROR MinMdnsResolver::Init(chip::Inet::EndPointManager<chip::Inet::UDPEndP
 void MinMdnsResolver::Shutdown()
 {
     GlobalMinimalMdnsServer::Instance().ShutdownServer();
+
+    // Addresses may not be valid anymore once restarted (e.g. interfaces changed)
+    mRecordCache.Clear();
+    mCachedResolveCount   = 0;
+    mCachedBrowse.pending = false;
 }
 
 CHIP_ERROR MinMdnsResolver::BuildQuery(QueryBuilder & builder, const ActiveResolveAttempts::ScheduledAttempt::Browse & data,
@@ -495,8 +614,8 @@ CHIP_ERROR MinMdnsResolver::BuildQuery(QueryBuilder & builder, const ActiveResol
         .SetAnswerViaUnicast(firstSend) //
         ;
 
+    ReturnErrorCodeIf(!builder.TryAddQuery(query), CHIP_ERROR_BUFFER_TOO_SMALL);
     mdns::Minimal::Logging::LogSendingQuery(query);
-    builder.AddQuery(query);
 
     return CHIP_NO_ERROR;
 }
@@ -518,8 +637,8 @@ CHIP_ERROR MinMdnsResolver::BuildQuery(QueryBuilder & builder, const ActiveResol
         .SetAnswerViaUnicast(firstSend) //
         ;
 
+    ReturnErrorCodeIf(!builder.TryAddQuery(query), CHIP_ERROR_BUFFER_TOO_SMALL);
     mdns::Minimal::Logging::LogSendingQuery(query);
-    builder.AddQuery(query);
 
     return CHIP_NO_ERROR;
 }
@@ -536,8 +655,8 @@ CHIP_ERROR MinMdnsResolver::BuildQuery(QueryBuilder & builder, const ActiveResol
         .SetAnswerViaUnicast(firstSend) //
         ;
 
+    ReturnErrorCodeIf(!builder.TryAddQuery(query), CHIP_ERROR_BUFFER_TOO_SMALL);
     mdns::Minimal::Logging::LogSendingQuery(query);
-    builder.AddQuery(query);
 
     return CHIP_NO_ERROR;
 }
@@ -565,8 +684,48 @@ CHIP_ERROR MinMdnsResolver::BuildQuery(QueryBuilder & builder, const ActiveResol
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR MinMdnsResolver::AddToQueryPacket(QueryBuilder & builder, const ActiveResolveAttempts::ScheduledAttempt & attempt)
+{
+    if (builder.HasPacket())
+    {
+        CHIP_ERROR err = BuildQuery(builder, attempt);
+        if (err != CHIP_ERROR_BUFFER_TOO_SMALL)
+        {
+            return err;
+        }
+
+        // Packet is full
+        ReturnErrorOnFailure(SendQueryPacket(builder, attempt.firstSend));
+    }
+
+    System::PacketBufferHandle buffer = System::PacketBufferHandle::New(kMdnsMaxPacketSize);
+    ReturnErrorCodeIf(buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+    builder.Reset(std::move(buffer));
+    builder.Header().SetMessageId(0);
+
+    return BuildQuery(builder, attempt);
+}
+
+CHIP_ERROR MinMdnsResolver::SendQueryPacket(QueryBuilder & builder, bool firstSend)
+{
+    VerifyOrReturnError(builder.HasPacket(), CHIP_NO_ERROR);
+
+    if (firstSend)
+    {
+        return GlobalMinimalMdnsServer::Server().BroadcastUnicastQuery(builder.ReleasePacket(), kMdnsPort);
+    }
+
+    return GlobalMinimalMdnsServer::Server().BroadcastSend(builder.ReleasePacket(), kMdnsPort);
+}
+
 CHIP_ERROR MinMdnsResolver::SendAllPendingQueries()
 {
+    // Queries are packed in as few packets as possible. First queries ask for
+    // unicast answers and are sent separately from retries.
+    QueryBuilder firstSendBuilder;
+    QueryBuilder retryBuilder;
+
     while (true)
     {
         Optional<ActiveResolveAttempts::ScheduledAttempt> resolve = mActiveResolves.NextScheduled();
@@ -576,24 +735,12 @@ CHIP_ERROR MinMdnsResolver::SendAllPendingQueries()
             break;
         }
 
-        System::PacketBufferHandle buffer = System::PacketBufferHandle::New(kMdnsMaxPacketSize);
-        ReturnErrorCodeIf(buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
-
-        QueryBuilder builder(std::move(buffer));
-        builder.Header().SetMessageId(0);
-
-        ReturnErrorOnFailure(BuildQuery(builder, resolve.Value()));
-
-        if (resolve.Value().firstSend)
-        {
-            ReturnErrorOnFailure(GlobalMinimalMdnsServer::Server().BroadcastUnicastQuery(builder.ReleasePacket(), kMdnsPort));
-        }
-        else
-        {
-            ReturnErrorOnFailure(GlobalMinimalMdnsServer::Server().BroadcastSend(builder.ReleasePacket(), kMdnsPort));
-        }
+        ReturnErrorOnFailure(AddToQueryPacket(resolve.Value().firstSend ? firstSendBuilder : retryBuilder, resolve.Value()));
     }
 
+    ReturnErrorOnFailure(SendQueryPacket(firstSendBuilder, true /* firstSend */));
+    ReturnErrorOnFailure(SendQueryPacket(retryBuilder, false /* firstSend */));
+
     ExpireIncrementalResolvers();
 
     return ScheduleRetries();
@@ -635,6 +782,9 @@ CHIP_ERROR MinMdnsResolver::DiscoverCommissioners(DiscoveryFilter filter)
 
 CHIP_ERROR MinMdnsResolver::BrowseNodes(DiscoveryType type, DiscoveryFilter filter)
 {
+    // Nodes seen earlier are reported right away, the network is still browsed for new ones
+    ScheduleCachedBrowse(type, filter);
+
     mActiveResolves.MarkPending(filter, type);
 
     return SendAllPendingQueries();
@@ -642,9 +792,129 @@ CHIP_ERROR MinMdnsResolver::BrowseNodes(DiscoveryType type, DiscoveryFilter filt
 
 CHIP_ERROR MinMdnsResolver::ResolveNodeId(const PeerId & peerId, Inet::IPAddressType type)
 {
+    if (ScheduleCachedResolve(peerId))
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    if (!mActiveResolves.HasFreeSlot())
+    {
+        // Send what is pending rather than replacing resolves that were never queried
+        ReturnErrorOnFailure(SendAllPendingQueries());
+    }
+
     mActiveResolves.MarkPending(peerId);
 
-    return SendAllPendingQueries();
+    // Queries are sent from the event loop, so that resolves requested together
+    // (e.g. all nodes of a controller at startup) share query packets.
+    return ScheduleRetries();
+}
+
+bool MinMdnsResolver::ResolveFromCache(const PeerId & peerId, IncrementalResolver & resolver, bool newLookup)
+{
+    char nameBuffer[kMaxOperationalServiceNameSize] = "";
+    VerifyOrReturnValue(MakeInstanceName(nameBuffer, sizeof(nameBuffer), peerId) == CHIP_NO_ERROR, false);
+
+    const QNamePart instanceQName[] = { nameBuffer, kOperationalServiceName, kOperationalProtocol, kLocalDomain };
+
+    return newLookup ? mRecordCache.Lookup(FullQName(instanceQName), resolver)
+                     : mRecordCache.Fill(FullQName(instanceQName), resolver);
+}
+
+bool MinMdnsResolver::ScheduleCachedResolve(const PeerId & peerId)
+{
+    VerifyOrReturnValue(mSystemLayer != nullptr, false);
+    VerifyOrReturnValue(mCachedResolveCount < kMaxCachedResolves, false);
+
+    IncrementalResolver resolver;
+    VerifyOrReturnValue(ResolveFromCache(peerId, resolver, true /* newLookup */), false);
+    VerifyOrReturnValue(mSystemLayer->ScheduleWork(&CachedResultsCallback, this) == CHIP_NO_ERROR, false);
+
+    mCachedResolves[mCachedResolveCount++] = peerId;
+    return true;
+}
+
+void MinMdnsResolver::ScheduleCachedBrowse(DiscoveryType type, const DiscoveryFilter & filter)
+{
+    VerifyOrReturn(mSystemLayer != nullptr);
+    VerifyOrReturn(CanFilterLocally(filter));
+
+    mCachedBrowse.type   = type;
+    mCachedBrowse.filter = filter;
+    if (filter.type == DiscoveryFilterType::kInstanceName)
+    {
+        VerifyOrReturn(filter.instanceName != nullptr);
+        Platform::CopyString(mCachedBrowse.instanceName, filter.instanceName);
+        mCachedBrowse.filter.instanceName = mCachedBrowse.instanceName;
+    }
+
+    VerifyOrReturn(mSystemLayer->ScheduleWork(&CachedResultsCallback, this) == CHIP_NO_ERROR);
+    mCachedBrowse.pending = true;
+}
+
+void MinMdnsResolver::ReportCachedResults()
+{
+    // Delegates may start new resolves: work on a copy
+    PeerId peers[kMaxCachedResolves];
+    const size_t peerCount = mCachedResolveCount;
+    for (size_t i = 0; i < peerCount; i++)
+    {
+        peers[i] = mCachedResolves[i];
+    }
+    mCachedResolveCount = 0;
+
+    bool queryNeeded = false;
+    for (size_t i = 0; i < peerCount; i++)
+    {
+        IncrementalResolver resolver;
+        ResolvedNodeData nodeData;
+
+        if (!ResolveFromCache(peers[i], resolver, false /* newLookup */) || (resolver.Take(nodeData) != CHIP_NO_ERROR))
+        {
+            // Records expired (or were removed) since the lookup started
+            mActiveResolves.MarkPending(peers[i]);
+            queryNeeded = true;
+            continue;
+        }
+
+        if (mOperationalDelegate != nullptr)
+        {
+            mOperationalDelegate->OnOperationalNodeResolved(nodeData);
+        }
+    }
+
+    if (mCachedBrowse.pending)
+    {
+        mCachedBrowse.pending = false;
+
+        IncrementalResolver resolver;
+        size_t index = 0;
+        while (mRecordCache.FillNext(index, resolver))
+        {
+            if (!resolver.IsActiveCommissionParse() || !IsServiceOfType(resolver.GetRecordName(), mCachedBrowse.type))
+            {
+                resolver.ResetToInactive();
+                continue;
+            }
+
+            DiscoveredNodeData nodeData;
+            if ((resolver.Take(nodeData) == CHIP_NO_ERROR) && MatchesFilter(nodeData, mCachedBrowse.filter) &&
+                (mCommissioningDelegate != nullptr))
+            {
+                mCommissioningDelegate->OnNodeDiscovered(nodeData);
+            }
+        }
+    }
+
+    if (queryNeeded)
+    {
+        SendAllPendingQueries();
+    }
+}
+
+void MinMdnsResolver::CachedResultsCallback(System::Layer *, void * self)
+{
+    reinterpret_cast<MinMdnsResolver *>(self)->ReportCachedResults();
 }
 
 CHIP_ERROR MinMdnsResolver::ScheduleRetries()
@@ -659,7 +929,13 @@ CHIP_ERROR MinMdnsResolver::ScheduleRetries()
         return CHIP_NO_ERROR;
     }
 
-    return mSystemLayer->StartTimer(delay.Value(), &RetryCallback, this);
+    System::Clock::Timeout timeout = delay.Value();
+    if (timeout > System::Clock::kZero)
+    {
+        timeout += kRetryCoalescingWindow;
+    }
+
+    return mSystemLayer->StartTimer(timeout, &RetryCallback, this);
 }
 
 void MinMdnsResolver::RetryCallback(System::Layer *, void * self)
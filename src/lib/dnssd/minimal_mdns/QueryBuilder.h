@@ -25,20 +25,36 @@
 namespace mdns {
 namespace Minimal {
 
+/// Builds a query packet, holding one or more questions.
+///
+/// Names are compressed across all the questions of the packet: many questions
+/// typically share the same service suffix (e.g. resolving several nodes).
 class QueryBuilder
 {
 public:
-    QueryBuilder() : mHeader(nullptr) {}
-    QueryBuilder(chip::System::PacketBufferHandle && packet) : mHeader(nullptr) { Reset(std::move(packet)); }
+    QueryBuilder() : mHeader(nullptr), mOutput(nullptr, 0), mWriter(&mOutput) {}
+    QueryBuilder(chip::System::PacketBufferHandle && packet) : mHeader(nullptr), mOutput(nullptr, 0), mWriter(&mOutput)
+    {
+        Reset(std::move(packet));
+    }
+
+    // mWriter refers to mOutput
+    QueryBuilder(const QueryBuilder &) = delete;
+    QueryBuilder & operator=(const QueryBuilder &) = delete;
 
     QueryBuilder & Reset(chip::System::PacketBufferHandle && packet)
     {
-        mPacket = std::move(packet);
-        mHeader = HeaderRef(mPacket->Start());
+        mPacket       = std::move(packet);
+        mHeader       = HeaderRef(mPacket->Start());
+        mQueryBuildOk = true;
+
+        mOutput = chip::Encoding::BigEndian::BufferWriter(mPacket->Start(), mPacket->AvailableDataLength());
+        mWriter.Reset();
 
         if (mPacket->AvailableDataLength() >= HeaderRef::kSizeBytes)
         {
             mPacket->SetDataLength(HeaderRef::kSizeBytes);
+            mOutput.Skip(HeaderRef::kSizeBytes);
             mHeader.Clear();
         }
         else
@@ -60,6 +76,9 @@ public:
 
     HeaderRef & Header() { return mHeader; }
 
+    /// Returns true if a packet is being built (i.e. not yet released).
+    bool HasPacket() const { return !mPacket.IsNull(); }
+
     QueryBuilder & AddQuery(const Query & query)
     {
         if (!mQueryBuildOk)
@@ -67,25 +86,50 @@ public:
             return *this;
         }
 
-        chip::Encoding::BigEndian::BufferWriter out(mPacket->Start() + mPacket->DataLength(), mPacket->AvailableDataLength());
-        RecordWriter writer(&out);
-
-        if (!query.Append(mHeader, writer))
+        if (!query.Append(mHeader, mWriter))
         {
             mQueryBuildOk = false;
         }
         else
         {
-            mPacket->SetDataLength(static_cast<uint16_t>(mPacket->DataLength() + out.Needed()));
+            mPacket->SetDataLength(static_cast<uint16_t>(mOutput.Needed()));
         }
         return *this;
     }
 
+    /// Add the given query if it fits in the packet.
+    ///
+    /// Unlike AddQuery, a query that does not fit leaves the builder valid, so that
+    /// the packet built so far can still be sent (and the query added to the next one).
+    bool TryAddQuery(const Query & query)
+    {
+        if (!mQueryBuildOk)
+        {
+            return false;
+        }
+
+        const chip::Encoding::BigEndian::BufferWriter outputBackup = mOutput;
+        const RecordWriter writerBackup                            = mWriter;
+
+        if (!query.Append(mHeader, mWriter))
+        {
+            // Names of a partially written query must not be used for compression
+            mOutput = outputBackup;
+            mWriter = writerBackup;
+            return false;
+        }
+
+        mPacket->SetDataLength(static_cast<uint16_t>(mOutput.Needed()));
+        return true;
+    }
+
     bool Ok() const { return mQueryBuildOk; }
 
 private:
     chip::System::PacketBufferHandle mPacket;
     HeaderRef mHeader;
+    chip::Encoding::BigEndian::BufferWriter mOutput;
+    RecordWriter mWriter;
     bool mQueryBuildOk = true;
 };
 
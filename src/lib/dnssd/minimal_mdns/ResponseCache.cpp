@@ -0,0 +1,201 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "ResponseCache.h"
+
+#include <string.h>
+
+namespace mdns {
+namespace Minimal {
+
+namespace {
+
+/// Write the labels of the given name in wire format (length prefixed labels, zero terminated).
+///
+/// Returns the length of the flattened name, or 0 if the name is invalid or too long.
+size_t FlattenQName(SerializedQNameIterator name, uint8_t * out, size_t outSize)
+{
+    size_t length = 0;
+    while (name.Next())
+    {
+        size_t labelLength = strlen(name.Value());
+        if (length + 1 + labelLength >= outSize)
+        {
+            return 0;
+        }
+        out[length++] = static_cast<uint8_t>(labelLength);
+        memcpy(out + length, name.Value(), labelLength);
+        length += labelLength;
+    }
+    if (!name.IsValid())
+    {
+        return 0;
+    }
+    out[length++] = 0;
+    return length;
+}
+
+} // namespace
+
+constexpr chip::System::Clock::Seconds16 ResponseCache::kEntryLifetime;
+
+bool ResponseCache::Entry::AddPacket(const uint8_t * data, size_t length)
+{
+    if (mPacketCount >= kMaxPacketsPerEntry)
+    {
+        return false;
+    }
+    if (!mPackets[mPacketCount].Alloc(length))
+    {
+        return false;
+    }
+    memcpy(mPackets[mPacketCount].Get(), data, length);
+    mPacketLengths[mPacketCount] = length;
+    mPacketCount++;
+    return true;
+}
+
+bool ResponseCache::Entry::AddAnswer(QueryResponderRecord * answer)
+{
+    if (mAnswerCount >= kMaxAnswersPerEntry)
+    {
+        return false;
+    }
+    if (mAnswers.Get() == nullptr && !mAnswers.Calloc(kMaxAnswersPerEntry))
+    {
+        return false;
+    }
+    mAnswers[mAnswerCount++] = answer;
+    return true;
+}
+
+void ResponseCache::Entry::Clear()
+{
+    mValid = false;
+    for (size_t i = 0; i < mPacketCount; i++)
+    {
+        mPackets[i].Free();
+        mPacketLengths[i] = 0;
+    }
+    mPacketCount = 0;
+    mAnswers.Free();
+    mAnswerCount = 0;
+    mQName.Free();
+    mQNameLength = 0;
+}
+
+const ResponseCache::Entry * ResponseCache::Find(const QueryData & query, const chip::Inet::IPPacketInfo & source,
+                                                 bool includeQuery, chip::System::Clock::Timestamp now)
+{
+    uint8_t qname[kMaxQNameLength];
+    size_t qnameLength = FlattenQName(query.GetName(), qname, sizeof(qname));
+
+    if (qnameLength > 0)
+    {
+        for (size_t i = 0; i < kCacheSize; i++)
+        {
+            Entry & entry = mEntries[i];
+            if (!entry.mValid)
+            {
+                continue;
+            }
+            if (entry.mExpiry <= now)
+            {
+                entry.Clear();
+                continue;
+            }
+            if ((entry.mType != query.GetType()) || (entry.mClass != query.GetClass()) ||
+                (entry.mUnicastAnswer != query.RequestedUnicastAnswer()) || (entry.mIncludeQuery != includeQuery) ||
+                (entry.mInterface != source.Interface) || (entry.mAddrType != source.SrcAddress.Type()) ||
+                (entry.mQNameLength != qnameLength) || (memcmp(entry.mQName.Get(), qname, qnameLength) != 0))
+            {
+                continue;
+            }
+
+            entry.mLastUsed = ++mUseCounter;
+            mHits++;
+            return &entry;
+        }
+    }
+
+    mMisses++;
+    return nullptr;
+}
+
+ResponseCache::Entry * ResponseCache::Prepare(const QueryData & query, const chip::Inet::IPPacketInfo & source, bool includeQuery)
+{
+    if (kCacheSize == 0)
+    {
+        return nullptr;
+    }
+
+    uint8_t qname[kMaxQNameLength];
+    size_t qnameLength = FlattenQName(query.GetName(), qname, sizeof(qname));
+    if (qnameLength == 0)
+    {
+        return nullptr;
+    }
+
+    // Prefer a free slot, otherwise evict the least recently used reply
+    Entry * entry = &mEntries[0];
+    for (size_t i = 0; i < kCacheSize; i++)
+    {
+        if (!mEntries[i].mValid)
+        {
+            entry = &mEntries[i];
+            break;
+        }
+        if (mEntries[i].mLastUsed < entry->mLastUsed)
+        {
+            entry = &mEntries[i];
+        }
+    }
+
+    entry->Clear();
+    if (!entry->mQName.Alloc(qnameLength))
+    {
+        return nullptr;
+    }
+    memcpy(entry->mQName.Get(), qname, qnameLength);
+    entry->mQNameLength   = qnameLength;
+    entry->mType          = query.GetType();
+    entry->mClass         = query.GetClass();
+    entry->mUnicastAnswer = query.RequestedUnicastAnswer();
+    entry->mIncludeQuery  = includeQuery;
+    entry->mInterface     = source.Interface;
+    entry->mAddrType      = source.SrcAddress.Type();
+
+    return entry;
+}
+
+void ResponseCache::Commit(Entry & entry, chip::System::Clock::Timestamp now)
+{
+    entry.mValid    = true;
+    entry.mExpiry   = now + kEntryLifetime;
+    entry.mLastUsed = ++mUseCounter;
+}
+
+void ResponseCache::Invalidate()
+{
+    for (auto & entry : mEntries)
+    {
+        entry.Clear();
+    }
+}
+
+} // namespace Minimal
+} // namespace mdns
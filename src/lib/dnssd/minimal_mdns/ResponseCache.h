@@ -0,0 +1,129 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include "Parser.h"
+
+#include <inet/IPPacketInfo.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/dnssd/minimal_mdns/responders/QueryResponder.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/Span.h>
+#include <system/SystemClock.h>
+
+namespace mdns {
+namespace Minimal {
+
+/// Keeps the encoded reply packets of recently answered queries.
+///
+/// Many controllers browsing the same services make a device answer the very same
+/// queries over and over. Replaying the packets built for the first of these queries
+/// avoids walking all the query responders and serializing the same records again.
+///
+/// Entries are keyed by everything that affects the content of a reply: the query
+/// type, class and name, whether the query is echoed back and the interface and
+/// address type the query was received on.
+///
+/// The cache does not track the records its entries were built from: its owner MUST
+/// call Invalidate() whenever the advertised records change. Entries also expire after
+/// kEntryLifetime, since address records follow the addresses of the interfaces.
+class ResponseCache
+{
+public:
+    static constexpr size_t kMaxPacketsPerEntry = 2;
+    static constexpr size_t kMaxAnswersPerEntry = 16;
+    static constexpr size_t kMaxQNameLength     = 255;
+
+    static constexpr chip::System::Clock::Seconds16 kEntryLifetime = chip::System::Clock::Seconds16(10);
+
+    /// Number of cached replies. A size of 0 disables caching (Prepare always fails).
+    static constexpr size_t kCacheSize = CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE;
+
+    class Entry
+    {
+    public:
+        /// Record a packet sent as part of the reply. Returns false if the reply is too large to be cached.
+        bool AddPacket(const uint8_t * data, size_t length);
+
+        /// Record a record sent as an answer of a multicast reply, which is subject to rate limiting when replayed.
+        /// Returns false if there are too many answers to be cached.
+        bool AddAnswer(QueryResponderRecord * answer);
+
+        size_t GetPacketCount() const { return mPacketCount; }
+        chip::ByteSpan GetPacket(size_t index) const { return chip::ByteSpan(mPackets[index].Get(), mPacketLengths[index]); }
+
+        size_t GetAnswerCount() const { return mAnswerCount; }
+        QueryResponderRecord * GetAnswer(size_t index) const { return mAnswers[index]; }
+
+    private:
+        friend class ResponseCache;
+
+        void Clear();
+
+        bool mValid                            = false;
+        chip::System::Clock::Timestamp mExpiry = chip::System::Clock::kZero;
+        uint32_t mLastUsed                     = 0;
+
+        QType mType                          = QType::ANY;
+        QClass mClass                        = QClass::ANY;
+        bool mUnicastAnswer                  = false;
+        bool mIncludeQuery                   = false;
+        chip::Inet::InterfaceId mInterface   = chip::Inet::InterfaceId::Null();
+        chip::Inet::IPAddressType mAddrType  = chip::Inet::IPAddressType::kAny;
+        chip::Platform::ScopedMemoryBuffer<uint8_t> mQName;
+        size_t mQNameLength = 0;
+
+        chip::Platform::ScopedMemoryBuffer<uint8_t> mPackets[kMaxPacketsPerEntry];
+        size_t mPacketLengths[kMaxPacketsPerEntry] = {};
+        size_t mPacketCount                        = 0;
+
+        chip::Platform::ScopedMemoryBuffer<QueryResponderRecord *> mAnswers;
+        size_t mAnswerCount = 0;
+    };
+
+    /// Find the reply to the given query, if still valid at time `now`.
+    const Entry * Find(const QueryData & query, const chip::Inet::IPPacketInfo & source, bool includeQuery,
+                       chip::System::Clock::Timestamp now);
+
+    /// Start recording the reply to the given query, replacing the least recently used entry.
+    ///
+    /// The entry is only used by Find() once committed. Returns nullptr if the query cannot be cached.
+    Entry * Prepare(const QueryData & query, const chip::Inet::IPPacketInfo & source, bool includeQuery);
+
+    /// Make a prepared entry available to Find() until `now` + kEntryLifetime.
+    void Commit(Entry & entry, chip::System::Clock::Timestamp now);
+
+    /// Drop a prepared entry, e.g. because the reply could not be sent or recorded.
+    void Discard(Entry & entry) { entry.Clear(); }
+
+    /// Drop all entries. MUST be called whenever the records being advertised change.
+    void Invalidate();
+
+    uint32_t GetHits() const { return mHits; }
+    uint32_t GetMisses() const { return mMisses; }
+
+private:
+    // keep a valid array type even if caching is disabled
+    Entry mEntries[kCacheSize > 0 ? kCacheSize : 1];
+    uint32_t mUseCounter = 0;
+    uint32_t mHits       = 0;
+    uint32_t mMisses     = 0;
+};
+
+} // namespace Minimal
+} // namespace mdns
@@ -105,6 +105,24 @@ CHIP_ERROR ResponseSender::Respond(uint32_t messageId, const QueryData & query,
 {
     mSendState.Reset(messageId, query, querySource);
 
+    const chip::System::Clock::Timestamp kTimeNow = chip::System::SystemClock().GetMonotonicTimestamp();
+
+    // Internal broadcasts and TTL overrides (e.g. removal of all services) are one-off replies, not worth caching
+    mCacheEntry = nullptr;
+    if ((mResponseCache != nullptr) && !query.IsInternalBroadcast() && !configuration.GetTtlSecondsOverride().HasValue())
+    {
+        const ResponseCache::Entry * cached = mResponseCache->Find(query, *querySource, mSendState.IncludeQuery(), kTimeNow);
+        if (cached == nullptr)
+        {
+            mCacheEntry = mResponseCache->Prepare(query, *querySource, mSendState.IncludeQuery());
+        }
+        else if (CanReplay(*cached, kTimeNow))
+        {
+            return Replay(*cached, kTimeNow);
+        }
+        // Otherwise some answers are rate limited: build a partial reply that is not cached
+    }
+
     // Responder has a stateful 'additional replies required' that is used within the response
     // loop. 'no additionals required' is set at the start and additionals are marked as the query
     // reply is built.
@@ -120,8 +138,6 @@ CHIP_ERROR ResponseSender::Respond(uint32_t messageId, const QueryData & query,
 
     // send all 'Answer' replies
     {
-        const chip::System::Clock::Timestamp kTimeNow = chip::System::SystemClock().GetMonotonicTimestamp();
-
         QueryReplyFilter queryReplyFilter(query);
         QueryResponderRecordFilter responseFilter;
 
@@ -144,14 +160,49 @@ CHIP_ERROR ResponseSender::Respond(uint32_t messageId, const QueryData & query,
             for (auto it = (*responder)->begin(&responseFilter); it != (*responder)->end(); it++)
             {
                 it->responder->AddAllResponses(querySource, this, configuration);
-                ReturnErrorOnFailure(mSendState.GetError());
+                if (mSendState.GetError() != CHIP_NO_ERROR)
+                {
+                    DiscardCacheEntry();
+                    return mSendState.GetError();
+                }
 
                 (*responder)->MarkAdditionalRepliesFor(it);
 
                 if (!mSendState.SendUnicast())
                 {
                     it->lastMulticastTime = kTimeNow;
+
+                    // replays of this reply are rate limited like the reply itself
+                    if ((mCacheEntry != nullptr) && !mCacheEntry->AddAnswer(&*it))
+                    {
+                        DiscardCacheEntry();
+                    }
+                }
+            }
+        }
+
+        // A multicast reply missing rate limited answers only fits the current state of the rate limiting
+        if ((mCacheEntry != nullptr) && !mSendState.SendUnicast())
+        {
+            QueryResponderRecordFilter unlimitedFilter;
+            unlimitedFilter.SetReplyFilter(&queryReplyFilter);
+
+            size_t answerCount = 0;
+            for (auto responder = mResponders.begin(); responder != mResponders.end(); responder++)
+            {
+                if (*responder == nullptr)
+                {
+                    continue;
                 }
+                for (auto it = (*responder)->begin(&unlimitedFilter); it != (*responder)->end(); it++)
+                {
+                    answerCount++;
+                }
+            }
+
+            if (answerCount != mCacheEntry->GetAnswerCount())
+            {
+                DiscardCacheEntry();
             }
         }
     }
@@ -177,12 +228,81 @@ CHIP_ERROR ResponseSender::Respond(uint32_t messageId, const QueryData & query,
             for (auto it = (*responder)->begin(&responseFilter); it != (*responder)->end(); it++)
             {
                 it->responder->AddAllResponses(querySource, this, configuration);
-                ReturnErrorOnFailure(mSendState.GetError());
+                if (mSendState.GetError() != CHIP_NO_ERROR)
+                {
+                    DiscardCacheEntry();
+                    return mSendState.GetError();
+                }
             }
         }
     }
 
-    return FlushReply();
+    CHIP_ERROR err = FlushReply();
+    if (err != CHIP_NO_ERROR)
+    {
+        DiscardCacheEntry();
+        return err;
+    }
+
+    if (mCacheEntry != nullptr)
+    {
+        mResponseCache->Commit(*mCacheEntry, kTimeNow);
+        mCacheEntry = nullptr;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+bool ResponseSender::CanReplay(const ResponseCache::Entry & entry, chip::System::Clock::Timestamp now) const
+{
+    if (mSendState.SendUnicast() || (now <= chip::System::Clock::Seconds32(1)))
+    {
+        return true;
+    }
+
+    // Same check as QueryResponderRecordFilter::SetIncludeOnlyMulticastBeforeMS
+    const chip::System::Clock::Timestamp includeOnlyMulticastBefore = now - chip::System::Clock::Seconds32(1);
+    for (size_t i = 0; i < entry.GetAnswerCount(); i++)
+    {
+        if (entry.GetAnswer(i)->lastMulticastTime >= includeOnlyMulticastBefore)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+CHIP_ERROR ResponseSender::Replay(const ResponseCache::Entry & entry, chip::System::Clock::Timestamp now)
+{
+    for (size_t i = 0; i < entry.GetPacketCount(); i++)
+    {
+        chip::ByteSpan data = entry.GetPacket(i);
+
+        chip::System::PacketBufferHandle packet = chip::System::PacketBufferHandle::NewWithData(data.data(), data.size());
+        ReturnErrorCodeIf(packet.IsNull(), CHIP_ERROR_NO_MEMORY);
+
+        HeaderRef(packet->Start()).SetMessageId(static_cast<uint16_t>(mSendState.GetMessageId()));
+        ReturnErrorOnFailure(SendReply(std::move(packet)));
+    }
+
+    if (!mSendState.SendUnicast())
+    {
+        for (size_t i = 0; i < entry.GetAnswerCount(); i++)
+        {
+            entry.GetAnswer(i)->lastMulticastTime = now;
+        }
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void ResponseSender::DiscardCacheEntry()
+{
+    if (mCacheEntry != nullptr)
+    {
+        mResponseCache->Discard(*mCacheEntry);
+        mCacheEntry = nullptr;
+    }
 }
 
 CHIP_ERROR ResponseSender::FlushReply()
@@ -191,29 +311,38 @@ CHIP_ERROR ResponseSender::FlushReply()
 
     if (mResponseBuilder.HasResponseRecords())
     {
-        char srcAddressString[chip::Inet::IPAddress::kMaxStringLength];
-        VerifyOrDie(mSendState.GetSourceAddress().ToString(srcAddressString) != nullptr);
+        chip::System::PacketBufferHandle packet = mResponseBuilder.ReleasePacket();
 
-        if (mSendState.SendUnicast())
+        if ((mCacheEntry != nullptr) && !mCacheEntry->AddPacket(packet->Start(), packet->DataLength()))
         {
-#if CHIP_MINMDNS_HIGH_VERBOSITY
-            ChipLogDetail(Discovery, "Directly sending mDns reply to peer %s on port %d", srcAddressString,
-                          mSendState.GetSourcePort());
-#endif
-            ReturnErrorOnFailure(mServer->DirectSend(mResponseBuilder.ReleasePacket(), mSendState.GetSourceAddress(),
-                                                     mSendState.GetSourcePort(), mSendState.GetSourceInterfaceId()));
+            DiscardCacheEntry();
         }
-        else
-        {
+
+        ReturnErrorOnFailure(SendReply(std::move(packet)));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ResponseSender::SendReply(chip::System::PacketBufferHandle && packet)
+{
+    char srcAddressString[chip::Inet::IPAddress::kMaxStringLength];
+    VerifyOrDie(mSendState.GetSourceAddress().ToString(srcAddressString) != nullptr);
+
+    if (mSendState.SendUnicast())
+    {
 #if CHIP_MINMDNS_HIGH_VERBOSITY
-            ChipLogDetail(Discovery, "Broadcasting mDns reply for query from %s", srcAddressString);
+        ChipLogDetail(Discovery, "Directly sending mDns reply to peer %s on port %d", srcAddressString, mSendState.GetSourcePort());
 #endif
-            ReturnErrorOnFailure(mServer->BroadcastSend(mResponseBuilder.ReleasePacket(), kMdnsStandardPort,
-                                                        mSendState.GetSourceInterfaceId(), mSendState.GetSourceAddress().Type()));
-        }
+        return mServer->DirectSend(std::move(packet), mSendState.GetSourceAddress(), mSendState.GetSourcePort(),
+                                   mSendState.GetSourceInterfaceId());
     }
 
-    return CHIP_NO_ERROR;
+#if CHIP_MINMDNS_HIGH_VERBOSITY
+    ChipLogDetail(Discovery, "Broadcasting mDns reply for query from %s", srcAddressString);
+#endif
+    return mServer->BroadcastSend(std::move(packet), kMdnsStandardPort, mSendState.GetSourceInterfaceId(),
+                                  mSendState.GetSourceAddress().Type());
 }
 
 CHIP_ERROR ResponseSender::PrepareNewReplyPacket()
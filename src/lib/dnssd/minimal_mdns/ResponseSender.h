@@ -19,6 +19,7 @@
 
 #include "Parser.h"
 #include "ResponseBuilder.h"
+#include "ResponseCache.h"
 #include "Server.h"
 
 #include <lib/dnssd/minimal_mdns/responders/QueryResponder.h>
@@ -120,9 +121,25 @@ public:
 
     void SetServer(ServerBase * server) { mServer = server; }
 
+    /// Keep the encoded replies in the given cache and replay them for identical queries.
+    ///
+    /// The cache stores pointers to the records of the query responders: whoever sets a
+    /// cache is responsible for invalidating it whenever responders or their records change.
+    /// Set to nullptr to always build replies from the query responders.
+    void SetResponseCache(ResponseCache * cache) { mResponseCache = cache; }
+
 private:
     CHIP_ERROR FlushReply();
     CHIP_ERROR PrepareNewReplyPacket();
+    CHIP_ERROR SendReply(chip::System::PacketBufferHandle && packet);
+
+    /// Checks if a cached reply may be sent at time `now`, i.e. none of its answers
+    /// is subject to multicast rate limiting.
+    bool CanReplay(const ResponseCache::Entry & entry, chip::System::Clock::Timestamp now) const;
+    CHIP_ERROR Replay(const ResponseCache::Entry & entry, chip::System::Clock::Timestamp now);
+
+    /// Drop the reply being recorded, e.g. because it cannot be replayed as-is.
+    void DiscardCacheEntry();
 
     ServerBase * mServer;
     QueryResponderPtrPool mResponders = {};
@@ -130,6 +147,9 @@ private:
     /// Current send state
     ResponseBuilder mResponseBuilder;          // packet being built
     Internal::ResponseSendingState mSendState; // sending state
+
+    ResponseCache * mResponseCache     = nullptr;
+    ResponseCache::Entry * mCacheEntry = nullptr; // reply being recorded, if any
 };
 
 } // namespace Minimal
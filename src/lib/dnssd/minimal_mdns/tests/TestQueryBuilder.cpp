@@ -0,0 +1,248 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <lib/dnssd/minimal_mdns/QueryBuilder.h>
+
+#include <chrono>
+#include <stdio.h>
+
+#include <lib/dnssd/minimal_mdns/Parser.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/UnitTestRegistration.h>
+
+#include <nlunit-test.h>
+
+namespace {
+
+using namespace chip;
+using namespace mdns::Minimal;
+
+constexpr size_t kMdnsMaxPacketSize = 1024;
+constexpr size_t kNodeCount         = 2000;
+
+/// Counts the questions of received query packets, as the responder parses them.
+class QueryCounter : public ParserDelegate
+{
+public:
+    void OnHeader(ConstHeaderRef & header) override {}
+    void OnResource(ResourceType type, const ResourceData & data) override {}
+    void OnQuery(const QueryData & data) override
+    {
+        mQueryCount++;
+        mLastType = data.GetType();
+    }
+
+    size_t GetQueryCount() const { return mQueryCount; }
+    QType GetLastType() const { return mLastType; }
+
+private:
+    size_t mQueryCount = 0;
+    QType mLastType    = QType::ANY;
+};
+
+/// Operational service names of simulated nodes: <fabric>-<node>._matter._tcp.local
+class OperationalName
+{
+public:
+    OperationalName(size_t nodeIndex)
+    {
+        snprintf(mInstanceName, sizeof(mInstanceName), "1234567898765432-%016X", static_cast<unsigned>(nodeIndex));
+    }
+
+    Query MakeQuery() const { return Query(FullQName(mNames)).SetClass(QClass::IN).SetType(QType::SRV); }
+
+private:
+    char mInstanceName[64];
+    const QNamePart mNames[4] = { mInstanceName, "_matter", "_tcp", "local" };
+};
+
+size_t CountQueries(nlTestSuite * inSuite, const System::PacketBufferHandle & packet)
+{
+    QueryCounter counter;
+    NL_TEST_ASSERT(inSuite, ParsePacket(BytesRange(packet->Start(), packet->Start() + packet->DataLength()), &counter));
+    return counter.GetQueryCount();
+}
+
+void TestSingleQuery(nlTestSuite * inSuite, void * inContext)
+{
+    QueryBuilder builder(System::PacketBufferHandle::New(kMdnsMaxPacketSize));
+    NL_TEST_ASSERT(inSuite, builder.HasPacket());
+
+    builder.AddQuery(OperationalName(1).MakeQuery());
+    NL_TEST_ASSERT(inSuite, builder.Ok());
+    NL_TEST_ASSERT(inSuite, builder.Header().GetQueryCount() == 1);
+
+    System::PacketBufferHandle packet = builder.ReleasePacket();
+    NL_TEST_ASSERT(inSuite, !builder.HasPacket());
+    NL_TEST_ASSERT(inSuite, CountQueries(inSuite, packet) == 1);
+}
+
+void TestQueriesShareNames(nlTestSuite * inSuite, void * inContext)
+{
+    QueryBuilder single(System::PacketBufferHandle::New(kMdnsMaxPacketSize));
+    NL_TEST_ASSERT(inSuite, single.TryAddQuery(OperationalName(1).MakeQuery()));
+    System::PacketBufferHandle singlePacket = single.ReleasePacket();
+
+    QueryBuilder packed(System::PacketBufferHandle::New(kMdnsMaxPacketSize));
+    NL_TEST_ASSERT(inSuite, packed.TryAddQuery(OperationalName(1).MakeQuery()));
+    NL_TEST_ASSERT(inSuite, packed.TryAddQuery(OperationalName(2).MakeQuery()));
+    NL_TEST_ASSERT(inSuite, packed.Header().GetQueryCount() == 2);
+    System::PacketBufferHandle packedPacket = packed.ReleasePacket();
+
+    NL_TEST_ASSERT(inSuite, CountQueries(inSuite, packedPacket) == 2);
+
+    // The second query replaces "_matter._tcp.local" by a pointer to the first one
+    constexpr size_t kServiceSuffixSize = sizeof("\x07_matter\x04_tcp\x05local");
+    constexpr size_t kPointerSize       = 2;
+
+    const size_t querySize       = singlePacket->DataLength() - HeaderRef::kSizeBytes;
+    const size_t secondQuerySize = packedPacket->DataLength() - singlePacket->DataLength();
+    NL_TEST_ASSERT(inSuite, secondQuerySize == querySize - kServiceSuffixSize + kPointerSize);
+}
+
+void TestFullPacketRemainsValid(nlTestSuite * inSuite, void * inContext)
+{
+    QueryBuilder builder(System::PacketBufferHandle::New(kMdnsMaxPacketSize));
+
+    size_t added = 0;
+    while (builder.TryAddQuery(OperationalName(added).MakeQuery()))
+    {
+        added++;
+    }
+
+    NL_TEST_ASSERT(inSuite, added > 1);
+    NL_TEST_ASSERT(inSuite, builder.Ok());
+    NL_TEST_ASSERT(inSuite, builder.Header().GetQueryCount() == added);
+
+    System::PacketBufferHandle packet = builder.ReleasePacket();
+    NL_TEST_ASSERT(inSuite, packet->DataLength() <= packet->MaxDataLength());
+    NL_TEST_ASSERT(inSuite, CountQueries(inSuite, packet) == added);
+
+    // The query that did not fit goes into the next packet
+    builder.Reset(System::PacketBufferHandle::New(kMdnsMaxPacketSize));
+    NL_TEST_ASSERT(inSuite, builder.TryAddQuery(OperationalName(added).MakeQuery()));
+    NL_TEST_ASSERT(inSuite, CountQueries(inSuite, builder.ReleasePacket()) == 1);
+}
+
+void TestAddQueryFailureIsSticky(nlTestSuite * inSuite, void * inContext)
+{
+    QueryBuilder builder(System::PacketBufferHandle::New(kMdnsMaxPacketSize));
+
+    size_t added = 0;
+    while (builder.Ok())
+    {
+        builder.AddQuery(OperationalName(added++).MakeQuery());
+    }
+
+    NL_TEST_ASSERT(inSuite, !builder.TryAddQuery(OperationalName(added).MakeQuery()));
+}
+
+/// Send SRV queries for many nodes, one packet per node or batched, and have
+/// them parsed as the responder does.
+///
+/// Returns the number of packets sent.
+size_t SendOperationalQueries(nlTestSuite * inSuite, bool batched, std::chrono::microseconds & duration)
+{
+    auto start         = std::chrono::steady_clock::now();
+    size_t packetCount = 0;
+    size_t received    = 0;
+
+    QueryBuilder builder;
+    auto send = [&]() {
+        System::PacketBufferHandle packet = builder.ReleasePacket();
+        received += CountQueries(inSuite, packet);
+        packetCount++;
+    };
+
+    for (size_t i = 0; i < kNodeCount; i++)
+    {
+        OperationalName name(i);
+        Query query = name.MakeQuery();
+
+        if (builder.HasPacket() && !builder.TryAddQuery(query))
+        {
+            send();
+        }
+        if (!builder.HasPacket())
+        {
+            builder.Reset(System::PacketBufferHandle::New(kMdnsMaxPacketSize));
+            NL_TEST_ASSERT(inSuite, builder.TryAddQuery(query));
+        }
+        if (!batched)
+        {
+            send();
+        }
+    }
+    if (builder.HasPacket())
+    {
+        send();
+    }
+
+    duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    NL_TEST_ASSERT(inSuite, received == kNodeCount);
+    return packetCount;
+}
+
+void BenchmarkResolveAllNodes(nlTestSuite * inSuite, void * inContext)
+{
+    std::chrono::microseconds separateDuration;
+    std::chrono::microseconds batchedDuration;
+
+    size_t separatePackets = SendOperationalQueries(inSuite, false /* batched */, separateDuration);
+    size_t batchedPackets  = SendOperationalQueries(inSuite, true /* batched */, batchedDuration);
+
+    ChipLogProgress(Discovery, "Querying %u nodes: %u packets in %u us separately, %u packets in %u us batched",
+                    static_cast<unsigned>(kNodeCount), static_cast<unsigned>(separatePackets),
+                    static_cast<unsigned>(separateDuration.count()), static_cast<unsigned>(batchedPackets),
+                    static_cast<unsigned>(batchedDuration.count()));
+
+    NL_TEST_ASSERT(inSuite, separatePackets == kNodeCount);
+    // more than 20 compressed SRV queries fit in a packet
+    NL_TEST_ASSERT(inSuite, batchedPackets * 20 < separatePackets);
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("SingleQuery", TestSingleQuery),                         //
+    NL_TEST_DEF("QueriesShareNames", TestQueriesShareNames),             //
+    NL_TEST_DEF("FullPacketRemainsValid", TestFullPacketRemainsValid),   //
+    NL_TEST_DEF("AddQueryFailureIsSticky", TestAddQueryFailureIsSticky), //
+    NL_TEST_DEF("BenchmarkResolveAllNodes", BenchmarkResolveAllNodes),   //
+
+    NL_TEST_SENTINEL() //
+};
+
+int TestSetup(void * inContext)
+{
+    return chip::Platform::MemoryInit() == CHIP_NO_ERROR ? SUCCESS : FAILURE;
+}
+
+int TestTeardown(void * inContext)
+{
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+} // namespace
+
+int TestQueryBuilder(void)
+{
+    nlTestSuite theSuite = { "QueryBuilder", sTests, &TestSetup, &TestTeardown };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestQueryBuilder)
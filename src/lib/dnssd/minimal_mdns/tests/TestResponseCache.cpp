@@ -0,0 +1,377 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <lib/dnssd/minimal_mdns/ResponseCache.h>
+#include <lib/dnssd/minimal_mdns/ResponseSender.h>
+
+#include <chrono>
+#include <vector>
+
+#include <lib/dnssd/minimal_mdns/core/FlatAllocatedQName.h>
+#include <lib/dnssd/minimal_mdns/core/RecordWriter.h>
+#include <lib/dnssd/minimal_mdns/responders/Ptr.h>
+#include <lib/dnssd/minimal_mdns/responders/Srv.h>
+#include <lib/dnssd/minimal_mdns/responders/Txt.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <system/SystemClock.h>
+
+#include <nlunit-test.h>
+
+namespace {
+
+using namespace chip;
+using namespace mdns::Minimal;
+using namespace chip::System::Clock::Literals;
+
+constexpr uint16_t kMdnsPort = 5353;
+
+/// Records the packets sent by a ResponseSender
+class RecordingServer : private chip::PoolImpl<ServerBase::EndpointInfo, 0, chip::ObjectPoolMem::kInline,
+                                               ServerBase::EndpointInfoPoolType::Interface>,
+                        public ServerBase
+{
+public:
+    struct SentPacket
+    {
+        std::vector<uint8_t> data;
+        bool multicast;
+    };
+
+    RecordingServer() : ServerBase(*static_cast<ServerBase::EndpointInfoPoolType *>(this)) {}
+
+    CHIP_ERROR DirectSend(chip::System::PacketBufferHandle && data, const chip::Inet::IPAddress & addr, uint16_t port,
+                          chip::Inet::InterfaceId interface) override
+    {
+        Record(data, false);
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR BroadcastSend(chip::System::PacketBufferHandle && data, uint16_t port, chip::Inet::InterfaceId interface,
+                             chip::Inet::IPAddressType addressType) override
+    {
+        Record(data, true);
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR BroadcastSend(chip::System::PacketBufferHandle && data, uint16_t port) override
+    {
+        Record(data, true);
+        return CHIP_NO_ERROR;
+    }
+
+    std::vector<SentPacket> & GetSent() { return mSent; }
+    void SetRecording(bool recording) { mRecording = recording; }
+
+private:
+    void Record(const chip::System::PacketBufferHandle & data, bool multicast)
+    {
+        if (mRecording)
+        {
+            mSent.push_back(SentPacket{ std::vector<uint8_t>(data->Start(), data->Start() + data->DataLength()), multicast });
+        }
+    }
+
+    std::vector<SentPacket> mSent;
+    bool mRecording = true;
+};
+
+struct CommonTestElements
+{
+    uint8_t requestStorage[64];
+    BytesRange requestBytesRange = BytesRange(requestStorage, requestStorage + sizeof(requestStorage));
+    uint8_t * requestNameStart   = requestStorage + ConstHeaderRef::kSizeBytes;
+    Encoding::BigEndian::BufferWriter requestBufferWriter =
+        Encoding::BigEndian::BufferWriter(requestNameStart, sizeof(requestStorage) - HeaderRef::kSizeBytes);
+    RecordWriter recordWriter;
+
+    uint8_t serviceNameStorage[64];
+    uint8_t instanceNameStorage[64];
+    uint8_t hostNameStorage[64];
+    uint8_t txtStorage[64];
+    FullQName service;
+    FullQName instance;
+    FullQName host;
+    FullQName txt;
+
+    static constexpr uint16_t kPort = 5540;
+    PtrResponder ptrResponder       = PtrResponder(service, instance);
+    SrvResponder srvResponder       = SrvResponder(SrvResourceRecord(instance, host, kPort));
+    TxtResponder txtResponder       = TxtResponder(TxtResourceRecord(instance, txt));
+
+    QueryResponder<10> queryResponder;
+    Inet::IPPacketInfo packetInfo;
+
+    CommonTestElements() :
+        recordWriter(&requestBufferWriter), service(FlatAllocatedQName::Build(serviceNameStorage, "_matter", "_tcp", "local")),
+        instance(FlatAllocatedQName::Build(instanceNameStorage, "ABCD", "_matter", "_tcp", "local")),
+        host(FlatAllocatedQName::Build(hostNameStorage, "0102030405060708", "local")),
+        txt(FlatAllocatedQName::Build(txtStorage, "SII=5000", "SAI=300", "T=1"))
+    {
+        queryResponder.Init();
+        queryResponder.AddResponder(&ptrResponder).SetReportAdditional(instance).SetReportInServiceListing(true);
+        queryResponder.AddResponder(&srvResponder).SetReportAdditional(host);
+        queryResponder.AddResponder(&txtResponder);
+        packetInfo.Clear();
+    }
+
+    /// Builds a query. Storage is shared: only the last built query is valid.
+    QueryData Query(QType type, FullQName name, bool unicastAnswer = false)
+    {
+        recordWriter.Reset();
+        requestBufferWriter = Encoding::BigEndian::BufferWriter(requestNameStart, sizeof(requestStorage) - HeaderRef::kSizeBytes);
+        recordWriter.WriteQName(name);
+        return QueryData(type, QClass::IN, unicastAnswer, requestNameStart, requestBytesRange);
+    }
+};
+
+void CachedReplyMatchesBuiltReply(nlTestSuite * inSuite, void * inContext)
+{
+    CommonTestElements common;
+    RecordingServer cachedServer;
+    RecordingServer builtServer;
+    ResponseCache cache;
+
+    ResponseSender cachedSender(&cachedServer);
+    ResponseSender builtSender(&builtServer);
+    cachedSender.SetResponseCache(&cache);
+    NL_TEST_ASSERT(inSuite, cachedSender.AddQueryResponder(&common.queryResponder) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, builtSender.AddQueryResponder(&common.queryResponder) == CHIP_NO_ERROR);
+
+    QueryData query = common.Query(QType::PTR, common.service);
+
+    for (uint32_t messageId = 1; messageId <= 3; messageId++)
+    {
+        NL_TEST_ASSERT(inSuite, cachedSender.Respond(messageId, query, &common.packetInfo, ResponseConfiguration()) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, builtSender.Respond(messageId, query, &common.packetInfo, ResponseConfiguration()) == CHIP_NO_ERROR);
+    }
+
+    NL_TEST_ASSERT(inSuite, cache.GetMisses() == 1);
+    NL_TEST_ASSERT(inSuite, cache.GetHits() == 2);
+
+    // Replayed replies are identical to built ones, including the message id
+    NL_TEST_ASSERT(inSuite, cachedServer.GetSent().size() == 3);
+    NL_TEST_ASSERT(inSuite, builtServer.GetSent().size() == 3);
+    for (size_t i = 0; i < cachedServer.GetSent().size() && i < builtServer.GetSent().size(); i++)
+    {
+        NL_TEST_ASSERT(inSuite, cachedServer.GetSent()[i].data == builtServer.GetSent()[i].data);
+        NL_TEST_ASSERT(inSuite, !cachedServer.GetSent()[i].multicast);
+    }
+}
+
+void QueriesAreCachedSeparately(nlTestSuite * inSuite, void * inContext)
+{
+    CommonTestElements common;
+    RecordingServer server;
+    ResponseCache cache;
+
+    ResponseSender sender(&server);
+    sender.SetResponseCache(&cache);
+    NL_TEST_ASSERT(inSuite, sender.AddQueryResponder(&common.queryResponder) == CHIP_NO_ERROR);
+
+    QueryData srvQuery = common.Query(QType::SRV, common.instance);
+    NL_TEST_ASSERT(inSuite, sender.Respond(1, srvQuery, &common.packetInfo, ResponseConfiguration()) == CHIP_NO_ERROR);
+    QueryData txtQuery = common.Query(QType::TXT, common.instance);
+    NL_TEST_ASSERT(inSuite, sender.Respond(1, txtQuery, &common.packetInfo, ResponseConfiguration()) == CHIP_NO_ERROR);
+
+    // A query from the mDNS port does not echo the query back, so it does not use the replies above
+    common.packetInfo.SrcPort = kMdnsPort;
+    txtQuery                  = common.Query(QType::TXT, common.instance, true /* unicastAnswer */);
+    NL_TEST_ASSERT(inSuite, sender.Respond(1, txtQuery, &common.packetInfo, ResponseConfiguration()) == CHIP_NO_ERROR);
+
+    NL_TEST_ASSERT(inSuite, cache.GetMisses() == 3);
+    NL_TEST_ASSERT(inSuite, cache.GetHits() == 0);
+    NL_TEST_ASSERT(inSuite, server.GetSent().size() == 3);
+    NL_TEST_ASSERT(inSuite, server.GetSent()[0].data != server.GetSent()[1].data);
+
+    common.packetInfo.SrcPort = 0;
+    srvQuery                  = common.Query(QType::SRV, common.instance);
+    NL_TEST_ASSERT(inSuite, sender.Respond(1, srvQuery, &common.packetInfo, ResponseConfiguration()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cache.GetHits() == 1);
+    NL_TEST_ASSERT(inSuite, server.GetSent().size() == 4);
+    NL_TEST_ASSERT(inSuite, server.GetSent()[3].data == server.GetSent()[0].data);
+}
+
+void InvalidateDropsReplies(nlTestSuite * inSuite, void * inContext)
+{
+    CommonTestElements common;
+    RecordingServer server;
+    ResponseCache cache;
+
+    ResponseSender sender(&server);
+    sender.SetResponseCache(&cache);
+    NL_TEST_ASSERT(inSuite, sender.AddQueryResponder(&common.queryResponder) == CHIP_NO_ERROR);
+
+    QueryData query = common.Query(QType::ANY, common.host);
+    NL_TEST_ASSERT(inSuite, sender.Respond(1, query, &common.packetInfo, ResponseConfiguration()) == CHIP_NO_ERROR);
+
+    // Nothing answers for the host yet: the empty reply is cached as well
+    NL_TEST_ASSERT(inSuite, sender.Respond(1, query, &common.packetInfo, ResponseConfiguration()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cache.GetHits() == 1);
+    NL_TEST_ASSERT(inSuite, server.GetSent().empty());
+
+    // Advertised records change: owner of the cache invalidates it
+    TxtResponder hostTxtResponder(TxtResourceRecord(common.host, common.txt));
+    common.queryResponder.AddResponder(&hostTxtResponder);
+    cache.Invalidate();
+
+    NL_TEST_ASSERT(inSuite, sender.Respond(1, query, &common.packetInfo, ResponseConfiguration()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cache.GetMisses() == 2);
+    NL_TEST_ASSERT(inSuite, cache.GetHits() == 1);
+    NL_TEST_ASSERT(inSuite, server.GetSent().size() == 1);
+}
+
+void TtlOverrideIsNotCached(nlTestSuite * inSuite, void * inContext)
+{
+    CommonTestElements common;
+    RecordingServer server;
+    ResponseCache cache;
+
+    ResponseSender sender(&server);
+    sender.SetResponseCache(&cache);
+    NL_TEST_ASSERT(inSuite, sender.AddQueryResponder(&common.queryResponder) == CHIP_NO_ERROR);
+
+    QueryData query = common.Query(QType::PTR, common.service);
+    ResponseConfiguration removeConfiguration;
+    removeConfiguration.SetTtlSecondsOverride(MakeOptional<uint32_t>(0));
+
+    NL_TEST_ASSERT(inSuite, sender.Respond(1, query, &common.packetInfo, removeConfiguration) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, sender.Respond(1, query, &common.packetInfo, ResponseConfiguration()) == CHIP_NO_ERROR);
+
+    // The reply with TTL 0 was neither looked up nor stored
+    NL_TEST_ASSERT(inSuite, cache.GetHits() == 0);
+    NL_TEST_ASSERT(inSuite, cache.GetMisses() == 1);
+    NL_TEST_ASSERT(inSuite, server.GetSent().size() == 2);
+    NL_TEST_ASSERT(inSuite, server.GetSent()[0].data != server.GetSent()[1].data);
+}
+
+void MulticastReplayIsRateLimited(nlTestSuite * inSuite, void * inContext)
+{
+    System::Clock::ClockBase * realClock = &System::SystemClock();
+    System::Clock::Internal::MockClock mockClock;
+    System::Clock::Internal::SetSystemClockForTesting(&mockClock);
+    mockClock.SetMonotonic(100_s);
+
+    CommonTestElements common;
+    RecordingServer server;
+    ResponseCache cache;
+
+    ResponseSender sender(&server);
+    sender.SetResponseCache(&cache);
+    NL_TEST_ASSERT(inSuite, sender.AddQueryResponder(&common.queryResponder) == CHIP_NO_ERROR);
+
+    common.packetInfo.SrcPort = kMdnsPort;
+    QueryData query           = common.Query(QType::PTR, common.service);
+
+    NL_TEST_ASSERT(inSuite, sender.Respond(0, query, &common.packetInfo, ResponseConfiguration()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, server.GetSent().size() == 1);
+    NL_TEST_ASSERT(inSuite, server.GetSent()[0].multicast);
+
+    // Same query within a second: the cached reply is not multicast again
+    mockClock.AdvanceMonotonic(500_ms64);
+    NL_TEST_ASSERT(inSuite, sender.Respond(0, query, &common.packetInfo, ResponseConfiguration()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, server.GetSent().size() == 1);
+
+    // Once the rate limit expires, the cached reply is multicast again
+    mockClock.AdvanceMonotonic(1000_ms64);
+    NL_TEST_ASSERT(inSuite, sender.Respond(0, query, &common.packetInfo, ResponseConfiguration()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, server.GetSent().size() == 2);
+    NL_TEST_ASSERT(inSuite, cache.GetHits() == 2);
+    if (server.GetSent().size() == 2)
+    {
+        NL_TEST_ASSERT(inSuite, server.GetSent()[1].data == server.GetSent()[0].data);
+    }
+
+    // Cached replies expire
+    mockClock.AdvanceMonotonic(ResponseCache::kEntryLifetime);
+    NL_TEST_ASSERT(inSuite, sender.Respond(0, query, &common.packetInfo, ResponseConfiguration()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cache.GetMisses() == 2);
+    NL_TEST_ASSERT(inSuite, server.GetSent().size() == 3);
+
+    System::Clock::Internal::SetSystemClockForTesting(realClock);
+}
+
+uint64_t QueriesPerSecond(ResponseSender & sender, QueryData & query, const Inet::IPPacketInfo & source, uint32_t count)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < count; i++)
+    {
+        sender.Respond(i, query, &source, ResponseConfiguration());
+    }
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    return static_cast<uint64_t>(count) * 1000000 / static_cast<uint64_t>(elapsed > 0 ? elapsed : 1);
+}
+
+void BenchmarkQueriesPerSecond(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr uint32_t kQueryCount = 20000;
+
+    CommonTestElements common;
+    RecordingServer server;
+    ResponseCache cache;
+    server.SetRecording(false);
+
+    ResponseSender builtSender(&server);
+    ResponseSender cachedSender(&server);
+    cachedSender.SetResponseCache(&cache);
+    NL_TEST_ASSERT(inSuite, builtSender.AddQueryResponder(&common.queryResponder) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, cachedSender.AddQueryResponder(&common.queryResponder) == CHIP_NO_ERROR);
+
+    // Browse for operational nodes: PTR answer plus SRV/TXT additionals, as sent to every controller
+    QueryData query = common.Query(QType::PTR, common.service);
+
+    uint64_t built  = QueriesPerSecond(builtSender, query, common.packetInfo, kQueryCount);
+    uint64_t cached = QueriesPerSecond(cachedSender, query, common.packetInfo, kQueryCount);
+
+    ChipLogProgress(Discovery, "mDNS replies: %u queries/s built, %u queries/s cached", static_cast<unsigned>(built),
+                    static_cast<unsigned>(cached));
+
+    NL_TEST_ASSERT(inSuite, cache.GetMisses() == 1);
+    NL_TEST_ASSERT(inSuite, cache.GetHits() == kQueryCount - 1);
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("CachedReplyMatchesBuiltReply", CachedReplyMatchesBuiltReply), //
+    NL_TEST_DEF("QueriesAreCachedSeparately", QueriesAreCachedSeparately),     //
+    NL_TEST_DEF("InvalidateDropsReplies", InvalidateDropsReplies),             //
+    NL_TEST_DEF("TtlOverrideIsNotCached", TtlOverrideIsNotCached),             //
+    NL_TEST_DEF("MulticastReplayIsRateLimited", MulticastReplayIsRateLimited), //
+    NL_TEST_DEF("BenchmarkQueriesPerSecond", BenchmarkQueriesPerSecond),       //
+
+    NL_TEST_SENTINEL() //
+};
+
+int TestSetup(void * inContext)
+{
+    return chip::Platform::MemoryInit() == CHIP_NO_ERROR ? SUCCESS : FAILURE;
+}
+
+int TestTeardown(void * inContext)
+{
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+} // namespace
+
+int TestResponseCache(void)
+{
+    nlTestSuite theSuite = { "ResponseCache", sTests, &TestSetup, &TestTeardown };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestResponseCache)
@@ -0,0 +1,332 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/dnssd/RecordCache.h>
+
+#include <memory>
+#include <stdio.h>
+
+#include <lib/dnssd/ServiceNaming.h>
+#include <lib/dnssd/minimal_mdns/records/IP.h>
+#include <lib/dnssd/minimal_mdns/records/ResourceRecord.h>
+#include <lib/dnssd/minimal_mdns/records/Srv.h>
+#include <lib/dnssd/minimal_mdns/records/Txt.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <system/SystemClock.h>
+
+#include <nlunit-test.h>
+
+using namespace chip;
+using namespace chip::Dnssd;
+using namespace mdns::Minimal;
+using namespace chip::System::Clock::Literals;
+
+namespace {
+
+constexpr uint64_t kCompressedFabricId = 0x1234567898765432ULL;
+constexpr uint16_t kPort               = 5540;
+constexpr uint32_t kTtlSeconds         = 120;
+constexpr size_t kNodeCount            = 1000;
+
+/// A simulated operational node, advertising SRV, TXT and AAAA records.
+class SimulatedNode
+{
+public:
+    void Init(NodeId nodeId)
+    {
+        mPeerId = PeerId().SetCompressedFabricId(kCompressedFabricId).SetNodeId(nodeId);
+        MakeInstanceName(mInstanceName, sizeof(mInstanceName), mPeerId);
+        snprintf(mHostName, sizeof(mHostName), "%012llX", static_cast<unsigned long long>(nodeId));
+
+        char address[Inet::IPAddress::kMaxStringLength];
+        snprintf(address, sizeof(address), "fd00::%x", static_cast<unsigned>(nodeId));
+        Inet::IPAddress::FromString(address, mAddress);
+    }
+
+    const PeerId & GetPeerId() const { return mPeerId; }
+    const Inet::IPAddress & GetAddress() const { return mAddress; }
+    FullQName GetInstanceName() const { return FullQName(mInstanceQName); }
+
+    /// Build the announcement of the node, as sent when the node comes online (or a TTL of 0 when going away).
+    ///
+    /// Returns the number of bytes written to [buffer].
+    size_t Announce(uint8_t * buffer, size_t bufferSize, uint32_t ttl) const
+    {
+        uint8_t headerBuffer[HeaderRef::kSizeBytes] = {};
+        HeaderRef dummyHeader(headerBuffer);
+
+        Encoding::BigEndian::BufferWriter output(buffer, bufferSize);
+        RecordWriter writer(&output);
+
+        const char * txtEntries[] = { "SII=5000" };
+
+        SrvResourceRecord srv(GetInstanceName(), FullQName(mHostQName), kPort);
+        TxtResourceRecord txt(GetInstanceName(), txtEntries);
+        IPResourceRecord ip(FullQName(mHostQName), mAddress);
+
+        srv.SetTtl(ttl);
+        txt.SetTtl(ttl);
+        ip.SetTtl(ttl);
+
+        srv.Append(dummyHeader, ResourceType::kAnswer, writer);
+        txt.Append(dummyHeader, ResourceType::kAnswer, writer);
+        ip.Append(dummyHeader, ResourceType::kAdditional, writer);
+
+        return writer.Fit() ? output.Needed() : 0;
+    }
+
+private:
+    PeerId mPeerId;
+    char mInstanceName[kMaxOperationalServiceNameSize];
+    char mHostName[16];
+    Inet::IPAddress mAddress;
+
+    const QNamePart mInstanceQName[4] = { mInstanceName, kOperationalServiceName, kOperationalProtocol, kLocalDomain };
+    const QNamePart mHostQName[2]     = { mHostName, kLocalDomain };
+};
+
+/// Feed all the records of an announcement into [cache], as the resolver does for every received response.
+void ReceiveAnnouncement(nlTestSuite * inSuite, RecordCacheBase & cache, const SimulatedNode & node, uint32_t ttl = kTtlSeconds)
+{
+    uint8_t buffer[512];
+    size_t length = node.Announce(buffer, sizeof(buffer), ttl);
+    NL_TEST_ASSERT(inSuite, length > 0);
+
+    BytesRange packet(buffer, buffer + length);
+    const uint8_t * pos = buffer;
+    while (pos < packet.End())
+    {
+        ResourceData data;
+        bool parsed = data.Parse(packet, &pos);
+        NL_TEST_ASSERT(inSuite, parsed);
+        VerifyOrReturn(parsed);
+        NL_TEST_ASSERT(inSuite, cache.AddRecord(Inet::InterfaceId::Null(), data, packet) == CHIP_NO_ERROR);
+    }
+}
+
+/// Resolve a node the way the resolver does: from the cache if possible, querying
+/// the network otherwise. Returns true if a query had to be sent.
+bool Resolve(nlTestSuite * inSuite, RecordCacheBase & cache, const SimulatedNode & node)
+{
+    IncrementalResolver resolver;
+    if (!cache.Lookup(node.GetInstanceName(), resolver))
+    {
+        return true;
+    }
+
+    ResolvedNodeData nodeData;
+    NL_TEST_ASSERT(inSuite, resolver.Take(nodeData) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, nodeData.operationalData.peerId == node.GetPeerId());
+    NL_TEST_ASSERT(inSuite, nodeData.resolutionData.port == kPort);
+    NL_TEST_ASSERT(inSuite, nodeData.resolutionData.numIPs == 1);
+    NL_TEST_ASSERT(inSuite, nodeData.resolutionData.ipAddress[0] == node.GetAddress());
+    NL_TEST_ASSERT(inSuite, nodeData.resolutionData.GetMrpRetryIntervalIdle().HasValue());
+    return false;
+}
+
+void TestResolveAnnouncedNode(nlTestSuite * inSuite, void * inContext)
+{
+    System::Clock::Internal::MockClock clock;
+    RecordCache<8> cache(&clock);
+
+    SimulatedNode node;
+    node.Init(1);
+
+    // nothing known yet
+    NL_TEST_ASSERT(inSuite, Resolve(inSuite, cache, node));
+
+    ReceiveAnnouncement(inSuite, cache, node);
+    NL_TEST_ASSERT(inSuite, cache.GetRecordCount() == 3);
+    NL_TEST_ASSERT(inSuite, !Resolve(inSuite, cache, node));
+
+    // the same announcement again replaces the records
+    ReceiveAnnouncement(inSuite, cache, node);
+    NL_TEST_ASSERT(inSuite, cache.GetRecordCount() == 3);
+    NL_TEST_ASSERT(inSuite, !Resolve(inSuite, cache, node));
+
+    NL_TEST_ASSERT(inSuite, cache.GetStatistics().hits == 2);
+    NL_TEST_ASSERT(inSuite, cache.GetStatistics().misses == 1);
+    NL_TEST_ASSERT(inSuite, cache.GetStatistics().inserts == 6);
+    NL_TEST_ASSERT(inSuite, cache.GetStatistics().evictions == 0);
+}
+
+void TestRecordsExpire(nlTestSuite * inSuite, void * inContext)
+{
+    System::Clock::Internal::MockClock clock;
+    RecordCache<8> cache(&clock);
+
+    SimulatedNode node;
+    node.Init(2);
+
+    ReceiveAnnouncement(inSuite, cache, node);
+
+    clock.AdvanceMonotonic(System::Clock::Seconds32(kTtlSeconds - 1));
+    NL_TEST_ASSERT(inSuite, !Resolve(inSuite, cache, node));
+
+    clock.AdvanceMonotonic(1_s);
+    NL_TEST_ASSERT(inSuite, Resolve(inSuite, cache, node));
+    NL_TEST_ASSERT(inSuite, cache.GetRecordCount() == 0);
+}
+
+void TestGoodbyeRemovesRecords(nlTestSuite * inSuite, void * inContext)
+{
+    System::Clock::Internal::MockClock clock;
+    RecordCache<8> cache(&clock);
+
+    SimulatedNode node;
+    node.Init(3);
+
+    ReceiveAnnouncement(inSuite, cache, node);
+    NL_TEST_ASSERT(inSuite, !Resolve(inSuite, cache, node));
+
+    ReceiveAnnouncement(inSuite, cache, node, 0 /* ttl */);
+    NL_TEST_ASSERT(inSuite, cache.GetRecordCount() == 0);
+    NL_TEST_ASSERT(inSuite, Resolve(inSuite, cache, node));
+}
+
+void TestEvictsRecordsClosestToExpiry(nlTestSuite * inSuite, void * inContext)
+{
+    System::Clock::Internal::MockClock clock;
+    RecordCache<3> cache(&clock);
+
+    SimulatedNode first;
+    SimulatedNode second;
+    first.Init(4);
+    second.Init(5);
+
+    ReceiveAnnouncement(inSuite, cache, first, kTtlSeconds);
+    clock.AdvanceMonotonic(1_s);
+    ReceiveAnnouncement(inSuite, cache, second, kTtlSeconds);
+
+    NL_TEST_ASSERT(inSuite, cache.GetStatistics().evictions == 3);
+    NL_TEST_ASSERT(inSuite, cache.GetRecordCount() == 3);
+    NL_TEST_ASSERT(inSuite, Resolve(inSuite, cache, first));
+    NL_TEST_ASSERT(inSuite, !Resolve(inSuite, cache, second));
+}
+
+void TestFillNextVisitsAllServices(nlTestSuite * inSuite, void * inContext)
+{
+    System::Clock::Internal::MockClock clock;
+    RecordCache<16> cache(&clock);
+
+    SimulatedNode nodes[4];
+    for (size_t i = 0; i < ArraySize(nodes); i++)
+    {
+        nodes[i].Init(100 + i);
+        ReceiveAnnouncement(inSuite, cache, nodes[i]);
+    }
+
+    IncrementalResolver resolver;
+    size_t index = 0;
+    size_t found = 0;
+    while (cache.FillNext(index, resolver))
+    {
+        NL_TEST_ASSERT(inSuite, resolver.IsActiveOperationalParse());
+        resolver.ResetToInactive();
+        found++;
+    }
+    NL_TEST_ASSERT(inSuite, found == ArraySize(nodes));
+
+    // FillNext is not a lookup
+    NL_TEST_ASSERT(inSuite, cache.GetStatistics().hits == 0);
+    NL_TEST_ASSERT(inSuite, cache.GetStatistics().misses == 0);
+}
+
+/// A controller talking to many nodes that announced themselves should not have to
+/// query the network until the announced records expire.
+void TestSimulatedNodeFleet(nlTestSuite * inSuite, void * inContext)
+{
+    System::Clock::Internal::MockClock clock;
+
+    // too large for the stack
+    std::unique_ptr<RecordCache<kNodeCount * 3>> cache(new RecordCache<kNodeCount * 3>(&clock));
+    std::unique_ptr<SimulatedNode[]> nodes(new SimulatedNode[kNodeCount]);
+
+    for (size_t i = 0; i < kNodeCount; i++)
+    {
+        nodes[i].Init(i + 1);
+        ReceiveAnnouncement(inSuite, *cache, nodes[i]);
+    }
+
+    size_t queriesSent = 0;
+    for (size_t i = 0; i < kNodeCount; i++)
+    {
+        queriesSent += Resolve(inSuite, *cache, nodes[i]) ? 1 : 0;
+    }
+    NL_TEST_ASSERT(inSuite, queriesSent == 0);
+
+    // Once the records expire, every node has to be queried again
+    clock.AdvanceMonotonic(System::Clock::Seconds32(kTtlSeconds));
+    for (size_t i = 0; i < kNodeCount; i++)
+    {
+        if (Resolve(inSuite, *cache, nodes[i]))
+        {
+            queriesSent++;
+            ReceiveAnnouncement(inSuite, *cache, nodes[i]); // the query response
+        }
+    }
+    NL_TEST_ASSERT(inSuite, queriesSent == kNodeCount);
+
+    // ... and the responses are reused
+    for (size_t i = 0; i < kNodeCount; i++)
+    {
+        queriesSent += Resolve(inSuite, *cache, nodes[i]) ? 1 : 0;
+    }
+    NL_TEST_ASSERT(inSuite, queriesSent == kNodeCount);
+
+    const RecordCacheBase::Statistics & stats = cache->GetStatistics();
+    ChipLogProgress(Discovery, "Record cache: %u hits, %u misses, %u inserts, %u evictions", static_cast<unsigned>(stats.hits),
+                    static_cast<unsigned>(stats.misses), static_cast<unsigned>(stats.inserts),
+                    static_cast<unsigned>(stats.evictions));
+
+    NL_TEST_ASSERT(inSuite, stats.hits == 2 * kNodeCount);
+    NL_TEST_ASSERT(inSuite, stats.misses == kNodeCount);
+    NL_TEST_ASSERT(inSuite, stats.evictions == 0);
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("ResolveAnnouncedNode", TestResolveAnnouncedNode),                 //
+    NL_TEST_DEF("RecordsExpire", TestRecordsExpire),                               //
+    NL_TEST_DEF("GoodbyeRemovesRecords", TestGoodbyeRemovesRecords),               //
+    NL_TEST_DEF("EvictsRecordsClosestToExpiry", TestEvictsRecordsClosestToExpiry), //
+    NL_TEST_DEF("FillNextVisitsAllServices", TestFillNextVisitsAllServices),       //
+    NL_TEST_DEF("SimulatedNodeFleet", TestSimulatedNodeFleet),                     //
+    NL_TEST_SENTINEL()                                                             //
+};
+
+int TestSetup(void * inContext)
+{
+    return chip::Platform::MemoryInit() == CHIP_NO_ERROR ? SUCCESS : FAILURE;
+}
+
+int TestTeardown(void * inContext)
+{
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+} // namespace
+
+int TestRecordCache(void)
+{
+    nlTestSuite theSuite = { "RecordCache", sTests, &TestSetup, &TestTeardown };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestRecordCache)
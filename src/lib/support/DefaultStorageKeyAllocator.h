@@ -101,6 +101,7 @@ public:
         // for the cluster and attribute ids.
         return Format("g/a/%x/%" PRIx32 "/%" PRIx32, endpointId, clusterId, attributeId);
     }
+    const char * AttributeSnapshot(EndpointId endpointId) { return Format("g/as/%x", endpointId); }
 
     // TODO: Should store fabric-specific parts of the binding list under keys
     // starting with "f/%x/".
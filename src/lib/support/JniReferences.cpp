@@ -21,6 +21,8 @@
 #include <lib/support/JniReferences.h>
 #include <lib/support/JniTypeWrappers.h>
 
+#include <string.h>
+
 namespace chip {
 
 void JniReferences::SetJavaVm(JavaVM * jvm, const char * clsType)
@@ -44,7 +46,6 @@ void JniReferences::SetJavaVm(JavaVM * jvm, const char * clsType)
     mFindClassMethod = env->GetMethodID(classLoaderClass, "findClass", "(Ljava/lang/String;)Ljava/lang/Class;");
 
     chip::JniReferences::GetInstance().GetClassRef(env, "java/util/List", mListClass);
-    chip::JniReferences::GetInstance().GetClassRef(env, "java/util/ArrayList", mArrayListClass);
     chip::JniReferences::GetInstance().GetClassRef(env, "java/util/HashMap", mHashMapClass);
 }
 
@@ -95,6 +96,79 @@ CHIP_ERROR JniReferences::GetClassRef(JNIEnv * env, const char * clsType, jclass
     return err;
 }
 
+CHIP_ERROR JniCachedMethod::Resolve(JNIEnv * env, jclass & outCls, jmethodID & outMethod)
+{
+    return JniReferences::GetInstance().ResolveCachedMethod(env, *this, outCls, outMethod);
+}
+
+CHIP_ERROR JniReferences::ResolveCachedMethod(JNIEnv * env, JniCachedMethod & cache, jclass & outCls, jmethodID & outMethod)
+{
+    std::lock_guard<std::mutex> lock(mCacheMutex);
+
+    // Another thread may have resolved the method while this one was waiting for the lock.
+    jmethodID method = cache.mMethod.load(std::memory_order_relaxed);
+    if (method == nullptr)
+    {
+        jclass cls;
+        ReturnErrorOnFailure(GetClassRef(env, cache.mClsType, cls));
+        method = cache.mIsStatic ? env->GetStaticMethodID(cls, cache.mMethodName, cache.mMethodSignature)
+                                 : env->GetMethodID(cls, cache.mMethodName, cache.mMethodSignature);
+        if (method == nullptr)
+        {
+            env->DeleteGlobalRef(cls);
+            return CHIP_JNI_ERROR_METHOD_NOT_FOUND;
+        }
+
+        cache.mClass   = cls;
+        cache.mNext    = mCachedMethods;
+        mCachedMethods = &cache;
+        cache.mMethod.store(method, std::memory_order_release);
+    }
+
+    outCls    = cache.mClass;
+    outMethod = method;
+    return CHIP_NO_ERROR;
+}
+
+JniCachedMethod * JniReferences::GetBoxedTypeConstructor(const char * boxedTypeClsName, const char * constructorSignature)
+{
+    static JniCachedConstructor sBoxedTypeConstructors[] = {
+        { "java/lang/Integer", "(I)V" },
+        { "java/lang/Long", "(J)V" },
+        { "java/lang/Boolean", "(Z)V" },
+        { "java/lang/Float", "(F)V" },
+        { "java/lang/Double", "(D)V" },
+        { "java/lang/Short", "(S)V" },
+        { "java/lang/Byte", "(B)V" },
+        { "java/lang/Character", "(C)V" },
+    };
+
+    for (JniCachedConstructor & constructor : sBoxedTypeConstructors)
+    {
+        if (strcmp(constructor.mMethodSignature, constructorSignature) == 0 && strcmp(constructor.mClsType, boxedTypeClsName) == 0)
+        {
+            return &constructor;
+        }
+    }
+    return nullptr;
+}
+
+void JniReferences::ClearCachedClassRefs(JNIEnv * env)
+{
+    std::lock_guard<std::mutex> lock(mCacheMutex);
+    // Method IDs are only valid as long as their class is loaded.
+    JniCachedMethod * next;
+    for (JniCachedMethod * cache = mCachedMethods; cache != nullptr; cache = next)
+    {
+        next = cache->mNext;
+        cache->mMethod.store(nullptr, std::memory_order_relaxed);
+        env->DeleteGlobalRef(cache->mClass);
+        cache->mClass = nullptr;
+        cache->mNext  = nullptr;
+    }
+    mCachedMethods = nullptr;
+}
+
 CHIP_ERROR JniReferences::N2J_ByteArray(JNIEnv * env, const uint8_t * inArray, jsize inArrayLen, jbyteArray & outArray)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
@@ -186,13 +260,10 @@ void JniReferences::ThrowError(JNIEnv * env, jclass exceptionCls, CHIP_ERROR err
 CHIP_ERROR JniReferences::CreateOptional(jobject objectToWrap, jobject & outOptional)
 {
     JNIEnv * env = GetEnvForCurrentThread();
+    static JniCachedStaticMethod sOfNullableMethod("java/util/Optional", "ofNullable", "(Ljava/lang/Object;)Ljava/util/Optional;");
     jclass optionalCls;
-    chip::JniReferences::GetInstance().GetClassRef(env, "java/util/Optional", optionalCls);
-    VerifyOrReturnError(optionalCls != nullptr, CHIP_JNI_ERROR_TYPE_NOT_FOUND);
-    chip::JniClass jniClass(optionalCls);
-
-    jmethodID ofMethod = env->GetStaticMethodID(optionalCls, "ofNullable", "(Ljava/lang/Object;)Ljava/util/Optional;");
-    VerifyOrReturnError(ofMethod != nullptr, CHIP_JNI_ERROR_METHOD_NOT_FOUND);
+    jmethodID ofMethod;
+    ReturnErrorOnFailure(sOfNullableMethod.Get(env, optionalCls, ofMethod));
     outOptional = env->CallStaticObjectMethod(optionalCls, ofMethod, objectToWrap);
 
     VerifyOrReturnError(!env->ExceptionCheck(), CHIP_JNI_ERROR_EXCEPTION_THROWN);
@@ -203,13 +274,11 @@ CHIP_ERROR JniReferences::CreateOptional(jobject objectToWrap, jobject & outOpti
 CHIP_ERROR JniReferences::GetOptionalValue(jobject optionalObj, jobject & optionalValue)
 {
     JNIEnv * env = GetEnvForCurrentThread();
+    static JniCachedMethod sIsPresentMethod("java/util/Optional", "isPresent", "()Z");
+    static JniCachedMethod sGetMethod("java/util/Optional", "get", "()Ljava/lang/Object;");
     jclass optionalCls;
-    chip::JniReferences::GetInstance().GetClassRef(env, "java/util/Optional", optionalCls);
-    VerifyOrReturnError(optionalCls != nullptr, CHIP_JNI_ERROR_TYPE_NOT_FOUND);
-    chip::JniClass jniClass(optionalCls);
-
-    jmethodID isPresentMethod = env->GetMethodID(optionalCls, "isPresent", "()Z");
-    VerifyOrReturnError(isPresentMethod != nullptr, CHIP_JNI_ERROR_METHOD_NOT_FOUND);
+    jmethodID isPresentMethod;
+    ReturnErrorOnFailure(sIsPresentMethod.Get(env, optionalCls, isPresentMethod));
     jboolean isPresent = optionalObj && env->CallBooleanMethod(optionalObj, isPresentMethod);
 
     if (!isPresent)
@@ -218,64 +287,59 @@ CHIP_ERROR JniReferences::GetOptionalValue(jobject optionalObj, jobject & option
         return CHIP_NO_ERROR;
     }
 
-    jmethodID getMethod = env->GetMethodID(optionalCls, "get", "()Ljava/lang/Object;");
-    VerifyOrReturnError(getMethod != nullptr, CHIP_JNI_ERROR_METHOD_NOT_FOUND);
+    jmethodID getMethod;
+    ReturnErrorOnFailure(sGetMethod.Get(env, optionalCls, getMethod));
     optionalValue = env->CallObjectMethod(optionalObj, getMethod);
     return CHIP_NO_ERROR;
 }
 
 jint JniReferences::IntegerToPrimitive(jobject boxedInteger)
 {
+    static JniCachedMethod sIntValueMethod("java/lang/Integer", "intValue", "()I");
     JNIEnv * env = GetEnvForCurrentThread();
     jclass boxedTypeCls;
-    chip::JniReferences::GetInstance().GetClassRef(env, "java/lang/Integer", boxedTypeCls);
-    chip::JniClass jniClass(boxedTypeCls);
-
-    jmethodID valueMethod = env->GetMethodID(boxedTypeCls, "intValue", "()I");
+    jmethodID valueMethod = nullptr;
+    sIntValueMethod.Get(env, boxedTypeCls, valueMethod);
     return env->CallIntMethod(boxedInteger, valueMethod);
 }
 
 jlong JniReferences::LongToPrimitive(jobject boxedLong)
 {
+    static JniCachedMethod sLongValueMethod("java/lang/Long", "longValue", "()J");
     JNIEnv * env = GetEnvForCurrentThread();
     jclass boxedTypeCls;
-    chip::JniReferences::GetInstance().GetClassRef(env, "java/lang/Long", boxedTypeCls);
-    chip::JniClass jniClass(boxedTypeCls);
-
-    jmethodID valueMethod = env->GetMethodID(boxedTypeCls, "longValue", "()J");
+    jmethodID valueMethod = nullptr;
+    sLongValueMethod.Get(env, boxedTypeCls, valueMethod);
     return env->CallLongMethod(boxedLong, valueMethod);
 }
 
 jboolean JniReferences::BooleanToPrimitive(jobject boxedBoolean)
 {
+    static JniCachedMethod sBooleanValueMethod("java/lang/Boolean", "booleanValue", "()Z");
     JNIEnv * env = GetEnvForCurrentThread();
     jclass boxedTypeCls;
-    chip::JniReferences::GetInstance().GetClassRef(env, "java/lang/Boolean", boxedTypeCls);
-    chip::JniClass jniClass(boxedTypeCls);
-
-    jmethodID valueMethod = env->GetMethodID(boxedTypeCls, "booleanValue", "()Z");
+    jmethodID valueMethod = nullptr;
+    sBooleanValueMethod.Get(env, boxedTypeCls, valueMethod);
     return env->CallBooleanMethod(boxedBoolean, valueMethod);
 }
 
 jfloat JniReferences::FloatToPrimitive(jobject boxedFloat)
 {
+    static JniCachedMethod sFloatValueMethod("java/lang/Float", "floatValue", "()F");
     JNIEnv * env = GetEnvForCurrentThread();
     jclass boxedTypeCls;
-    chip::JniReferences::GetInstance().GetClassRef(env, "java/lang/Float", boxedTypeCls);
-    chip::JniClass jniClass(boxedTypeCls);
-
-    jmethodID valueMethod = env->GetMethodID(boxedTypeCls, "floatValue", "()F");
+    jmethodID valueMethod = nullptr;
+    sFloatValueMethod.Get(env, boxedTypeCls, valueMethod);
     return env->CallFloatMethod(boxedFloat, valueMethod);
 }
 
 jdouble JniReferences::DoubleToPrimitive(jobject boxedDouble)
 {
+    static JniCachedMethod sDoubleValueMethod("java/lang/Double", "doubleValue", "()D");
     JNIEnv * env = GetEnvForCurrentThread();
     jclass boxedTypeCls;
-    chip::JniReferences::GetInstance().GetClassRef(env, "java/lang/Double", boxedTypeCls);
-    chip::JniClass jniClass(boxedTypeCls);
-
-    jmethodID valueMethod = env->GetMethodID(boxedTypeCls, "doubleValue", "()D");
+    jmethodID valueMethod = nullptr;
+    sDoubleValueMethod.Get(env, boxedTypeCls, valueMethod);
     return env->CallDoubleMethod(boxedDouble, valueMethod);
 }
 
@@ -300,9 +364,11 @@ CHIP_ERROR JniReferences::CreateArrayList(jobject & outList)
     JNIEnv * env   = GetEnvForCurrentThread();
     CHIP_ERROR err = CHIP_NO_ERROR;
 
-    jmethodID arrayListCtor = env->GetMethodID(mArrayListClass, "<init>", "()V");
-    VerifyOrReturnError(arrayListCtor != nullptr, CHIP_JNI_ERROR_METHOD_NOT_FOUND);
-    outList = env->NewObject(mArrayListClass, arrayListCtor);
+    static JniCachedConstructor sArrayListCtor("java/util/ArrayList", "()V");
+    jclass arrayListClass;
+    jmethodID arrayListCtor;
+    ReturnErrorOnFailure(sArrayListCtor.Get(env, arrayListClass, arrayListCtor));
+    outList = env->NewObject(arrayListClass, arrayListCtor);
     VerifyOrReturnError(outList != nullptr, CHIP_JNI_ERROR_NULL_OBJECT);
 
     return err;
@@ -313,8 +379,10 @@ CHIP_ERROR JniReferences::AddToList(jobject list, jobject objectToAdd)
     JNIEnv * env   = GetEnvForCurrentThread();
     CHIP_ERROR err = CHIP_NO_ERROR;
 
-    jmethodID addMethod = env->GetMethodID(mListClass, "add", "(Ljava/lang/Object;)Z");
-    VerifyOrReturnError(addMethod != nullptr, CHIP_JNI_ERROR_METHOD_NOT_FOUND);
+    static JniCachedMethod sAddMethod("java/util/List", "add", "(Ljava/lang/Object;)Z");
+    jclass listClass;
+    jmethodID addMethod;
+    ReturnErrorOnFailure(sAddMethod.Get(env, listClass, addMethod));
 
     env->CallBooleanMethod(list, addMethod, objectToAdd);
     VerifyOrReturnError(!env->ExceptionCheck(), CHIP_JNI_ERROR_EXCEPTION_THROWN);
@@ -19,11 +19,90 @@
 
 #include <jni.h>
 #include <lib/core/CHIPError.h>
+#include <lib/support/CHIPJNIError.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/TypeTraits.h>
+#include <atomic>
+#include <mutex>
 #include <string>
 
 namespace chip {
+
+/**
+ * A Java class and one of its methods, looked up on the first call to Get() and kept until
+ * JniReferences::ClearCachedClassRefs().
+ *
+ * Declare it as a function-local static at the call site: once resolved, Get() is a single atomic load, without allocation
+ * or lock.
+ */
+class JniCachedMethod
+{
+public:
+    constexpr JniCachedMethod(const char * clsType, const char * methodName, const char * methodSignature) :
+        JniCachedMethod(clsType, methodName, methodSignature, false)
+    {}
+
+    JniCachedMethod(const JniCachedMethod &) = delete;
+    JniCachedMethod & operator=(const JniCachedMethod &) = delete;
+
+    /**
+     * Returns the class and the method ID.  The class reference is owned by the cache: callers must not delete it.
+     */
+    CHIP_ERROR Get(JNIEnv * env, jclass & outCls, jmethodID & outMethod)
+    {
+        jmethodID method = mMethod.load(std::memory_order_acquire);
+        if (method == nullptr)
+        {
+            return Resolve(env, outCls, outMethod);
+        }
+        outCls    = mClass;
+        outMethod = method;
+        return CHIP_NO_ERROR;
+    }
+
+protected:
+    constexpr JniCachedMethod(const char * clsType, const char * methodName, const char * methodSignature, bool isStatic) :
+        mClsType(clsType), mMethodName(methodName), mMethodSignature(methodSignature), mIsStatic(isStatic)
+    {}
+
+private:
+    friend class JniReferences;
+
+    CHIP_ERROR Resolve(JNIEnv * env, jclass & outCls, jmethodID & outMethod);
+
+    const char * const mClsType;
+    const char * const mMethodName;
+    const char * const mMethodSignature;
+    const bool mIsStatic;
+
+    // mClass is set before mMethod is published, and both are only reset by ClearCachedClassRefs().
+    jclass mClass = nullptr;
+    std::atomic<jmethodID> mMethod{ nullptr };
+    JniCachedMethod * mNext = nullptr;
+};
+
+/**
+ * A cached constructor, see JniCachedMethod.
+ */
+class JniCachedConstructor : public JniCachedMethod
+{
+public:
+    constexpr JniCachedConstructor(const char * clsType, const char * constructorSignature) :
+        JniCachedMethod(clsType, "<init>", constructorSignature)
+    {}
+};
+
+/**
+ * A cached static method, see JniCachedMethod.
+ */
+class JniCachedStaticMethod : public JniCachedMethod
+{
+public:
+    constexpr JniCachedStaticMethod(const char * clsType, const char * methodName, const char * methodSignature) :
+        JniCachedMethod(clsType, methodName, methodSignature, true)
+    {}
+};
+
 class JniReferences
 {
 public:
@@ -66,6 +145,13 @@ public:
      * @param[out] outCls A Java reference to the class matching clsType.
      */
     CHIP_ERROR GetClassRef(JNIEnv * env, const char * clsType, jclass & outCls);
+
+    /**
+     * Releases the class references and method IDs resolved by JniCachedMethod instances.
+     *
+     * The cached references keep the classes from being unloaded, so this must be called when the native library is unloaded.
+     */
+    void ClearCachedClassRefs(JNIEnv * env);
     CHIP_ERROR FindMethod(JNIEnv * env, jobject object, const char * methodName, const char * methodSignature,
                           jmethodID * methodId);
     void CallVoidInt(JNIEnv * env, jobject object, const char * methodName, jint argument);
@@ -136,26 +222,36 @@ public:
      * ("(I)V"), and value.
      */
     template <class T, typename std::enable_if_t<!std::is_enum<T>::value, int> = 0>
-    CHIP_ERROR CreateBoxedObject(std::string boxedTypeClsName, std::string constructorSignature, T value, jobject & outObj)
+    CHIP_ERROR CreateBoxedObject(const char * boxedTypeClsName, const char * constructorSignature, T value, jobject & outObj)
     {
-        JNIEnv * env   = GetEnvForCurrentThread();
-        CHIP_ERROR err = CHIP_NO_ERROR;
+        JNIEnv * env = GetEnvForCurrentThread();
         jclass boxedTypeCls;
-        err = GetClassRef(env, boxedTypeClsName.c_str(), boxedTypeCls);
-        VerifyOrReturnError(err == CHIP_NO_ERROR, err);
-
-        jmethodID boxedTypeConstructor = env->GetMethodID(boxedTypeCls, "<init>", constructorSignature.c_str());
-        outObj                         = env->NewObject(boxedTypeCls, boxedTypeConstructor, value);
-        env->DeleteGlobalRef(boxedTypeCls);
-
-        return err;
+        jmethodID boxedTypeConstructor;
+        JniCachedMethod * cachedConstructor = GetBoxedTypeConstructor(boxedTypeClsName, constructorSignature);
+        if (cachedConstructor == nullptr)
+        {
+            // Not one of the java.lang boxed types: look the class up on every call.
+            ReturnErrorOnFailure(GetClassRef(env, boxedTypeClsName, boxedTypeCls));
+            boxedTypeConstructor = env->GetMethodID(boxedTypeCls, "<init>", constructorSignature);
+            if (boxedTypeConstructor != nullptr)
+            {
+                outObj = env->NewObject(boxedTypeCls, boxedTypeConstructor, value);
+            }
+            env->DeleteGlobalRef(boxedTypeCls);
+            VerifyOrReturnError(boxedTypeConstructor != nullptr, CHIP_JNI_ERROR_METHOD_NOT_FOUND);
+            return CHIP_NO_ERROR;
+        }
+
+        ReturnErrorOnFailure(cachedConstructor->Get(env, boxedTypeCls, boxedTypeConstructor));
+        outObj = env->NewObject(boxedTypeCls, boxedTypeConstructor, value);
+        return CHIP_NO_ERROR;
     }
 
     /**
      * Handling for strongly-typed enums.
      */
     template <class T, typename std::enable_if_t<std::is_enum<T>::value, int> = 0>
-    CHIP_ERROR CreateBoxedObject(std::string boxedTypeClsName, std::string constructorSignature, T value, jobject & outObj)
+    CHIP_ERROR CreateBoxedObject(const char * boxedTypeClsName, const char * constructorSignature, T value, jobject & outObj)
     {
         return CreateBoxedObject(boxedTypeClsName, constructorSignature, chip::to_underlying(value), outObj);
     }
@@ -163,12 +259,22 @@ public:
 private:
     JniReferences() {}
 
+    friend class JniCachedMethod;
+
+    CHIP_ERROR ResolveCachedMethod(JNIEnv * env, JniCachedMethod & cache, jclass & outCls, jmethodID & outMethod);
+
+    // Returns the cached constructor of the given java.lang boxed type, or nullptr if the class is not one of them.
+    JniCachedMethod * GetBoxedTypeConstructor(const char * boxedTypeClsName, const char * constructorSignature);
+
     JavaVM * mJvm              = nullptr;
     jobject mClassLoader       = nullptr;
     jmethodID mFindClassMethod = nullptr;
 
-    jclass mHashMapClass   = nullptr;
-    jclass mListClass      = nullptr;
-    jclass mArrayListClass = nullptr;
+    jclass mHashMapClass = nullptr;
+    jclass mListClass    = nullptr;
+
+    // Serializes the first lookups of JniCachedMethod instances, which are then linked in mCachedMethods.
+    std::mutex mCacheMutex;
+    JniCachedMethod * mCachedMethods = nullptr;
 };
 } // namespace chip
@@ -0,0 +1,177 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      A bounded, lock-free, multi-producer single-consumer FIFO queue.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include <lib/core/CHIPError.h>
+
+namespace chip {
+
+/**
+ *  @class MpscRingQueue
+ *
+ *  @brief
+ *      A fixed-capacity ring of items that any number of threads can push to concurrently, without locking,
+ *      and that a single thread pops from.
+ *
+ *      Each slot carries a sequence number telling whether it is free for the producer of a given position
+ *      or holds an item for the consumer. Producers reserve a position with a compare-and-swap on the
+ *      enqueue index, store their item, then publish it through the slot sequence number.
+ *
+ *      The queue also coalesces consumer wake-ups: Push() only requests a wake-up for the first item pushed
+ *      after the consumer found the queue empty, so a consumer blocked on an event (e.g. the select() loop
+ *      wake pipe) is signalled once per batch instead of once per item.
+ *
+ *  @tparam T          The item type. Items are copied in and out of the queue.
+ *  @tparam kCapacity  The maximum number of queued items. Must be a power of two.
+ */
+template <typename T, size_t kCapacity>
+class MpscRingQueue
+{
+public:
+    static_assert(kCapacity >= 2 && (kCapacity & (kCapacity - 1)) == 0, "Capacity must be a power of two");
+
+    MpscRingQueue()
+    {
+        for (size_t i = 0; i < kCapacity; i++)
+        {
+            mSlots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscRingQueue(const MpscRingQueue &) = delete;
+    MpscRingQueue & operator=(const MpscRingQueue &) = delete;
+
+    /**
+     * Add an item at the end of the queue. May be called from any thread.
+     *
+     * @param[in]  item          The item to copy into the queue.
+     * @param[out] wakeConsumer  Set to true if the consumer may be waiting for items and must be woken up.
+     *
+     * @retval CHIP_ERROR_NO_MEMORY if the queue is full.
+     */
+    CHIP_ERROR Push(const T & item, bool & wakeConsumer)
+    {
+        wakeConsumer = false;
+
+        size_t position = mEnqueuePosition.load(std::memory_order_relaxed);
+        Slot * slot;
+        for (;;)
+        {
+            slot                    = &mSlots[position & kIndexMask];
+            const size_t sequence   = slot->sequence.load(std::memory_order_acquire);
+            const intptr_t distance = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+            if (distance == 0)
+            {
+                if (mEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (distance < 0)
+            {
+                // The slot still holds the item pushed one lap earlier
+                return CHIP_ERROR_NO_MEMORY;
+            }
+            else
+            {
+                position = mEnqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->item = item;
+        slot->sequence.store(position + 1, std::memory_order_release);
+
+        // Pairs with the fence in Pop(): either the consumer sees this item, or this producer sees the consumer idle.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        wakeConsumer = mConsumerIdle.load(std::memory_order_relaxed) && mConsumerIdle.exchange(false, std::memory_order_relaxed);
+        return CHIP_NO_ERROR;
+    }
+
+    /**
+     * Remove the item at the head of the queue. Must only be called from the consumer thread.
+     *
+     * Returns false if the queue is empty, in which case the next Push() requests a wake-up. An item
+     * whose producer is still copying it in is not visible yet; that producer will request the wake-up.
+     */
+    bool Pop(T & item)
+    {
+        if (TryPop(item))
+        {
+            return true;
+        }
+
+        mConsumerIdle.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // An item published before the fence above may not have seen the consumer idle: check again.
+        return TryPop(item);
+    }
+
+    /**
+     * Whether the queue holds no published item. Only meaningful on the consumer thread.
+     */
+    bool Empty() const
+    {
+        return mSlots[mDequeuePosition & kIndexMask].sequence.load(std::memory_order_acquire) != mDequeuePosition + 1;
+    }
+
+    static constexpr size_t Capacity() { return kCapacity; }
+
+private:
+    static constexpr size_t kIndexMask = kCapacity - 1;
+
+    // Keep the indices touched by producers and by the consumer on separate cache lines.
+    static constexpr size_t kCacheLineSize = 64;
+
+    struct Slot
+    {
+        std::atomic<size_t> sequence;
+        T item;
+    };
+
+    bool TryPop(T & item)
+    {
+        Slot & slot = mSlots[mDequeuePosition & kIndexMask];
+        if (slot.sequence.load(std::memory_order_acquire) != mDequeuePosition + 1)
+        {
+            return false;
+        }
+
+        item = slot.item;
+        // Hand the slot over to the producer of the same index on the next lap.
+        slot.sequence.store(mDequeuePosition + kCapacity, std::memory_order_release);
+        mDequeuePosition++;
+        return true;
+    }
+
+    alignas(kCacheLineSize) std::atomic<size_t> mEnqueuePosition{ 0 };
+    alignas(kCacheLineSize) std::atomic<bool> mConsumerIdle{ true };
+    alignas(kCacheLineSize) size_t mDequeuePosition = 0;
+    alignas(kCacheLineSize) Slot mSlots[kCapacity];
+};
+
+} // namespace chip
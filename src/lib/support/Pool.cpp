@@ -102,16 +102,16 @@ Loop StaticAllocatorBitmap::ForEachActiveObjectInner(void * context, Lambda lamb
 
 #if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 
-HeapObjectListNode * HeapObjectList::FindNode(void * object) const
+bool HeapObjectList::Contains(const void * object) const
 {
-    for (HeapObjectListNode * p = mNext; p != this; p = p->mNext)
+    for (const HeapObjectListNode * p = mNext; p != this; p = p->mNext)
     {
         if (p->mObject == object)
         {
-            return p;
+            return true;
         }
     }
-    return nullptr;
+    return false;
 }
 
 Loop HeapObjectList::ForEachNode(void * context, Lambda lambda)
@@ -134,7 +134,7 @@ Loop HeapObjectList::ForEachNode(void * context, Lambda lambda)
     --mIterationDepth;
     if (mIterationDepth == 0 && mHaveDeferredNodeRemovals)
     {
-        // Remove nodes for released objects.
+        // Remove nodes for released objects. Nodes are allocated at the start of the block holding their object.
         p = mNext;
         while (p != this)
         {
@@ -142,7 +142,7 @@ Loop HeapObjectList::ForEachNode(void * context, Lambda lambda)
             if (p->mObject == nullptr)
             {
                 p->Remove();
-                Platform::Delete(p);
+                Platform::MemoryFree(p);
             }
             p = next;
         }
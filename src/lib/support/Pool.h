@@ -161,8 +161,6 @@ struct HeapObjectList : HeapObjectListNode
         mPrev        = node;
     }
 
-    HeapObjectListNode * FindNode(void * object) const;
-
     using Lambda = Loop (*)(void *, void *);
     Loop ForEachNode(void * context, Lambda lambda);
     Loop ForEachNode(void * context, Loop lambda(void * context, const void * object)) const
@@ -170,6 +168,9 @@ struct HeapObjectList : HeapObjectListNode
         return const_cast<HeapObjectList *>(this)->ForEachNode(context, reinterpret_cast<Lambda>(lambda));
     }
 
+    // Linear in the number of allocated objects; only used for CHIP_CONFIG_MEMORY_DEBUG_CHECKS.
+    bool Contains(const void * object) const;
+
     size_t mIterationDepth         = 0;
     bool mHaveDeferredNodeRemovals = false;
 };
@@ -193,7 +194,8 @@ struct HeapObjectList : HeapObjectListNode
  *
  * @fn ReleaseObject
  * @memberof ObjectPool
- * @param object   Pointer to object to release (or return to the pool). Its destructor runs.
+ * @param object   Pointer to object to release (or return to the pool). Its destructor runs. It must be an object currently
+ *                 allocated from this pool.
  *
  * @fn ForEachActiveObject
  * @memberof ObjectPool
@@ -322,19 +324,18 @@ public:
     template <typename... Args>
     T * CreateObject(Args &&... args)
     {
-        T * object = Platform::New<T>(std::forward<Args>(args)...);
-        if (object != nullptr)
+        auto block = static_cast<Block *>(Platform::MemoryAlloc(sizeof(Block)));
+        if (block == nullptr)
         {
-            auto node = Platform::New<internal::HeapObjectListNode>();
-            if (node != nullptr)
-            {
-                node->mObject = object;
-                mObjects.Append(node);
-                IncreaseUsage();
-                return object;
-            }
+            return nullptr;
         }
-        return nullptr;
+
+        T * object           = new (block->mObjectStorage) T(std::forward<Args>(args)...);
+        block->mNode.mObject = object;
+        block->mPool         = this;
+        mObjects.Append(&block->mNode);
+        IncreaseUsage();
+        return object;
     }
 
     /*
@@ -353,20 +354,27 @@ public:
     {
         if (object != nullptr)
         {
-            internal::HeapObjectListNode * node = mObjects.FindNode(object);
             // Releasing an object that is not allocated indicates likely memory
-            // corruption; better to safe-crash than proceed at this point.
-            VerifyOrDie(node != nullptr);
-
-            node->mObject = nullptr;
-            Platform::Delete(object);
-
-            // The node needs to be released immediately if we are not in the middle of iteration.
+            // corruption; better to safe-crash than proceed at this point. The block is found from the object address, and
+            // records the pool it was allocated from, so that an object of another pool, or one already released, is caught
+            // without searching the list of allocated objects.
+#if CHIP_CONFIG_MEMORY_DEBUG_CHECKS
+            VerifyOrDie(mObjects.Contains(object));
+#endif // CHIP_CONFIG_MEMORY_DEBUG_CHECKS
+            Block * block = BlockOf(object);
+            VerifyOrDie(block->mPool == this && block->mNode.mObject == object);
+
+            internal::HeapObjectListNode * node = &block->mNode;
+            block->mPool                        = nullptr;
+            node->mObject                       = nullptr;
+            object->~T();
+
+            // The node (and the object memory with it) needs to be released immediately if we are not in the middle of iteration.
             // Otherwise cleanup is deferred until all iteration on this pool completes and it's safe to release nodes.
             if (mObjects.mIterationDepth == 0)
             {
                 node->Remove();
-                Platform::Delete(node);
+                Platform::MemoryFree(node);
             }
             else
             {
@@ -411,6 +419,20 @@ public:
     }
 
 private:
+    // Objects are allocated along with their list node, so that releasing an object does not have to search for its node.
+    // The node comes first so that the list can free the block through the node once the object is released.
+    struct Block
+    {
+        internal::HeapObjectListNode mNode;
+        const HeapObjectPool * mPool;
+        alignas(T) uint8_t mObjectStorage[sizeof(T)];
+    };
+
+    static Block * BlockOf(T * object)
+    {
+        return reinterpret_cast<Block *>(reinterpret_cast<uint8_t *>(object) - offsetof(Block, mObjectStorage));
+    }
+
     static Loop ReleaseObject(void * context, void * object)
     {
         static_cast<HeapObjectPool *>(context)->ReleaseObject(static_cast<T *>(object));
@@ -0,0 +1,328 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Unit tests and producer contention benchmark for the MpscRingQueue.
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include <lib/support/MpscRingQueue.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <nlunit-test.h>
+
+using namespace chip;
+
+namespace {
+
+// Same size as a ChipDeviceEvent
+struct Item
+{
+    uint32_t producer;
+    uint32_t sequence;
+    uint8_t payload[32];
+};
+
+constexpr size_t kSmallCapacity = 8;
+
+void TestPushPopOrder(nlTestSuite * inSuite, void * inContext)
+{
+    MpscRingQueue<int, kSmallCapacity> queue;
+    bool wake;
+    int value;
+
+    NL_TEST_ASSERT(inSuite, queue.Empty());
+    NL_TEST_ASSERT(inSuite, !queue.Pop(value));
+
+    // Go around the ring a few times
+    for (int lap = 0; lap < 3; lap++)
+    {
+        for (int i = 0; i < 5; i++)
+        {
+            NL_TEST_ASSERT(inSuite, queue.Push(lap * 10 + i, wake) == CHIP_NO_ERROR);
+        }
+        NL_TEST_ASSERT(inSuite, !queue.Empty());
+        for (int i = 0; i < 5; i++)
+        {
+            NL_TEST_ASSERT(inSuite, queue.Pop(value));
+            NL_TEST_ASSERT(inSuite, value == lap * 10 + i);
+        }
+        NL_TEST_ASSERT(inSuite, queue.Empty());
+        NL_TEST_ASSERT(inSuite, !queue.Pop(value));
+    }
+}
+
+void TestFull(nlTestSuite * inSuite, void * inContext)
+{
+    MpscRingQueue<int, kSmallCapacity> queue;
+    bool wake;
+    int value;
+
+    for (int i = 0; i < static_cast<int>(kSmallCapacity); i++)
+    {
+        NL_TEST_ASSERT(inSuite, queue.Push(i, wake) == CHIP_NO_ERROR);
+    }
+    NL_TEST_ASSERT(inSuite, queue.Push(100, wake) == CHIP_ERROR_NO_MEMORY);
+    NL_TEST_ASSERT(inSuite, !wake);
+
+    // Freeing one slot makes room for one more item
+    NL_TEST_ASSERT(inSuite, queue.Pop(value) && value == 0);
+    NL_TEST_ASSERT(inSuite, queue.Push(100, wake) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, queue.Push(101, wake) == CHIP_ERROR_NO_MEMORY);
+
+    for (int i = 1; i < static_cast<int>(kSmallCapacity); i++)
+    {
+        NL_TEST_ASSERT(inSuite, queue.Pop(value) && value == i);
+    }
+    NL_TEST_ASSERT(inSuite, queue.Pop(value) && value == 100);
+    NL_TEST_ASSERT(inSuite, !queue.Pop(value));
+}
+
+void TestWakeCoalescing(nlTestSuite * inSuite, void * inContext)
+{
+    MpscRingQueue<int, kSmallCapacity> queue;
+    bool wake;
+    int value;
+
+    // The consumer starts idle: the first item wakes it up, the following ones do not.
+    NL_TEST_ASSERT(inSuite, queue.Push(1, wake) == CHIP_NO_ERROR && wake);
+    NL_TEST_ASSERT(inSuite, queue.Push(2, wake) == CHIP_NO_ERROR && !wake);
+
+    // Popping without emptying the queue does not re-arm the wake-up
+    NL_TEST_ASSERT(inSuite, queue.Pop(value));
+    NL_TEST_ASSERT(inSuite, queue.Push(3, wake) == CHIP_NO_ERROR && !wake);
+
+    // Once the consumer found the queue empty, the next item wakes it up again
+    while (queue.Pop(value))
+    {
+    }
+    NL_TEST_ASSERT(inSuite, queue.Push(4, wake) == CHIP_NO_ERROR && wake);
+    NL_TEST_ASSERT(inSuite, queue.Push(5, wake) == CHIP_NO_ERROR && !wake);
+}
+
+/// Stands for the wake pipe of the select() loop: the consumer sleeps until notified.
+class WakeEvent
+{
+public:
+    void Notify()
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        mPending = true;
+        mNotifyCount++;
+        mCondition.notify_one();
+    }
+
+    /// Returns false if no notification arrived within a second.
+    bool Wait()
+    {
+        std::unique_lock<std::mutex> lock(mLock);
+        bool notified = mCondition.wait_for(lock, std::chrono::seconds(1), [this] { return mPending; });
+        mPending      = false;
+        return notified;
+    }
+
+    size_t GetNotifyCount()
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        return mNotifyCount;
+    }
+
+private:
+    std::mutex mLock;
+    std::condition_variable mCondition;
+    bool mPending       = false;
+    size_t mNotifyCount = 0;
+};
+
+/// The previous event queue: a locked std::queue, waking the consumer for every item.
+class LockedQueue
+{
+public:
+    CHIP_ERROR Push(const Item & item, bool & wakeConsumer)
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        mQueue.push(item);
+        wakeConsumer = true;
+        return CHIP_NO_ERROR;
+    }
+
+    bool Pop(Item & item)
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        if (mQueue.empty())
+        {
+            return false;
+        }
+        item = mQueue.front();
+        mQueue.pop();
+        return true;
+    }
+
+private:
+    std::mutex mLock;
+    std::queue<Item> mQueue;
+};
+
+using EventRing = MpscRingQueue<Item, 4096>;
+
+struct RunResult
+{
+    std::chrono::microseconds duration;
+    size_t wakeCount;
+    size_t missedWakeCount; // consumer timed out with items queued
+    bool inOrder;           // items of every producer were received in order
+};
+
+/// Push [itemsPerProducer] items from [producerCount] threads while the current thread consumes them,
+/// sleeping on a WakeEvent whenever the queue is empty.
+template <typename Queue>
+RunResult RunProducers(Queue & queue, size_t producerCount, uint32_t itemsPerProducer)
+{
+    WakeEvent wakeEvent;
+    std::vector<std::thread> producers;
+    std::vector<uint32_t> nextSequence(producerCount, 0);
+    RunResult result = { std::chrono::microseconds(0), 0, 0, true };
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (size_t p = 0; p < producerCount; p++)
+    {
+        producers.emplace_back([&queue, &wakeEvent, p, itemsPerProducer] {
+            Item item     = {};
+            item.producer = static_cast<uint32_t>(p);
+            for (uint32_t i = 0; i < itemsPerProducer; i++)
+            {
+                bool wake;
+                item.sequence = i;
+                while (queue.Push(item, wake) != CHIP_NO_ERROR)
+                {
+                    std::this_thread::yield(); // full, let the consumer catch up
+                }
+                if (wake)
+                {
+                    wakeEvent.Notify();
+                }
+            }
+        });
+    }
+
+    const size_t total = producerCount * itemsPerProducer;
+    size_t received    = 0;
+    while (received < total)
+    {
+        Item item;
+        while (queue.Pop(item))
+        {
+            result.inOrder = result.inOrder && (item.sequence == nextSequence[item.producer]);
+            nextSequence[item.producer]++;
+            received++;
+        }
+        if ((received < total) && !wakeEvent.Wait() && queue.Pop(item))
+        {
+            // Nobody woke us up although an item was available
+            result.missedWakeCount++;
+            result.inOrder = result.inOrder && (item.sequence == nextSequence[item.producer]);
+            nextSequence[item.producer]++;
+            received++;
+        }
+    }
+
+    for (auto & producer : producers)
+    {
+        producer.join();
+    }
+
+    result.duration  = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    result.wakeCount = wakeEvent.GetNotifyCount();
+    return result;
+}
+
+void TestConcurrentProducers(nlTestSuite * inSuite, void * inContext)
+{
+    // A small ring so that producers often find it full
+    MpscRingQueue<Item, 16> queue;
+
+    RunResult result = RunProducers(queue, 8, 20000);
+    NL_TEST_ASSERT(inSuite, result.inOrder);
+    NL_TEST_ASSERT(inSuite, result.missedWakeCount == 0);
+    NL_TEST_ASSERT(inSuite, queue.Empty());
+}
+
+void BenchmarkProducerContention(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr uint32_t kItemsPerRun = 1 << 18;
+
+    for (size_t producerCount = 1; producerCount <= 16; producerCount *= 2)
+    {
+        const uint32_t itemsPerProducer = static_cast<uint32_t>(kItemsPerRun / producerCount);
+
+        LockedQueue lockedQueue;
+        RunResult locked = RunProducers(lockedQueue, producerCount, itemsPerProducer);
+
+        std::unique_ptr<EventRing> ring(new EventRing());
+        RunResult lockFree = RunProducers(*ring, producerCount, itemsPerProducer);
+
+        ChipLogProgress(Support, "%2u producers: locked queue %8u items/s, %7u wakes; lock-free ring %8u items/s, %7u wakes",
+                        static_cast<unsigned>(producerCount),
+                        static_cast<unsigned>(kItemsPerRun * 1000000ull / static_cast<uint64_t>(locked.duration.count() + 1)),
+                        static_cast<unsigned>(locked.wakeCount),
+                        static_cast<unsigned>(kItemsPerRun * 1000000ull / static_cast<uint64_t>(lockFree.duration.count() + 1)),
+                        static_cast<unsigned>(lockFree.wakeCount));
+
+        NL_TEST_ASSERT(inSuite, locked.inOrder);
+        NL_TEST_ASSERT(inSuite, lockFree.inOrder);
+        NL_TEST_ASSERT(inSuite, lockFree.missedWakeCount == 0);
+        NL_TEST_ASSERT(inSuite, locked.wakeCount == kItemsPerRun);
+        NL_TEST_ASSERT(inSuite, lockFree.wakeCount <= kItemsPerRun);
+    }
+}
+
+} // namespace
+
+#define NL_TEST_DEF_FN(fn) NL_TEST_DEF("Test " #fn, fn)
+/**
+ *   Test Suite. It lists all the test functions.
+ */
+static const nlTest sTests[] = {
+    // clang-format off
+    NL_TEST_DEF_FN(TestPushPopOrder),
+    NL_TEST_DEF_FN(TestFull),
+    NL_TEST_DEF_FN(TestWakeCoalescing),
+    NL_TEST_DEF_FN(TestConcurrentProducers),
+    NL_TEST_DEF_FN(BenchmarkProducerContention),
+    NL_TEST_SENTINEL()
+    // clang-format on
+};
+
+int TestMpscRingQueue()
+{
+    nlTestSuite theSuite = { "CHIP MpscRingQueue tests", &sTests[0], nullptr, nullptr };
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestMpscRingQueue);
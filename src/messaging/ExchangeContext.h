@@ -40,6 +40,7 @@ namespace Messaging {
 
 class ExchangeManager;
 class ExchangeContext;
+class ExchangeContextIndex;
 class ExchangeMessageDispatch;
 using ExchangeHandle = ReferenceCountedHandle<ExchangeContext>;
 
@@ -62,6 +63,7 @@ class DLL_EXPORT ExchangeContext : public ReliableMessageContext,
 {
     friend class ExchangeManager;
     friend class ExchangeContextDeletor;
+    friend class ExchangeContextIndex;
 
 public:
     typedef System::Clock::Timeout Timeout; // Type used to express the timeout in this ExchangeContext
@@ -246,6 +248,9 @@ private:
     ExchangeSessionHolder mSession; // The connection state
     uint16_t mExchangeId;           // Assigned exchange ID.
 
+    ExchangeContext * mNextInIndex = nullptr; // Next exchange in the same ExchangeContextIndex bucket.
+    uint32_t mIndexHash            = 0;       // ExchangeContextIndex key of the exchange.
+
     /**
      *  Track whether we are now expecting a response to a message sent via this exchange (because that
      *  message had the kExpectResponse flag set in its sendFlags).
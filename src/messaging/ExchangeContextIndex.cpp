@@ -0,0 +1,121 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <messaging/ExchangeContextIndex.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace Messaging {
+
+ExchangeContextIndex::~ExchangeContextIndex()
+{
+    if (mBuckets != mInlineBuckets)
+    {
+        Platform::MemoryFree(mBuckets);
+    }
+}
+
+uint32_t ExchangeContextIndex::Hash(uint16_t exchangeId, const SessionHandle & session, bool isInitiator)
+{
+    uint64_t key = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(session.operator->()));
+    key ^= static_cast<uint64_t>(exchangeId) << 1 | (isInitiator ? 1u : 0u);
+
+    // MurmurHash3 finalizer, so that the low bits used to pick a bucket depend on all the bits of the key
+    key ^= key >> 33;
+    key *= 0xFF51AFD7ED558CCDULL;
+    key ^= key >> 33;
+    key *= 0xC4CEB9FE1A85EC53ULL;
+    key ^= key >> 33;
+    return static_cast<uint32_t>(key);
+}
+
+void ExchangeContextIndex::Insert(ExchangeContext * ec, const SessionHandle & session)
+{
+    ec->mIndexHash   = Hash(ec->GetExchangeId(), session, ec->IsInitiator());
+    ec->mNextInIndex = nullptr;
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    if (mCount >= mBucketCount)
+    {
+        Grow();
+    }
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+    Append(mBuckets, mBucketCount, ec);
+    mCount++;
+}
+
+void ExchangeContextIndex::Remove(ExchangeContext * ec)
+{
+    for (ExchangeContext ** link = &mBuckets[ec->mIndexHash & (mBucketCount - 1)]; *link != nullptr; link = &(*link)->mNextInIndex)
+    {
+        if (*link == ec)
+        {
+            *link            = ec->mNextInIndex;
+            ec->mNextInIndex = nullptr;
+            mCount--;
+            return;
+        }
+    }
+}
+
+void ExchangeContextIndex::Append(ExchangeContext ** buckets, size_t bucketCount, ExchangeContext * ec)
+{
+    // Appending keeps the chains in creation order, so that Find returns the oldest matching exchange as the pool did.
+    ExchangeContext ** link = &buckets[ec->mIndexHash & (bucketCount - 1)];
+    while (*link != nullptr)
+    {
+        link = &(*link)->mNextInIndex;
+    }
+    *link = ec;
+}
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+void ExchangeContextIndex::Grow()
+{
+    size_t bucketCount = mBucketCount * 2;
+    auto buckets       = static_cast<ExchangeContext **>(Platform::MemoryCalloc(bucketCount, sizeof(ExchangeContext *)));
+
+    // Longer chains are slower, not wrong: keep the current table if memory is short.
+    VerifyOrReturn(buckets != nullptr);
+
+    for (size_t i = 0; i < mBucketCount; i++)
+    {
+        ExchangeContext * ec = mBuckets[i];
+        while (ec != nullptr)
+        {
+            ExchangeContext * next = ec->mNextInIndex;
+            ec->mNextInIndex       = nullptr;
+            Append(buckets, bucketCount, ec);
+            ec = next;
+        }
+    }
+
+    if (mBuckets != mInlineBuckets)
+    {
+        Platform::MemoryFree(mBuckets);
+    }
+    mBuckets     = buckets;
+    mBucketCount = bucketCount;
+}
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+} // namespace Messaging
+} // namespace chip
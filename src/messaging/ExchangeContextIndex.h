@@ -0,0 +1,110 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the hash index the ExchangeManager uses to find the exchange a received message belongs to.
+ *
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <messaging/ExchangeContext.h>
+#include <system/SystemConfig.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace Messaging {
+
+namespace detail {
+
+constexpr size_t RoundUpToPowerOfTwo(size_t value, size_t powerOfTwo = 1)
+{
+    return powerOfTwo >= value ? powerOfTwo : RoundUpToPowerOfTwo(value, powerOfTwo * 2);
+}
+
+} // namespace detail
+
+/**
+ *  @brief
+ *    Hash index of the active exchanges on (exchange id, session, initiator flag), so that finding the exchange
+ *    of a received message does not have to compare every exchange.
+ *
+ *    Exchanges are chained in buckets through ExchangeContext::mNextInIndex, so the index never fails to insert.
+ *    The bucket table is sized for CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS exchanges; when the exchange pool is heap
+ *    allocated it doubles on the heap whenever there are more exchanges than buckets.
+ */
+class ExchangeContextIndex
+{
+public:
+    ExchangeContextIndex() = default;
+    ~ExchangeContextIndex();
+
+    ExchangeContextIndex(const ExchangeContextIndex &) = delete;
+    ExchangeContextIndex & operator=(const ExchangeContextIndex &) = delete;
+
+    static uint32_t Hash(uint16_t exchangeId, const SessionHandle & session, bool isInitiator);
+
+    /**
+     * Index an exchange created on the given session. The session is only used to compute the key: an exchange never
+     * moves to another session, so its key does not change until it is removed.
+     */
+    void Insert(ExchangeContext * ec, const SessionHandle & session);
+
+    void Remove(ExchangeContext * ec);
+
+    /**
+     * Find the oldest exchange indexed with the given key for which predicate(ExchangeContext *) returns true. The
+     * predicate has to check the exchange fully, since different keys may share a hash.
+     */
+    template <typename Predicate>
+    ExchangeContext * Find(uint32_t hash, Predicate && predicate) const
+    {
+        for (ExchangeContext * ec = mBuckets[hash & (mBucketCount - 1)]; ec != nullptr; ec = ec->mNextInIndex)
+        {
+            if (ec->mIndexHash == hash && predicate(ec))
+            {
+                return ec;
+            }
+        }
+        return nullptr;
+    }
+
+    size_t Count() const { return mCount; }
+    size_t BucketCount() const { return mBucketCount; }
+
+private:
+    static constexpr size_t kInlineBucketCount = detail::RoundUpToPowerOfTwo(CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS);
+
+    static void Append(ExchangeContext ** buckets, size_t bucketCount, ExchangeContext * ec);
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    void Grow();
+#endif // CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+
+    ExchangeContext * mInlineBuckets[kInlineBucketCount] = {};
+    ExchangeContext ** mBuckets                          = mInlineBuckets;
+    size_t mBucketCount                                  = kInlineBucketCount;
+    size_t mCount                                        = 0;
+};
+
+} // namespace Messaging
+} // namespace chip
@@ -54,6 +54,11 @@ CHIP_ERROR ExchangeMessageDispatch::SendMessage(SessionManager * sessionManager,
     // If there is a pending acknowledgment piggyback it on this message.
     if (reliableMessageContext->HasPiggybackAckPending())
     {
+        if (reliableMessageContext->IsAckPending() && reliableMessageContext->GetReliableMessageMgr() != nullptr)
+        {
+            reliableMessageContext->GetReliableMessageMgr()->CountAckSent(
+                payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::StandaloneAck));
+        }
         payloadHeader.SetAckMessageCounter(reliableMessageContext->TakePendingPeerAckMessageCounter());
     }
 
@@ -115,7 +115,18 @@ ExchangeContext * ExchangeManager::NewContext(const SessionHandle & session, Exc
         ChipLogError(ExchangeManager, "NewContext failed: session inactive");
         return nullptr;
     }
-    return mContextPool.CreateObject(this, mNextExchangeId++, session, isInitiator, delegate);
+    return CreateContext(mNextExchangeId++, session, isInitiator, delegate);
+}
+
+ExchangeContext * ExchangeManager::CreateContext(uint16_t exchangeId, const SessionHandle & session, bool isInitiator,
+                                                 ExchangeDelegate * delegate, bool isEphemeralExchange)
+{
+    ExchangeContext * ec = mContextPool.CreateObject(this, exchangeId, session, isInitiator, delegate, isEphemeralExchange);
+    if (ec != nullptr)
+    {
+        mContextIndex.Insert(ec, session);
+    }
+    return ec;
 }
 
 CHIP_ERROR ExchangeManager::RegisterUnsolicitedMessageHandlerForProtocol(Protocols::Id protocolId,
@@ -237,24 +248,19 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
     // for group msg (optimization)
     if (!packetHeader.IsGroupSession())
     {
-        // Search for an existing exchange that the message applies to. If a match is found...
-        bool found = false;
-        mContextPool.ForEachActiveObject([&](auto * ec) {
-            if (ec->MatchExchange(session, packetHeader, payloadHeader))
-            {
-                ChipLogDetail(ExchangeManager, "Found matching exchange: " ChipLogFormatExchange ", Delegate: %p",
-                              ChipLogValueExchange(ec), ec->GetDelegate());
-
-                // Matched ExchangeContext; send to message handler.
-                ec->HandleMessage(packetHeader.GetMessageCounter(), payloadHeader, msgFlags, std::move(msgBuf));
-                found = true;
-                return Loop::Break;
-            }
-            return Loop::Continue;
-        });
+        // Search for an existing exchange that the message applies to: the message is from the initiator of
+        // the exchange iff the exchange is the responder. If a match is found...
+        uint32_t hash = ExchangeContextIndex::Hash(payloadHeader.GetExchangeID(), session, !payloadHeader.IsInitiator());
+        ExchangeContext * ec = mContextIndex.Find(
+            hash, [&](ExchangeContext * candidate) { return candidate->MatchExchange(session, packetHeader, payloadHeader); });
 
-        if (found)
+        if (ec != nullptr)
         {
+            ChipLogDetail(ExchangeManager, "Found matching exchange: " ChipLogFormatExchange ", Delegate: %p",
+                          ChipLogValueExchange(ec), ec->GetDelegate());
+
+            // Matched ExchangeContext; send to message handler.
+            ec->HandleMessage(packetHeader.GetMessageCounter(), payloadHeader, msgFlags, std::move(msgBuf));
             return;
         }
     }
@@ -321,7 +327,7 @@ void ExchangeManager::OnMessageReceived(const PacketHeader & packetHeader, const
             return;
         }
 
-        ExchangeContext * ec = mContextPool.CreateObject(this, payloadHeader.GetExchangeID(), session, false, delegate);
+        ExchangeContext * ec = CreateContext(payloadHeader.GetExchangeID(), session, false, delegate);
 
         if (ec == nullptr)
         {
@@ -372,8 +378,8 @@ void ExchangeManager::SendStandaloneAckIfNeeded(const PacketHeader & packetHeade
     // If rcvd msg is from initiator then this exchange is created as not Initiator.
     // If rcvd msg is not from initiator then this exchange is created as Initiator.
     // Create a EphemeralExchange to generate a StandaloneAck
-    ExchangeContext * ec = mContextPool.CreateObject(this, payloadHeader.GetExchangeID(), session, !payloadHeader.IsInitiator(),
-                                                     nullptr, true /* IsEphemeralExchange */);
+    ExchangeContext * ec = CreateContext(payloadHeader.GetExchangeID(), session, !payloadHeader.IsInitiator(), nullptr,
+                                         true /* IsEphemeralExchange */);
 
     if (ec == nullptr)
     {
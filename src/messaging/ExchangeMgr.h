@@ -30,6 +30,7 @@
 #include <lib/support/Pool.h>
 #include <lib/support/TypeTraits.h>
 #include <messaging/ExchangeContext.h>
+#include <messaging/ExchangeContextIndex.h>
 #include <messaging/ReliableMessageMgr.h>
 #include <protocols/Protocols.h>
 #include <transport/SessionManager.h>
@@ -100,7 +101,11 @@ public:
      */
     ExchangeContext * NewContext(const SessionHandle & session, ExchangeDelegate * delegate, bool isInitiator = true);
 
-    void ReleaseContext(ExchangeContext * ec) { mContextPool.ReleaseObject(ec); }
+    void ReleaseContext(ExchangeContext * ec)
+    {
+        mContextIndex.Remove(ec);
+        mContextPool.ReleaseObject(ec);
+    }
 
     /**
      *  Register an unsolicited message handler for a given protocol identifier. This handler would be
@@ -229,12 +234,16 @@ private:
     FabricIndex mFabricIndex = 0;
 
     ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> mContextPool;
+    ExchangeContextIndex mContextIndex;
 
     SessionManager * mSessionManager;
     ReliableMessageMgr mReliableMessageMgr;
 
     UnsolicitedMessageHandlerSlot UMHandlerPool[CHIP_CONFIG_MAX_UNSOLICITED_MESSAGE_HANDLERS];
 
+    ExchangeContext * CreateContext(uint16_t exchangeId, const SessionHandle & session, bool isInitiator,
+                                    ExchangeDelegate * delegate, bool isEphemeralExchange = false);
+
     CHIP_ERROR RegisterUMH(Protocols::Id protocolId, int16_t msgType, UnsolicitedMessageHandler * handler);
     CHIP_ERROR UnregisterUMH(Protocols::Id protocolId, int16_t msgType);
 
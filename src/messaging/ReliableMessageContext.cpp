@@ -158,8 +158,7 @@ CHIP_ERROR ReliableMessageContext::HandleNeedsAckInner(uint32_t messageCounter,
 
     // Replace the Pending ack message counter.
     SetPendingPeerAckMessageCounter(messageCounter);
-    using namespace System::Clock::Literals;
-    mNextAckTime = System::SystemClock().GetMonotonicTimestamp() + CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT;
+    mNextAckTime = GetReliableMessageMgr()->GetAckDeadline(System::SystemClock().GetMonotonicTimestamp());
     return CHIP_NO_ERROR;
 }
 
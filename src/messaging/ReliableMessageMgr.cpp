@@ -43,7 +43,7 @@ namespace chip {
 namespace Messaging {
 
 ReliableMessageMgr::RetransTableEntry::RetransTableEntry(ReliableMessageContext * rc) :
-    ec(*rc->GetExchangeContext()), nextRetransTime(0), sendCount(0)
+    ec(*rc->GetExchangeContext()), nextRetransTime(0), initialSendTime(0), sendCount(0)
 {
     ec->SetMessageNotAcked(true);
 }
@@ -54,7 +54,8 @@ ReliableMessageMgr::RetransTableEntry::~RetransTableEntry()
 }
 
 ReliableMessageMgr::ReliableMessageMgr(ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool) :
-    mContextPool(contextPool), mSystemLayer(nullptr)
+    mContextPool(contextPool), mSystemLayer(nullptr), mAckTimeout(CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT),
+    mAckCoalescingWindow(CHIP_CONFIG_RMP_DEFAULT_ACK_COALESCING_WINDOW)
 {}
 
 ReliableMessageMgr::~ReliableMessageMgr() {}
@@ -156,13 +157,16 @@ void ReliableMessageMgr::ExecuteActions()
         }
 
         entry->sendCount++;
+        if (entry->sendCount == 1)
+        {
+            entry->ec->GetSessionHandle()->GetRoundTripTimeEstimator().OnRetransmission();
+        }
         ChipLogDetail(ExchangeManager,
                       "Retransmitting MessageCounter:" ChipLogFormatMessageCounter " on exchange " ChipLogFormatExchange
                       " Send Cnt %d",
                       messageCounter, ChipLogValueExchange(&entry->ec.Get()), entry->sendCount);
 
-        // Choose active/idle timeout from PeerActiveMode of session per 4.11.2.1. Retransmissions.
-        System::Clock::Timestamp baseTimeout = entry->ec->GetSessionHandle()->GetMRPBaseTimeout();
+        System::Clock::Timestamp baseTimeout = GetRetransBaseTimeout(entry->ec->GetSessionHandle());
         System::Clock::Timestamp backoff     = ReliableMessageMgr::GetBackoff(baseTimeout, entry->sendCount);
         entry->nextRetransTime               = System::SystemClock().GetMonotonicTimestamp() + backoff;
         SendFromRetransTable(entry);
@@ -265,12 +269,39 @@ System::Clock::Timestamp ReliableMessageMgr::GetBackoff(System::Clock::Timestamp
     return mrpBackoffTime;
 }
 
-void ReliableMessageMgr::StartRetransmision(RetransTableEntry * entry)
+System::Clock::Timestamp ReliableMessageMgr::GetRetransBaseTimeout(const SessionHandle & session) const
 {
     // Choose active/idle timeout from PeerActiveMode of session per 4.11.2.1. Retransmissions.
-    System::Clock::Timestamp baseTimeout = entry->ec->GetSessionHandle()->GetMRPBaseTimeout();
+    System::Clock::Timestamp baseTimeout = session->GetMRPBaseTimeout();
+    if (mAdaptiveRetransTimeout)
+    {
+        // Until the round trip time is measured, the advertised interval is the initial timeout.
+        baseTimeout = session->GetRoundTripTimeEstimator().GetRetransTimeout(
+            std::chrono::duration_cast<System::Clock::Milliseconds32>(baseTimeout));
+    }
+    return baseTimeout;
+}
+
+System::Clock::Timestamp ReliableMessageMgr::GetAckDeadline(System::Clock::Timestamp pendingSince) const
+{
+    System::Clock::Timestamp deadline = pendingSince + mAckTimeout;
+    System::Clock::Timestamp window   = std::min<System::Clock::Timestamp>(mAckCoalescingWindow, mAckTimeout);
+    if (window.count() == 0)
+    {
+        return deadline;
+    }
+
+    // Aligning the deadlines on the window makes the acknowledgments falling due within the same window expire
+    // together, so that they are all sent by one timer expiration instead of one each.
+    return deadline - System::Clock::Timestamp(deadline.count() % window.count());
+}
+
+void ReliableMessageMgr::StartRetransmision(RetransTableEntry * entry)
+{
+    System::Clock::Timestamp baseTimeout = GetRetransBaseTimeout(entry->ec->GetSessionHandle());
     System::Clock::Timestamp backoff     = ReliableMessageMgr::GetBackoff(baseTimeout, entry->sendCount);
-    entry->nextRetransTime               = System::SystemClock().GetMonotonicTimestamp() + backoff;
+    entry->initialSendTime               = System::SystemClock().GetMonotonicTimestamp();
+    entry->nextRetransTime               = entry->initialSendTime + backoff;
     StartTimer();
 }
 
@@ -280,6 +311,15 @@ bool ReliableMessageMgr::CheckAndRemRetransTable(ReliableMessageContext * rc, ui
     mRetransTable.ForEachActiveObject([&](auto * entry) {
         if (entry->ec->GetReliableMessageContext() == rc && entry->retainedBuf.GetMessageCounter() == ackMessageCounter)
         {
+            // Karn's rule: the ack of a retransmitted message may be for any of its transmissions, so only the round trip
+            // time of messages acked on their first transmission is sampled.
+            if (entry->sendCount == 0)
+            {
+                System::Clock::Timestamp roundTripTime = System::SystemClock().GetMonotonicTimestamp() - entry->initialSendTime;
+                entry->ec->GetSessionHandle()->GetRoundTripTimeEstimator().AddSample(
+                    std::chrono::duration_cast<System::Clock::Milliseconds32>(roundTripTime));
+            }
+
             // Clear the entry from the retransmision table.
             ClearRetransTable(*entry);
 
@@ -63,10 +63,20 @@ public:
         ExchangeHandle ec;                        /**< The context for the stored CHIP message. */
         EncryptedPacketBufferHandle retainedBuf;  /**< The packet buffer holding the CHIP message. */
         System::Clock::Timestamp nextRetransTime; /**< A counter representing the next retransmission time for the message. */
+        System::Clock::Timestamp initialSendTime; /**< The time the message was first sent, to sample the round trip time. */
         uint8_t sendCount;                        /**< The number of times we have tried to send this entry,
                                                        including both successfully and failure send. */
     };
 
+    /**
+     *  Counters of the acknowledgments sent for the messages received reliably.
+     */
+    struct AckCounters
+    {
+        uint32_t piggybacked = 0; /**< Acknowledgments carried by a message sent on the exchange. */
+        uint32_t standalone  = 0; /**< Acknowledgments sent in a StandaloneAck message. */
+    };
+
     ReliableMessageMgr(ObjectPool<ExchangeContext, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS> & contextPool);
     ~ReliableMessageMgr();
 
@@ -112,6 +122,58 @@ public:
      */
     static System::Clock::Timestamp GetBackoff(System::Clock::Timestamp baseInterval, uint8_t sendCount);
 
+    /**
+     *  Get the base interval of the backoff of messages sent on a session: the interval advertised by the peer for its
+     *  current active or idle mode or, when adaptive retransmission timeouts are enabled, the retransmission timeout
+     *  derived from the round trip times measured on the session (see RoundTripTimeEstimator).
+     *
+     *  @param[in]   session    The session the message is sent on.
+     */
+    System::Clock::Timestamp GetRetransBaseTimeout(const SessionHandle & session) const;
+
+    /**
+     *  Enable or disable adaptive retransmission timeouts, see GetRetransBaseTimeout. The round trip times of the sessions
+     *  are measured either way. Defaults to CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT.
+     */
+    void SetAdaptiveRetransTimeoutEnabled(bool enabled) { mAdaptiveRetransTimeout = enabled; }
+    bool IsAdaptiveRetransTimeoutEnabled() const { return mAdaptiveRetransTimeout; }
+
+    /**
+     *  Set how long an acknowledgment is held waiting for a message to piggyback on before it is sent in a StandaloneAck
+     *  message, and the window within which acknowledgments falling due are sent together (0 to send each one at its
+     *  timeout). Default to CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT and CHIP_CONFIG_RMP_DEFAULT_ACK_COALESCING_WINDOW.
+     *
+     *  A longer timeout lets slow responses carry the acknowledgment, but delays the acknowledgment of messages that get
+     *  no response: it has to stay well below the retransmission interval the peers use for this node.
+     */
+    void SetAckTimeout(System::Clock::Milliseconds32 ackTimeout) { mAckTimeout = ackTimeout; }
+    void SetAckCoalescingWindow(System::Clock::Milliseconds32 window) { mAckCoalescingWindow = window; }
+    System::Clock::Milliseconds32 GetAckTimeout() const { return mAckTimeout; }
+    System::Clock::Milliseconds32 GetAckCoalescingWindow() const { return mAckCoalescingWindow; }
+
+    /**
+     *  Get the time at which an acknowledgment that became pending at the given time has to be sent if no message carries it.
+     */
+    System::Clock::Timestamp GetAckDeadline(System::Clock::Timestamp pendingSince) const;
+
+    /**
+     *  Count an acknowledgment sent, in a StandaloneAck message or piggybacked on another message.
+     */
+    void CountAckSent(bool standalone)
+    {
+        if (standalone)
+        {
+            mAckCounters.standalone++;
+        }
+        else
+        {
+            mAckCounters.piggybacked++;
+        }
+    }
+
+    const AckCounters & GetAckCounters() const { return mAckCounters; }
+    void ResetAckCounters() { mAckCounters = AckCounters(); }
+
     /**
      *  Start retranmisttion of cached encryped packet for current entry.
      *
@@ -214,6 +276,12 @@ private:
     ObjectPool<RetransTableEntry, CHIP_CONFIG_RMP_RETRANS_TABLE_SIZE> mRetransTable;
 
     SessionUpdateDelegate * mSessionUpdateDelegate = nullptr;
+
+    bool mAdaptiveRetransTimeout = CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT;
+
+    System::Clock::Milliseconds32 mAckTimeout;
+    System::Clock::Milliseconds32 mAckCoalescingWindow;
+    AckCounters mAckCounters;
 };
 
 } // namespace Messaging
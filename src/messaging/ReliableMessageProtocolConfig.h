@@ -71,6 +71,19 @@ namespace chip {
 #define CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT (200_ms32)
 #endif // CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT
 
+/**
+ *  @def CHIP_CONFIG_RMP_DEFAULT_ACK_COALESCING_WINDOW
+ *
+ *  @brief
+ *    The default window in milliseconds within which the acknowledgments falling due are sent together, so that
+ *    acknowledgments pending on many exchanges need a single timer expiration (and radio wake up) instead of one
+ *    each. Acknowledgments are sent up to this much before their timeout. 0 disables the coalescing.
+ *
+ */
+#ifndef CHIP_CONFIG_RMP_DEFAULT_ACK_COALESCING_WINDOW
+#define CHIP_CONFIG_RMP_DEFAULT_ACK_COALESCING_WINDOW (0_ms32)
+#endif // CHIP_CONFIG_RMP_DEFAULT_ACK_COALESCING_WINDOW
+
 /**
  *  @def CHIP_CONFIG_RESOLVE_PEER_ON_FIRST_TRANSMIT_FAILURE
  *
@@ -121,6 +134,43 @@ namespace chip {
 #define CHIP_CONFIG_RMP_DEFAULT_MAX_RETRANS (4)
 #endif // CHIP_CONFIG_RMP_DEFAULT_MAX_RETRANS
 
+/**
+ *  @def CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT
+ *
+ *  @brief
+ *    Whether the base retransmission interval of a session is derived from the round trip times measured on
+ *    it instead of the interval advertised by the peer, once a round trip time has been measured.
+ *
+ *  The round trip times are always measured; this only selects the default of
+ *  ReliableMessageMgr::SetAdaptiveRetransTimeoutEnabled.
+ */
+#ifndef CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT
+#define CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT 0
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT
+
+/**
+ *  @def CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRY_INTERVAL
+ *
+ *  @brief
+ *    Lower bound of the base retransmission interval derived from measured round trip times.
+ *
+ */
+#ifndef CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRY_INTERVAL
+#define CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRY_INTERVAL (100_ms32)
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRY_INTERVAL
+
+/**
+ *  @def CHIP_CONFIG_MRP_ADAPTIVE_MAX_RETRY_INTERVAL
+ *
+ *  @brief
+ *    Upper bound of the base retransmission interval derived from measured round trip times. The default is the
+ *    largest idle and active interval a node may advertise.
+ *
+ */
+#ifndef CHIP_CONFIG_MRP_ADAPTIVE_MAX_RETRY_INTERVAL
+#define CHIP_CONFIG_MRP_ADAPTIVE_MAX_RETRY_INTERVAL (3600000_ms32)
+#endif // CHIP_CONFIG_MRP_ADAPTIVE_MAX_RETRY_INTERVAL
+
 /**
  *  @brief
  *    The ReliableMessageProtocol configuration.
@@ -0,0 +1,133 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines the round trip time estimator from which the adaptive
+ *      ReliableMessageProtocol retransmission interval of a session is derived.
+ *
+ */
+
+#pragma once
+
+#include <messaging/ReliableMessageProtocolConfig.h>
+#include <system/SystemClock.h>
+
+#include <algorithm>
+#include <stdint.h>
+
+namespace chip {
+namespace Messaging {
+
+/**
+ *  @brief
+ *    Smoothed round trip time and round trip time variation of a session, computed as for the TCP retransmission
+ *    timer (RFC 6298) from the time it takes for reliable messages to be acknowledged.
+ *
+ *    Following Karn's algorithm, only messages acknowledged without having been retransmitted shall be sampled, since
+ *    the acknowledgment of a retransmitted message cannot be attributed to one of its transmissions, and the timeout is
+ *    doubled for every message that had to be retransmitted until a sample is taken again. Otherwise a link whose round
+ *    trip time is above the timeout would never be sampled.
+ */
+class RoundTripTimeEstimator
+{
+public:
+    void AddSample(System::Clock::Milliseconds32 roundTripTime)
+    {
+        using namespace System::Clock::Literals;
+        const System::Clock::Milliseconds32 maxSample(CHIP_CONFIG_MRP_ADAPTIVE_MAX_RETRY_INTERVAL);
+        uint32_t sample = std::min(roundTripTime, maxSample).count();
+
+        // Both values are kept scaled by kScale so that the 1/8 and 1/4 gains do not lose the low bits
+        if (mSampleCount == 0)
+        {
+            mScaledSmoothedRtt  = sample * kScale;
+            mScaledRttVariation = sample * kScale / 2;
+        }
+        else
+        {
+            uint32_t scaledSample = sample * kScale;
+            uint32_t error =
+                (mScaledSmoothedRtt > scaledSample) ? mScaledSmoothedRtt - scaledSample : scaledSample - mScaledSmoothedRtt;
+
+            // RTTVAR = 3/4 RTTVAR + 1/4 |SRTT - R|, then SRTT = 7/8 SRTT + 1/8 R
+            mScaledRttVariation = mScaledRttVariation - mScaledRttVariation / 4 + error / 4;
+            mScaledSmoothedRtt  = mScaledSmoothedRtt - mScaledSmoothedRtt / 8 + sample;
+        }
+
+        if (mSampleCount < UINT16_MAX)
+        {
+            mSampleCount++;
+        }
+        mBackoffExponent = 0;
+    }
+
+    /**
+     * Called when the first transmission of a message timed out.
+     */
+    void OnRetransmission()
+    {
+        if (mBackoffExponent < kMaxBackoffExponent)
+        {
+            mBackoffExponent++;
+        }
+    }
+
+    void Reset() { *this = RoundTripTimeEstimator(); }
+
+    bool HasEstimate() const { return mSampleCount > 0; }
+    uint16_t GetSampleCount() const { return mSampleCount; }
+
+    System::Clock::Milliseconds32 GetSmoothedRoundTripTime() const
+    {
+        return System::Clock::Milliseconds32(mScaledSmoothedRtt / kScale);
+    }
+
+    System::Clock::Milliseconds32 GetRoundTripTimeVariation() const
+    {
+        return System::Clock::Milliseconds32(mScaledRttVariation / kScale);
+    }
+
+    /**
+     * The retransmission timeout SRTT + 4 * RTTVAR, or initialTimeout when no sample has been taken yet, doubled for
+     * every message retransmitted since the last sample and clamped between CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRY_INTERVAL
+     * and CHIP_CONFIG_MRP_ADAPTIVE_MAX_RETRY_INTERVAL.
+     */
+    System::Clock::Milliseconds32 GetRetransTimeout(System::Clock::Milliseconds32 initialTimeout) const
+    {
+        using namespace System::Clock::Literals;
+        const System::Clock::Milliseconds32 minTimeout(CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRY_INTERVAL);
+        const System::Clock::Milliseconds32 maxTimeout(CHIP_CONFIG_MRP_ADAPTIVE_MAX_RETRY_INTERVAL);
+
+        uint64_t timeout = HasEstimate() ? (mScaledSmoothedRtt + 4 * mScaledRttVariation) / kScale : initialTimeout.count();
+        timeout          = std::min<uint64_t>(timeout << mBackoffExponent, maxTimeout.count());
+        return std::max(minTimeout, System::Clock::Milliseconds32(static_cast<uint32_t>(timeout)));
+    }
+
+private:
+    static constexpr uint32_t kScale             = 8;
+    static constexpr uint8_t kMaxBackoffExponent = 6;
+
+    uint32_t mScaledSmoothedRtt  = 0;
+    uint32_t mScaledRttVariation = 0;
+    uint16_t mSampleCount        = 0;
+    uint8_t mBackoffExponent     = 0;
+};
+
+} // namespace Messaging
+} // namespace chip
@@ -37,8 +37,12 @@
 #include <nlbyteorder.h>
 #include <nlunit-test.h>
 
+#include <algorithm>
 #include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
 #include <utility>
+#include <vector>
 
 namespace {
 
@@ -90,6 +94,45 @@ public:
     bool IsOnResponseTimeoutCalled = false;
 };
 
+// Keeps the exchanges it gets messages on open, as if it was going to respond.
+class KeepOpenDelegate : public ExchangeDelegate
+{
+public:
+    CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && buffer) override
+    {
+        ec->WillSendMessage();
+        mLastExchange = ec;
+        mMessageCount++;
+        return CHIP_NO_ERROR;
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+
+    ExchangeContext * mLastExchange = nullptr;
+    uint32_t mMessageCount          = 0;
+};
+
+// Hands a message from the peer of an exchange to the exchange manager, as the session manager would once decrypted.
+void DispatchResponse(TestContext & ctx, uint16_t exchangeId, bool exchangeIsInitiator, const SessionHandle & session)
+{
+    PacketHeader packetHeader;
+    PayloadHeader payloadHeader;
+
+    packetHeader.SetSessionId(1);
+    payloadHeader.SetExchangeID(exchangeId).SetMessageType(Protocols::BDX::Id, kMsgType_TEST1);
+    payloadHeader.SetInitiator(!exchangeIsInitiator);
+
+    SessionMessageDelegate & dispatcher = ctx.GetExchangeManager();
+    dispatcher.OnMessageReceived(packetHeader, payloadHeader, session, SessionMessageDelegate::DuplicateMessage::No,
+                                 System::PacketBufferHandle());
+}
+
+void DispatchResponse(TestContext & ctx, ExchangeContext * ec)
+{
+    DispatchResponse(ctx, ec->GetExchangeId(), ec->IsInitiator(), ec->GetSessionHandle());
+}
+
 void CheckNewContextTest(nlTestSuite * inSuite, void * inContext)
 {
     TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
@@ -224,6 +267,123 @@ void CheckExchangeMessages(nlTestSuite * inSuite, void * inContext)
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
 }
 
+void CheckDispatchWithManyExchanges(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    struct ExchangeInfo
+    {
+        ExchangeContext * mExchange;
+        uint16_t mExchangeId;
+        bool mIsInitiator;
+        bool mToAlice;
+    };
+
+    constexpr size_t kExchangeCount = std::min<size_t>(200, CHIP_CONFIG_MAX_EXCHANGE_CONTEXTS);
+    KeepOpenDelegate delegate;
+    std::vector<ExchangeInfo> exchanges;
+
+    // Initiator and responder exchanges on both sessions
+    while (exchanges.size() < kExchangeCount)
+    {
+        bool toAlice     = (exchanges.size() % 2 == 0);
+        bool isInitiator = (exchanges.size() % 3 != 0);
+        ExchangeContext * ec =
+            toAlice ? ctx.NewExchangeToAlice(&delegate, isInitiator) : ctx.NewExchangeToBob(&delegate, isInitiator);
+        NL_TEST_ASSERT(inSuite, ec != nullptr);
+        exchanges.push_back({ ec, ec->GetExchangeId(), isInitiator, toAlice });
+    }
+
+    auto dispatch = [&](const ExchangeInfo & info, bool toAlice) {
+        delegate.mLastExchange = nullptr;
+        DispatchResponse(ctx, info.mExchangeId, info.mIsInitiator,
+                         toAlice ? ctx.GetSessionBobToAlice() : ctx.GetSessionAliceToBob());
+        return delegate.mLastExchange;
+    };
+
+    for (size_t i = 0; i < exchanges.size(); i++)
+    {
+        const ExchangeInfo & info = exchanges[(i * 7) % exchanges.size()];
+        NL_TEST_ASSERT(inSuite, dispatch(info, info.mToAlice) == info.mExchange);
+    }
+    NL_TEST_ASSERT(inSuite, delegate.mMessageCount == exchanges.size());
+
+    // Messages for closed exchanges no longer reach them, and messages only reach exchanges of the session they come from.
+    for (size_t i = 0; i < exchanges.size(); i += 2)
+    {
+        exchanges[i].mExchange->Close();
+    }
+    for (size_t i = 0; i < exchanges.size(); i++)
+    {
+        const ExchangeInfo & info = exchanges[i];
+        NL_TEST_ASSERT(inSuite, dispatch(info, info.mToAlice) == ((i % 2 == 0) ? nullptr : info.mExchange));
+        NL_TEST_ASSERT(inSuite, dispatch(info, !info.mToAlice) == nullptr);
+    }
+
+    for (size_t i = 1; i < exchanges.size(); i += 2)
+    {
+        exchanges[i].mExchange->Close();
+    }
+    NL_TEST_ASSERT(inSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+
+void BenchmarkDispatch(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    constexpr size_t kExchangeCounts[] = { 16, 1000, 10000 };
+    constexpr uint32_t kMessageCount   = 20000;
+    KeepOpenDelegate delegate;
+    std::vector<ExchangeContext *> exchanges;
+
+    // Per message detail logs would dominate the measurement
+    Logging::SetLogRedirectCallback([](const char * module, uint8_t category, const char * msg, va_list args) {});
+
+    for (size_t exchangeCount : kExchangeCounts)
+    {
+        System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+        while (exchanges.size() < exchangeCount)
+        {
+            ExchangeContext * ec = ctx.NewExchangeToAlice(&delegate);
+            if (ec == nullptr)
+            {
+                break;
+            }
+            exchanges.push_back(ec);
+        }
+        System::Clock::Microseconds64 setup = System::SystemClock().GetMonotonicMicroseconds64() - start;
+        if (exchanges.size() < exchangeCount)
+        {
+            printf("Exchange pool exhausted at %u exchanges\n", static_cast<unsigned>(exchanges.size()));
+            break;
+        }
+
+        start = System::SystemClock().GetMonotonicMicroseconds64();
+        for (uint32_t i = 0; i < kMessageCount; i++)
+        {
+            DispatchResponse(ctx, exchanges[(i * 7919u) % exchangeCount]);
+        }
+        System::Clock::Microseconds64 elapsed = System::SystemClock().GetMonotonicMicroseconds64() - start;
+
+        printf("%5u active exchanges: %" PRIu64 " ns per dispatched message, %" PRIu64 " us to open them\n",
+               static_cast<unsigned>(exchangeCount), elapsed.count() * 1000 / kMessageCount, setup.count());
+    }
+    NL_TEST_ASSERT(inSuite, delegate.mMessageCount > 0);
+
+    System::Clock::Microseconds64 start = System::SystemClock().GetMonotonicMicroseconds64();
+    // Out of order, as interactions complete
+    for (size_t i = 0; i < exchanges.size(); i++)
+    {
+        exchanges[(i * 7919u) % exchanges.size()]->Close();
+    }
+    System::Clock::Microseconds64 elapsed = System::SystemClock().GetMonotonicMicroseconds64() - start;
+    printf("%u exchanges closed in %" PRIu64 " us\n", static_cast<unsigned>(exchanges.size()), elapsed.count());
+
+    Logging::SetLogRedirectCallback(nullptr);
+
+    NL_TEST_ASSERT(inSuite, ctx.GetExchangeManager().GetNumActiveExchanges() == 0);
+}
+
 // Test Suite
 
 /**
@@ -237,6 +397,8 @@ const nlTest sTests[] =
     NL_TEST_DEF("Test ExchangeMgr::CheckExchangeMessages",    CheckExchangeMessages),
     NL_TEST_DEF("Test OnConnectionExpired basics",            CheckSessionExpirationBasics),
     NL_TEST_DEF("Test OnConnectionExpired timeout handling",  CheckSessionExpirationTimeout),
+    NL_TEST_DEF("Test dispatch with many exchanges",          CheckDispatchWithManyExchanges),
+    NL_TEST_DEF("Benchmark message dispatch",                 BenchmarkDispatch),
 
     NL_TEST_SENTINEL()
 };
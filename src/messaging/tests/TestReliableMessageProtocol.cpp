@@ -1664,6 +1664,210 @@ void CheckGetBackoff(nlTestSuite * inSuite, void * inContext)
     }
 }
 
+/**
+ * Tests that the round trip time of a session is sampled from the acks of messages sent once only (Karn's rule), and that
+ * adaptive retransmission timeouts use it.
+ */
+void CheckRoundTripTimeSampling(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    MockAppDelegate mockSender;
+    MockAppDelegate mockReceiver;
+    ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    NL_TEST_ASSERT(inSuite, rm != nullptr);
+    NL_TEST_ASSERT(inSuite,
+                   ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Echo::MsgType::EchoRequest, &mockReceiver) ==
+                       CHIP_NO_ERROR);
+
+    SessionHandle session                 = ctx.GetSessionBobToAlice();
+    RoundTripTimeEstimator & rttEstimator = session->GetRoundTripTimeEstimator();
+    session->AsSecureSession()->SetRemoteMRPConfig({
+        System::Clock::Timestamp(64), // CHIP_CONFIG_MRP_LOCAL_IDLE_RETRY_INTERVAL
+        System::Clock::Timestamp(64), // CHIP_CONFIG_MRP_LOCAL_ACTIVE_RETRY_INTERVAL
+    });
+    rttEstimator.Reset();
+
+    auto & loopback = ctx.GetLoopback();
+    loopback.Reset();
+
+    // A message acked on its first transmission is sampled
+    chip::System::PacketBufferHandle buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+    NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+    ExchangeContext * exchange = ctx.NewExchangeToAlice(&mockSender);
+    NL_TEST_ASSERT(inSuite, exchange != nullptr);
+    NL_TEST_ASSERT(inSuite,
+                   exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer), SendMessageFlags::kExpectResponse) ==
+                       CHIP_NO_ERROR);
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 0);
+    NL_TEST_ASSERT(inSuite, rttEstimator.GetSampleCount() == 1);
+    NL_TEST_ASSERT(inSuite, rttEstimator.GetSmoothedRoundTripTime() < System::Clock::Milliseconds32(64));
+    exchange->Close();
+
+    // Only when enabled, the retransmission interval is derived from it: the loopback round trip time is below the minimum
+    NL_TEST_ASSERT(inSuite, rm->GetRetransBaseTimeout(session) == session->GetMRPBaseTimeout());
+    rm->SetAdaptiveRetransTimeoutEnabled(true);
+    NL_TEST_ASSERT(inSuite, rm->GetRetransBaseTimeout(session) == CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRY_INTERVAL);
+    rm->SetAdaptiveRetransTimeoutEnabled(CHIP_CONFIG_MRP_ADAPTIVE_RETRANS_TIMEOUT);
+
+    // A message acked after a retransmission is not
+    rttEstimator.Reset();
+    loopback.mSentMessageCount    = 0;
+    loopback.mNumMessagesToDrop   = 1;
+    loopback.mDroppedMessageCount = 0;
+
+    buffer = chip::MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+    NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+    exchange = ctx.NewExchangeToAlice(&mockSender);
+    NL_TEST_ASSERT(inSuite, exchange != nullptr);
+    NL_TEST_ASSERT(inSuite,
+                   exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer), SendMessageFlags::kExpectResponse) ==
+                       CHIP_NO_ERROR);
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(inSuite, loopback.mDroppedMessageCount == 1);
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 1);
+
+    ctx.GetIOContext().DriveIOUntil(1000_ms32, [&] { return loopback.mSentMessageCount >= 2; });
+    ctx.DrainAndServiceIO();
+
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 0);
+    NL_TEST_ASSERT(inSuite, !rttEstimator.HasEstimate());
+    exchange->Close();
+
+    rttEstimator.Reset();
+    loopback.Reset();
+    CHIP_ERROR err = ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Echo::MsgType::EchoRequest);
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+}
+
+class MockDelayedResponder : public UnsolicitedMessageHandler, public ExchangeDelegate
+{
+public:
+    static constexpr size_t kMaxExchanges = 8;
+
+    CHIP_ERROR OnUnsolicitedMessageReceived(const PayloadHeader & payloadHeader, ExchangeDelegate *& newDelegate) override
+    {
+        newDelegate = this;
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR OnMessageReceived(ExchangeContext * ec, const PayloadHeader & payloadHeader,
+                                 System::PacketBufferHandle && buffer) override
+    {
+        // Hold on to the exchange to respond later, as a device does while it prepares a report.
+        VerifyOrReturnError(mExchangeCount < kMaxExchanges, CHIP_ERROR_NO_MEMORY);
+        ec->WillSendMessage();
+        mExchanges[mExchangeCount++] = ec;
+        return CHIP_NO_ERROR;
+    }
+
+    void OnResponseTimeout(ExchangeContext * ec) override {}
+
+    CHIP_ERROR RespondToAll()
+    {
+        for (size_t i = 0; i < mExchangeCount; i++)
+        {
+            System::PacketBufferHandle buffer = MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+            VerifyOrReturnError(!buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
+            ReturnErrorOnFailure(mExchanges[i]->SendMessage(Echo::MsgType::EchoResponse, std::move(buffer)));
+        }
+        mExchangeCount = 0;
+        return CHIP_NO_ERROR;
+    }
+
+    ExchangeContext * mExchanges[kMaxExchanges];
+    size_t mExchangeCount = 0;
+};
+
+// Sends requests on kExchangeCount exchanges that the peer answers after processingTime, and returns the acknowledgments
+// counted for the requests and for the responses.
+ReliableMessageMgr::AckCounters RunDelayedResponses(nlTestSuite * inSuite, TestContext & ctx, size_t exchangeCount,
+                                                    System::Clock::Milliseconds32 processingTime)
+{
+    ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    MockAppDelegate mockSender;
+    MockDelayedResponder mockReceiver;
+    NL_TEST_ASSERT(inSuite,
+                   ctx.GetExchangeManager().RegisterUnsolicitedMessageHandlerForType(Echo::MsgType::EchoRequest, &mockReceiver) ==
+                       CHIP_NO_ERROR);
+    rm->ResetAckCounters();
+
+    for (size_t i = 0; i < exchangeCount; i++)
+    {
+        System::PacketBufferHandle buffer = MessagePacketBuffer::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+        NL_TEST_ASSERT(inSuite, !buffer.IsNull());
+        ExchangeContext * exchange = ctx.NewExchangeToBob(&mockSender);
+        NL_TEST_ASSERT(inSuite, exchange != nullptr);
+        NL_TEST_ASSERT(inSuite,
+                       exchange->SendMessage(Echo::MsgType::EchoRequest, std::move(buffer), SendMessageFlags::kExpectResponse) ==
+                           CHIP_NO_ERROR);
+    }
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(inSuite, mockReceiver.mExchangeCount == exchangeCount);
+
+    ctx.GetIOContext().DriveIOUntil(processingTime, [] { return false; });
+    NL_TEST_ASSERT(inSuite, mockReceiver.RespondToAll() == CHIP_NO_ERROR);
+    ctx.DrainAndServiceIO();
+    NL_TEST_ASSERT(inSuite, rm->TestGetCountRetransTable() == 0);
+
+    NL_TEST_ASSERT(inSuite, ctx.GetExchangeManager().UnregisterUnsolicitedMessageHandlerForType(Echo::MsgType::EchoRequest) ==
+                       CHIP_NO_ERROR);
+    return rm->GetAckCounters();
+}
+
+void CheckDelayedAckTuning(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    ReliableMessageMgr * rm = ctx.GetExchangeManager().GetReliableMessageMgr();
+    NL_TEST_ASSERT(inSuite, rm != nullptr);
+    NL_TEST_ASSERT(inSuite, rm->GetAckTimeout() == CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT);
+
+    // Deadlines are aligned on the coalescing window, so that the acks falling due within it expire together
+    rm->SetAckCoalescingWindow(100_ms32);
+    NL_TEST_ASSERT(inSuite, rm->GetAckDeadline(System::Clock::Timestamp(1000)) == System::Clock::Timestamp(1200));
+    NL_TEST_ASSERT(inSuite, rm->GetAckDeadline(System::Clock::Timestamp(1030)) == System::Clock::Timestamp(1200));
+    NL_TEST_ASSERT(inSuite, rm->GetAckDeadline(System::Clock::Timestamp(1099)) == System::Clock::Timestamp(1200));
+    NL_TEST_ASSERT(inSuite, rm->GetAckDeadline(System::Clock::Timestamp(1100)) == System::Clock::Timestamp(1300));
+    // and never later than the ack timeout nor earlier than the ack timeout minus the window
+    rm->SetAckCoalescingWindow(500_ms32);
+    NL_TEST_ASSERT(inSuite, rm->GetAckDeadline(System::Clock::Timestamp(1030)) == System::Clock::Timestamp(1200));
+    NL_TEST_ASSERT(inSuite, rm->GetAckDeadline(System::Clock::Timestamp(1130)) == System::Clock::Timestamp(1200));
+    rm->SetAckCoalescingWindow(0_ms32);
+    NL_TEST_ASSERT(inSuite, rm->GetAckDeadline(System::Clock::Timestamp(1030)) == System::Clock::Timestamp(1230));
+
+    // Keep the requests from being retransmitted while the responses are prepared
+    ctx.GetSessionAliceToBob()->AsSecureSession()->SetRemoteMRPConfig({ 2000_ms32, 2000_ms32 });
+    ctx.GetSessionBobToAlice()->AsSecureSession()->SetRemoteMRPConfig({ 2000_ms32, 2000_ms32 });
+
+    constexpr size_t kExchangeCount = 4;
+
+    // Responses prepared for longer than the ack timeout cannot carry the ack of the request
+    ReliableMessageMgr::AckCounters counters = RunDelayedResponses(inSuite, ctx, kExchangeCount, 250_ms32);
+    NL_TEST_ASSERT(inSuite, counters.standalone == 2 * kExchangeCount);
+    NL_TEST_ASSERT(inSuite, counters.piggybacked == 0);
+
+    // With a longer ack timeout they do: only the acks of the responses are standalone
+    rm->SetAckTimeout(400_ms32);
+    counters = RunDelayedResponses(inSuite, ctx, kExchangeCount, 250_ms32);
+    NL_TEST_ASSERT(inSuite, counters.standalone == kExchangeCount);
+    NL_TEST_ASSERT(inSuite, counters.piggybacked == kExchangeCount);
+
+    // Coalescing never sends the ack later than the ack timeout
+    rm->SetAckCoalescingWindow(100_ms32);
+    counters = RunDelayedResponses(inSuite, ctx, kExchangeCount, 250_ms32);
+    NL_TEST_ASSERT(inSuite, counters.standalone == kExchangeCount);
+    NL_TEST_ASSERT(inSuite, counters.piggybacked == kExchangeCount);
+
+    rm->SetAckTimeout(CHIP_CONFIG_RMP_DEFAULT_ACK_TIMEOUT);
+    rm->SetAckCoalescingWindow(CHIP_CONFIG_RMP_DEFAULT_ACK_COALESCING_WINDOW);
+    rm->ResetAckCounters();
+    ctx.GetSessionAliceToBob()->AsSecureSession()->SetRemoteMRPConfig(GetLocalMRPConfig().ValueOr(GetDefaultMRPConfig()));
+    ctx.GetSessionBobToAlice()->AsSecureSession()->SetRemoteMRPConfig(GetLocalMRPConfig().ValueOr(GetDefaultMRPConfig()));
+}
+
 int InitializeTestCase(void * inContext)
 {
     TestContext & ctx = *static_cast<TestContext *>(inContext);
@@ -1713,6 +1917,8 @@ const nlTest sTests[] =
     NL_TEST_DEF("Test that dropping an application-level message with a piggyback ack works ok once both sides retransmit", CheckLostResponseWithPiggyback),
     NL_TEST_DEF("Test that an application-level response-to-response after a lost standalone ack to the initial message works", CheckLostStandaloneAck),
     NL_TEST_DEF("Test MRP backoff algorithm", CheckGetBackoff),
+    NL_TEST_DEF("Test MRP round trip time sampling", CheckRoundTripTimeSampling),
+    NL_TEST_DEF("Test that a longer ack timeout lets delayed responses carry the ack", CheckDelayedAckTuning),
 
     NL_TEST_SENTINEL()
 };
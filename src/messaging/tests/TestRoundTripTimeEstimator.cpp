@@ -0,0 +1,300 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements unit tests for the round trip time estimator of the
+ *      ReliableMessageProtocol, and a simulation of reliable message delivery
+ *      over lossy links comparing static and adaptive retransmission timeouts.
+ */
+
+#include <lib/support/UnitTestRegistration.h>
+#include <messaging/ReliableMessageMgr.h>
+#include <messaging/RoundTripTimeEstimator.h>
+
+#include <nlunit-test.h>
+
+#include <inttypes.h>
+#include <stdio.h>
+
+namespace {
+
+using namespace chip;
+using namespace chip::Messaging;
+using namespace chip::System::Clock::Literals;
+
+using System::Clock::Milliseconds32;
+
+constexpr Milliseconds32 kInitialTimeout = 300_ms32;
+
+void CheckFirstSample(nlTestSuite * inSuite, void * inContext)
+{
+    RoundTripTimeEstimator estimator;
+    NL_TEST_ASSERT(inSuite, !estimator.HasEstimate());
+    NL_TEST_ASSERT(inSuite, estimator.GetRetransTimeout(kInitialTimeout) == kInitialTimeout);
+
+    // SRTT = R, RTTVAR = R/2, RTO = SRTT + 4 * RTTVAR
+    estimator.AddSample(400_ms32);
+    NL_TEST_ASSERT(inSuite, estimator.HasEstimate());
+    NL_TEST_ASSERT(inSuite, estimator.GetSmoothedRoundTripTime() == 400_ms32);
+    NL_TEST_ASSERT(inSuite, estimator.GetRoundTripTimeVariation() == 200_ms32);
+    NL_TEST_ASSERT(inSuite, estimator.GetRetransTimeout(kInitialTimeout) == 1200_ms32);
+
+    estimator.Reset();
+    NL_TEST_ASSERT(inSuite, !estimator.HasEstimate());
+}
+
+void CheckConvergence(nlTestSuite * inSuite, void * inContext)
+{
+    RoundTripTimeEstimator estimator;
+
+    estimator.AddSample(1000_ms32);
+    for (int i = 0; i < 100; i++)
+    {
+        estimator.AddSample(200_ms32);
+    }
+
+    // A steady round trip time pulls SRTT to it and RTTVAR to zero, leaving the RTO at the round trip time
+    NL_TEST_ASSERT(inSuite, estimator.GetSmoothedRoundTripTime() >= 200_ms32);
+    NL_TEST_ASSERT(inSuite, estimator.GetSmoothedRoundTripTime() <= 201_ms32);
+    NL_TEST_ASSERT(inSuite, estimator.GetRoundTripTimeVariation() <= 1_ms32);
+    NL_TEST_ASSERT(inSuite, estimator.GetRetransTimeout(kInitialTimeout) <= 205_ms32);
+
+    // Jitter raises the RTO above the mean round trip time
+    for (int i = 0; i < 100; i++)
+    {
+        estimator.AddSample((i % 2 == 0) ? 100_ms32 : 300_ms32);
+    }
+    NL_TEST_ASSERT(inSuite, estimator.GetSmoothedRoundTripTime() >= 180_ms32);
+    NL_TEST_ASSERT(inSuite, estimator.GetSmoothedRoundTripTime() <= 220_ms32);
+    NL_TEST_ASSERT(inSuite, estimator.GetRetransTimeout(kInitialTimeout) >= 500_ms32);
+}
+
+void CheckBackoff(nlTestSuite * inSuite, void * inContext)
+{
+    RoundTripTimeEstimator estimator;
+
+    // Before the first sample, the initial timeout is backed off
+    estimator.OnRetransmission();
+    NL_TEST_ASSERT(inSuite, estimator.GetRetransTimeout(kInitialTimeout) == 600_ms32);
+    estimator.OnRetransmission();
+    NL_TEST_ASSERT(inSuite, estimator.GetRetransTimeout(kInitialTimeout) == 1200_ms32);
+
+    // A sample ends the backoff
+    estimator.AddSample(400_ms32);
+    NL_TEST_ASSERT(inSuite, estimator.GetRetransTimeout(kInitialTimeout) == 1200_ms32);
+    estimator.OnRetransmission();
+    NL_TEST_ASSERT(inSuite, estimator.GetRetransTimeout(kInitialTimeout) == 2400_ms32);
+    estimator.AddSample(400_ms32);
+    NL_TEST_ASSERT(inSuite, estimator.GetRetransTimeout(kInitialTimeout) < 1200_ms32);
+
+    // The backoff is bounded
+    for (int i = 0; i < 100; i++)
+    {
+        estimator.OnRetransmission();
+    }
+    NL_TEST_ASSERT(inSuite, estimator.GetRetransTimeout(kInitialTimeout) < CHIP_CONFIG_MRP_ADAPTIVE_MAX_RETRY_INTERVAL);
+}
+
+void CheckBounds(nlTestSuite * inSuite, void * inContext)
+{
+    RoundTripTimeEstimator estimator;
+
+    estimator.AddSample(0_ms32);
+    NL_TEST_ASSERT(inSuite, estimator.GetRetransTimeout(kInitialTimeout) == CHIP_CONFIG_MRP_ADAPTIVE_MIN_RETRY_INTERVAL);
+
+    estimator.Reset();
+    estimator.AddSample(Milliseconds32(UINT32_MAX));
+    NL_TEST_ASSERT(inSuite, estimator.GetSmoothedRoundTripTime() == CHIP_CONFIG_MRP_ADAPTIVE_MAX_RETRY_INTERVAL);
+    NL_TEST_ASSERT(inSuite, estimator.GetRetransTimeout(kInitialTimeout) == CHIP_CONFIG_MRP_ADAPTIVE_MAX_RETRY_INTERVAL);
+}
+
+/**
+ * Simulation of a sender delivering messages one after the other to a peer over a link with the given latency, jitter
+ * and loss, applying the retransmission policy of the ReliableMessageMgr (ReliableMessageMgr::GetBackoff from either the
+ * interval advertised by the peer or the adaptive retransmission timeout, and Karn's rule).
+ */
+struct LinkModel
+{
+    const char * name;
+    uint32_t latencyMs;  // One way latency
+    uint32_t jitterMs;   // Added to the one way latency, uniformly distributed
+    uint32_t ackDelayMs; // Time the peer takes to ack, e.g. waiting for a response to piggyback the ack on
+    uint8_t lossPercent; // Of messages and of acks
+    Milliseconds32 peerInterval;
+};
+
+struct SimulationResult
+{
+    uint64_t completionTimeMs = 0;
+    uint32_t retransmissions  = 0;
+    uint32_t duplicates       = 0; // Retransmissions of messages the peer had already received
+    uint32_t failures         = 0; // Messages not acked after CHIP_CONFIG_RMP_DEFAULT_MAX_RETRANS retransmissions
+};
+
+class Random
+{
+public:
+    explicit Random(uint32_t seed) : mState(seed) {}
+
+    // xorshift32
+    uint32_t Next()
+    {
+        mState ^= mState << 13;
+        mState ^= mState >> 17;
+        mState ^= mState << 5;
+        return mState;
+    }
+
+    uint32_t Below(uint32_t bound) { return bound == 0 ? 0 : Next() % bound; }
+    bool Chance(uint8_t percent) { return Below(100) < percent; }
+
+private:
+    uint32_t mState;
+};
+
+SimulationResult Simulate(const LinkModel & link, bool adaptive, uint32_t messageCount)
+{
+    RoundTripTimeEstimator estimator;
+    Random random(0x5EED1234);
+    SimulationResult result;
+    uint64_t now = 0;
+
+    auto oneWay = [&] { return static_cast<uint64_t>(link.latencyMs + random.Below(link.jitterMs + 1)); };
+
+    for (uint32_t message = 0; message < messageCount; message++)
+    {
+        uint64_t firstSendTime = now;
+        uint64_t sendTime      = now;
+        uint64_t receiveTime   = UINT64_MAX;
+        uint64_t ackTime       = UINT64_MAX;
+        uint8_t sendCount      = 0;
+
+        while (true)
+        {
+            if (sendCount > 0)
+            {
+                result.retransmissions++;
+                result.duplicates += (receiveTime <= sendTime) ? 1 : 0;
+            }
+            if (sendCount == 1)
+            {
+                estimator.OnRetransmission();
+            }
+
+            if (!random.Chance(link.lossPercent))
+            {
+                uint64_t arrival = sendTime + oneWay();
+                receiveTime      = std::min(receiveTime, arrival);
+                if (!random.Chance(link.lossPercent))
+                {
+                    ackTime = std::min(ackTime, arrival + link.ackDelayMs + oneWay());
+                }
+            }
+
+            Milliseconds32 baseTimeout = adaptive ? estimator.GetRetransTimeout(link.peerInterval) : link.peerInterval;
+            uint64_t retransTime       = sendTime + ReliableMessageMgr::GetBackoff(baseTimeout, sendCount).count();
+
+            if (ackTime <= retransTime)
+            {
+                if (sendCount == 0)
+                {
+                    estimator.AddSample(Milliseconds32(static_cast<uint32_t>(ackTime - firstSendTime)));
+                }
+                now = ackTime;
+                break;
+            }
+            if (sendCount == CHIP_CONFIG_RMP_DEFAULT_MAX_RETRANS)
+            {
+                result.failures++;
+                now = retransTime;
+                break;
+            }
+
+            sendCount++;
+            sendTime = retransTime;
+        }
+    }
+
+    result.completionTimeMs = now;
+    return result;
+}
+
+void CheckSimulation(nlTestSuite * inSuite, void * inContext)
+{
+    constexpr uint32_t kMessageCount = 1000;
+
+    // clang-format off
+    const LinkModel kLinks[] = {
+        { "LAN",                 1,   2,   0,  5, 300_ms32 },
+        { "Wi-Fi, slow peer",    5,  20,  50,  2, 300_ms32 },
+        { "Thread",             30,  40,   0,  2, 300_ms32 },
+        { "Thread, congested", 200, 300,   0,  5, 300_ms32 },
+    };
+    // clang-format on
+
+    printf("%-18s %-8s %10s %8s %8s %8s\n", "link", "timeout", "time (ms)", "retrans", "dups", "failed");
+    for (const LinkModel & link : kLinks)
+    {
+        SimulationResult fixed    = Simulate(link, false, kMessageCount);
+        SimulationResult adaptive = Simulate(link, true, kMessageCount);
+
+        printf("%-18s %-8s %10" PRIu64 " %8" PRIu32 " %8" PRIu32 " %8" PRIu32 "\n", link.name, "static", fixed.completionTimeMs,
+               fixed.retransmissions, fixed.duplicates, fixed.failures);
+        printf("%-18s %-8s %10" PRIu64 " %8" PRIu32 " %8" PRIu32 " %8" PRIu32 "\n", link.name, "adaptive",
+               adaptive.completionTimeMs, adaptive.retransmissions, adaptive.duplicates, adaptive.failures);
+
+        // Adapting to the link never wastes more retransmissions than the advertised intervals
+        NL_TEST_ASSERT(inSuite, adaptive.duplicates <= fixed.duplicates + kMessageCount / 100);
+        NL_TEST_ASSERT(inSuite, adaptive.failures <= fixed.failures);
+    }
+
+    // Losses are recovered much faster on a LAN
+    SimulationResult fixed    = Simulate(kLinks[0], false, kMessageCount);
+    SimulationResult adaptive = Simulate(kLinks[0], true, kMessageCount);
+    NL_TEST_ASSERT(inSuite, adaptive.completionTimeMs * 2 < fixed.completionTimeMs);
+
+    // A congested link is not flooded with duplicates, at the cost of waiting longer to recover actual losses
+    fixed    = Simulate(kLinks[3], false, kMessageCount);
+    adaptive = Simulate(kLinks[3], true, kMessageCount);
+    NL_TEST_ASSERT(inSuite, adaptive.duplicates * 5 < fixed.duplicates);
+    NL_TEST_ASSERT(inSuite, adaptive.completionTimeMs <= fixed.completionTimeMs * 3 / 2);
+}
+
+// clang-format off
+const nlTest sTests[] =
+{
+    NL_TEST_DEF("Test first round trip time sample", CheckFirstSample),
+    NL_TEST_DEF("Test round trip time convergence", CheckConvergence),
+    NL_TEST_DEF("Test retransmission timeout backoff", CheckBackoff),
+    NL_TEST_DEF("Test retransmission timeout bounds", CheckBounds),
+    NL_TEST_DEF("Test simulated delivery over lossy links", CheckSimulation),
+    NL_TEST_SENTINEL()
+};
+// clang-format on
+
+} // namespace
+
+int TestRoundTripTimeEstimator()
+{
+    nlTestSuite theSuite = { "RoundTripTimeEstimator", &sTests[0], nullptr, nullptr };
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestRoundTripTimeEstimator)
@@ -28,26 +28,19 @@ namespace chip {
 namespace DeviceLayer {
 namespace Internal {
 
-void DeviceSafeQueue::Push(const ChipDeviceEvent & event)
+CHIP_ERROR DeviceSafeQueue::Push(const ChipDeviceEvent & event, bool & wakeEventLoop)
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
-    mEventQueue.push(event);
+    return mEventQueue.Push(event, wakeEventLoop);
 }
 
-bool DeviceSafeQueue::Empty()
+bool DeviceSafeQueue::Empty() const
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
-    return mEventQueue.empty();
+    return mEventQueue.Empty();
 }
 
-const ChipDeviceEvent DeviceSafeQueue::PopFront()
+bool DeviceSafeQueue::PopFront(ChipDeviceEvent & event)
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
-
-    const ChipDeviceEvent event = mEventQueue.front();
-    mEventQueue.pop();
-
-    return event;
+    return mEventQueue.Pop(event);
 }
 
 } // namespace Internal
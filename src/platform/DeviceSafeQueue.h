@@ -24,10 +24,8 @@
 
 #pragma once
 
-#include <mutex>
-#include <queue>
-
 #include <lib/core/CHIPCore.h>
+#include <lib/support/MpscRingQueue.h>
 #include <platform/CHIPDeviceConfig.h>
 #include <platform/CHIPDeviceEvent.h>
 
@@ -39,10 +37,12 @@ namespace Internal {
  *  @class DeviceSafeQueue
  *
  *  @brief
- *      This class represents a thread-safe message queue implemented with C++ Standard Library, the message queue
+ *      This class represents a thread-safe message queue implemented with a lock-free ring, the message queue
  *      is used by the CHIP event loop to hold incoming messages. Each message is sequentially dequeued, decoded,
  *      and then an action is performed.
  *
+ *      Any thread can post messages without taking a lock. Only the CHIP event loop thread dequeues them.
+ *
  */
 class DeviceSafeQueue
 {
@@ -50,13 +50,23 @@ public:
     DeviceSafeQueue()  = default;
     ~DeviceSafeQueue() = default;
 
-    void Push(const ChipDeviceEvent & event);
-    bool Empty();
-    const ChipDeviceEvent PopFront();
+    /**
+     * Post an event. Sets [wakeEventLoop] when the event loop may be waiting and has to be signalled, which
+     * is only the case for the first event posted after the event loop emptied the queue.
+     *
+     * Returns CHIP_ERROR_NO_MEMORY if CHIP_DEVICE_CONFIG_POSIX_EVENT_QUEUE_SIZE events are already queued.
+     */
+    CHIP_ERROR Push(const ChipDeviceEvent & event, bool & wakeEventLoop);
+    bool Empty() const;
+
+    /**
+     * Dequeue the next event into [event]. Returns false if the queue is empty. Must only be called from the
+     * event loop thread.
+     */
+    bool PopFront(ChipDeviceEvent & event);
 
 private:
-    std::queue<ChipDeviceEvent> mEventQueue;
-    std::mutex mEventQueueLock;
+    MpscRingQueue<ChipDeviceEvent, CHIP_DEVICE_CONFIG_POSIX_EVENT_QUEUE_SIZE> mEventQueue;
 
     DeviceSafeQueue(const DeviceSafeQueue &) = delete;
     DeviceSafeQueue & operator=(const DeviceSafeQueue &) = delete;
@@ -63,7 +63,7 @@ CHIP_ERROR OTAImageProcessorImpl::Abort()
 
 CHIP_ERROR OTAImageProcessorImpl::ProcessBlock(ByteSpan & block)
 {
-    if (!mOfs.is_open() || !mOfs.good())
+    if (!mWriter.IsOpen())
     {
         return CHIP_ERROR_INTERNAL;
     }
@@ -125,13 +125,13 @@ void OTAImageProcessorImpl::HandlePrepareDownload(intptr_t context)
         return;
     }
 
-    unlink(imageProcessor->mImageFile);
-
-    imageProcessor->mHeaderParser.Init();
-    imageProcessor->mOfs.open(imageProcessor->mImageFile, std::ofstream::out | std::ofstream::ate | std::ofstream::app);
-    if (!imageProcessor->mOfs.good())
+    // Data left by an interrupted download of the same image is kept so that the download can be resumed
+    imageProcessor->mImageVerified = false;
+    imageProcessor->mParams        = OTAImageProgress();
+    CHIP_ERROR error               = imageProcessor->mWriter.Open(imageProcessor->mImageFile);
+    if (error != CHIP_NO_ERROR)
     {
-        imageProcessor->mDownloader->OnPreparedForDownload(CHIP_ERROR_OPEN_FAILED);
+        imageProcessor->mDownloader->OnPreparedForDownload(error);
         return;
     }
 
@@ -146,9 +146,18 @@ void OTAImageProcessorImpl::HandleFinalize(intptr_t context)
         return;
     }
 
-    imageProcessor->mOfs.close();
     imageProcessor->ReleaseBlock();
 
+    // The payload has been hashed as it was written, so the image is verified without reading it back
+    CHIP_ERROR error = imageProcessor->mWriter.Finalize();
+    if (error != CHIP_NO_ERROR)
+    {
+        ChipLogError(SoftwareUpdate, "OTA image verification failed: %" CHIP_ERROR_FORMAT, error.Format());
+        imageProcessor->mWriter.Discard();
+        return;
+    }
+
+    imageProcessor->mImageVerified = true;
     ChipLogProgress(SoftwareUpdate, "OTA image downloaded to %s", imageProcessor->mImageFile);
 }
 
@@ -160,6 +169,14 @@ void OTAImageProcessorImpl::HandleApply(intptr_t context)
     OTARequestorInterface * requestor = chip::GetRequestorInstance();
     VerifyOrReturn(requestor != nullptr);
 
+    if (!imageProcessor->mImageVerified)
+    {
+        ChipLogError(SoftwareUpdate, "No verified OTA image to apply");
+        requestor->CancelImageUpdate();
+        return;
+    }
+    imageProcessor->mImageVerified = false;
+
     // Move the downloaded image to the location where the new image is to be executed from
     unlink(kImageExecPath);
     rename(imageProcessor->mImageFile, kImageExecPath);
@@ -178,8 +195,8 @@ void OTAImageProcessorImpl::HandleAbort(intptr_t context)
         return;
     }
 
-    imageProcessor->mOfs.close();
-    unlink(imageProcessor->mImageFile);
+    // What has been synced to storage is kept so that a later download of the same image can resume from there
+    imageProcessor->mWriter.Close();
     imageProcessor->ReleaseBlock();
 }
 
@@ -197,43 +214,37 @@ void OTAImageProcessorImpl::HandleProcessBlock(intptr_t context)
         return;
     }
 
-    ByteSpan block   = imageProcessor->mBlock;
-    CHIP_ERROR error = imageProcessor->ProcessHeader(block);
+    uint32_t bytesToSkip = 0;
+    CHIP_ERROR error     = imageProcessor->mWriter.Write(imageProcessor->mBlock, bytesToSkip);
     if (error != CHIP_NO_ERROR)
     {
-        ChipLogError(SoftwareUpdate, "Image does not contain a valid header");
-        imageProcessor->mDownloader->EndDownload(CHIP_ERROR_INVALID_FILE_IDENTIFIER);
+        ChipLogError(SoftwareUpdate, "Cannot process OTA image block: %" CHIP_ERROR_FORMAT, error.Format());
+        imageProcessor->mDownloader->EndDownload(error == CHIP_ERROR_INVALID_FILE_IDENTIFIER ? error : CHIP_ERROR_WRITE_FAILED);
         return;
     }
 
-    if (!imageProcessor->mOfs.write(reinterpret_cast<const char *>(block.data()), static_cast<std::streamsize>(block.size())))
+    imageProcessor->mParams.totalFileBytes  = imageProcessor->mWriter.GetPayloadSize();
+    imageProcessor->mParams.downloadedBytes = imageProcessor->mWriter.GetPayloadBytesReceived();
+
+    if (bytesToSkip > 0)
     {
+        // Part of the image is already on storage from an interrupted download
+        error = imageProcessor->mDownloader->SkipData(bytesToSkip);
+        if (error == CHIP_NO_ERROR)
+        {
+            return;
+        }
+
+        // The downloader cannot skip, so the writer has to start over from what it has been given
+        ChipLogError(SoftwareUpdate, "Cannot resume OTA image download: %" CHIP_ERROR_FORMAT, error.Format());
+        imageProcessor->mWriter.Discard();
         imageProcessor->mDownloader->EndDownload(CHIP_ERROR_WRITE_FAILED);
         return;
     }
 
-    imageProcessor->mParams.downloadedBytes += block.size();
     imageProcessor->mDownloader->FetchNextData();
 }
 
-CHIP_ERROR OTAImageProcessorImpl::ProcessHeader(ByteSpan & block)
-{
-    if (mHeaderParser.IsInitialized())
-    {
-        OTAImageHeader header;
-        CHIP_ERROR error = mHeaderParser.AccumulateAndDecode(block, header);
-
-        // Needs more data to decode the header
-        ReturnErrorCodeIf(error == CHIP_ERROR_BUFFER_TOO_SMALL, CHIP_NO_ERROR);
-        ReturnErrorOnFailure(error);
-
-        mParams.totalFileBytes = header.mPayloadSize;
-        mHeaderParser.Clear();
-    }
-
-    return CHIP_NO_ERROR;
-}
-
 CHIP_ERROR OTAImageProcessorImpl::SetBlock(ByteSpan & block)
 {
     if (!IsSpanUsable(block))
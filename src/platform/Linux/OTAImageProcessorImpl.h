@@ -19,11 +19,10 @@
 #pragma once
 
 #include <app/clusters/ota-requestor/OTADownloader.h>
-#include <lib/core/OTAImageHeader.h>
 #include <platform/CHIPDeviceLayer.h>
 #include <platform/OTAImageProcessor.h>
 
-#include <fstream>
+#include "OTAImageStreamWriter.h"
 
 namespace chip {
 
@@ -53,8 +52,6 @@ private:
     static void HandleAbort(intptr_t context);
     static void HandleProcessBlock(intptr_t context);
 
-    CHIP_ERROR ProcessHeader(ByteSpan & block);
-
     /**
      * Called to allocate memory for mBlock if necessary and set it to block
      */
@@ -65,11 +62,12 @@ private:
      */
     CHIP_ERROR ReleaseBlock();
 
-    std::ofstream mOfs;
+    OTAImageStreamWriter mWriter;
     MutableByteSpan mBlock;
     OTADownloader * mDownloader;
-    OTAImageHeaderParser mHeaderParser;
     const char * mImageFile = nullptr;
+    // Set once the downloaded image has been verified against its digest
+    bool mImageVerified = false;
 };
 
 } // namespace chip
@@ -0,0 +1,344 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "OTAImageStreamWriter.h"
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedBuffer.h>
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace chip {
+
+namespace {
+
+/// Identifies a resume record, and changes whenever its layout does
+constexpr uint32_t kResumeRecordMagic = 0x4F544152; // "OTAR"
+
+/// Size of the chunks read back when hashing the payload recovered from an interrupted download
+constexpr size_t kRehashChunkSize = 16 * 1024;
+
+/// Length of the digest, for the digest types that can be verified with SHA-256
+uint8_t GetSha256DigestLength(OTAImageDigestType type)
+{
+    switch (type)
+    {
+    case OTAImageDigestType::kSha256:
+        return 32;
+    case OTAImageDigestType::kSha256_128:
+        return 16;
+    case OTAImageDigestType::kSha256_120:
+        return 15;
+    case OTAImageDigestType::kSha256_96:
+        return 12;
+    case OTAImageDigestType::kSha256_64:
+        return 8;
+    case OTAImageDigestType::kSha256_32:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+} // namespace
+
+constexpr uint32_t OTAImageStreamWriter::kDefaultSyncInterval;
+
+CHIP_ERROR OTAImageStreamWriter::Open(const char * path, uint32_t syncInterval)
+{
+    VerifyOrReturnError(path != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Close();
+
+    mPath         = path;
+    mRecordPath   = mPath + ".resume";
+    mSyncInterval = syncInterval > 0 ? syncInterval : kDefaultSyncInterval;
+
+    mFd = open(mPath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    VerifyOrReturnError(mFd >= 0, CHIP_ERROR_OPEN_FAILED);
+
+    mRecordFd = open(mRecordPath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (mRecordFd < 0)
+    {
+        Close();
+        return CHIP_ERROR_OPEN_FAILED;
+    }
+
+    mHeaderParser.Init();
+    mHeaderDecoded   = false;
+    mVerifyDigest    = false;
+    mRecord          = {};
+    mPayloadReceived = 0;
+    mPayloadWritten  = 0;
+    mResumedBytes    = 0;
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageStreamWriter::Write(ByteSpan block, uint32_t & bytesToSkip)
+{
+    bytesToSkip = 0;
+    VerifyOrReturnError(IsOpen(), CHIP_ERROR_INCORRECT_STATE);
+
+    if (!mHeaderDecoded)
+    {
+        CHIP_ERROR error = ProcessHeader(block);
+
+        // Needs more data to decode the header
+        ReturnErrorCodeIf(error == CHIP_ERROR_BUFFER_TOO_SMALL, CHIP_NO_ERROR);
+        if (error != CHIP_NO_ERROR)
+        {
+            ChipLogError(SoftwareUpdate, "Image does not contain a valid header: %" CHIP_ERROR_FORMAT, error.Format());
+            return CHIP_ERROR_INVALID_FILE_IDENTIFIER;
+        }
+    }
+
+    // Drop the part of the block that is already on storage
+    if (mPayloadReceived < mPayloadWritten)
+    {
+        uint64_t overlap = chip::min(mPayloadWritten - mPayloadReceived, static_cast<uint64_t>(block.size()));
+        block            = block.SubSpan(static_cast<size_t>(overlap));
+        mPayloadReceived += overlap;
+    }
+
+    if (block.size() > mRecord.payloadSize - mPayloadReceived)
+    {
+        ChipLogError(SoftwareUpdate, "Image is larger than the payload size in its header");
+        return CHIP_ERROR_INVALID_FILE_IDENTIFIER;
+    }
+
+    ReturnErrorOnFailure(WritePayload(block));
+    mPayloadReceived += block.size();
+
+    if (mPayloadReceived < mPayloadWritten)
+    {
+        bytesToSkip = static_cast<uint32_t>(chip::min(mPayloadWritten - mPayloadReceived, static_cast<uint64_t>(UINT32_MAX)));
+        mPayloadReceived += bytesToSkip;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageStreamWriter::Finalize()
+{
+    VerifyOrReturnError(IsOpen() && mHeaderDecoded, CHIP_ERROR_INCORRECT_STATE);
+
+    if (mPayloadWritten != mRecord.payloadSize)
+    {
+        ChipLogError(SoftwareUpdate, "Image payload is incomplete: %" PRIu64 " of %" PRIu64 " bytes", mPayloadWritten,
+                     mRecord.payloadSize);
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
+
+    ReturnErrorOnFailure(Sync());
+
+    if (mVerifyDigest)
+    {
+        uint8_t digestBuffer[Crypto::kSHA256_Hash_Length];
+        MutableByteSpan digest(digestBuffer);
+        ReturnErrorOnFailure(mHash.Finish(digest));
+
+        if (memcmp(digest.data(), mRecord.digest, mRecord.digestLength) != 0)
+        {
+            ChipLogError(SoftwareUpdate, "Image digest does not match its header");
+            return CHIP_ERROR_INTEGRITY_CHECK_FAILED;
+        }
+    }
+    else
+    {
+        ChipLogProgress(SoftwareUpdate, "Image digest type %u is not supported, skipping verification",
+                        static_cast<unsigned>(mRecord.digestType));
+    }
+
+    // The download is complete, there is nothing left to resume
+    close(mRecordFd);
+    mRecordFd = -1;
+    unlink(mRecordPath.c_str());
+    Close();
+
+    return CHIP_NO_ERROR;
+}
+
+void OTAImageStreamWriter::Close()
+{
+    if (mFd >= 0)
+    {
+        close(mFd);
+        mFd = -1;
+    }
+
+    if (mRecordFd >= 0)
+    {
+        close(mRecordFd);
+        mRecordFd = -1;
+    }
+
+    mHeaderParser.Clear();
+    mHash.Clear();
+}
+
+void OTAImageStreamWriter::Discard()
+{
+    Close();
+
+    if (!mPath.empty())
+    {
+        unlink(mPath.c_str());
+        unlink(mRecordPath.c_str());
+    }
+}
+
+CHIP_ERROR OTAImageStreamWriter::ProcessHeader(ByteSpan & block)
+{
+    OTAImageHeader header;
+    ReturnErrorOnFailure(mHeaderParser.AccumulateAndDecode(block, header));
+
+    mRecord.magic           = kResumeRecordMagic;
+    mRecord.softwareVersion = header.mSoftwareVersion;
+    mRecord.payloadSize     = header.mPayloadSize;
+    mRecord.syncedBytes     = 0;
+    mRecord.digestType      = to_underlying(header.mImageDigestType);
+    mRecord.digestLength    = GetSha256DigestLength(header.mImageDigestType);
+
+    // The header only references the parser buffer, so the digest must be copied before the parser is cleared
+    mVerifyDigest = mRecord.digestLength > 0 && header.mImageDigest.size() == mRecord.digestLength;
+    if (mVerifyDigest)
+    {
+        memcpy(mRecord.digest, header.mImageDigest.data(), mRecord.digestLength);
+    }
+    else
+    {
+        mRecord.digestLength = 0;
+    }
+
+    mHeaderParser.Clear();
+    mHeaderDecoded = true;
+
+    return Resume();
+}
+
+CHIP_ERROR OTAImageStreamWriter::Resume()
+{
+    ResumeRecord previous;
+    struct stat fileStat;
+
+    ReturnErrorOnFailure(mHash.Begin());
+
+    // Only the payload of the very same image, as identified by its header, can be resumed
+    bool canResume = ReadRecord(previous) && previous.softwareVersion == mRecord.softwareVersion &&
+        previous.payloadSize == mRecord.payloadSize && previous.digestType == mRecord.digestType &&
+        previous.digestLength == mRecord.digestLength && memcmp(previous.digest, mRecord.digest, mRecord.digestLength) == 0 &&
+        previous.syncedBytes > 0 && previous.syncedBytes <= mRecord.payloadSize && fstat(mFd, &fileStat) == 0 &&
+        static_cast<uint64_t>(fileStat.st_size) >= previous.syncedBytes;
+
+    if (canResume && mVerifyDigest)
+    {
+        Platform::ScopedMemoryBuffer<uint8_t> buffer;
+        VerifyOrReturnError(buffer.Alloc(kRehashChunkSize), CHIP_ERROR_NO_MEMORY);
+
+        uint64_t offset = 0;
+        while (canResume && offset < previous.syncedBytes)
+        {
+            uint64_t remaining = previous.syncedBytes - offset;
+            size_t chunkSize   = static_cast<size_t>(chip::min(remaining, static_cast<uint64_t>(kRehashChunkSize)));
+            ssize_t numRead    = pread(mFd, buffer.Get(), chunkSize, static_cast<off_t>(offset));
+            canResume          = (numRead == static_cast<ssize_t>(chunkSize)) &&
+                (mHash.AddData(ByteSpan(buffer.Get(), chunkSize)) == CHIP_NO_ERROR);
+            offset += chunkSize;
+        }
+
+        if (!canResume)
+        {
+            ReturnErrorOnFailure(mHash.Begin());
+        }
+    }
+
+    if (canResume)
+    {
+        mPayloadWritten     = previous.syncedBytes;
+        mResumedBytes       = previous.syncedBytes;
+        mRecord.syncedBytes = previous.syncedBytes;
+        ChipLogProgress(SoftwareUpdate, "Resuming download of image version %" PRIu32 " at %" PRIu64 " of %" PRIu64 " bytes",
+                        mRecord.softwareVersion, mPayloadWritten, mRecord.payloadSize);
+    }
+
+    // Anything past the last synced offset, or a previous image altogether, is discarded
+    VerifyOrReturnError(ftruncate(mFd, static_cast<off_t>(mPayloadWritten)) == 0, CHIP_ERROR_WRITE_FAILED);
+
+    return WriteRecord();
+}
+
+CHIP_ERROR OTAImageStreamWriter::WritePayload(ByteSpan payload)
+{
+    if (mVerifyDigest)
+    {
+        ReturnErrorOnFailure(mHash.AddData(payload));
+    }
+
+    while (!payload.empty())
+    {
+        ssize_t numWritten = pwrite(mFd, payload.data(), payload.size(), static_cast<off_t>(mPayloadWritten));
+        if (numWritten < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        VerifyOrReturnError(numWritten > 0, CHIP_ERROR_WRITE_FAILED);
+
+        payload = payload.SubSpan(static_cast<size_t>(numWritten));
+        mPayloadWritten += static_cast<uint64_t>(numWritten);
+    }
+
+    if (mPayloadWritten - mRecord.syncedBytes >= mSyncInterval)
+    {
+        ReturnErrorOnFailure(Sync());
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR OTAImageStreamWriter::Sync()
+{
+    VerifyOrReturnError(fdatasync(mFd) == 0, CHIP_ERROR_WRITE_FAILED);
+
+    // The record must never claim more than what is actually on storage
+    mRecord.syncedBytes = mPayloadWritten;
+    return WriteRecord();
+}
+
+CHIP_ERROR OTAImageStreamWriter::WriteRecord()
+{
+    ssize_t numWritten = pwrite(mRecordFd, &mRecord, sizeof(mRecord), 0);
+    VerifyOrReturnError(numWritten == static_cast<ssize_t>(sizeof(mRecord)), CHIP_ERROR_WRITE_FAILED);
+    VerifyOrReturnError(fdatasync(mRecordFd) == 0, CHIP_ERROR_WRITE_FAILED);
+
+    return CHIP_NO_ERROR;
+}
+
+bool OTAImageStreamWriter::ReadRecord(ResumeRecord & record)
+{
+    ssize_t numRead = pread(mRecordFd, &record, sizeof(record), 0);
+    return numRead == static_cast<ssize_t>(sizeof(record)) && record.magic == kResumeRecordMagic &&
+        record.digestLength <= sizeof(record.digest);
+}
+
+} // namespace chip
@@ -0,0 +1,133 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/OTAImageHeader.h>
+#include <lib/support/Span.h>
+
+#include <stdint.h>
+#include <string>
+
+namespace chip {
+
+/**
+ * Writes a Matter OTA image to a file as it is being downloaded.
+ *
+ * The image header is decoded incrementally from the first chunks, the payload is written with positional writes and hashed on
+ * the fly so that the image digest can be verified as soon as the last block has been received, without reading the file back.
+ *
+ * The payload is synced to storage every `syncInterval` bytes. Alongside the image, a small resume record tracks the header of
+ * the image being downloaded and how much of the payload is known to be on storage. When a download of the same image is started
+ * again (e.g. after a reboot), the writer picks up from the last synced offset and asks the caller to skip the bytes that are
+ * already there.
+ */
+class OTAImageStreamWriter
+{
+public:
+    static constexpr uint32_t kDefaultSyncInterval = 256 * 1024;
+
+    ~OTAImageStreamWriter() { Close(); }
+
+    /**
+     * Open the file the image payload is written to.
+     *
+     * Data of a previous, interrupted download is kept until the image header has been decoded and it is known whether that
+     * download can be resumed.
+     */
+    CHIP_ERROR Open(const char * path, uint32_t syncInterval = kDefaultSyncInterval);
+
+    /**
+     * Consume the next chunk of the image.
+     *
+     * @param[in]  block        Next chunk of the image, starting right after the previous chunk (or the skipped bytes)
+     * @param[out] bytesToSkip  Number of image bytes the caller should skip before providing the next chunk, because they are
+     *                          already on storage. Zero if the next chunk should follow this one.
+     *
+     * @retval CHIP_ERROR_INVALID_FILE_IDENTIFIER  Not a Matter OTA image, or an invalid header
+     * @retval CHIP_ERROR_WRITE_FAILED             The payload could not be written
+     */
+    CHIP_ERROR Write(ByteSpan block, uint32_t & bytesToSkip);
+
+    /**
+     * Sync the remaining payload to storage and verify it against the image digest.
+     *
+     * @retval CHIP_ERROR_INCORRECT_STATE          The payload is incomplete
+     * @retval CHIP_ERROR_INTEGRITY_CHECK_FAILED   The payload does not match the digest in the header
+     */
+    CHIP_ERROR Finalize();
+
+    /**
+     * Close the image file. The resume record is kept so that the download can be resumed later.
+     */
+    void Close();
+
+    /**
+     * Close and remove the image file and its resume record.
+     */
+    void Discard();
+
+    bool IsOpen() const { return mFd >= 0; }
+    bool IsHeaderDecoded() const { return mHeaderDecoded; }
+    uint32_t GetSoftwareVersion() const { return mRecord.softwareVersion; }
+    uint64_t GetPayloadSize() const { return mRecord.payloadSize; }
+    uint64_t GetPayloadBytesReceived() const { return mPayloadReceived; }
+    uint64_t GetResumedBytes() const { return mResumedBytes; }
+
+private:
+    struct ResumeRecord
+    {
+        uint32_t magic;
+        uint32_t softwareVersion;
+        uint64_t payloadSize;
+        uint64_t syncedBytes;
+        uint8_t digestType;
+        uint8_t digestLength;
+        uint8_t digest[Crypto::kSHA256_Hash_Length];
+    };
+
+    CHIP_ERROR ProcessHeader(ByteSpan & block);
+    CHIP_ERROR Resume();
+    CHIP_ERROR WritePayload(ByteSpan payload);
+    CHIP_ERROR Sync();
+    CHIP_ERROR WriteRecord();
+    bool ReadRecord(ResumeRecord & record);
+
+    int mFd       = -1;
+    int mRecordFd = -1;
+    std::string mPath;
+    std::string mRecordPath;
+    uint32_t mSyncInterval = kDefaultSyncInterval;
+
+    OTAImageHeaderParser mHeaderParser;
+    bool mHeaderDecoded = false;
+    bool mVerifyDigest  = false;
+    Crypto::Hash_SHA256_stream mHash;
+    ResumeRecord mRecord = {};
+
+    // Payload bytes received so far, including those skipped because they were already on storage
+    uint64_t mPayloadReceived = 0;
+    // Payload bytes written to the image file
+    uint64_t mPayloadWritten = 0;
+    // Payload bytes recovered from an interrupted download
+    uint64_t mResumedBytes = 0;
+};
+
+} // namespace chip
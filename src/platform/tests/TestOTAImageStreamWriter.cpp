@@ -0,0 +1,320 @@
+/*
+ *
+ *    Copyright (c) 2022 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test suite for the streaming OTA image
+ *      writer used by the Linux OTA image processor, along with a benchmark
+ *      of the time it takes to download and verify a 16MB image.
+ *
+ */
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPTLV.h>
+#include <lib/core/OTAImageHeader.h>
+#include <lib/support/BufferWriter.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/UnitTestRegistration.h>
+#include <nlunit-test.h>
+#include <platform/Linux/OTAImageStreamWriter.h>
+#include <system/SystemClock.h>
+
+#include <stdio.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace chip;
+using namespace chip::TLV;
+
+namespace {
+
+constexpr size_t kBlockSize        = 1024;
+constexpr uint32_t kSyncInterval   = 4 * 1024;
+constexpr size_t kBenchmarkPayload = 16 * 1024 * 1024;
+
+std::string gImagePath;
+
+std::vector<uint8_t> MakePayload(size_t size, uint32_t seed)
+{
+    std::vector<uint8_t> payload(size);
+    for (auto & byte : payload)
+    {
+        seed = seed * 1103515245 + 12345;
+        byte = static_cast<uint8_t>(seed >> 16);
+    }
+    return payload;
+}
+
+std::vector<uint8_t> MakeImage(uint32_t softwareVersion, const std::vector<uint8_t> & payload)
+{
+    uint8_t digest[Crypto::kSHA256_Hash_Length];
+    VerifyOrDie(Crypto::Hash_SHA256(payload.data(), payload.size(), digest) == CHIP_NO_ERROR);
+
+    uint8_t tlv[128];
+    TLVWriter tlvWriter;
+    TLVType outerType;
+    tlvWriter.Init(tlv);
+    VerifyOrDie(tlvWriter.StartContainer(AnonymousTag(), kTLVType_Structure, outerType) == CHIP_NO_ERROR);
+    VerifyOrDie(tlvWriter.Put(ContextTag(0), static_cast<uint16_t>(0xFFF1)) == CHIP_NO_ERROR);
+    VerifyOrDie(tlvWriter.Put(ContextTag(1), static_cast<uint16_t>(0x8001)) == CHIP_NO_ERROR);
+    VerifyOrDie(tlvWriter.Put(ContextTag(2), softwareVersion) == CHIP_NO_ERROR);
+    VerifyOrDie(tlvWriter.PutString(ContextTag(3), "1.0") == CHIP_NO_ERROR);
+    VerifyOrDie(tlvWriter.Put(ContextTag(4), static_cast<uint64_t>(payload.size())) == CHIP_NO_ERROR);
+    VerifyOrDie(tlvWriter.Put(ContextTag(8), to_underlying(OTAImageDigestType::kSha256)) == CHIP_NO_ERROR);
+    VerifyOrDie(tlvWriter.Put(ContextTag(9), ByteSpan(digest)) == CHIP_NO_ERROR);
+    VerifyOrDie(tlvWriter.EndContainer(outerType) == CHIP_NO_ERROR);
+    VerifyOrDie(tlvWriter.Finalize() == CHIP_NO_ERROR);
+
+    uint32_t tlvSize = tlvWriter.GetLengthWritten();
+    std::vector<uint8_t> image(16 + tlvSize + payload.size());
+
+    Encoding::LittleEndian::BufferWriter writer(image.data(), 16);
+    writer.Put32(kOTAImageFileIdentifier).Put64(image.size()).Put32(tlvSize);
+    VerifyOrDie(writer.Fit());
+
+    memcpy(&image[16], tlv, tlvSize);
+    memcpy(&image[16 + tlvSize], payload.data(), payload.size());
+    return image;
+}
+
+/**
+ * Feed the image to the writer block by block, the way the image processor is fed by the downloader, until `limit` bytes of
+ * the image have been consumed. Skip requests are honoured the way a BlockQueryWithSkip would.
+ */
+CHIP_ERROR StreamImage(OTAImageStreamWriter & writer, const std::vector<uint8_t> & image, size_t limit, uint64_t & skipped)
+{
+    size_t offset = 0;
+    skipped       = 0;
+
+    while (offset < limit)
+    {
+        size_t blockSize     = chip::min(kBlockSize, image.size() - offset);
+        uint32_t bytesToSkip = 0;
+        ReturnErrorOnFailure(writer.Write(ByteSpan(&image[offset], blockSize), bytesToSkip));
+        offset += blockSize + bytesToSkip;
+        skipped += bytesToSkip;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+bool FileMatches(const std::string & path, const std::vector<uint8_t> & payload)
+{
+    FILE * file = fopen(path.c_str(), "rb");
+    VerifyOrReturnValue(file != nullptr, false);
+
+    std::vector<uint8_t> content(payload.size() + 1);
+    size_t size = fread(content.data(), 1, content.size(), file);
+    fclose(file);
+
+    return size == payload.size() && memcmp(content.data(), payload.data(), size) == 0;
+}
+
+bool RecordExists()
+{
+    return access((gImagePath + ".resume").c_str(), F_OK) == 0;
+}
+
+void TestStreamAndVerify(nlTestSuite * inSuite, void * inContext)
+{
+    std::vector<uint8_t> payload = MakePayload(100 * 1000, 1);
+    std::vector<uint8_t> image   = MakeImage(2, payload);
+    OTAImageStreamWriter writer;
+    uint64_t skipped;
+
+    NL_TEST_ASSERT(inSuite, writer.Open(gImagePath.c_str(), kSyncInterval) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, StreamImage(writer, image, image.size(), skipped) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, skipped == 0);
+    NL_TEST_ASSERT(inSuite, writer.IsHeaderDecoded());
+    NL_TEST_ASSERT(inSuite, writer.GetSoftwareVersion() == 2);
+    NL_TEST_ASSERT(inSuite, writer.GetPayloadSize() == payload.size());
+    NL_TEST_ASSERT(inSuite, writer.GetPayloadBytesReceived() == payload.size());
+    NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, FileMatches(gImagePath, payload));
+    NL_TEST_ASSERT(inSuite, !RecordExists());
+
+    writer.Discard();
+}
+
+void TestCorruptedPayload(nlTestSuite * inSuite, void * inContext)
+{
+    std::vector<uint8_t> payload = MakePayload(10 * 1000, 2);
+    std::vector<uint8_t> image   = MakeImage(2, payload);
+    OTAImageStreamWriter writer;
+    uint64_t skipped;
+
+    image[image.size() - 100] ^= 0x01;
+
+    NL_TEST_ASSERT(inSuite, writer.Open(gImagePath.c_str(), kSyncInterval) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, StreamImage(writer, image, image.size(), skipped) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+
+    writer.Discard();
+}
+
+void TestInvalidImage(nlTestSuite * inSuite, void * inContext)
+{
+    std::vector<uint8_t> payload = MakePayload(10 * 1000, 3);
+    std::vector<uint8_t> image   = MakeImage(2, payload);
+    OTAImageStreamWriter writer;
+    uint64_t skipped;
+
+    image[0] ^= 0xFF;
+
+    NL_TEST_ASSERT(inSuite, writer.Open(gImagePath.c_str(), kSyncInterval) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, StreamImage(writer, image, image.size(), skipped) == CHIP_ERROR_INVALID_FILE_IDENTIFIER);
+
+    writer.Discard();
+}
+
+void TestIncompletePayload(nlTestSuite * inSuite, void * inContext)
+{
+    std::vector<uint8_t> payload = MakePayload(10 * 1000, 4);
+    std::vector<uint8_t> image   = MakeImage(2, payload);
+    OTAImageStreamWriter writer;
+    uint64_t skipped;
+
+    NL_TEST_ASSERT(inSuite, writer.Open(gImagePath.c_str(), kSyncInterval) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, StreamImage(writer, image, image.size() - kBlockSize, skipped) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_ERROR_INCORRECT_STATE);
+
+    writer.Discard();
+}
+
+void TestResume(nlTestSuite * inSuite, void * inContext)
+{
+    std::vector<uint8_t> payload = MakePayload(100 * 1000, 5);
+    std::vector<uint8_t> image   = MakeImage(2, payload);
+    uint64_t skipped;
+
+    // Interrupted download, e.g. by a reboot
+    {
+        OTAImageStreamWriter writer;
+        NL_TEST_ASSERT(inSuite, writer.Open(gImagePath.c_str(), kSyncInterval) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, StreamImage(writer, image, image.size() / 2, skipped) == CHIP_NO_ERROR);
+        writer.Close();
+        NL_TEST_ASSERT(inSuite, RecordExists());
+    }
+
+    // The download of the same image picks up from the last synced offset
+    OTAImageStreamWriter writer;
+    NL_TEST_ASSERT(inSuite, writer.Open(gImagePath.c_str(), kSyncInterval) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, StreamImage(writer, image, image.size(), skipped) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.GetResumedBytes() > 0);
+    NL_TEST_ASSERT(inSuite, writer.GetResumedBytes() < payload.size());
+    NL_TEST_ASSERT(inSuite, skipped > 0);
+    NL_TEST_ASSERT(inSuite, skipped <= writer.GetResumedBytes());
+    NL_TEST_ASSERT(inSuite, writer.GetPayloadBytesReceived() == payload.size());
+    NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, FileMatches(gImagePath, payload));
+
+    writer.Discard();
+}
+
+void TestNoResumeForOtherImage(nlTestSuite * inSuite, void * inContext)
+{
+    std::vector<uint8_t> oldPayload = MakePayload(100 * 1000, 6);
+    std::vector<uint8_t> oldImage   = MakeImage(2, oldPayload);
+    std::vector<uint8_t> newPayload = MakePayload(100 * 1000, 7);
+    std::vector<uint8_t> newImage   = MakeImage(3, newPayload);
+    uint64_t skipped;
+
+    {
+        OTAImageStreamWriter writer;
+        NL_TEST_ASSERT(inSuite, writer.Open(gImagePath.c_str(), kSyncInterval) == CHIP_NO_ERROR);
+        NL_TEST_ASSERT(inSuite, StreamImage(writer, oldImage, oldImage.size() / 2, skipped) == CHIP_NO_ERROR);
+        writer.Close();
+    }
+
+    OTAImageStreamWriter writer;
+    NL_TEST_ASSERT(inSuite, writer.Open(gImagePath.c_str(), kSyncInterval) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, StreamImage(writer, newImage, newImage.size(), skipped) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.GetResumedBytes() == 0);
+    NL_TEST_ASSERT(inSuite, skipped == 0);
+    NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, FileMatches(gImagePath, newPayload));
+
+    writer.Discard();
+}
+
+void BenchmarkApplyTime(nlTestSuite * inSuite, void * inContext)
+{
+    std::vector<uint8_t> payload = MakePayload(kBenchmarkPayload, 8);
+    std::vector<uint8_t> image   = MakeImage(2, payload);
+    OTAImageStreamWriter writer;
+    uint64_t skipped;
+
+    System::Clock::Milliseconds64 start = System::SystemClock().GetMonotonicMilliseconds64();
+
+    NL_TEST_ASSERT(inSuite, writer.Open(gImagePath.c_str()) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, StreamImage(writer, image, image.size(), skipped) == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, writer.Finalize() == CHIP_NO_ERROR);
+
+    System::Clock::Milliseconds64 elapsed = System::SystemClock().GetMonotonicMilliseconds64() - start;
+    printf("Streamed and verified a %u byte image in %u ms\n", static_cast<unsigned>(image.size()),
+           static_cast<unsigned>(elapsed.count()));
+
+    writer.Discard();
+}
+
+const nlTest sTests[] = {
+    NL_TEST_DEF("Test streaming and verifying an image", TestStreamAndVerify),
+    NL_TEST_DEF("Test corrupted payload", TestCorruptedPayload),
+    NL_TEST_DEF("Test invalid image", TestInvalidImage),
+    NL_TEST_DEF("Test incomplete payload", TestIncompletePayload),
+    NL_TEST_DEF("Test resuming an interrupted download", TestResume),
+    NL_TEST_DEF("Test not resuming a different image", TestNoResumeForOtherImage),
+    NL_TEST_DEF("Benchmark 16MB image apply time", BenchmarkApplyTime),
+    NL_TEST_SENTINEL()
+};
+
+int TestOTAImageStreamWriter_Setup(void * inContext)
+{
+    VerifyOrReturnValue(chip::Platform::MemoryInit() == CHIP_NO_ERROR, FAILURE);
+
+    char path[] = "/tmp/TestOTAImageStreamWriterXXXXXX";
+    int fd      = mkstemp(path);
+    VerifyOrReturnValue(fd >= 0, FAILURE);
+    close(fd);
+    gImagePath = path;
+
+    return SUCCESS;
+}
+
+int TestOTAImageStreamWriter_Teardown(void * inContext)
+{
+    unlink(gImagePath.c_str());
+    unlink((gImagePath + ".resume").c_str());
+    chip::Platform::MemoryShutdown();
+    return SUCCESS;
+}
+
+} // namespace
+
+int TestOTAImageStreamWriter()
+{
+    nlTestSuite theSuite = { "OTAImageStreamWriter tests", &sTests[0], TestOTAImageStreamWriter_Setup,
+                             TestOTAImageStreamWriter_Teardown };
+
+    nlTestRunner(&theSuite, nullptr);
+    return nlTestRunnerStats(&theSuite);
+}
+
+CHIP_REGISTER_TEST_SUITE(TestOTAImageStreamWriter)
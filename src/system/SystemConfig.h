@@ -385,6 +385,23 @@
 #define CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX 1583
 #endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_MAX_LARGE_BUFFER_SIZE_BYTES
+ *
+ *  @brief
+ *      The maximum size of a large \c PacketBuffer, allocated with \c PacketBufferHandle::NewLarge for messages sent over
+ *      transports that carry more than a network packet (e.g. TCP). This is not the raw memory size consumed by a
+ *      \c PacketBuffer object.
+ *
+ *  @note
+ *      Large buffers are only available when packet buffers are allocated from the heap
+ *      (#CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE is 0); otherwise they are limited to
+ *      #CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX. The 16-bit buffer lengths bound the value.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_MAX_LARGE_BUFFER_SIZE_BYTES
+#define CHIP_SYSTEM_CONFIG_MAX_LARGE_BUFFER_SIZE_BYTES 64000
+#endif /* CHIP_SYSTEM_CONFIG_MAX_LARGE_BUFFER_SIZE_BYTES */
+
 /**
  *  @def _CHIP_SYSTEM_CONFIG_LWIP_EVENT
  *
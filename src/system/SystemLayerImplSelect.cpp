@@ -245,6 +245,11 @@ CHIP_ERROR LayerImplSelect::ScheduleWork(TimerCompleteCallback onComplete, void
 
 CHIP_ERROR LayerImplSelect::StartWatchingSocket(int fd, SocketWatchToken * tokenOut)
 {
+#if !CHIP_SYSTEM_CONFIG_USE_DISPATCH
+    // select() cannot watch descriptors beyond FD_SETSIZE, and FD_SET() on them overflows the fd_set.
+    VerifyOrReturnError(fd < FD_SETSIZE, CHIP_ERROR_ENDPOINT_POOL_FULL);
+#endif // !CHIP_SYSTEM_CONFIG_USE_DISPATCH
+
     // Find a free slot.
     SocketWatch * watch = nullptr;
     for (auto & w : mSocketWatchPool)
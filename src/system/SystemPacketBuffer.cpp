@@ -440,6 +440,16 @@ void PacketBuffer::AddRef()
 }
 
 PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aReservedSize)
+{
+    return Allocate(aAvailableSize, aReservedSize, PacketBuffer::kMaxSizeWithoutReserve);
+}
+
+PacketBufferHandle PacketBufferHandle::NewLarge(size_t aAvailableSize, uint16_t aReservedSize)
+{
+    return Allocate(aAvailableSize, aReservedSize, PacketBuffer::kLargeBufMaxSizeWithoutReserve);
+}
+
+PacketBufferHandle PacketBufferHandle::Allocate(size_t aAvailableSize, uint16_t aReservedSize, size_t aMaxAllocSize)
 {
     // Adding three 16-bit-int sized numbers together will never overflow
     // assuming int is at least 32 bits.
@@ -448,6 +458,7 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
     static_assert(PacketBuffer::kStructureSize < UINT16_MAX, "Check for overflow more carefully");
     static_assert(SIZE_MAX >= INT_MAX, "Our additions might not fit in size_t");
     static_assert(PacketBuffer::kMaxSizeWithoutReserve <= UINT16_MAX, "PacketBuffer may have size not fitting uint16_t");
+    static_assert(PacketBuffer::kLargeBufMaxSizeWithoutReserve <= UINT16_MAX, "PacketBuffer may have size not fitting uint16_t");
 
     // When `aAvailableSize` fits in uint16_t (as tested below) and size_t is at least 32 bits (as asserted above),
     // these additions will not overflow.
@@ -457,7 +468,7 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
 
     CHIP_SYSTEM_FAULT_INJECT(FaultInjection::kFault_PacketBufferNew, return PacketBufferHandle());
 
-    if (aAvailableSize > UINT16_MAX || lAllocSize > PacketBuffer::kMaxSizeWithoutReserve || lBlockSize > UINT16_MAX)
+    if (aAvailableSize > UINT16_MAX || lAllocSize > aMaxAllocSize || lBlockSize > UINT16_MAX)
     {
         ChipLogError(chipSystemLayer, "PacketBuffer: allocation too large.");
         return PacketBufferHandle();
@@ -649,21 +660,21 @@ PacketBufferHandle PacketBufferHandle::CloneData() const
         uint16_t originalDataSize     = original->MaxDataLength();
         uint16_t originalReservedSize = original->ReservedSize();
 
-        if (originalDataSize + originalReservedSize > PacketBuffer::kMaxSizeWithoutReserve)
+        if (originalDataSize + originalReservedSize > PacketBuffer::kLargeBufMaxSizeWithoutReserve)
         {
             // The original memory allocation may have provided a larger block than requested (e.g. when using a shared pool),
-            // and in particular may have provided a larger block than we are able to request from PackBufferHandle::New().
+            // and in particular may have provided a larger block than we are able to request from PackBufferHandle::NewLarge().
             // It is a genuine error if that extra space has been used.
-            if (originalReservedSize + original->DataLength() > PacketBuffer::kMaxSizeWithoutReserve)
+            if (originalReservedSize + original->DataLength() > PacketBuffer::kLargeBufMaxSizeWithoutReserve)
             {
                 return PacketBufferHandle();
             }
             // Otherwise, reduce the requested data size. This subtraction can not underflow because the above test
-            // guarantees originalReservedSize <= PacketBuffer::kMaxSizeWithoutReserve.
-            originalDataSize = static_cast<uint16_t>(PacketBuffer::kMaxSizeWithoutReserve - originalReservedSize);
+            // guarantees originalReservedSize <= PacketBuffer::kLargeBufMaxSizeWithoutReserve.
+            originalDataSize = static_cast<uint16_t>(PacketBuffer::kLargeBufMaxSizeWithoutReserve - originalReservedSize);
         }
 
-        PacketBufferHandle clone = PacketBufferHandle::New(originalDataSize, originalReservedSize);
+        PacketBufferHandle clone = PacketBufferHandle::NewLarge(originalDataSize, originalReservedSize);
         if (clone.IsNull())
         {
             return PacketBufferHandle();
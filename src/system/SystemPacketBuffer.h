@@ -140,6 +140,16 @@ public:
      */
     static constexpr uint16_t kMaxSize = kMaxSizeWithoutReserve - kDefaultHeaderReserve;
 
+    /**
+     * The maximum size buffer an application can allocate with PacketBufferHandle::NewLarge and no protocol header reserve.
+     */
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
+    static constexpr uint16_t kLargeBufMaxSizeWithoutReserve = CHIP_SYSTEM_CONFIG_MAX_LARGE_BUFFER_SIZE_BYTES;
+    static_assert(kLargeBufMaxSizeWithoutReserve >= kMaxSizeWithoutReserve, "Large buffers cannot be smaller than other buffers");
+#else
+    static constexpr uint16_t kLargeBufMaxSizeWithoutReserve = kMaxSizeWithoutReserve;
+#endif
+
     /**
      * Return the size of the allocation including the reserved and payload data spaces but not including space
      * allocated for the PacketBuffer structure.
@@ -612,6 +622,18 @@ public:
      */
     static PacketBufferHandle New(size_t aAvailableSize, uint16_t aReservedSize = PacketBuffer::kDefaultHeaderReserve);
 
+    /**
+     * Allocates a packet buffer that may be larger than \c PacketBuffer::kMaxSizeWithoutReserve, for a message sent over a
+     * transport that is not limited to a network packet. As New(), but fails only when the sum of \a aAvailableSize and
+     * \a aReservedSize is greater than \c PacketBuffer::kLargeBufMaxSizeWithoutReserve.
+     *
+     *  @param[in]  aAvailableSize  Minimum number of octets to for application data (at `Start()`).
+     *  @param[in]  aReservedSize   Number of octets to reserve for protocol headers (before `Start()`).
+     *
+     *  @return     On success, a PacketBufferHandle to the allocated buffer. On fail, \c nullptr.
+     */
+    static PacketBufferHandle NewLarge(size_t aAvailableSize, uint16_t aReservedSize = PacketBuffer::kDefaultHeaderReserve);
+
     /**
      * Allocates a packet buffer with initial contents.
      *
@@ -677,6 +699,8 @@ private:
         return PacketBufferHandle(buffer);
     }
 
+    static PacketBufferHandle Allocate(size_t aAvailableSize, uint16_t aReservedSize, size_t aMaxAllocSize);
+
     PacketBuffer * Get() const { return mBuffer; }
 
     bool operator==(const PacketBufferHandle & aOther) { return mBuffer == aOther.mBuffer; }
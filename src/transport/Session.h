@@ -25,6 +25,7 @@
 #include <lib/support/IntrusiveList.h>
 #include <lib/support/ReferenceCountedHandle.h>
 #include <messaging/ReliableMessageProtocolConfig.h>
+#include <messaging/RoundTripTimeEstimator.h>
 #include <platform/LockTracker.h>
 #include <transport/SessionDelegate.h>
 #include <transport/raw/PeerAddress.h>
@@ -119,6 +120,12 @@ protected:
     void GrabUnchecked(const SessionHandle & session);
 
     Optional<ReferenceCountedHandle<Transport::Session>> mSession;
+
+private:
+    friend class Transport::Session;
+
+    // Session whose holder list this holder is in, maintained by the session itself.
+    Transport::Session * mHolderListOwner = nullptr;
 };
 
 /// @brief Extends SessionHolder to allow propagate SessionDelegate::* events to a given destination
@@ -180,13 +187,21 @@ public:
         assertChipStackLockedByCurrentThread();
         VerifyOrDie(!holder.IsInList());
         mHolders.PushBack(&holder);
+        holder.mHolderListOwner = this;
     }
 
     void RemoveHolder(SessionHolder & holder)
     {
         assertChipStackLockedByCurrentThread();
+        // Removing a holder of another session would corrupt both lists; better to safe-crash. The holder records which
+        // session holds it, since searching the list is linear in the number of holders, which can be large with many
+        // exchanges on the session.
+        VerifyOrDie(holder.IsInList() && holder.mHolderListOwner == this);
+#if CHIP_CONFIG_MEMORY_DEBUG_CHECKS
         VerifyOrDie(mHolders.Contains(&holder));
+#endif // CHIP_CONFIG_MEMORY_DEBUG_CHECKS
         mHolders.Remove(&holder);
+        holder.mHolderListOwner = nullptr;
     }
 
     virtual void Retain()  = 0;
@@ -202,12 +217,19 @@ public:
     virtual System::Clock::Timestamp GetMRPBaseTimeout()                     = 0;
     virtual System::Clock::Milliseconds32 GetAckTimeout() const              = 0;
 
+    // Whether the transport of this session carries messages larger than a network packet, so that up to
+    // kMaxLargeAppMessageLen bytes can be sent in one message instead of kMaxAppMessageLen.
+    virtual bool AllowsLargePayload() const { return false; }
+
     // Returns a suggested timeout value based on the round-trip time it takes for the peer at the other end of the session to
     // receive a message, process it and send it back. This is computed based on the session type, the type of transport, sleepy
     // characteristics of the target and a caller-provided value for the time it takes to process a message at the upper layer on
     // the target For group sessions, this function will always return 0.
     System::Clock::Timeout ComputeRoundTripTimeout(System::Clock::Timeout upperlayerProcessingTimeout);
 
+    // Round trip times of the reliable messages sent on this session, sampled by the ReliableMessageMgr.
+    Messaging::RoundTripTimeEstimator & GetRoundTripTimeEstimator() { return mRoundTripTimeEstimator; }
+
     FabricIndex GetFabricIndex() const { return mFabricIndex; }
 
     SecureSession * AsSecureSession();
@@ -252,6 +274,7 @@ protected:
 
 private:
     FabricIndex mFabricIndex = kUndefinedFabricIndex;
+    Messaging::RoundTripTimeEstimator mRoundTripTimeEstimator;
 };
 
 //
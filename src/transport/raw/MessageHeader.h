@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <string.h>
@@ -44,6 +45,11 @@ static constexpr size_t kMaxTagLen = 16;
 
 static constexpr size_t kMaxAppMessageLen = 1200;
 
+// Largest application payload of a message over a session that allows large payloads (see Session::AllowsLargePayload), leaving
+// room in a large packet buffer for the message headers and the MIC.
+static constexpr size_t kMaxLargeAppMessageLen = std::max<size_t>(
+    kMaxAppMessageLen, System::PacketBuffer::kLargeBufMaxSizeWithoutReserve - System::PacketBuffer::kDefaultHeaderReserve - kMaxTagLen);
+
 static constexpr uint16_t kMsgUnicastSessionIdUnsecured = 0x0000;
 
 typedef int PacketHeaderFlags;
@@ -43,7 +43,8 @@ using namespace chip::Encoding;
 constexpr size_t kPacketSizeBytes = 2;
 
 // TODO: Actual limit may be lower (spec issue #2119)
-constexpr uint16_t kMaxMessageSize = static_cast<uint16_t>(System::PacketBuffer::kMaxSizeWithoutReserve - kPacketSizeBytes);
+constexpr uint16_t kMaxMessageSize =
+    static_cast<uint16_t>(System::PacketBuffer::kLargeBufMaxSizeWithoutReserve - kPacketSizeBytes);
 
 constexpr int kListenBacklogSize = 2;
 
@@ -58,19 +59,34 @@ TCPBase::~TCPBase()
         mListenSocket = nullptr;
     }
 
-    CloseActiveConnections();
+    // The connections are closed by the derived class, which owns the connection table.
 }
 
 void TCPBase::CloseActiveConnections()
 {
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
+    mActiveConnections.ForEachActiveObject([&](ActiveConnectionState * connection) {
+        ReleaseActiveConnection(connection);
+        return Loop::Continue;
+    });
+}
+
+CHIP_ERROR TCPBase::AddActiveConnection(Inet::TCPEndPoint * endPoint, const PeerAddress & peerAddress)
+{
+    ActiveConnectionState * connection = mActiveConnections.CreateObject(endPoint, peerAddress);
+    if (connection == nullptr)
     {
-        if (mActiveConnections[i].InUse())
-        {
-            mActiveConnections[i].Free();
-            mUsedEndPointCount--;
-        }
+        endPoint->Free();
+        return CHIP_ERROR_NO_MEMORY;
     }
+
+    return CHIP_NO_ERROR;
+}
+
+void TCPBase::ReleaseActiveConnection(ActiveConnectionState * connection)
+{
+    connection->mEndPoint->Free();
+    mActiveConnections.ReleaseObject(connection);
+    mUsedEndPointCount--;
 }
 
 CHIP_ERROR TCPBase::Init(TcpListenParameters & params)
@@ -134,35 +150,31 @@ TCPBase::ActiveConnectionState * TCPBase::FindActiveConnection(const PeerAddress
         return nullptr;
     }
 
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
-    {
-        if (!mActiveConnections[i].InUse())
-        {
-            continue;
-        }
-        Inet::IPAddress addr;
-        uint16_t port;
-        mActiveConnections[i].mEndPoint->GetPeerInfo(&addr, &port);
-
-        if ((addr == address.GetIPAddress()) && (port == address.GetPort()))
+    ActiveConnectionState * found = nullptr;
+    mActiveConnections.ForEachActiveObject([&](ActiveConnectionState * connection) {
+        if ((connection->mPeerAddress.GetIPAddress() == address.GetIPAddress()) &&
+            (connection->mPeerAddress.GetPort() == address.GetPort()))
         {
-            return &mActiveConnections[i];
+            found = connection;
+            return Loop::Break;
         }
-    }
-
-    return nullptr;
+        return Loop::Continue;
+    });
+    return found;
 }
 
 TCPBase::ActiveConnectionState * TCPBase::FindActiveConnection(const Inet::TCPEndPoint * endPoint)
 {
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
-    {
-        if (mActiveConnections[i].mEndPoint == endPoint)
+    ActiveConnectionState * found = nullptr;
+    mActiveConnections.ForEachActiveObject([&](ActiveConnectionState * connection) {
+        if (connection->mEndPoint == endPoint)
         {
-            return &mActiveConnections[i];
+            found = connection;
+            return Loop::Break;
         }
-    }
-    return nullptr;
+        return Loop::Continue;
+    });
+    return found;
 }
 
 CHIP_ERROR TCPBase::SendMessage(const Transport::PeerAddress & address, System::PacketBufferHandle && msgBuf)
@@ -222,7 +234,7 @@ CHIP_ERROR TCPBase::SendAfterConnect(const PeerAddress & addr, System::PacketBuf
     }
 
     // Ensures sufficient active connections size exist
-    VerifyOrReturnError(mUsedEndPointCount < mActiveConnectionsSize, CHIP_ERROR_NO_MEMORY);
+    VerifyOrReturnError(mUsedEndPointCount < mMaxActiveConnections, CHIP_ERROR_NO_MEMORY);
 
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
     Inet::TCPEndPoint * endPoint = nullptr;
@@ -259,7 +271,7 @@ CHIP_ERROR TCPBase::ProcessReceivedBuffer(Inet::TCPEndPoint * endPoint, const Pe
     VerifyOrReturnError(state != nullptr, CHIP_ERROR_INTERNAL);
     state->mReceived.AddToEnd(std::move(buffer));
 
-    while (!state->mReceived.IsNull())
+    while (state != nullptr && !state->mReceived.IsNull())
     {
         uint8_t messageSizeBuf[kPacketSizeBytes];
         CHIP_ERROR err = state->mReceived->Read(messageSizeBuf);
@@ -286,6 +298,9 @@ CHIP_ERROR TCPBase::ProcessReceivedBuffer(Inet::TCPEndPoint * endPoint, const Pe
         }
         state->mReceived.Consume(kPacketSizeBytes);
         ReturnErrorOnFailure(ProcessSingleMessage(peerAddress, state, messageSize));
+
+        // Handling the message may have closed the connection.
+        state = FindActiveConnection(endPoint);
     }
 
     return CHIP_NO_ERROR;
@@ -310,7 +325,7 @@ CHIP_ERROR TCPBase::ProcessSingleMessage(const PeerAddress & peerAddress, Active
         // In either case, copy the message to a fresh linear buffer to pass upstream. We always copy, rather than provide
         // a shared reference to the current buffer, in case upper layers manipulate the buffer in ways that would affect
         // our use, e.g. chaining it elsewhere or reusing space beyond the current message.
-        message = System::PacketBufferHandle::New(messageSize, 0);
+        message = System::PacketBufferHandle::NewLarge(messageSize, 0);
         if (message.IsNull())
         {
             return CHIP_ERROR_NO_MEMORY;
@@ -327,16 +342,16 @@ CHIP_ERROR TCPBase::ProcessSingleMessage(const PeerAddress & peerAddress, Active
 
 CHIP_ERROR TCPBase::OnTcpReceive(Inet::TCPEndPoint * endPoint, System::PacketBufferHandle && buffer)
 {
-    Inet::IPAddress ipAddress;
-    uint16_t port;
-    Inet::InterfaceId interfaceId;
-
-    endPoint->GetPeerInfo(&ipAddress, &port);
-    endPoint->GetInterfaceId(&interfaceId);
-    PeerAddress peerAddress = PeerAddress::TCP(ipAddress, port, interfaceId);
+    TCPBase * tcp                      = reinterpret_cast<TCPBase *>(endPoint->mAppState);
+    ActiveConnectionState * connection = tcp->FindActiveConnection(endPoint);
+    CHIP_ERROR err                     = CHIP_ERROR_INTERNAL;
 
-    TCPBase * tcp  = reinterpret_cast<TCPBase *>(endPoint->mAppState);
-    CHIP_ERROR err = tcp->ProcessReceivedBuffer(endPoint, peerAddress, std::move(buffer));
+    if (connection != nullptr)
+    {
+        // Copied, since handling a message may close the connection.
+        PeerAddress peerAddress = connection->mPeerAddress;
+        err                     = tcp->ProcessReceivedBuffer(endPoint, peerAddress, std::move(buffer));
+    }
 
     if (err != CHIP_NO_ERROR)
     {
@@ -396,27 +411,22 @@ void TCPBase::OnConnectionComplete(Inet::TCPEndPoint * endPoint, CHIP_ERROR inet
         endPoint->Free();
         tcp->mUsedEndPointCount--;
     }
-    else
+    else if (tcp->AddActiveConnection(endPoint, addr) != CHIP_NO_ERROR)
     {
-        bool connectionStored = false;
-        for (size_t i = 0; i < tcp->mActiveConnectionsSize; i++)
-        {
-            if (!tcp->mActiveConnections[i].InUse())
-            {
-                tcp->mActiveConnections[i].Init(endPoint);
-                connectionStored = true;
-                break;
-            }
-        }
-
         // since we track end points counts, we always expect to store the
         // connection.
-        if (!connectionStored)
-        {
-            endPoint->Free();
-            ChipLogError(Inet, "Internal logic error: insufficient space to store active connection");
-        }
+        ChipLogError(Inet, "Internal logic error: insufficient space to store active connection");
+        tcp->mUsedEndPointCount--;
+    }
+#if INET_TCP_IDLE_CHECK_INTERVAL > 0 && CHIP_CONFIG_TCP_CONNECTION_IDLE_TIMEOUT_MS > 0
+    else
+    {
+        // Keep the connection for the next messages to the peer, but not forever. Only connections initiated by this node
+        // are closed when idle: the peer of an accepted connection cannot be reconnected to, since its address is that of
+        // an ephemeral port, so the peer decides when that connection is no longer needed.
+        endPoint->SetIdleTimeout(CHIP_CONFIG_TCP_CONNECTION_IDLE_TIMEOUT_MS);
     }
+#endif
 }
 
 void TCPBase::OnConnectionClosed(Inet::TCPEndPoint * endPoint, CHIP_ERROR err)
@@ -425,14 +435,11 @@ void TCPBase::OnConnectionClosed(Inet::TCPEndPoint * endPoint, CHIP_ERROR err)
 
     ChipLogProgress(Inet, "Connection closed.");
 
-    for (size_t i = 0; i < tcp->mActiveConnectionsSize; i++)
+    ActiveConnectionState * connection = tcp->FindActiveConnection(endPoint);
+    if (connection != nullptr)
     {
-        if (tcp->mActiveConnections[i].mEndPoint == endPoint)
-        {
-            ChipLogProgress(Inet, "Freeing closed connection.");
-            tcp->mActiveConnections[i].Free();
-            tcp->mUsedEndPointCount--;
-        }
+        ChipLogProgress(Inet, "Freeing closed connection.");
+        tcp->ReleaseActiveConnection(connection);
     }
 }
 
@@ -441,31 +448,30 @@ void TCPBase::OnConnectionReceived(Inet::TCPEndPoint * listenEndPoint, Inet::TCP
 {
     TCPBase * tcp = reinterpret_cast<TCPBase *>(listenEndPoint->mAppState);
 
-    if (tcp->mUsedEndPointCount < tcp->mActiveConnectionsSize)
+    // have space to use one more (even if considering pending connections)
+    if (tcp->mUsedEndPointCount >= tcp->mMaxActiveConnections)
     {
-        // have space to use one more (even if considering pending connections)
-        for (size_t i = 0; i < tcp->mActiveConnectionsSize; i++)
-        {
-            if (!tcp->mActiveConnections[i].InUse())
-            {
-                tcp->mActiveConnections[i].Init(endPoint);
-                break;
-            }
-        }
-
-        endPoint->mAppState            = listenEndPoint->mAppState;
-        endPoint->OnDataReceived       = OnTcpReceive;
-        endPoint->OnConnectComplete    = OnConnectionComplete;
-        endPoint->OnConnectionClosed   = OnConnectionClosed;
-        endPoint->OnConnectionReceived = OnConnectionReceived;
-        endPoint->OnAcceptError        = OnAcceptError;
-        endPoint->OnPeerClose          = OnPeerClosed;
+        ChipLogError(Inet, "Insufficient connection space to accept new connections");
+        endPoint->Free();
+        return;
     }
-    else
+
+    Inet::InterfaceId interfaceId;
+    endPoint->GetInterfaceId(&interfaceId);
+    if (tcp->AddActiveConnection(endPoint, PeerAddress::TCP(peerAddress, peerPort, interfaceId)) != CHIP_NO_ERROR)
     {
         ChipLogError(Inet, "Insufficient connection space to accept new connections");
-        endPoint->Free();
+        return;
     }
+    tcp->mUsedEndPointCount++;
+
+    endPoint->mAppState            = listenEndPoint->mAppState;
+    endPoint->OnDataReceived       = OnTcpReceive;
+    endPoint->OnConnectComplete    = OnConnectionComplete;
+    endPoint->OnConnectionClosed   = OnConnectionClosed;
+    endPoint->OnConnectionReceived = OnConnectionReceived;
+    endPoint->OnAcceptError        = OnAcceptError;
+    endPoint->OnPeerClose          = OnPeerClosed;
 }
 
 void TCPBase::OnAcceptError(Inet::TCPEndPoint * endPoint, CHIP_ERROR err)
@@ -476,54 +482,33 @@ void TCPBase::OnAcceptError(Inet::TCPEndPoint * endPoint, CHIP_ERROR err)
 void TCPBase::Disconnect(const PeerAddress & address)
 {
     // Closes an existing connection
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
-    {
-        if (mActiveConnections[i].InUse())
+    mActiveConnections.ForEachActiveObject([&](ActiveConnectionState * connection) {
+        if (address == connection->mPeerAddress)
         {
-            Inet::IPAddress ipAddress;
-            uint16_t port;
-            Inet::InterfaceId interfaceId;
-
-            mActiveConnections[i].mEndPoint->GetPeerInfo(&ipAddress, &port);
-            mActiveConnections[i].mEndPoint->GetInterfaceId(&interfaceId);
-            if (address == PeerAddress::TCP(ipAddress, port, interfaceId))
-            {
-                // NOTE: this leaves the socket in TIME_WAIT.
-                // Calling Abort() would clean it since SO_LINGER would be set to 0,
-                // however this seems not to be useful.
-                mActiveConnections[i].Free();
-                mUsedEndPointCount--;
-            }
+            // NOTE: this leaves the socket in TIME_WAIT.
+            // Calling Abort() would clean it since SO_LINGER would be set to 0,
+            // however this seems not to be useful.
+            ReleaseActiveConnection(connection);
         }
-    }
+        return Loop::Continue;
+    });
 }
 
 void TCPBase::OnPeerClosed(Inet::TCPEndPoint * endPoint)
 {
     TCPBase * tcp = reinterpret_cast<TCPBase *>(endPoint->mAppState);
 
-    for (size_t i = 0; i < tcp->mActiveConnectionsSize; i++)
+    ActiveConnectionState * connection = tcp->FindActiveConnection(endPoint);
+    if (connection != nullptr)
     {
-        if (tcp->mActiveConnections[i].mEndPoint == endPoint)
-        {
-            ChipLogProgress(Inet, "Freeing connection: connection closed by peer");
-            tcp->mActiveConnections[i].Free();
-            tcp->mUsedEndPointCount--;
-        }
+        ChipLogProgress(Inet, "Freeing connection: connection closed by peer");
+        tcp->ReleaseActiveConnection(connection);
     }
 }
 
 bool TCPBase::HasActiveConnections() const
 {
-    for (size_t i = 0; i < mActiveConnectionsSize; i++)
-    {
-        if (mActiveConnections[i].InUse())
-        {
-            return true;
-        }
-    }
-
-    return false;
+    return mActiveConnections.ForEachActiveObject([](const ActiveConnectionState *) { return Loop::Break; }) == Loop::Break;
 }
 
 } // namespace Transport
@@ -111,34 +111,26 @@ protected:
      */
     struct ActiveConnectionState
     {
-        void Init(Inet::TCPEndPoint * endPoint)
-        {
-            mEndPoint = endPoint;
-            mReceived = nullptr;
-        }
-
-        void Free()
-        {
-            mEndPoint->Free();
-            mEndPoint = nullptr;
-            mReceived = nullptr;
-        }
-        bool InUse() const { return mEndPoint != nullptr; }
+        ActiveConnectionState(Inet::TCPEndPoint * endPoint, const PeerAddress & peerAddress) :
+            mEndPoint(endPoint), mPeerAddress(peerAddress)
+        {}
 
         // Associated endpoint.
         Inet::TCPEndPoint * mEndPoint;
 
+        // Address of the peer, kept so that finding the connection to a peer does not query every socket.
+        PeerAddress mPeerAddress;
+
         // Buffers received but not yet consumed.
         System::PacketBufferHandle mReceived;
     };
 
 public:
-    using PendingPacketPoolType = PoolInterface<PendingPacket, const PeerAddress &, System::PacketBufferHandle &&>;
-    TCPBase(ActiveConnectionState * activeConnectionsBuffer, size_t bufferSize, PendingPacketPoolType & packetBuffers) :
-        mActiveConnections(activeConnectionsBuffer), mActiveConnectionsSize(bufferSize), mPendingPackets(packetBuffers)
-    {
-        // activeConnectionsBuffer must be initialized by the caller.
-    }
+    using ActiveConnectionPoolType = PoolInterface<ActiveConnectionState, Inet::TCPEndPoint *, const PeerAddress &>;
+    using PendingPacketPoolType    = PoolInterface<PendingPacket, const PeerAddress &, System::PacketBufferHandle &&>;
+    TCPBase(ActiveConnectionPoolType & activeConnections, size_t maxActiveConnections, PendingPacketPoolType & packetBuffers) :
+        mActiveConnections(activeConnections), mMaxActiveConnections(maxActiveConnections), mPendingPackets(packetBuffers)
+    {}
     ~TCPBase() override;
 
     /**
@@ -190,6 +182,16 @@ private:
     ActiveConnectionState * FindActiveConnection(const PeerAddress & addr);
     ActiveConnectionState * FindActiveConnection(const Inet::TCPEndPoint * endPoint);
 
+    /**
+     * Track a connected endpoint, or free it if the connection table is full.
+     */
+    CHIP_ERROR AddActiveConnection(Inet::TCPEndPoint * endPoint, const PeerAddress & peerAddress);
+
+    /**
+     * Free the endpoint of a connection and stop tracking it.
+     */
+    void ReleaseActiveConnection(ActiveConnectionState * connection);
+
     /**
      * Sends the specified message once a connection has been established.
      *
@@ -258,8 +260,8 @@ private:
     size_t mUsedEndPointCount = 0;
 
     // Currently active connections
-    ActiveConnectionState * mActiveConnections;
-    const size_t mActiveConnectionsSize;
+    ActiveConnectionPoolType & mActiveConnections;
+    const size_t mMaxActiveConnections;
 
     // Data to be sent when connections succeed
     PendingPacketPoolType & mPendingPackets;
@@ -269,18 +271,25 @@ template <size_t kActiveConnectionsSize, size_t kPendingPacketSize>
 class TCP : public TCPBase
 {
 public:
-    TCP() : TCPBase(mConnectionsBuffer, kActiveConnectionsSize, mPendingPackets)
+    TCP() : TCPBase(mConnections, kMaxActiveConnections, mPendingPackets) {}
+    ~TCP() override
     {
-        for (size_t i = 0; i < kActiveConnectionsSize; ++i)
-        {
-            mConnectionsBuffer[i].Init(nullptr);
-        }
+        CloseActiveConnections();
+        mPendingPackets.ReleaseAll();
     }
-    ~TCP() override { mPendingPackets.ReleaseAll(); }
 
 private:
     friend class TCPTest;
-    TCPBase::ActiveConnectionState mConnectionsBuffer[kActiveConnectionsSize];
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    // The connection table is allocated from the heap and grows with the number of connections.
+    static constexpr size_t kMaxActiveConnections = SIZE_MAX;
+#else
+    static constexpr size_t kMaxActiveConnections = kActiveConnectionsSize;
+#endif
+
+    PoolImpl<ActiveConnectionState, kActiveConnectionsSize, ObjectPoolMem::kDefault, ActiveConnectionPoolType::Interface>
+        mConnections;
     PoolImpl<PendingPacket, kPendingPacketSize, ObjectPoolMem::kInline, PendingPacketPoolType::Interface> mPendingPackets;
 };
 
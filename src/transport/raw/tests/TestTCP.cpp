@@ -30,14 +30,18 @@
 #include <lib/support/UnitTestContext.h>
 #include <lib/support/UnitTestRegistration.h>
 #include <lib/support/UnitTestUtils.h>
+#include <system/SystemClock.h>
 #include <system/SystemLayer.h>
 #include <transport/TransportMgr.h>
 #include <transport/raw/TCP.h>
+#include <transport/raw/UDP.h>
 
 #include <nlbyteorder.h>
 #include <nlunit-test.h>
 
+#include <algorithm>
 #include <errno.h>
+#include <inttypes.h>
 #include <stdlib.h>
 #include <string.h>
 #include <utility>
@@ -74,6 +78,43 @@ using TestContext = chip::Test::IOContext;
 
 const char PAYLOAD[] = "Hello!";
 
+// Builds a message carrying payloadLength bytes of a recognizable pattern, in a single packet buffer.
+System::PacketBufferHandle BuildLargeMessage(size_t payloadLength)
+{
+    System::PacketBufferHandle buffer = System::PacketBufferHandle::NewLarge(payloadLength);
+    VerifyOrReturnValue(!buffer.IsNull(), buffer);
+
+    for (size_t i = 0; i < payloadLength; ++i)
+    {
+        buffer->Start()[i] = static_cast<uint8_t>(i);
+    }
+    buffer->SetDataLength(static_cast<uint16_t>(payloadLength));
+
+    PacketHeader header;
+    header.SetSourceNodeId(kSourceNodeId).SetDestinationNodeId(kDestinationNodeId).SetMessageCounter(kMessageCounter);
+    if (header.EncodeBeforeData(buffer) != CHIP_NO_ERROR)
+    {
+        return System::PacketBufferHandle();
+    }
+    return buffer;
+}
+
+int LargeMessageCallbackCheck(const uint8_t * message, size_t length, int count, void * data)
+{
+    if (length != *static_cast<size_t *>(data))
+    {
+        return -1;
+    }
+    for (size_t i = 0; i < length; ++i)
+    {
+        if (message[i] != static_cast<uint8_t>(i))
+        {
+            return -2;
+        }
+    }
+    return 0;
+}
+
 class MockTransportMgrDelegate : public chip::TransportMgrDelegate
 {
 public:
@@ -161,6 +202,24 @@ public:
         SetCallback(nullptr);
     }
 
+    void LargeMessageTest(TCPImpl & tcp, const IPAddress & addr, size_t payloadLength)
+    {
+        chip::System::PacketBufferHandle buffer = BuildLargeMessage(payloadLength);
+        NL_TEST_ASSERT(mSuite, !buffer.IsNull());
+
+        SetCallback(LargeMessageCallbackCheck, &payloadLength);
+        mReceiveHandlerCallCount = 0;
+
+        // The message is sent in a single TCP message, whatever the size of a packet on the network.
+        CHIP_ERROR err = tcp.SendMessage(Transport::PeerAddress::TCP(addr), std::move(buffer));
+        NL_TEST_ASSERT(mSuite, err == CHIP_NO_ERROR);
+
+        mContext.DriveIOUntil(chip::System::Clock::Seconds16(5), [this]() { return mReceiveHandlerCallCount != 0; });
+        NL_TEST_ASSERT(mSuite, mReceiveHandlerCallCount == 1);
+
+        SetCallback(nullptr);
+    }
+
     void FinalizeMessageTest(TCPImpl & tcp, const IPAddress & addr)
     {
         // Disconnect and wait for seeing peer close
@@ -232,6 +291,111 @@ void CheckMessageTest6(nlTestSuite * inSuite, void * inContext)
     CheckMessageTest(inSuite, inContext, addr);
 }
 
+/////////////////////////// Large message test
+
+void CheckLargeMessageTest(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+    TCPImpl tcp;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+
+    MockTransportMgrDelegate gMockTransportMgrDelegate(inSuite, ctx);
+    gMockTransportMgrDelegate.InitializeMessageTest(tcp, addr);
+
+    // Larger than a packet buffer, sent on a new connection and then on the same connection.
+    gMockTransportMgrDelegate.LargeMessageTest(tcp, addr, 20000);
+    gMockTransportMgrDelegate.LargeMessageTest(tcp, addr, kMaxLargeAppMessageLen - PacketHeader().EncodeSizeBytes());
+    NL_TEST_ASSERT(inSuite, tcp.HasActiveConnections());
+
+    gMockTransportMgrDelegate.FinalizeMessageTest(tcp, addr);
+}
+
+/////////////////////////// Benchmark
+
+class CountingTransportMgrDelegate : public chip::TransportMgrDelegate
+{
+public:
+    void OnMessageReceived(const Transport::PeerAddress & source, System::PacketBufferHandle && msgBuf) override
+    {
+        mReceivedCount++;
+        mReceivedLength += msgBuf->TotalLength();
+    }
+
+    size_t mReceivedCount  = 0;
+    size_t mReceivedLength = 0;
+};
+
+/**
+ * Compares the time it takes to transfer a report of a wildcard read to the local node: over UDP the report is chunked
+ * into messages that fit a network packet and every chunk is acknowledged by a status response before the next one is
+ * sent, over TCP it is a single message on an established connection.
+ */
+void CheckLargeReportBenchmark(nlTestSuite * inSuite, void * inContext)
+{
+    TestContext & ctx = *reinterpret_cast<TestContext *>(inContext);
+
+    constexpr size_t kReportLength = 48000;
+    constexpr size_t kChunkLength  = kMaxAppMessageLen - 64;
+    constexpr size_t kStatusLength = 16;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+
+    // UDP, one round trip per chunk.
+    Transport::UDP udp;
+    CHIP_ERROR err = udp.Init(Transport::UdpListenParameters(ctx.GetUDPEndPointManager()).SetAddressType(addr.Type()));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+
+    CountingTransportMgrDelegate udpDelegate;
+    TransportMgrBase udpTransportMgr;
+    udpTransportMgr.SetSessionManager(&udpDelegate);
+    udpTransportMgr.Init(&udp);
+
+    auto sendAndWait = [&](Transport::Base & transport, CountingTransportMgrDelegate & delegate,
+                           const Transport::PeerAddress & peer, size_t length) {
+        size_t expectedCount = delegate.mReceivedCount + 1;
+        NL_TEST_ASSERT(inSuite, transport.SendMessage(peer, BuildLargeMessage(length)) == CHIP_NO_ERROR);
+        ctx.DriveIOUntil(chip::System::Clock::Seconds16(5), [&]() { return delegate.mReceivedCount == expectedCount; });
+        NL_TEST_ASSERT(inSuite, delegate.mReceivedCount == expectedCount);
+    };
+
+    System::Clock::Timestamp start = System::SystemClock().GetMonotonicTimestamp();
+    for (size_t sent = 0; sent < kReportLength; sent += kChunkLength)
+    {
+        sendAndWait(udp, udpDelegate, Transport::PeerAddress::UDP(addr, udp.GetBoundPort()),
+                    std::min(kChunkLength, kReportLength - sent));
+        sendAndWait(udp, udpDelegate, Transport::PeerAddress::UDP(addr, udp.GetBoundPort()), kStatusLength);
+    }
+    System::Clock::Timestamp udpDuration = System::SystemClock().GetMonotonicTimestamp() - start;
+    udp.Close();
+
+    // TCP, the whole report in one message. The connection is established beforehand, as it is reused across reads.
+    TCPImpl tcp;
+    CountingTransportMgrDelegate tcpDelegate;
+    MockTransportMgrDelegate gMockTransportMgrDelegate(inSuite, ctx);
+    gMockTransportMgrDelegate.InitializeMessageTest(tcp, addr);
+    gMockTransportMgrDelegate.SingleMessageTest(tcp, addr);
+
+    TransportMgrBase tcpTransportMgr;
+    tcpTransportMgr.SetSessionManager(&tcpDelegate);
+    tcpTransportMgr.Init(&tcp);
+
+    start = System::SystemClock().GetMonotonicTimestamp();
+    sendAndWait(tcp, tcpDelegate, Transport::PeerAddress::TCP(addr), kReportLength);
+    sendAndWait(tcp, tcpDelegate, Transport::PeerAddress::TCP(addr), kStatusLength);
+    System::Clock::Timestamp tcpDuration = System::SystemClock().GetMonotonicTimestamp() - start;
+
+    ChipLogProgress(NotSpecified, "%u byte report: %u messages in %" PRIu32 " ms over UDP, %u messages in %" PRIu32 " ms over TCP",
+                    static_cast<unsigned>(kReportLength), static_cast<unsigned>(udpDelegate.mReceivedCount),
+                    static_cast<uint32_t>(udpDuration.count()),
+                    static_cast<unsigned>(tcpDelegate.mReceivedCount),
+                    static_cast<uint32_t>(tcpDuration.count()));
+
+    gMockTransportMgrDelegate.FinalizeMessageTest(tcp, addr);
+}
+
 // Generates a packet buffer or a chain of packet buffers for a single message.
 struct TestData
 {
@@ -440,13 +604,23 @@ void chip::Transport::TCPTest::CheckProcessReceivedBuffer(nlTestSuite * inSuite,
     NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
     NL_TEST_ASSERT(inSuite, gMockTransportMgrDelegate.mReceiveHandlerCallCount == 2);
 
+    // Test a message that is larger than a packet buffer but fits a large packet buffer.
+    gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
+    NL_TEST_ASSERT(inSuite, testData[0].Init((const uint16_t[]){ 51, System::PacketBuffer::kMaxSizeWithoutReserve, 0 }));
+    err = tcp.ProcessReceivedBuffer(lEndPoint, lPeerAddress, std::move(testData[0].mHandle));
+    NL_TEST_ASSERT(inSuite, err == CHIP_NO_ERROR);
+    NL_TEST_ASSERT(inSuite, gMockTransportMgrDelegate.mReceiveHandlerCallCount == 1);
+
     // Test a message that is too large to coalesce into a single packet buffer.
     gMockTransportMgrDelegate.mReceiveHandlerCallCount = 0;
     gMockTransportMgrDelegate.SetCallback(TestDataCallbackCheck, &testData[1]);
-    NL_TEST_ASSERT(inSuite, testData[0].Init((const uint16_t[]){ 51, System::PacketBuffer::kMaxSizeWithoutReserve, 0 }));
-    // Sending only the first buffer of the long chain. This should be enough to trigger the error.
-    System::PacketBufferHandle head = testData[0].mHandle.PopHead();
-    err                             = tcp.ProcessReceivedBuffer(lEndPoint, lPeerAddress, std::move(head));
+    // Sending only the start of the message. Its length field should be enough to trigger the error.
+    System::PacketBufferHandle head = System::PacketBufferHandle::New(51, 0 /* reserve */);
+    NL_TEST_ASSERT(inSuite, !head.IsNull());
+    memset(head->Start(), 0, 51);
+    chip::Encoding::LittleEndian::Put16(head->Start(), System::PacketBuffer::kLargeBufMaxSizeWithoutReserve);
+    head->SetDataLength(51);
+    err = tcp.ProcessReceivedBuffer(lEndPoint, lPeerAddress, std::move(head));
     NL_TEST_ASSERT(inSuite, err == CHIP_ERROR_MESSAGE_TOO_LONG);
     NL_TEST_ASSERT(inSuite, gMockTransportMgrDelegate.mReceiveHandlerCallCount == 0);
 
@@ -468,6 +642,8 @@ static const nlTest sTests[] =
     NL_TEST_DEF("Simple Init Test IPV6",        CheckSimpleInitTest6),
     NL_TEST_DEF("Message Self Test IPV6",       CheckMessageTest6),
     NL_TEST_DEF("ProcessReceivedBuffer Test",   chip::Transport::TCPTest::CheckProcessReceivedBuffer),
+    NL_TEST_DEF("Large Message Test",           CheckLargeMessageTest),
+    NL_TEST_DEF("Large Report Benchmark",       CheckLargeReportBenchmark),
 
     NL_TEST_SENTINEL()
 };